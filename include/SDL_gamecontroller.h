@@ -157,6 +157,10 @@ extern DECLSPEC SDL_bool SDLCALL SDL_IsGameController(int joystick_index);
  *  Get the implementation dependent name of a game controller.
  *  This can be called before any controllers are opened.
  *  If no name can be found, this function returns NULL.
+ *
+ *  The string is only valid until the mapping for the controller is next
+ *  changed.  If another thread may add mappings, copy the name instead of
+ *  keeping the pointer.
  */
 extern DECLSPEC const char *SDLCALL SDL_GameControllerNameForIndex(int joystick_index);
 
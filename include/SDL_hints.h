@@ -571,6 +571,63 @@ extern "C" {
  */
 #define SDL_HINT_NO_SIGNAL_HANDLERS   "SDL_NO_SIGNAL_HANDLERS"
 
+/**
+ *  \brief  A variable controlling how many threads large software blits may use.
+ *
+ *  Blits covering many pixels are split into bands of rows that run in
+ *  parallel on a pool of worker threads.  Small blits always run on the
+ *  calling thread.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Use one thread per CPU core
+ *    "1"       - Blit on the calling thread only (default)
+ *    "N"       - Use up to N threads, the calling thread included
+ */
+#define SDL_HINT_BLIT_THREADS   "SDL_BLIT_THREADS"
+
+/**
+ *  \brief  A variable overriding the CPU features the software blitters use.
+ *
+ *  This is for testing, it selects between the plain C and the vectorized
+ *  blit and fill code.  The value is a decimal mask of the blitter CPU
+ *  flags, for example "0" for plain C only.  An empty value detects the
+ *  features of the CPU, which is the default.
+ */
+#define SDL_HINT_BLIT_CPU_FEATURES   "SDL_BLIT_CPU_FEATURES"
+
+/**
+ *  \brief  A variable controlling whether the 2D render API batches its drawing.
+ *
+ *  When batching, drawing calls are recorded and handed to the renderer
+ *  in one go at SDL_RenderPresent(), when the render target changes, when
+ *  pixels are read back, or when SDL_RenderFlush() is called.  Programs that
+ *  mix the render API with direct calls into the underlying graphics API must
+ *  call SDL_RenderFlush() before doing so.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Draw immediately on every call
+ *    "1"       - Batch drawing calls
+ *
+ *  By default drawing is batched for renderers picked by SDL, and not when
+ *  a renderer was requested by name or index, or for SDL_CreateSoftwareRenderer().
+ */
+#define SDL_HINT_RENDER_BATCHING   "SDL_RENDER_BATCHING"
+
+/**
+ *  \brief  A variable controlling how many threads the software renderer draws with.
+ *
+ *  With more than one thread, the drawing handed to the software renderer
+ *  at once is sorted into 64x64 tiles of the target, and the tiles are drawn
+ *  in parallel on a pool of worker threads.  This pays off with batching,
+ *  when a whole frame is drawn at SDL_RenderPresent().
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Use one thread per CPU core
+ *    "1"       - Draw on the calling thread only (default)
+ *    "N"       - Use up to N threads, the calling thread included
+ */
+#define SDL_HINT_RENDER_SOFTWARE_THREADS   "SDL_RENDER_SOFTWARE_THREADS"
+
 /**
  *  \brief  An enumeration of hint priorities
  */
@@ -607,6 +664,10 @@ extern DECLSPEC SDL_bool SDLCALL SDL_SetHint(const char *name,
  *  \brief Get a hint
  *
  *  \return The string value of a hint variable.
+ *
+ *  \note The string belongs to SDL and is only valid until the hint is next
+ *        set.  If another thread may set the hint, copy the value instead
+ *        of keeping the pointer.
  */
 extern DECLSPEC const char * SDLCALL SDL_GetHint(const char *name);
 
@@ -30,6 +30,7 @@
 
 #include "SDL_stdinc.h"
 #include "SDL_error.h"
+#include "SDL_atomic.h"
 
 #include "begin_code.h"
 /* Set up for C function definitions, even when using C++ */
@@ -63,6 +64,16 @@ typedef struct SDL_mutex SDL_mutex;
  */
 extern DECLSPEC SDL_mutex *SDLCALL SDL_CreateMutex(void);
 
+/**
+ *  Create a mutex that may not be locked recursively, initialized unlocked.
+ *
+ *  This works with all the other mutex and condition variable functions,
+ *  but locking it again from the thread that already holds it deadlocks.
+ *  In return it can be cheaper than SDL_CreateMutex(); on Linux taking it
+ *  uncontended is a single atomic operation.
+ */
+extern DECLSPEC SDL_mutex *SDLCALL SDL_CreateNonRecursiveMutex(void);
+
 /**
  *  Lock the mutex.
  *
@@ -240,6 +251,131 @@ extern DECLSPEC int SDLCALL SDL_CondWaitTimeout(SDL_cond * cond,
 /* @} *//* Condition variable functions */
 
 
+/**
+ *  \name Reader-writer lock functions
+ */
+/* @{ */
+
+/* The SDL reader-writer lock structure, defined in SDL_sysrwlock.c */
+struct SDL_RWLock;
+typedef struct SDL_RWLock SDL_RWLock;
+
+/**
+ *  Create a reader-writer lock, initialized unlocked.
+ *
+ *  Any number of threads may hold the lock for reading at the same time,
+ *  while a thread holding it for writing excludes everybody else.  This
+ *  suits data that is read far more often than it is changed.
+ *
+ *  The lock is not recursive, and a reader may not upgrade to a writer.
+ */
+extern DECLSPEC SDL_RWLock *SDLCALL SDL_CreateRWLock(void);
+
+/**
+ *  Lock the reader-writer lock for reading, shared with other readers.
+ *
+ *  \return 0, or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_LockRWLockForReading(SDL_RWLock * rwlock);
+
+/**
+ *  Lock the reader-writer lock for writing, excluding all other threads.
+ *
+ *  \return 0, or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_LockRWLockForWriting(SDL_RWLock * rwlock);
+
+/**
+ *  Try to lock the reader-writer lock for reading.
+ *
+ *  \return 0, SDL_MUTEX_TIMEDOUT, or -1 on error
+ */
+extern DECLSPEC int SDLCALL SDL_TryLockRWLockForReading(SDL_RWLock * rwlock);
+
+/**
+ *  Try to lock the reader-writer lock for writing.
+ *
+ *  \return 0, SDL_MUTEX_TIMEDOUT, or -1 on error
+ */
+extern DECLSPEC int SDLCALL SDL_TryLockRWLockForWriting(SDL_RWLock * rwlock);
+
+/**
+ *  Unlock the reader-writer lock, whichever way it was locked.
+ *
+ *  \return 0, or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_UnlockRWLock(SDL_RWLock * rwlock);
+
+/**
+ *  Destroy a reader-writer lock.
+ */
+extern DECLSPEC void SDLCALL SDL_DestroyRWLock(SDL_RWLock * rwlock);
+
+/* @} *//* Reader-writer lock functions */
+
+
+/**
+ *  \name Sequence lock functions
+ *
+ *  A sequence lock protects a small block of plain data (a few integers,
+ *  a rectangle, a timestamp) that is read much more often than written.
+ *  Readers never block the writer and never write to shared memory; they
+ *  copy the data out and retry if a write happened in the meantime:
+ *
+ *  \code
+ *  static SDL_SeqLock lock;
+ *  static SDL_Rect shared_rect;
+ *
+ *  SDL_Rect rect;
+ *  Uint32 seq;
+ *  do {
+ *      seq = SDL_SeqLockReadBegin(&lock);
+ *      rect = shared_rect;
+ *  } while (SDL_SeqLockReadRetry(&lock, seq));
+ *  \endcode
+ *
+ *  Data protected this way must not contain pointers the reader follows,
+ *  since a reader may see a torn copy before it retries.
+ */
+/* @{ */
+
+/**
+ *  The sequence lock structure; a zero-initialized one is ready to use.
+ */
+typedef struct SDL_SeqLock
+{
+    SDL_atomic_t sequence;
+    SDL_SpinLock writer;
+} SDL_SeqLock;
+
+/**
+ *  Start reading the protected data.
+ *
+ *  \return The sequence number to pass to SDL_SeqLockReadRetry().
+ */
+extern DECLSPEC Uint32 SDLCALL SDL_SeqLockReadBegin(SDL_SeqLock * seqlock);
+
+/**
+ *  Finish reading the protected data.
+ *
+ *  \return SDL_TRUE if a writer changed the data while it was being read,
+ *          in which case the copy must be thrown away and read again.
+ */
+extern DECLSPEC SDL_bool SDLCALL SDL_SeqLockReadRetry(SDL_SeqLock * seqlock, Uint32 start);
+
+/**
+ *  Start changing the protected data, excluding other writers.
+ */
+extern DECLSPEC void SDLCALL SDL_SeqLockWriteBegin(SDL_SeqLock * seqlock);
+
+/**
+ *  Finish changing the protected data.
+ */
+extern DECLSPEC void SDLCALL SDL_SeqLockWriteEnd(SDL_SeqLock * seqlock);
+
+/* @} *//* Sequence lock functions */
+
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
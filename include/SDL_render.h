@@ -115,6 +115,16 @@ typedef enum
     SDL_FLIP_VERTICAL = 0x00000002     /**< flip vertically */
 } SDL_RendererFlip;
 
+/**
+ *  \brief A vertex of a triangle drawn with SDL_RenderGeometry()
+ */
+typedef struct SDL_Vertex
+{
+    SDL_FPoint position;    /**< Vertex position, in render coordinates */
+    SDL_Color color;        /**< Vertex color */
+    SDL_FPoint tex_coord;   /**< Normalized texture coordinates, if textured */
+} SDL_Vertex;
+
 /**
  *  \brief A structure representing rendering state
  */
@@ -127,6 +137,14 @@ typedef struct SDL_Renderer SDL_Renderer;
 struct SDL_Texture;
 typedef struct SDL_Texture SDL_Texture;
 
+/**
+ *  \brief A set of images packed together into a few large textures
+ *
+ *  \sa SDL_CreateTextureAtlas()
+ */
+struct SDL_TextureAtlas;
+typedef struct SDL_TextureAtlas SDL_TextureAtlas;
+
 
 /* Function prototypes */
 
@@ -257,6 +275,32 @@ extern DECLSPEC SDL_Texture * SDLCALL SDL_CreateTexture(SDL_Renderer * renderer,
  */
 extern DECLSPEC SDL_Texture * SDLCALL SDL_CreateTextureFromSurface(SDL_Renderer * renderer, SDL_Surface * surface);
 
+/**
+ *  \brief Create a texture that draws straight from the pixels of a surface,
+ *         without copying them.
+ *
+ *  The texture has SDL_TEXTUREACCESS_STREAMING access, and changes to the
+ *  pixels of the surface show up in the texture.  Call SDL_RenderFlush()
+ *  before changing pixels that drawing already batched up still reads.
+ *  The color and alpha modulation and blend mode start out as those of the
+ *  surface; a color key is ignored.
+ *
+ *  \param renderer The renderer.
+ *  \param surface  The surface whose pixels the texture uses.  It must be in
+ *                  one of the renderer's texture formats and not need locking.
+ *
+ *  \return The created texture, or NULL if the renderer can't use the pixels
+ *          of the surface directly, or on error.
+ *
+ *  \note The texture keeps a reference to the surface, so the surface may be
+ *        freed with SDL_FreeSurface() before the texture is destroyed.
+ *        Only the software renderer supports this.
+ *
+ *  \sa SDL_CreateTextureFromSurface()
+ *  \sa SDL_DestroyTexture()
+ */
+extern DECLSPEC SDL_Texture * SDLCALL SDL_CreateTextureWrappingSurface(SDL_Renderer * renderer, SDL_Surface * surface);
+
 /**
  *  \brief Query the attributes of a texture
  *
@@ -417,7 +461,7 @@ extern DECLSPEC int SDLCALL SDL_UpdateYUVTexture(SDL_Texture * texture,
  *                   appropriately offset by the locked area.
  *  \param pitch     This is filled in with the pitch of the locked pixels.
  *
- *  \return 0 on success, or -1 if the texture is not valid or was not created with ::SDL_TEXTUREACCESS_STREAMING.
+ *  \return 0 on success, or -1 if the texture is not valid, was not created with ::SDL_TEXTUREACCESS_STREAMING, or rect doesn't lie within it.
  *
  *  \sa SDL_UnlockTexture()
  */
@@ -425,13 +469,62 @@ extern DECLSPEC int SDLCALL SDL_LockTexture(SDL_Texture * texture,
                                             const SDL_Rect * rect,
                                             void **pixels, int *pitch);
 
+/**
+ *  \brief Lock several areas of the texture for write-only pixel access.
+ *
+ *  Only the pixels inside the areas are changed when the texture is
+ *  unlocked, the rest of the texture keeps its contents.
+ *
+ *  \param texture   The texture to lock for access, which was created with
+ *                   ::SDL_TEXTUREACCESS_STREAMING.
+ *  \param rects     An array of the rectangles that will be written.
+ *  \param numrects  The number of rectangles.
+ *  \param pixels    This is filled in with a pointer to the locked pixels,
+ *                   appropriately offset by the top left corner of the
+ *                   bounding box of the rectangles.
+ *  \param pitch     This is filled in with the pitch of the locked pixels.
+ *
+ *  \return 0 on success, or -1 if the texture is not valid, was not created with ::SDL_TEXTUREACCESS_STREAMING, or any of the rectangles doesn't lie within it.
+ *
+ *  \sa SDL_LockTexture()
+ *  \sa SDL_UnlockTexture()
+ */
+extern DECLSPEC int SDLCALL SDL_LockTextureRects(SDL_Texture * texture,
+                                                 const SDL_Rect * rects,
+                                                 int numrects,
+                                                 void **pixels, int *pitch);
+
 /**
  *  \brief Unlock a texture, uploading the changes to video memory, if needed.
  *
  *  \sa SDL_LockTexture()
+ *  \sa SDL_LockTextureRects()
  */
 extern DECLSPEC void SDLCALL SDL_UnlockTexture(SDL_Texture * texture);
 
+/**
+ *  \brief Set the number of pixel buffers of a streaming texture.
+ *
+ *  With more than one buffer, locking the texture hands out a buffer that
+ *  isn't being drawn, so the texture can be drawn with the pixels last
+ *  unlocked while the next ones are written, and drawing that is already
+ *  batched up doesn't need to be done first.
+ *
+ *  \param texture The texture to update, which was created with
+ *                 ::SDL_TEXTUREACCESS_STREAMING.
+ *  \param buffers 1 for a single buffer, 2 for double or 3 for triple
+ *                 buffering.
+ *
+ *  \return 0 on success, or -1 if the texture is not valid or the renderer
+ *          doesn't support that many buffers.
+ *
+ *  \note The texture must not be locked when this is called.
+ *
+ *  \sa SDL_LockTexture()
+ */
+extern DECLSPEC int SDLCALL SDL_SetTextureBuffers(SDL_Texture * texture,
+                                                  int buffers);
+
 /**
  * \brief Determines whether a window supports the use of render targets
  *
@@ -676,6 +769,18 @@ extern DECLSPEC int SDLCALL SDL_RenderClear(SDL_Renderer * renderer);
 extern DECLSPEC int SDLCALL SDL_RenderDrawPoint(SDL_Renderer * renderer,
                                                 int x, int y);
 
+/**
+ *  \brief Draw a point on the current rendering target at subpixel precision.
+ *
+ *  \param renderer The renderer which should draw a point.
+ *  \param x The x coordinate of the point.
+ *  \param y The y coordinate of the point.
+ *
+ *  \return 0 on success, or -1 on error
+ */
+extern DECLSPEC int SDLCALL SDL_RenderDrawPointF(SDL_Renderer * renderer,
+                                                 float x, float y);
+
 /**
  *  \brief Draw multiple points on the current rendering target.
  *
@@ -689,6 +794,19 @@ extern DECLSPEC int SDLCALL SDL_RenderDrawPoints(SDL_Renderer * renderer,
                                                  const SDL_Point * points,
                                                  int count);
 
+/**
+ *  \brief Draw multiple points on the current rendering target at subpixel precision.
+ *
+ *  \param renderer The renderer which should draw multiple points.
+ *  \param points The points to draw
+ *  \param count The number of points to draw
+ *
+ *  \return 0 on success, or -1 on error
+ */
+extern DECLSPEC int SDLCALL SDL_RenderDrawPointsF(SDL_Renderer * renderer,
+                                                  const SDL_FPoint * points,
+                                                  int count);
+
 /**
  *  \brief Draw a line on the current rendering target.
  *
@@ -703,6 +821,20 @@ extern DECLSPEC int SDLCALL SDL_RenderDrawPoints(SDL_Renderer * renderer,
 extern DECLSPEC int SDLCALL SDL_RenderDrawLine(SDL_Renderer * renderer,
                                                int x1, int y1, int x2, int y2);
 
+/**
+ *  \brief Draw a line on the current rendering target at subpixel precision.
+ *
+ *  \param renderer The renderer which should draw a line.
+ *  \param x1 The x coordinate of the start point.
+ *  \param y1 The y coordinate of the start point.
+ *  \param x2 The x coordinate of the end point.
+ *  \param y2 The y coordinate of the end point.
+ *
+ *  \return 0 on success, or -1 on error
+ */
+extern DECLSPEC int SDLCALL SDL_RenderDrawLineF(SDL_Renderer * renderer,
+                                                float x1, float y1, float x2, float y2);
+
 /**
  *  \brief Draw a series of connected lines on the current rendering target.
  *
@@ -716,6 +848,19 @@ extern DECLSPEC int SDLCALL SDL_RenderDrawLines(SDL_Renderer * renderer,
                                                 const SDL_Point * points,
                                                 int count);
 
+/**
+ *  \brief Draw a series of connected lines on the current rendering target at subpixel precision.
+ *
+ *  \param renderer The renderer which should draw multiple lines.
+ *  \param points The points along the lines
+ *  \param count The number of points, drawing count-1 lines
+ *
+ *  \return 0 on success, or -1 on error
+ */
+extern DECLSPEC int SDLCALL SDL_RenderDrawLinesF(SDL_Renderer * renderer,
+                                                 const SDL_FPoint * points,
+                                                 int count);
+
 /**
  *  \brief Draw a rectangle on the current rendering target.
  *
@@ -727,6 +872,17 @@ extern DECLSPEC int SDLCALL SDL_RenderDrawLines(SDL_Renderer * renderer,
 extern DECLSPEC int SDLCALL SDL_RenderDrawRect(SDL_Renderer * renderer,
                                                const SDL_Rect * rect);
 
+/**
+ *  \brief Draw a rectangle on the current rendering target at subpixel precision.
+ *
+ *  \param renderer The renderer which should draw a rectangle.
+ *  \param rect A pointer to the destination rectangle, or NULL to outline the entire rendering target.
+ *
+ *  \return 0 on success, or -1 on error
+ */
+extern DECLSPEC int SDLCALL SDL_RenderDrawRectF(SDL_Renderer * renderer,
+                                                const SDL_FRect * rect);
+
 /**
  *  \brief Draw some number of rectangles on the current rendering target.
  *
@@ -740,6 +896,19 @@ extern DECLSPEC int SDLCALL SDL_RenderDrawRects(SDL_Renderer * renderer,
                                                 const SDL_Rect * rects,
                                                 int count);
 
+/**
+ *  \brief Draw some number of rectangles on the current rendering target at subpixel precision.
+ *
+ *  \param renderer The renderer which should draw multiple rectangles.
+ *  \param rects A pointer to an array of destination rectangles.
+ *  \param count The number of rectangles.
+ *
+ *  \return 0 on success, or -1 on error
+ */
+extern DECLSPEC int SDLCALL SDL_RenderDrawRectsF(SDL_Renderer * renderer,
+                                                 const SDL_FRect * rects,
+                                                 int count);
+
 /**
  *  \brief Fill a rectangle on the current rendering target with the drawing color.
  *
@@ -752,6 +921,18 @@ extern DECLSPEC int SDLCALL SDL_RenderDrawRects(SDL_Renderer * renderer,
 extern DECLSPEC int SDLCALL SDL_RenderFillRect(SDL_Renderer * renderer,
                                                const SDL_Rect * rect);
 
+/**
+ *  \brief Fill a rectangle on the current rendering target with the drawing color at subpixel precision.
+ *
+ *  \param renderer The renderer which should fill a rectangle.
+ *  \param rect A pointer to the destination rectangle, or NULL for the entire
+ *              rendering target.
+ *
+ *  \return 0 on success, or -1 on error
+ */
+extern DECLSPEC int SDLCALL SDL_RenderFillRectF(SDL_Renderer * renderer,
+                                                const SDL_FRect * rect);
+
 /**
  *  \brief Fill some number of rectangles on the current rendering target with the drawing color.
  *
@@ -765,6 +946,19 @@ extern DECLSPEC int SDLCALL SDL_RenderFillRects(SDL_Renderer * renderer,
                                                 const SDL_Rect * rects,
                                                 int count);
 
+/**
+ *  \brief Fill some number of rectangles on the current rendering target with the drawing color at subpixel precision.
+ *
+ *  \param renderer The renderer which should fill multiple rectangles.
+ *  \param rects A pointer to an array of destination rectangles.
+ *  \param count The number of rectangles.
+ *
+ *  \return 0 on success, or -1 on error
+ */
+extern DECLSPEC int SDLCALL SDL_RenderFillRectsF(SDL_Renderer * renderer,
+                                                 const SDL_FRect * rects,
+                                                 int count);
+
 /**
  *  \brief Copy a portion of the texture to the current rendering target.
  *
@@ -782,6 +976,23 @@ extern DECLSPEC int SDLCALL SDL_RenderCopy(SDL_Renderer * renderer,
                                            const SDL_Rect * srcrect,
                                            const SDL_Rect * dstrect);
 
+/**
+ *  \brief Copy a portion of the texture to the current rendering target at subpixel precision.
+ *
+ *  \param renderer The renderer which should copy parts of a texture.
+ *  \param texture The source texture.
+ *  \param srcrect   A pointer to the source rectangle, or NULL for the entire
+ *                   texture.
+ *  \param dstrect   A pointer to the destination rectangle, or NULL for the
+ *                   entire rendering target.
+ *
+ *  \return 0 on success, or -1 on error
+ */
+extern DECLSPEC int SDLCALL SDL_RenderCopyF(SDL_Renderer * renderer,
+                                            SDL_Texture * texture,
+                                            const SDL_Rect * srcrect,
+                                            const SDL_FRect * dstrect);
+
 /**
  *  \brief Copy a portion of the source texture to the current rendering target, rotating it by angle around the given center
  *
@@ -805,6 +1016,183 @@ extern DECLSPEC int SDLCALL SDL_RenderCopyEx(SDL_Renderer * renderer,
                                            const SDL_Point *center,
                                            const SDL_RendererFlip flip);
 
+/**
+ *  \brief Copy a portion of the source texture to the current rendering target, rotating it by angle around the given center, at subpixel precision
+ *
+ *  \param renderer The renderer which should copy parts of a texture.
+ *  \param texture The source texture.
+ *  \param srcrect   A pointer to the source rectangle, or NULL for the entire
+ *                   texture.
+ *  \param dstrect   A pointer to the destination rectangle, or NULL for the
+ *                   entire rendering target.
+ *  \param angle    An angle in degrees that indicates the rotation that will be applied to dstrect
+ *  \param center   A pointer to a point indicating the point around which dstrect will be rotated (if NULL, rotation will be done around dstrect.w/2, dstrect.h/2).
+ *  \param flip     An SDL_RendererFlip value stating which flipping actions should be performed on the texture
+ *
+ *  \return 0 on success, or -1 on error
+ */
+extern DECLSPEC int SDLCALL SDL_RenderCopyExF(SDL_Renderer * renderer,
+                                            SDL_Texture * texture,
+                                            const SDL_Rect * srcrect,
+                                            const SDL_FRect * dstrect,
+                                            const double angle,
+                                            const SDL_FPoint *center,
+                                            const SDL_RendererFlip flip);
+
+/**
+ *  \brief Copy portions of a texture to the current rendering target many
+ *         times in a single call.
+ *
+ *  Each copy is drawn as SDL_RenderCopy() would draw it, or as
+ *  SDL_RenderCopyEx() would when it is rotated or flipped, but the renderer
+ *  can submit the whole set together, which is much faster for large
+ *  numbers of sprites or particles.
+ *
+ *  \param renderer The renderer which should copy parts of a texture.
+ *  \param texture The source texture.
+ *  \param srcrects An array of source rectangles, or NULL to use the entire
+ *                  texture for every copy.
+ *  \param dstrects An array of destination rectangles.
+ *  \param colors   An array of colors whose r, g, b and a are multiplied with
+ *                  the texture color and alpha modulation for each copy, or
+ *                  NULL to use the texture modulation alone.
+ *  \param angles   An array of angles in degrees, clockwise around the
+ *                  center of each destination rectangle, or NULL for no
+ *                  rotation.
+ *  \param flips    An array of SDL_RendererFlip values, or NULL for no
+ *                  flipping.
+ *  \param count    The number of copies.
+ *
+ *  \return 0 on success, or -1 on error
+ *
+ *  \sa SDL_RenderCopyEx()
+ */
+extern DECLSPEC int SDLCALL SDL_RenderCopyBatch(SDL_Renderer * renderer,
+                                                SDL_Texture * texture,
+                                                const SDL_Rect * srcrects,
+                                                const SDL_Rect * dstrects,
+                                                const SDL_Color * colors,
+                                                const double * angles,
+                                                const SDL_RendererFlip * flips,
+                                                int count);
+
+/**
+ *  \brief Render a list of triangles, optionally using a texture.
+ *
+ *  Every three vertices, or every three indices when \c indices is given,
+ *  make one triangle.  The vertex colors are interpolated across each
+ *  triangle and, for a textured triangle, multiplied with the texel and the
+ *  texture color and alpha modulation.  Textured triangles are blended with
+ *  the texture blend mode, untextured ones with the draw blend mode.
+ *
+ *  \param renderer     The renderer which should draw the triangles.
+ *  \param texture      The texture to use, or NULL for solid colored
+ *                      triangles.
+ *  \param vertices     An array of vertices.
+ *  \param num_vertices The number of vertices.
+ *  \param indices      An array of indices into the vertices, or NULL to
+ *                      use the vertices in order.
+ *  \param num_indices  The number of indices.
+ *
+ *  \return 0 on success, or -1 if the renderer can't draw triangles or on
+ *          error
+ */
+extern DECLSPEC int SDLCALL SDL_RenderGeometry(SDL_Renderer * renderer,
+                                               SDL_Texture * texture,
+                                               const SDL_Vertex * vertices,
+                                               int num_vertices,
+                                               const int * indices,
+                                               int num_indices);
+
+/**
+ *  \brief Create an atlas to pack many small images into a few textures.
+ *
+ *  Drawing from one texture instead of many lets the renderer batch more of
+ *  the drawing together.  The atlas starts a new texture page whenever the
+ *  images added don't fit on the pages it already has.
+ *
+ *  \param renderer The renderer the images will be drawn with.
+ *  \param format   The format of the pages, or 0 for a renderer format with
+ *                  alpha.
+ *  \param w        The width of the pages, or 0 for a default.
+ *  \param h        The height of the pages, or 0 for a default.
+ *
+ *  \return The atlas, or NULL on error.
+ *
+ *  \note The pages are textures of the renderer, so the atlas must be
+ *        destroyed before the renderer.
+ *
+ *  \sa SDL_AddAtlasImage()
+ *  \sa SDL_DestroyTextureAtlas()
+ */
+extern DECLSPEC SDL_TextureAtlas * SDLCALL SDL_CreateTextureAtlas(SDL_Renderer * renderer,
+                                                                  Uint32 format,
+                                                                  int w, int h);
+
+/**
+ *  \brief Copy a surface into a texture atlas.
+ *
+ *  The pages use SDL_BLENDMODE_BLEND.  Images larger than a page get a page
+ *  of their own.
+ *
+ *  \param atlas   The atlas to add to.
+ *  \param surface The image to add.
+ *
+ *  \return The handle of the image in the atlas, or -1 on error.
+ *
+ *  \sa SDL_RenderCopyAtlas()
+ *  \sa SDL_QueryAtlasImage()
+ */
+extern DECLSPEC int SDLCALL SDL_AddAtlasImage(SDL_TextureAtlas * atlas,
+                                              SDL_Surface * surface);
+
+/**
+ *  \brief Find where an image of a texture atlas is.
+ *
+ *  This is for drawing the image with SDL_RenderCopyEx() and the other
+ *  texture drawing calls, or for setting the color and alpha modulation of
+ *  its page.
+ *
+ *  \param atlas   The atlas the image is in.
+ *  \param image   The handle of the image.
+ *  \param texture A pointer filled in with the page holding the image, or
+ *                 NULL.
+ *  \param rect    A pointer filled in with the image's place on that page, or
+ *                 NULL.
+ *
+ *  \return 0 on success, or -1 if the image isn't in the atlas.
+ */
+extern DECLSPEC int SDLCALL SDL_QueryAtlasImage(SDL_TextureAtlas * atlas,
+                                                int image,
+                                                SDL_Texture ** texture,
+                                                SDL_Rect * rect);
+
+/**
+ *  \brief Copy an image of a texture atlas to the current rendering target.
+ *
+ *  \param renderer The renderer the atlas was created with.
+ *  \param atlas    The atlas the image is in.
+ *  \param image    The handle of the image.
+ *  \param srcrect  A part of the image, relative to its top left corner, or
+ *                  NULL for the entire image.
+ *  \param dstrect  The destination rectangle, or NULL for the entire
+ *                  rendering target.
+ *
+ *  \return 0 on success, or -1 on error
+ */
+extern DECLSPEC int SDLCALL SDL_RenderCopyAtlas(SDL_Renderer * renderer,
+                                                SDL_TextureAtlas * atlas,
+                                                int image,
+                                                const SDL_Rect * srcrect,
+                                                const SDL_Rect * dstrect);
+
+/**
+ *  \brief Destroy a texture atlas and its pages.
+ *
+ *  \sa SDL_CreateTextureAtlas()
+ */
+extern DECLSPEC void SDLCALL SDL_DestroyTextureAtlas(SDL_TextureAtlas * atlas);
+
 /**
  *  \brief Read pixels from the current rendering target.
  *
@@ -830,6 +1218,42 @@ extern DECLSPEC int SDLCALL SDL_RenderReadPixels(SDL_Renderer * renderer,
  */
 extern DECLSPEC void SDLCALL SDL_RenderPresent(SDL_Renderer * renderer);
 
+/**
+ *  \brief Draw everything the renderer has batched up so far.
+ *
+ *  Drawing calls may be recorded and run later, see SDL_HINT_RENDER_BATCHING.
+ *  SDL_RenderPresent() and render target changes do this automatically;
+ *  call this before drawing with the underlying graphics API directly, or
+ *  before reading the surface of a software renderer.
+ *
+ *  \return 0 on success, or -1 on error
+ */
+extern DECLSPEC int SDLCALL SDL_RenderFlush(SDL_Renderer * renderer);
+
+/**
+ *  \brief Get the areas of the output drawn on since the last present.
+ *
+ *  The software renderer keeps track of what it draws on the window, and
+ *  SDL_RenderPresent() only updates those areas of the window.  Other
+ *  renderers report the whole output.  This is useful when sending the
+ *  surface of a software renderer somewhere yourself.
+ *
+ *  \param renderer The renderer to query.
+ *  \param rects    An array of rectangles filled in with the changed areas,
+ *                  in output pixels, or NULL to only count them.
+ *  \param maxrects The number of rectangles rects has room for.  If there
+ *                  are more areas than that, the last is their union.
+ *
+ *  \return The number of rectangles filled in, 0 if nothing has been drawn,
+ *          or -1 on error.
+ *
+ *  \sa SDL_RenderPresent()
+ *  \sa SDL_GetRendererOutputSize()
+ */
+extern DECLSPEC int SDLCALL SDL_RenderGetDamageRects(SDL_Renderer * renderer,
+                                                     SDL_Rect * rects,
+                                                     int maxrects);
+
 /**
  *  \brief Destroy the specified texture.
  *
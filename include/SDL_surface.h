@@ -91,6 +91,18 @@ typedef struct SDL_Surface
     int refcount;               /**< Read-mostly */
 } SDL_Surface;
 
+/**
+ * \brief The filter used when a blit changes the size of the image.
+ *
+ * \sa SDL_SetSurfaceScaleMode()
+ */
+typedef enum
+{
+    SDL_SCALEMODE_NEAREST,  /**< Nearest pixel sampling */
+    SDL_SCALEMODE_LINEAR    /**< Bilinear filtering when enlarging, area
+                                 averaging when shrinking */
+} SDL_ScaleMode;
+
 /**
  * \brief The type of function used for surface blitting functions.
  */
@@ -321,6 +333,35 @@ extern DECLSPEC int SDLCALL SDL_SetSurfaceBlendMode(SDL_Surface * surface,
 extern DECLSPEC int SDLCALL SDL_GetSurfaceBlendMode(SDL_Surface * surface,
                                                     SDL_BlendMode *blendMode);
 
+/**
+ *  \brief Set the filter used when SDL_BlitScaled() resizes this surface.
+ *
+ *  \param surface The surface to update.
+ *  \param scaleMode ::SDL_ScaleMode to use for scaled blits.
+ *
+ *  \return 0 on success, or -1 if the parameters are not valid.
+ *
+ *  \note Filtering is only done for 32-bit source surfaces without a color
+ *        key, other surfaces are always scaled with ::SDL_SCALEMODE_NEAREST.
+ *
+ *  \sa SDL_GetSurfaceScaleMode()
+ */
+extern DECLSPEC int SDLCALL SDL_SetSurfaceScaleMode(SDL_Surface * surface,
+                                                    SDL_ScaleMode scaleMode);
+
+/**
+ *  \brief Get the filter used when SDL_BlitScaled() resizes this surface.
+ *
+ *  \param surface   The surface to query.
+ *  \param scaleMode A pointer filled in with the current scale mode.
+ *
+ *  \return 0 on success, or -1 if the surface is not valid.
+ *
+ *  \sa SDL_SetSurfaceScaleMode()
+ */
+extern DECLSPEC int SDLCALL SDL_GetSurfaceScaleMode(SDL_Surface * surface,
+                                                    SDL_ScaleMode *scaleMode);
+
 /**
  *  Sets the clipping rectangle for the destination surface in a blit.
  *
@@ -364,6 +405,14 @@ extern DECLSPEC SDL_Surface *SDLCALL SDL_ConvertSurfaceFormat
 /**
  * \brief Copy a block of pixels of one format to another format
  *
+ *  Either format may be one of the YUV formats, YV12, IYUV, NV12, NV21,
+ *  YUY2, UYVY or YVYU, as long as the other one is an RGB format.  The
+ *  color space used is given by SDL_GetYUVConversionModeForResolution().
+ *
+ *  The chroma planes of YV12 and IYUV follow the Y plane, with a pitch of
+ *  half of \c src_pitch or \c dst_pitch rounded up, and the interleaved
+ *  chroma plane of NV12 and NV21 follows the Y plane with the same pitch.
+ *
  *  \return 0 on success, or -1 if there was an error
  */
 extern DECLSPEC int SDLCALL SDL_ConvertPixels(int width, int height,
@@ -372,6 +421,35 @@ extern DECLSPEC int SDLCALL SDL_ConvertPixels(int width, int height,
                                               Uint32 dst_format,
                                               void * dst, int dst_pitch);
 
+/**
+ * \brief The formula used for converting between YUV and RGB
+ */
+typedef enum
+{
+    SDL_YUV_CONVERSION_JPEG,        /**< Full range JPEG */
+    SDL_YUV_CONVERSION_BT601,       /**< BT.601 (the default) */
+    SDL_YUV_CONVERSION_BT709,       /**< BT.709 */
+    SDL_YUV_CONVERSION_AUTOMATIC    /**< BT.601 for SD content, BT.709 for HD content */
+} SDL_YUV_CONVERSION_MODE;
+
+/**
+ *  \brief Set the YUV conversion mode
+ *
+ *  BT.601 and BT.709 use limited range, Y in [16,235] and U and V in
+ *  [16,240].  JPEG uses the BT.601 matrix with the full [0,255] range.
+ */
+extern DECLSPEC void SDLCALL SDL_SetYUVConversionMode(SDL_YUV_CONVERSION_MODE mode);
+
+/**
+ *  \brief Get the YUV conversion mode
+ */
+extern DECLSPEC SDL_YUV_CONVERSION_MODE SDLCALL SDL_GetYUVConversionMode(void);
+
+/**
+ *  \brief Get the YUV conversion mode, returning the correct mode for the resolution when the current conversion mode is SDL_YUV_CONVERSION_AUTOMATIC
+ */
+extern DECLSPEC SDL_YUV_CONVERSION_MODE SDLCALL SDL_GetYUVConversionModeForResolution(int width, int height);
+
 /**
  *  Performs a fast fill of the given rectangle with \c color.
  *
@@ -473,6 +551,18 @@ extern DECLSPEC int SDLCALL SDL_SoftStretch(SDL_Surface * src,
                                             SDL_Surface * dst,
                                             const SDL_Rect * dstrect);
 
+/**
+ *  \brief Perform a filtered stretch blit between two 32-bit surfaces of the
+ *         same pixel format, with 8 bits per channel.
+ *
+ *  The image is filtered bilinearly when it is enlarged and averaged over
+ *  the covered area when it is shrunk, separately for each axis.
+ */
+extern DECLSPEC int SDLCALL SDL_SoftStretchLinear(SDL_Surface * src,
+                                                  const SDL_Rect * srcrect,
+                                                  SDL_Surface * dst,
+                                                  const SDL_Rect * dstrect);
+
 #define SDL_BlitScaled SDL_UpperBlitScaled
 
 /**
@@ -59,9 +59,24 @@ typedef unsigned int SDL_TLSID;
 typedef enum {
     SDL_THREAD_PRIORITY_LOW,
     SDL_THREAD_PRIORITY_NORMAL,
-    SDL_THREAD_PRIORITY_HIGH
+    SDL_THREAD_PRIORITY_HIGH,
+    SDL_THREAD_PRIORITY_TIME_CRITICAL   /**< Real-time class, for audio and similar deadline-driven work */
 } SDL_ThreadPriority;
 
+/**
+ *  Optional attributes for a new thread, see SDL_CreateThreadWithAttributes().
+ *
+ *  A zeroed field means "use the system default".  \c priority is only
+ *  applied when \c setpriority is SDL_TRUE.
+ */
+typedef struct SDL_ThreadAttributes
+{
+    size_t stacksize;               /**< Stack size in bytes, or 0 for the default */
+    Uint64 affinity;                /**< Mask of CPUs the thread may run on, or 0 for any */
+    SDL_bool setpriority;           /**< SDL_TRUE to start with \c priority, or SDL_FALSE for the default */
+    SDL_ThreadPriority priority;    /**< Priority the thread starts with */
+} SDL_ThreadAttributes;
+
 /**
  *  The function passed to SDL_CreateThread().
  *  It is passed a void* user context parameter and returns an int.
@@ -118,6 +133,25 @@ SDL_CreateThread(SDL_ThreadFunction fn, const char *name, void *data,
 #define SDL_CreateThread(fn, name, data) SDL_CreateThread(fn, name, data, (pfnSDL_CurrentBeginThread)_beginthreadex, (pfnSDL_CurrentEndThread)_endthreadex)
 #endif
 
+/**
+ *  Create a thread with the specified attributes.
+ */
+extern DECLSPEC SDL_Thread *SDLCALL
+SDL_CreateThreadWithAttributes(SDL_ThreadFunction fn, const char *name, void *data,
+                               const SDL_ThreadAttributes *attributes,
+                               pfnSDL_CurrentBeginThread pfnBeginThread,
+                               pfnSDL_CurrentEndThread pfnEndThread);
+
+/**
+ *  Create a thread with the specified attributes.
+ */
+#if defined(SDL_CreateThreadWithAttributes) && SDL_DYNAMIC_API
+#undef SDL_CreateThreadWithAttributes
+#define SDL_CreateThreadWithAttributes(fn, name, data, attributes) SDL_CreateThreadWithAttributes_REAL(fn, name, data, attributes, (pfnSDL_CurrentBeginThread)_beginthreadex, (pfnSDL_CurrentEndThread)_endthreadex)
+#else
+#define SDL_CreateThreadWithAttributes(fn, name, data, attributes) SDL_CreateThreadWithAttributes(fn, name, data, attributes, (pfnSDL_CurrentBeginThread)_beginthreadex, (pfnSDL_CurrentEndThread)_endthreadex)
+#endif
+
 #else
 
 /**
@@ -141,6 +175,22 @@ SDL_CreateThread(SDL_ThreadFunction fn, const char *name, void *data,
 extern DECLSPEC SDL_Thread *SDLCALL
 SDL_CreateThread(SDL_ThreadFunction fn, const char *name, void *data);
 
+/**
+ *  Create a thread with the specified attributes.
+ *
+ *  This is the same as SDL_CreateThread(), but lets you pick the stack size,
+ *  the CPUs the thread may run on and the priority it starts with. The
+ *  priority and affinity are applied from the new thread before \c fn runs;
+ *  if the system refuses them the thread still runs, with the defaults.
+ *  SDL_THREAD_PRIORITY_TIME_CRITICAL falls back to SDL_THREAD_PRIORITY_HIGH
+ *  when real-time scheduling isn't available to the process.
+ *
+ *  \param attributes The thread attributes, or NULL for the defaults.
+ */
+extern DECLSPEC SDL_Thread *SDLCALL
+SDL_CreateThreadWithAttributes(SDL_ThreadFunction fn, const char *name, void *data,
+                               const SDL_ThreadAttributes *attributes);
+
 #endif
 
 /**
@@ -169,6 +219,17 @@ extern DECLSPEC SDL_threadID SDLCALL SDL_GetThreadID(SDL_Thread * thread);
  */
 extern DECLSPEC int SDLCALL SDL_SetThreadPriority(SDL_ThreadPriority priority);
 
+/**
+ *  Restrict the current thread to the CPUs in \c mask.
+ *
+ *  Bit N of \c mask selects the Nth logical CPU, as counted by
+ *  SDL_GetCPUCount().
+ *
+ *  \return 0 on success, or -1 if the mask is invalid or the platform
+ *          doesn't support thread affinity.
+ */
+extern DECLSPEC int SDLCALL SDL_SetThreadAffinity(Uint64 mask);
+
 /**
  *  Wait for a thread to finish. Threads that haven't been detached will
  *  remain (as a "zombie") until this function cleans them up. Not doing so
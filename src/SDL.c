@@ -41,6 +41,8 @@ extern void SDL_TimerQuit(void);
 extern void SDL_TicksInit(void);
 extern void SDL_TicksQuit(void);
 #endif
+extern void SDL_QuitParallel(void);
+extern void SDL_QuitBlitCPUFeatures(void);
 #if SDL_VIDEO_DRIVER_WINDOWS
 extern int SDL_HelperWindowCreate(void);
 extern int SDL_HelperWindowDestroy(void);
@@ -355,12 +357,14 @@ SDL_Quit(void)
     SDL_HelperWindowDestroy();
 #endif
     SDL_QuitSubSystem(SDL_INIT_EVERYTHING);
+    SDL_QuitParallel();
 
 #if !SDL_TIMERS_DISABLED
     SDL_TicksQuit();
 #endif
 
     SDL_ClearHints();
+    SDL_QuitBlitCPUFeatures();
     SDL_AssertionsQuit();
     SDL_LogResetPriorities();
 
@@ -25,6 +25,7 @@
 #include "SDL_log.h"
 #include "SDL_error.h"
 #include "SDL_error_c.h"
+#include "thread/SDL_thread_c.h"
 
 
 /* Routine to get the thread-specific error variable */
@@ -221,7 +222,11 @@ SDL_GetErrorMsg(char *errstr, int maxlen)
 const char *
 SDL_GetError(void)
 {
+#ifdef SDL_THREAD_LOCAL
+    static SDL_THREAD_LOCAL char errmsg[SDL_ERRBUFIZE];
+#else
     static char errmsg[SDL_ERRBUFIZE];
+#endif
 
     return SDL_GetErrorMsg(errmsg, SDL_ERRBUFIZE);
 }
@@ -22,6 +22,8 @@
 
 #include "SDL_hints.h"
 #include "SDL_error.h"
+#include "SDL_atomic.h"
+#include "SDL_mutex.h"
 
 
 /* Assuming there aren't many hints set and they aren't being queried in
@@ -42,14 +44,34 @@ typedef struct SDL_Hint {
 } SDL_Hint;
 
 static SDL_Hint *SDL_hints;
+static SDL_RWLock *SDL_hints_lock;
+
+/* Hints are looked up from any thread, and may be set before SDL_Init(),
+   so the lock protecting the list is created on first use. */
+static SDL_RWLock *
+SDL_GetHintsLock(void)
+{
+    SDL_RWLock *lock = (SDL_RWLock *)SDL_AtomicGetPtr((void **)&SDL_hints_lock);
+    if (!lock) {
+        lock = SDL_CreateRWLock();
+        if (lock && !SDL_AtomicCASPtr((void **)&SDL_hints_lock, NULL, lock)) {
+            SDL_DestroyRWLock(lock);
+            lock = (SDL_RWLock *)SDL_AtomicGetPtr((void **)&SDL_hints_lock);
+        }
+    }
+    return lock;
+}
 
 SDL_bool
 SDL_SetHintWithPriority(const char *name, const char *value,
                         SDL_HintPriority priority)
 {
     const char *env;
+    SDL_RWLock *lock;
     SDL_Hint *hint;
-    SDL_HintWatch *entry;
+    SDL_HintWatch *entry, *watches;
+    char *old_value;
+    int i, count;
 
     if (!name || !value) {
         return SDL_FALSE;
@@ -60,22 +82,52 @@ SDL_SetHintWithPriority(const char *name, const char *value,
         return SDL_FALSE;
     }
 
+    lock = SDL_GetHintsLock();
+    SDL_LockRWLockForWriting(lock);
     for (hint = SDL_hints; hint; hint = hint->next) {
         if (SDL_strcmp(name, hint->name) == 0) {
             if (priority < hint->priority) {
+                SDL_UnlockRWLock(lock);
                 return SDL_FALSE;
             }
             if (!hint->value || !value || SDL_strcmp(hint->value, value) != 0) {
-                for (entry = hint->callbacks; entry; ) {
-                    /* Save the next entry in case this one is deleted */
-                    SDL_HintWatch *next = entry->next;
-                    entry->callback(entry->userdata, name, hint->value, value);
-                    entry = next;
+                /* The callbacks may look at hints or stop watching this one,
+                   so they run unlocked on a copy of the list, before the
+                   new value is stored */
+                count = 0;
+                for (entry = hint->callbacks; entry; entry = entry->next) {
+                    ++count;
+                }
+                watches = NULL;
+                old_value = NULL;
+                if (count) {
+                    watches = (SDL_HintWatch *)SDL_malloc(count * sizeof(*watches));
+                    old_value = hint->value ? SDL_strdup(hint->value) : NULL;
+                    if (!watches || (hint->value && !old_value)) {
+                        SDL_UnlockRWLock(lock);
+                        SDL_free(watches);
+                        SDL_free(old_value);
+                        SDL_OutOfMemory();
+                        return SDL_FALSE;
+                    }
+                    for (i = 0, entry = hint->callbacks; entry; ++i, entry = entry->next) {
+                        watches[i] = *entry;
+                    }
+                    SDL_UnlockRWLock(lock);
+                    for (i = 0; i < count; ++i) {
+                        watches[i].callback(watches[i].userdata, name, old_value, value);
+                    }
+                    SDL_free(watches);
+                    SDL_free(old_value);
+                    SDL_LockRWLockForWriting(lock);
                 }
+                /* Hints are only removed by SDL_ClearHints(), the entry is
+                   still in the list */
                 SDL_free(hint->value);
                 hint->value = value ? SDL_strdup(value) : NULL;
             }
             hint->priority = priority;
+            SDL_UnlockRWLock(lock);
             return SDL_TRUE;
         }
     }
@@ -83,6 +135,7 @@ SDL_SetHintWithPriority(const char *name, const char *value,
     /* Couldn't find the hint, add a new one */
     hint = (SDL_Hint *)SDL_malloc(sizeof(*hint));
     if (!hint) {
+        SDL_UnlockRWLock(lock);
         return SDL_FALSE;
     }
     hint->name = SDL_strdup(name);
@@ -91,6 +144,7 @@ SDL_SetHintWithPriority(const char *name, const char *value,
     hint->callbacks = NULL;
     hint->next = SDL_hints;
     SDL_hints = hint;
+    SDL_UnlockRWLock(lock);
     return SDL_TRUE;
 }
 
@@ -104,23 +158,33 @@ const char *
 SDL_GetHint(const char *name)
 {
     const char *env;
+    const char *value;
+    SDL_RWLock *lock;
     SDL_Hint *hint;
 
     env = SDL_getenv(name);
+    value = env;
+
+    lock = SDL_GetHintsLock();
+    SDL_LockRWLockForReading(lock);
     for (hint = SDL_hints; hint; hint = hint->next) {
         if (SDL_strcmp(name, hint->name) == 0) {
             if (!env || hint->priority == SDL_HINT_OVERRIDE) {
-                return hint->value;
+                value = hint->value;
             }
             break;
         }
     }
-    return env;
+    /* The lock only keeps the list intact while searching it, the value
+       returned is freed by the next SDL_SetHint() of this hint */
+    SDL_UnlockRWLock(lock);
+    return value;
 }
 
 void
 SDL_AddHintCallback(const char *name, SDL_HintCallback callback, void *userdata)
 {
+    SDL_RWLock *lock;
     SDL_Hint *hint;
     SDL_HintWatch *entry;
     const char *value;
@@ -144,6 +208,8 @@ SDL_AddHintCallback(const char *name, SDL_HintCallback callback, void *userdata)
     entry->callback = callback;
     entry->userdata = userdata;
 
+    lock = SDL_GetHintsLock();
+    SDL_LockRWLockForWriting(lock);
     for (hint = SDL_hints; hint; hint = hint->next) {
         if (SDL_strcmp(name, hint->name) == 0) {
             break;
@@ -153,6 +219,7 @@ SDL_AddHintCallback(const char *name, SDL_HintCallback callback, void *userdata)
         /* Need to add a hint entry for this watcher */
         hint = (SDL_Hint *)SDL_malloc(sizeof(*hint));
         if (!hint) {
+            SDL_UnlockRWLock(lock);
             SDL_OutOfMemory();
             SDL_free(entry);
             return;
@@ -168,6 +235,7 @@ SDL_AddHintCallback(const char *name, SDL_HintCallback callback, void *userdata)
     /* Add it to the callbacks for this hint */
     entry->next = hint->callbacks;
     hint->callbacks = entry;
+    SDL_UnlockRWLock(lock);
 
     /* Now call it with the current value */
     value = SDL_GetHint(name);
@@ -177,9 +245,12 @@ SDL_AddHintCallback(const char *name, SDL_HintCallback callback, void *userdata)
 void
 SDL_DelHintCallback(const char *name, SDL_HintCallback callback, void *userdata)
 {
+    SDL_RWLock *lock;
     SDL_Hint *hint;
     SDL_HintWatch *entry, *prev;
 
+    lock = SDL_GetHintsLock();
+    SDL_LockRWLockForWriting(lock);
     for (hint = SDL_hints; hint; hint = hint->next) {
         if (SDL_strcmp(name, hint->name) == 0) {
             prev = NULL;
@@ -195,16 +266,20 @@ SDL_DelHintCallback(const char *name, SDL_HintCallback callback, void *userdata)
                 }
                 prev = entry;
             }
-            return;
+            break;
         }
     }
+    SDL_UnlockRWLock(lock);
 }
 
 void SDL_ClearHints(void)
 {
+    SDL_RWLock *lock;
     SDL_Hint *hint;
     SDL_HintWatch *entry;
 
+    lock = SDL_GetHintsLock();
+    SDL_LockRWLockForWriting(lock);
     while (SDL_hints) {
         hint = SDL_hints;
         SDL_hints = hint->next;
@@ -218,6 +293,7 @@ void SDL_ClearHints(void)
         }
         SDL_free(hint);
     }
+    SDL_UnlockRWLock(lock);
 }
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -32,6 +32,30 @@
 #include <atomic.h>
 #endif
 
+/* On Linux a contended lock parks on a futex instead of polling the
+   scheduler, which needs a third "locked with waiters" state in the lock
+   word.  The other platforms only ever see 0 and 1. */
+#include "../core/linux/SDL_futex.h"
+
+/* Tell the CPU we're busy-waiting, so it can back off the pipeline (and
+   yield to a hyperthread sibling) instead of hammering the cache line. */
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#define SDL_SPINLOCK_PAUSE() __asm__ __volatile__("pause\n" ::: "memory")
+#elif defined(__GNUC__) && (defined(__aarch64__) || (defined(__arm__) && \
+        (defined(__ARM_ARCH_6K__) || defined(__ARM_ARCH_6T2__) || defined(__ARM_ARCH_7__) || \
+         defined(__ARM_ARCH_7A__) || defined(__ARM_ARCH_7R__) || defined(__ARM_ARCH_7M__) || \
+         defined(__ARM_ARCH_7S__) || defined(__ARM_ARCH_8A__))))
+#define SDL_SPINLOCK_PAUSE() __asm__ __volatile__("yield\n" ::: "memory")
+#elif (defined(__WIN32__) || defined(__WINRT__)) && defined(_MSC_VER)
+#define SDL_SPINLOCK_PAUSE() YieldProcessor()
+#else
+#define SDL_SPINLOCK_PAUSE() do {} while (0)
+#endif
+
+/* Spin with exponential backoff up to this many pause instructions per
+   attempt before giving up the CPU. */
+#define SDL_SPINLOCK_MAX_BACKOFF 64
+
 /* This function is where all the magic happens... */
 SDL_bool
 SDL_AtomicTryLock(SDL_SpinLock *lock)
@@ -54,6 +78,10 @@ SDL_AtomicTryLock(SDL_SpinLock *lock)
         return SDL_FALSE;
     }
 
+#elif SDL_USE_FUTEX
+    /* Must not clobber the "has waiters" state, so this is a CAS, not a swap */
+    return SDL_FutexTryLock(lock);
+
 #elif defined(_MSC_VER)
     SDL_COMPILE_TIME_ASSERT(locksize, sizeof(*lock) == sizeof(long));
     return (InterlockedExchange((long*)lock, 1) == 0);
@@ -106,16 +134,36 @@ SDL_AtomicTryLock(SDL_SpinLock *lock)
 void
 SDL_AtomicLock(SDL_SpinLock *lock)
 {
+    int backoff = 1;
+    int i;
+
     /* FIXME: Should we have an eventual timeout? */
     while (!SDL_AtomicTryLock(lock)) {
+        if (backoff <= SDL_SPINLOCK_MAX_BACKOFF) {
+            /* Most holders are done within a few hundred cycles */
+            for (i = 0; i < backoff; ++i) {
+                SDL_SPINLOCK_PAUSE();
+            }
+            backoff <<= 1;
+            continue;
+        }
+
+#if SDL_USE_FUTEX
+        SDL_FutexLockContended(lock);
+        return;
+#else
         SDL_Delay(0);
+#endif
     }
 }
 
 void
 SDL_AtomicUnlock(SDL_SpinLock *lock)
 {
-#if defined(_MSC_VER)
+#if SDL_USE_FUTEX
+    SDL_FutexUnlock(lock);
+
+#elif defined(_MSC_VER)
     _ReadWriteBarrier();
     *lock = 0;
 
@@ -132,4 +180,41 @@ SDL_AtomicUnlock(SDL_SpinLock *lock)
 #endif
 }
 
+Uint32
+SDL_SeqLockReadBegin(SDL_SeqLock *seqlock)
+{
+    Uint32 seq;
+
+    /* An odd sequence number means a write is in progress */
+    while ((seq = (Uint32)SDL_AtomicGet(&seqlock->sequence)) & 1) {
+        SDL_SPINLOCK_PAUSE();
+    }
+    SDL_MemoryBarrierAcquire();
+    return seq;
+}
+
+SDL_bool
+SDL_SeqLockReadRetry(SDL_SeqLock *seqlock, Uint32 start)
+{
+    /* Make sure the caller's reads of the data finished first */
+    SDL_MemoryBarrierAcquire();
+    return ((Uint32)SDL_AtomicGet(&seqlock->sequence) != start) ? SDL_TRUE : SDL_FALSE;
+}
+
+void
+SDL_SeqLockWriteBegin(SDL_SeqLock *seqlock)
+{
+    SDL_AtomicLock(&seqlock->writer);
+    SDL_AtomicIncRef(&seqlock->sequence);
+    SDL_MemoryBarrierRelease();
+}
+
+void
+SDL_SeqLockWriteEnd(SDL_SeqLock *seqlock)
+{
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicIncRef(&seqlock->sequence);
+    SDL_AtomicUnlock(&seqlock->writer);
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -27,6 +27,7 @@
 #include "SDL_audio_c.h"
 #include "SDL_audiomem.h"
 #include "SDL_sysaudio.h"
+#include "../thread/SDL_thread_c.h"
 
 #define _THIS SDL_AudioDevice *_this
 
@@ -602,9 +603,6 @@ SDL_RunAudio(void *devicep)
     void *udata = device->spec.userdata;
     void (SDLCALL *fill) (void *, Uint8 *, int) = device->spec.callback;
 
-    /* The audio mixing is always a high priority thread */
-    SDL_SetThreadPriority(SDL_THREAD_PRIORITY_HIGH);
-
     /* Perform any thread setup */
     device->threadid = SDL_ThreadID();
     current_audio.impl.ThreadInit(device);
@@ -755,7 +753,7 @@ SDL_AudioInit(const char *driver_name)
         return -1;            /* No driver was available, so fail. */
     }
 
-    current_audio.detectionLock = SDL_CreateMutex();
+    current_audio.detectionLock = SDL_CreateNonRecursiveMutex();
 
     finalize_audio_entry_points();
 
@@ -1192,18 +1190,14 @@ open_audio_device(const char *devname, int iscapture,
     if (!current_audio.impl.ProvidesOwnCallbackThread) {
         /* Start the audio thread */
         char name[64];
+        SDL_ThreadAttributes attributes;
         SDL_snprintf(name, sizeof (name), "SDLAudioDev%d", (int) device->id);
-/* !!! FIXME: this is nasty. */
-#if defined(__WIN32__) && !defined(HAVE_LIBC)
-#undef SDL_CreateThread
-#if SDL_DYNAMIC_API
-        device->thread = SDL_CreateThread_REAL(SDL_RunAudio, name, device, NULL, NULL);
-#else
-        device->thread = SDL_CreateThread(SDL_RunAudio, name, device, NULL, NULL);
-#endif
-#else
-        device->thread = SDL_CreateThread(SDL_RunAudio, name, device);
-#endif
+
+        /* The audio mixing is always a high priority thread, real-time if we can */
+        SDL_zero(attributes);
+        attributes.setpriority = SDL_TRUE;
+        attributes.priority = SDL_THREAD_PRIORITY_TIME_CRITICAL;
+        device->thread = SDL_CreateThreadInternal(SDL_RunAudio, name, device, &attributes);
         if (device->thread == NULL) {
             SDL_CloseAudioDevice(device->id);
             SDL_SetError("Couldn't create audio thread");
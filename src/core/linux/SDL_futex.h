@@ -0,0 +1,113 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2014 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "../../SDL_internal.h"
+
+#ifndef _SDL_futex_h
+#define _SDL_futex_h
+
+/* Thin wrappers around the Linux futex syscall, shared by the spinlock and
+   the pthread mutex/condition variable code. */
+
+#if defined(__LINUX__) && defined(HAVE_GCC_ATOMICS) && !SDL_ATOMIC_DISABLED
+
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#if defined(SYS_futex)
+
+#ifndef SDL_USE_FUTEX
+#define SDL_USE_FUTEX 1
+#endif
+
+#ifndef FUTEX_WAIT_PRIVATE
+#define FUTEX_WAIT_PRIVATE FUTEX_WAIT
+#define FUTEX_WAKE_PRIVATE FUTEX_WAKE
+#endif
+
+#define SDL_FUTEX_WAIT_FOREVER  ~(Uint32)0
+
+/* Sleep while *addr == expected, for at most 'ms' milliseconds.
+   Returns 0 when woken (possibly spuriously), or ETIMEDOUT. */
+static SDL_INLINE int
+SDL_FutexWait(int *addr, int expected, Uint32 ms)
+{
+    struct timespec timeout;
+    struct timespec *ptimeout = NULL;
+
+    if (ms != SDL_FUTEX_WAIT_FOREVER) {
+        timeout.tv_sec = ms / 1000;
+        timeout.tv_nsec = (ms % 1000) * 1000000;
+        ptimeout = &timeout;
+    }
+    if (syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, expected, ptimeout, NULL, 0) < 0) {
+        if (errno == ETIMEDOUT) {
+            return ETIMEDOUT;
+        }
+    }
+    return 0;
+}
+
+/* Wake up to 'count' threads sleeping on addr */
+static SDL_INLINE void
+SDL_FutexWake(int *addr, int count)
+{
+    syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0);
+}
+
+/* A three state lock word: 0 is unlocked, 1 is locked, and 2 is locked
+   with (possibly) sleeping waiters.  Taking it uncontended is one CAS. */
+static SDL_INLINE SDL_bool
+SDL_FutexTryLock(int *word)
+{
+    return __sync_bool_compare_and_swap(word, 0, 1) ? SDL_TRUE : SDL_FALSE;
+}
+
+/* Slow path: mark the lock contended and sleep until it's ours.  We may
+   leave it marked after we get it, which only costs the next unlock a
+   spurious wake. */
+static SDL_INLINE void
+SDL_FutexLockContended(int *word)
+{
+    while (__sync_lock_test_and_set(word, 2) != 0) {
+        SDL_FutexWait(word, 2, SDL_FUTEX_WAIT_FOREVER);
+    }
+}
+
+static SDL_INLINE void
+SDL_FutexUnlock(int *word)
+{
+    /* Full barrier swap to unlocked, then wake a sleeper if there may be one */
+    if (__sync_fetch_and_and(word, 0) == 2) {
+        SDL_FutexWake(word, 1);
+    }
+}
+
+#endif /* SYS_futex */
+
+#endif /* __LINUX__ && HAVE_GCC_ATOMICS */
+
+#endif /* _SDL_futex_h */
+
+/* vi: set ts=4 sw=4 expandtab: */
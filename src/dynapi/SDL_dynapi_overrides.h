@@ -45,6 +45,7 @@
 #define SDL_sscanf SDL_sscanf_REAL
 #define SDL_snprintf SDL_snprintf_REAL
 #define SDL_CreateThread SDL_CreateThread_REAL
+#define SDL_CreateThreadWithAttributes SDL_CreateThreadWithAttributes_REAL
 #define SDL_RWFromFP SDL_RWFromFP_REAL
 #define SDL_RegisterApp SDL_RegisterApp_REAL
 #define SDL_UnregisterApp SDL_UnregisterApp_REAL
@@ -592,3 +593,44 @@
 #define SDL_GetQueuedAudioSize SDL_GetQueuedAudioSize_REAL
 #define SDL_ClearQueuedAudio SDL_ClearQueuedAudio_REAL
 #define SDL_GetGrabbedWindow SDL_GetGrabbedWindow_REAL
+#define SDL_CreateNonRecursiveMutex SDL_CreateNonRecursiveMutex_REAL
+#define SDL_CreateRWLock SDL_CreateRWLock_REAL
+#define SDL_LockRWLockForReading SDL_LockRWLockForReading_REAL
+#define SDL_LockRWLockForWriting SDL_LockRWLockForWriting_REAL
+#define SDL_TryLockRWLockForReading SDL_TryLockRWLockForReading_REAL
+#define SDL_TryLockRWLockForWriting SDL_TryLockRWLockForWriting_REAL
+#define SDL_UnlockRWLock SDL_UnlockRWLock_REAL
+#define SDL_DestroyRWLock SDL_DestroyRWLock_REAL
+#define SDL_SeqLockReadBegin SDL_SeqLockReadBegin_REAL
+#define SDL_SeqLockReadRetry SDL_SeqLockReadRetry_REAL
+#define SDL_SeqLockWriteBegin SDL_SeqLockWriteBegin_REAL
+#define SDL_SeqLockWriteEnd SDL_SeqLockWriteEnd_REAL
+#define SDL_SetThreadAffinity SDL_SetThreadAffinity_REAL
+#define SDL_SetSurfaceScaleMode SDL_SetSurfaceScaleMode_REAL
+#define SDL_GetSurfaceScaleMode SDL_GetSurfaceScaleMode_REAL
+#define SDL_SoftStretchLinear SDL_SoftStretchLinear_REAL
+#define SDL_SetYUVConversionMode SDL_SetYUVConversionMode_REAL
+#define SDL_GetYUVConversionMode SDL_GetYUVConversionMode_REAL
+#define SDL_GetYUVConversionModeForResolution SDL_GetYUVConversionModeForResolution_REAL
+#define SDL_RenderFlush SDL_RenderFlush_REAL
+#define SDL_RenderCopyBatch SDL_RenderCopyBatch_REAL
+#define SDL_RenderGeometry SDL_RenderGeometry_REAL
+#define SDL_RenderDrawPointF SDL_RenderDrawPointF_REAL
+#define SDL_RenderDrawPointsF SDL_RenderDrawPointsF_REAL
+#define SDL_RenderDrawLineF SDL_RenderDrawLineF_REAL
+#define SDL_RenderDrawLinesF SDL_RenderDrawLinesF_REAL
+#define SDL_RenderDrawRectF SDL_RenderDrawRectF_REAL
+#define SDL_RenderDrawRectsF SDL_RenderDrawRectsF_REAL
+#define SDL_RenderFillRectF SDL_RenderFillRectF_REAL
+#define SDL_RenderFillRectsF SDL_RenderFillRectsF_REAL
+#define SDL_RenderCopyF SDL_RenderCopyF_REAL
+#define SDL_RenderCopyExF SDL_RenderCopyExF_REAL
+#define SDL_RenderGetDamageRects SDL_RenderGetDamageRects_REAL
+#define SDL_CreateTextureAtlas SDL_CreateTextureAtlas_REAL
+#define SDL_AddAtlasImage SDL_AddAtlasImage_REAL
+#define SDL_QueryAtlasImage SDL_QueryAtlasImage_REAL
+#define SDL_RenderCopyAtlas SDL_RenderCopyAtlas_REAL
+#define SDL_DestroyTextureAtlas SDL_DestroyTextureAtlas_REAL
+#define SDL_CreateTextureWrappingSurface SDL_CreateTextureWrappingSurface_REAL
+#define SDL_LockTextureRects SDL_LockTextureRects_REAL
+#define SDL_SetTextureBuffers SDL_SetTextureBuffers_REAL
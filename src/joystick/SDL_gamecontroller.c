@@ -24,6 +24,7 @@
 
 #include "SDL_events.h"
 #include "SDL_assert.h"
+#include "SDL_mutex.h"
 #include "SDL_sysjoystick.h"
 #include "SDL_hints.h"
 #include "SDL_gamecontrollerdb.h"
@@ -91,6 +92,10 @@ static ControllerMapping_t *s_pSupportedControllers = NULL;
 static ControllerMapping_t *s_pXInputMapping = NULL;
 static ControllerMapping_t *s_pEmscriptenMapping = NULL;
 
+/* Protects the mappings database above.  Lookups vastly outnumber updates,
+   so readers share it.  Created by SDL_GameControllerInit(). */
+static SDL_RWLock *s_pMappingsLock = NULL;
+
 /* The SDL game controller structure */
 struct _SDL_GameController
 {
@@ -239,8 +244,29 @@ int SDL_GameControllerEventWatcher(void *userdata, SDL_Event * event)
     return 1;
 }
 
+static void
+SDL_PrivateLockMappings(SDL_bool for_writing)
+{
+    if (s_pMappingsLock) {
+        if (for_writing) {
+            SDL_LockRWLockForWriting(s_pMappingsLock);
+        } else {
+            SDL_LockRWLockForReading(s_pMappingsLock);
+        }
+    }
+}
+
+static void
+SDL_PrivateUnlockMappings(void)
+{
+    if (s_pMappingsLock) {
+        SDL_UnlockRWLock(s_pMappingsLock);
+    }
+}
+
 /*
  * Helper function to scan the mappings database for a controller with the specified GUID
+ * The caller must hold the mappings lock for as long as it uses the result.
  */
 ControllerMapping_t *SDL_PrivateGetControllerMappingForGUID(SDL_JoystickGUID *guid)
 {
@@ -256,6 +282,7 @@ ControllerMapping_t *SDL_PrivateGetControllerMappingForGUID(SDL_JoystickGUID *gu
 
 /*
  * Helper function to determine pre-calculated offset to certain joystick mappings
+ * The caller must hold the mappings lock for as long as it uses the result.
  */
 ControllerMapping_t *SDL_PrivateGetControllerMapping(int device_index)
 {
@@ -580,12 +607,16 @@ void SDL_PrivateGameControllerRefreshMapping(ControllerMapping_t *pControllerMap
     while (gamecontrollerlist) {
         if (!SDL_memcmp(&gamecontrollerlist->mapping.guid, &pControllerMapping->guid, sizeof(pControllerMapping->guid))) {
             SDL_Event event;
-            event.type = SDL_CONTROLLERDEVICEREMAPPED;
-            event.cdevice.which = gamecontrollerlist->joystick->instance_id;
-            SDL_PushEvent(&event);
 
             /* Not really threadsafe.  Should this lock access within SDL_GameControllerEventWatcher? */
+            SDL_PrivateLockMappings(SDL_FALSE);
             SDL_PrivateLoadButtonMapping(&gamecontrollerlist->mapping, pControllerMapping->guid, pControllerMapping->name, pControllerMapping->mapping);
+            SDL_PrivateUnlockMappings();
+
+            /* Event watchers may look up mappings, so push this unlocked */
+            event.type = SDL_CONTROLLERDEVICEREMAPPED;
+            event.cdevice.which = gamecontrollerlist->joystick->instance_id;
+            SDL_PushEvent(&event);
         }
 
         gamecontrollerlist = gamecontrollerlist->next;
@@ -705,6 +736,7 @@ SDL_GameControllerAddMapping(const char *mappingString)
         return SDL_SetError("Couldn't parse %s", mappingString);
     }
 
+    SDL_PrivateLockMappings(SDL_TRUE);
     pControllerMapping = SDL_PrivateGetControllerMappingForGUID(&jGUID);
 
     if (pControllerMapping) {
@@ -713,12 +745,14 @@ SDL_GameControllerAddMapping(const char *mappingString)
         pControllerMapping->name = pchName;
         SDL_free(pControllerMapping->mapping);
         pControllerMapping->mapping = pchMapping;
+        SDL_PrivateUnlockMappings();
         /* refresh open controllers */
         SDL_PrivateGameControllerRefreshMapping(pControllerMapping);
         return 0;
     } else {
         pControllerMapping = SDL_malloc(sizeof(*pControllerMapping));
         if (!pControllerMapping) {
+            SDL_PrivateUnlockMappings();
             SDL_free(pchName);
             SDL_free(pchMapping);
             return SDL_OutOfMemory();
@@ -734,6 +768,7 @@ SDL_GameControllerAddMapping(const char *mappingString)
         pControllerMapping->mapping = pchMapping;
         pControllerMapping->next = s_pSupportedControllers;
         s_pSupportedControllers = pControllerMapping;
+        SDL_PrivateUnlockMappings();
         return 1;
     }
 }
@@ -745,7 +780,10 @@ char *
 SDL_GameControllerMappingForGUID(SDL_JoystickGUID guid)
 {
     char *pMappingString = NULL;
-    ControllerMapping_t *mapping = SDL_PrivateGetControllerMappingForGUID(&guid);
+    ControllerMapping_t *mapping;
+
+    SDL_PrivateLockMappings(SDL_FALSE);
+    mapping = SDL_PrivateGetControllerMappingForGUID(&guid);
     if (mapping) {
         char pchGUID[33];
         size_t needed;
@@ -754,11 +792,13 @@ SDL_GameControllerMappingForGUID(SDL_JoystickGUID guid)
         needed = SDL_strlen(pchGUID) + 1 + SDL_strlen(mapping->name) + 1 + SDL_strlen(mapping->mapping) + 1;
         pMappingString = SDL_malloc(needed);
         if (!pMappingString) {
+            SDL_PrivateUnlockMappings();
             SDL_OutOfMemory();
             return NULL;
         }
         SDL_snprintf(pMappingString, needed, "%s,%s,%s", pchGUID, mapping->name, mapping->mapping);
     }
+    SDL_PrivateUnlockMappings();
     return pMappingString;
 }
 
@@ -813,6 +853,7 @@ SDL_GameControllerInit(void)
     int i = 0;
     const char *pMappingString = NULL;
     s_pSupportedControllers = NULL;
+    s_pMappingsLock = SDL_CreateRWLock();
     pMappingString = s_ControllerMappings[i];
     while (pMappingString) {
         SDL_GameControllerAddMapping(pMappingString);
@@ -847,11 +888,17 @@ SDL_GameControllerInit(void)
 const char *
 SDL_GameControllerNameForIndex(int device_index)
 {
-    ControllerMapping_t *pSupportedController =  SDL_PrivateGetControllerMapping(device_index);
+    ControllerMapping_t *pSupportedController;
+    const char *name = NULL;
+
+    SDL_PrivateLockMappings(SDL_FALSE);
+    pSupportedController = SDL_PrivateGetControllerMapping(device_index);
     if (pSupportedController) {
-        return pSupportedController->name;
+        name = pSupportedController->name;
     }
-    return NULL;
+    /* The name is freed when the mapping is replaced, see the header */
+    SDL_PrivateUnlockMappings();
+    return name;
 }
 
 
@@ -861,12 +908,13 @@ SDL_GameControllerNameForIndex(int device_index)
 SDL_bool
 SDL_IsGameController(int device_index)
 {
-    ControllerMapping_t *pSupportedController =  SDL_PrivateGetControllerMapping(device_index);
-    if (pSupportedController) {
-        return SDL_TRUE;
-    }
+    ControllerMapping_t *pSupportedController;
+
+    SDL_PrivateLockMappings(SDL_FALSE);
+    pSupportedController = SDL_PrivateGetControllerMapping(device_index);
+    SDL_PrivateUnlockMappings();
 
-    return SDL_FALSE;
+    return pSupportedController ? SDL_TRUE : SDL_FALSE;
 }
 
 /*
@@ -899,13 +947,6 @@ SDL_GameControllerOpen(int device_index)
         gamecontrollerlist = gamecontrollerlist->next;
     }
 
-    /* Find a controller mapping */
-    pSupportedController =  SDL_PrivateGetControllerMapping(device_index);
-    if (!pSupportedController) {
-        SDL_SetError("Couldn't find mapping for device (%d)", device_index);
-        return (NULL);
-    }
-
     /* Create and initialize the joystick */
     gamecontroller = (SDL_GameController *) SDL_malloc((sizeof *gamecontroller));
     if (gamecontroller == NULL) {
@@ -913,15 +954,26 @@ SDL_GameControllerOpen(int device_index)
         return NULL;
     }
 
+    /* Find a controller mapping */
+    SDL_PrivateLockMappings(SDL_FALSE);
+    pSupportedController =  SDL_PrivateGetControllerMapping(device_index);
+    if (!pSupportedController) {
+        SDL_PrivateUnlockMappings();
+        SDL_free(gamecontroller);
+        SDL_SetError("Couldn't find mapping for device (%d)", device_index);
+        return (NULL);
+    }
+
     SDL_memset(gamecontroller, 0, (sizeof *gamecontroller));
+    SDL_PrivateLoadButtonMapping(&gamecontroller->mapping, pSupportedController->guid, pSupportedController->name, pSupportedController->mapping);
+    SDL_PrivateUnlockMappings();
+
     gamecontroller->joystick = SDL_JoystickOpen(device_index);
     if (!gamecontroller->joystick) {
         SDL_free(gamecontroller);
         return NULL;
     }
 
-    SDL_PrivateLoadButtonMapping(&gamecontroller->mapping, pSupportedController->guid, pSupportedController->name, pSupportedController->mapping);
-
     /* Add joystick to list */
     ++gamecontroller->ref_count;
     /* Link the joystick in the list */
@@ -1137,6 +1189,7 @@ SDL_GameControllerQuit(void)
         SDL_GameControllerClose(SDL_gamecontrollers);
     }
 
+    SDL_PrivateLockMappings(SDL_TRUE);
     while (s_pSupportedControllers) {
         pControllerMap = s_pSupportedControllers;
         s_pSupportedControllers = s_pSupportedControllers->next;
@@ -1144,6 +1197,12 @@ SDL_GameControllerQuit(void)
         SDL_free(pControllerMap->mapping);
         SDL_free(pControllerMap);
     }
+    s_pXInputMapping = NULL;
+    s_pEmscriptenMapping = NULL;
+    SDL_PrivateUnlockMappings();
+
+    SDL_DestroyRWLock(s_pMappingsLock);
+    s_pMappingsLock = NULL;
 
     SDL_DelEventWatch(SDL_GameControllerEventWatcher, NULL);
 
@@ -0,0 +1,406 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2014 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+/* Texture atlases: many small images packed into a few big textures */
+
+#include "SDL_assert.h"
+#include "SDL_render.h"
+
+/* The size of the pages when the application leaves it to us */
+#define ATLAS_PAGE_SIZE 1024
+
+/* The gap to the right of and below each image, kept transparent so that
+   linear filtering at the edges of an image doesn't pick up its neighbors */
+#define ATLAS_PADDING   1
+
+/* A stretch of the top edge of the images packed into a page so far.  The
+   segments of a page go left to right and cover its whole width. */
+typedef struct
+{
+    int x, y, w;
+} SDL_AtlasSegment;
+
+typedef struct
+{
+    SDL_Texture *texture;
+    int w, h;
+    SDL_AtlasSegment *skyline;
+    int num_segments;
+} SDL_AtlasPage;
+
+typedef struct
+{
+    int page;
+    SDL_Rect rect;
+} SDL_AtlasImage;
+
+struct SDL_TextureAtlas
+{
+    SDL_Renderer *renderer;
+    Uint32 format;
+    int page_w, page_h;
+
+    SDL_AtlasPage *pages;
+    int num_pages;
+
+    SDL_AtlasImage *images;
+    int num_images;
+    int max_images;
+};
+
+/* Find the lowest place a w x h rectangle fits on the skyline of a page,
+   preferring the narrowest segment to start on among equally low places.
+   Returns the segment it would start on, or -1 if it doesn't fit. */
+static int
+FindSkylinePosition(const SDL_AtlasPage * page, int w, int h, int *y)
+{
+    const SDL_AtlasSegment *skyline = page->skyline;
+    int best = -1;
+    int best_bottom = 0;
+    int i, j;
+
+    for (i = 0; i < page->num_segments; ++i) {
+        int top = 0;
+        int width = 0;
+
+        if (skyline[i].x + w > page->w) {
+            break;  /* Every later segment is further right */
+        }
+
+        /* It rests on the highest segment under it */
+        for (j = i; width < w; ++j) {
+            top = SDL_max(top, skyline[j].y);
+            width += skyline[j].w;
+        }
+        if (top + h > page->h) {
+            continue;
+        }
+        if (best < 0 || top + h < best_bottom ||
+            (top + h == best_bottom && skyline[i].w < skyline[best].w)) {
+            best = i;
+            best_bottom = top + h;
+            *y = top;
+        }
+    }
+    return best;
+}
+
+/* Raise the skyline over a rectangle placed at segment i */
+static void
+AddSkylineSegment(SDL_AtlasPage * page, int i, int y, int w, int h)
+{
+    SDL_AtlasSegment *skyline = page->skyline;
+    int right;
+
+    SDL_memmove(&skyline[i + 1], &skyline[i], (page->num_segments - i) * sizeof(*skyline));
+    ++page->num_segments;
+    skyline[i].y = y + h;
+    skyline[i].w = w;
+
+    /* Cut off what the new segment covers from the ones after it */
+    right = skyline[i].x + w;
+    while (i + 1 < page->num_segments && skyline[i + 1].x < right) {
+        SDL_AtlasSegment *next = &skyline[i + 1];
+        const int covered = right - next->x;
+
+        if (covered < next->w) {
+            next->x += covered;
+            next->w -= covered;
+            break;
+        }
+        --page->num_segments;
+        SDL_memmove(next, next + 1, (page->num_segments - (i + 1)) * sizeof(*skyline));
+    }
+
+    /* Join neighbors at the same height */
+    for (i = 0; i + 1 < page->num_segments; ) {
+        if (skyline[i].y == skyline[i + 1].y) {
+            skyline[i].w += skyline[i + 1].w;
+            --page->num_segments;
+            SDL_memmove(&skyline[i + 1], &skyline[i + 2], (page->num_segments - (i + 1)) * sizeof(*skyline));
+        } else {
+            ++i;
+        }
+    }
+}
+
+/* Add an empty page of the given size */
+static SDL_AtlasPage *
+AddAtlasPage(SDL_TextureAtlas * atlas, int w, int h)
+{
+    SDL_AtlasPage *pages;
+    SDL_AtlasPage *page;
+    void *pixels;
+    const int pitch = w * SDL_BYTESPERPIXEL(atlas->format);
+
+    pages = (SDL_AtlasPage *) SDL_realloc(atlas->pages, (atlas->num_pages + 1) * sizeof(*pages));
+    if (!pages) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    atlas->pages = pages;
+    page = &pages[atlas->num_pages];
+
+    page->w = w;
+    page->h = h;
+    page->num_segments = 1;
+    page->skyline = (SDL_AtlasSegment *) SDL_malloc((w + 1) * sizeof(*page->skyline));
+    if (!page->skyline) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    page->skyline[0].x = 0;
+    page->skyline[0].y = 0;
+    page->skyline[0].w = w;
+
+    page->texture = SDL_CreateTexture(atlas->renderer, atlas->format,
+                                      SDL_TEXTUREACCESS_STATIC, w, h);
+    if (!page->texture) {
+        SDL_free(page->skyline);
+        return NULL;
+    }
+    SDL_SetTextureBlendMode(page->texture, SDL_BLENDMODE_BLEND);
+
+    /* The padding and any space left over must be transparent */
+    pixels = SDL_calloc(h, pitch);
+    if (!pixels) {
+        SDL_DestroyTexture(page->texture);
+        SDL_free(page->skyline);
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    SDL_UpdateTexture(page->texture, NULL, pixels, pitch);
+    SDL_free(pixels);
+
+    ++atlas->num_pages;
+    return page;
+}
+
+SDL_TextureAtlas *
+SDL_CreateTextureAtlas(SDL_Renderer * renderer, Uint32 format, int w, int h)
+{
+    SDL_RendererInfo info;
+    SDL_TextureAtlas *atlas;
+    Uint32 i;
+
+    if (SDL_GetRendererInfo(renderer, &info) < 0) {
+        return NULL;
+    }
+    if (w < 0 || h < 0) {
+        SDL_InvalidParamError(w < 0 ? "w" : "h");
+        return NULL;
+    }
+
+    if (!format) {
+        format = info.texture_formats[0];
+        for (i = 0; i < info.num_texture_formats; ++i) {
+            if (!SDL_ISPIXELFORMAT_FOURCC(info.texture_formats[i]) &&
+                SDL_ISPIXELFORMAT_ALPHA(info.texture_formats[i])) {
+                format = info.texture_formats[i];
+                break;
+            }
+        }
+    }
+    if (SDL_ISPIXELFORMAT_FOURCC(format) || SDL_ISPIXELFORMAT_INDEXED(format)) {
+        SDL_SetError("Texture atlases need a packed pixel format");
+        return NULL;
+    }
+
+    if (!w) {
+        w = info.max_texture_width ? SDL_min(info.max_texture_width, ATLAS_PAGE_SIZE) : ATLAS_PAGE_SIZE;
+    }
+    if (!h) {
+        h = info.max_texture_height ? SDL_min(info.max_texture_height, ATLAS_PAGE_SIZE) : ATLAS_PAGE_SIZE;
+    }
+
+    atlas = (SDL_TextureAtlas *) SDL_calloc(1, sizeof(*atlas));
+    if (!atlas) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    atlas->renderer = renderer;
+    atlas->format = format;
+    atlas->page_w = w;
+    atlas->page_h = h;
+    return atlas;
+}
+
+int
+SDL_AddAtlasImage(SDL_TextureAtlas * atlas, SDL_Surface * surface)
+{
+    SDL_Surface *converted = NULL;
+    SDL_AtlasPage *page = NULL;
+    SDL_AtlasImage *image;
+    int w, h, i, segment, y;
+    int status;
+
+    if (!atlas) {
+        return SDL_InvalidParamError("atlas");
+    }
+    if (!surface) {
+        return SDL_InvalidParamError("surface");
+    }
+
+    if (atlas->num_images == atlas->max_images) {
+        const int max_images = atlas->max_images ? 2 * atlas->max_images : 64;
+        SDL_AtlasImage *images = (SDL_AtlasImage *) SDL_realloc(atlas->images, max_images * sizeof(*images));
+
+        if (!images) {
+            return SDL_OutOfMemory();
+        }
+        atlas->images = images;
+        atlas->max_images = max_images;
+    }
+
+    /* Find the first page with room, or start a new one */
+    w = surface->w + ATLAS_PADDING;
+    h = surface->h + ATLAS_PADDING;
+    segment = -1;
+    for (i = 0; i < atlas->num_pages; ++i) {
+        segment = FindSkylinePosition(&atlas->pages[i], w, h, &y);
+        if (segment >= 0) {
+            page = &atlas->pages[i];
+            break;
+        }
+    }
+    if (!page) {
+        if (w > atlas->page_w || h > atlas->page_h) {
+            /* Too big to share a page, it gets one of its own */
+            page = AddAtlasPage(atlas, SDL_max(surface->w, 1), SDL_max(surface->h, 1));
+            w = page ? page->w : 0;
+            h = page ? page->h : 0;
+        } else {
+            page = AddAtlasPage(atlas, atlas->page_w, atlas->page_h);
+        }
+        if (!page) {
+            return -1;
+        }
+        segment = FindSkylinePosition(page, w, h, &y);
+        SDL_assert(segment == 0);
+    }
+
+    image = &atlas->images[atlas->num_images];
+    image->page = (int) (page - atlas->pages);
+    image->rect.x = page->skyline[segment].x;
+    image->rect.y = y;
+    image->rect.w = surface->w;
+    image->rect.h = surface->h;
+
+    if (surface->format->format != atlas->format) {
+        converted = SDL_ConvertSurfaceFormat(surface, atlas->format, 0);
+        if (!converted) {
+            return -1;
+        }
+        surface = converted;
+    }
+    if (image->rect.w > 0 && image->rect.h > 0) {
+        if (SDL_MUSTLOCK(surface)) {
+            SDL_LockSurface(surface);
+            status = SDL_UpdateTexture(page->texture, &image->rect, surface->pixels, surface->pitch);
+            SDL_UnlockSurface(surface);
+        } else {
+            status = SDL_UpdateTexture(page->texture, &image->rect, surface->pixels, surface->pitch);
+        }
+    } else {
+        status = 0;
+    }
+    SDL_FreeSurface(converted);
+    if (status < 0) {
+        return -1;
+    }
+
+    AddSkylineSegment(page, segment, y, w, h);
+    return atlas->num_images++;
+}
+
+int
+SDL_QueryAtlasImage(SDL_TextureAtlas * atlas, int image,
+                    SDL_Texture ** texture, SDL_Rect * rect)
+{
+    if (!atlas) {
+        return SDL_InvalidParamError("atlas");
+    }
+    if (image < 0 || image >= atlas->num_images) {
+        return SDL_InvalidParamError("image");
+    }
+
+    if (texture) {
+        *texture = atlas->pages[atlas->images[image].page].texture;
+    }
+    if (rect) {
+        *rect = atlas->images[image].rect;
+    }
+    return 0;
+}
+
+int
+SDL_RenderCopyAtlas(SDL_Renderer * renderer, SDL_TextureAtlas * atlas,
+                    int image, const SDL_Rect * srcrect,
+                    const SDL_Rect * dstrect)
+{
+    const SDL_AtlasImage *entry;
+    SDL_Rect real_srcrect;
+
+    if (!atlas) {
+        return SDL_InvalidParamError("atlas");
+    }
+    if (image < 0 || image >= atlas->num_images) {
+        return SDL_InvalidParamError("image");
+    }
+    if (renderer != atlas->renderer) {
+        return SDL_SetError("Texture atlas was not created with this renderer");
+    }
+
+    /* The source rectangle is relative to the image, and stays inside it */
+    entry = &atlas->images[image];
+    real_srcrect = entry->rect;
+    if (srcrect) {
+        SDL_Rect rect = *srcrect;
+
+        rect.x += entry->rect.x;
+        rect.y += entry->rect.y;
+        if (!SDL_IntersectRect(&rect, &entry->rect, &real_srcrect)) {
+            return 0;
+        }
+    }
+    return SDL_RenderCopy(renderer, atlas->pages[entry->page].texture,
+                          &real_srcrect, dstrect);
+}
+
+void
+SDL_DestroyTextureAtlas(SDL_TextureAtlas * atlas)
+{
+    int i;
+
+    if (!atlas) {
+        return;
+    }
+    for (i = 0; i < atlas->num_pages; ++i) {
+        SDL_DestroyTexture(atlas->pages[i].texture);
+        SDL_free(atlas->pages[i].skyline);
+    }
+    SDL_free(atlas->pages);
+    SDL_free(atlas->images);
+    SDL_free(atlas);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -77,6 +77,476 @@ static char texture_magic;
 
 static int UpdateLogicalSize(SDL_Renderer *renderer);
 
+/* Drawing is recorded as a list of commands plus one buffer of vertex data,
+   and handed to the renderer's RunCommandQueue() in one go.  Consecutive
+   draws of the same kind with the same state are merged into one command,
+   so a backend sees a whole run of copies from one texture at once.
+   Renderers without RunCommandQueue() are still called for every draw.
+ */
+static int
+FlushRenderCommands(SDL_Renderer *renderer)
+{
+    int retval = 0;
+
+    SDL_assert((renderer->render_commands == NULL) == (renderer->render_commands_tail == NULL));
+
+    if (renderer->render_commands) {
+        retval = renderer->RunCommandQueue(renderer, renderer->render_commands,
+                                           renderer->vertex_data,
+                                           renderer->vertex_data_used);
+
+        /* Keep the commands around for the next frame */
+        renderer->render_commands_tail->next = renderer->render_commands_pool;
+        renderer->render_commands_pool = renderer->render_commands;
+        renderer->render_commands = NULL;
+        renderer->render_commands_tail = NULL;
+        renderer->vertex_data_used = 0;
+        renderer->render_command_generation++;
+    }
+
+    /* The next batch starts by setting the complete state again */
+    renderer->viewport_queued = SDL_FALSE;
+    renderer->cliprect_queued = SDL_FALSE;
+    return retval;
+}
+
+static int
+FlushRenderCommandsIfTextureNeeded(SDL_Texture *texture)
+{
+    SDL_Renderer *renderer = texture->renderer;
+
+    if (texture->last_command_generation == renderer->render_command_generation) {
+        /* Queued commands use this texture, draw them before it changes */
+        return FlushRenderCommands(renderer);
+    }
+    return 0;
+}
+
+SDL_FORCE_INLINE int
+FlushRenderCommandsIfNotBatching(SDL_Renderer *renderer)
+{
+    return renderer->batching ? 0 : FlushRenderCommands(renderer);
+}
+
+void *
+SDL_AllocateRenderVertices(SDL_Renderer *renderer, size_t numbytes)
+{
+    const size_t needed = renderer->vertex_data_used + numbytes;
+    void *retval;
+
+    if (needed > renderer->vertex_data_allocation) {
+        size_t newsize = renderer->vertex_data_allocation * 2;
+        void *ptr;
+
+        if (newsize == 0) {
+            newsize = 1024;
+        }
+        while (newsize < needed) {
+            newsize *= 2;
+        }
+        ptr = SDL_realloc(renderer->vertex_data, newsize);
+        if (!ptr) {
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        renderer->vertex_data = ptr;
+        renderer->vertex_data_allocation = newsize;
+    }
+
+    retval = ((Uint8 *) renderer->vertex_data) + renderer->vertex_data_used;
+    renderer->vertex_data_used = needed;
+    return retval;
+}
+
+static SDL_RenderCommand *
+AllocateRenderCommand(SDL_Renderer *renderer)
+{
+    SDL_RenderCommand *retval;
+
+    retval = renderer->render_commands_pool;
+    if (retval) {
+        renderer->render_commands_pool = retval->next;
+        retval->next = NULL;
+    } else {
+        retval = (SDL_RenderCommand *) SDL_calloc(1, sizeof(*retval));
+        if (!retval) {
+            SDL_OutOfMemory();
+            return NULL;
+        }
+    }
+
+    if (renderer->render_commands_tail) {
+        renderer->render_commands_tail->next = retval;
+    } else {
+        renderer->render_commands = retval;
+    }
+    renderer->render_commands_tail = retval;
+    return retval;
+}
+
+static int
+QueueCmdSetViewport(SDL_Renderer *renderer)
+{
+    SDL_RenderCommand *cmd;
+
+    if (renderer->viewport_queued &&
+        SDL_memcmp(&renderer->viewport, &renderer->last_queued_viewport, sizeof(SDL_Rect)) == 0) {
+        return 0;
+    }
+    cmd = AllocateRenderCommand(renderer);
+    if (!cmd) {
+        return -1;
+    }
+    cmd->command = SDL_RENDERCMD_SETVIEWPORT;
+    cmd->data.viewport.rect = renderer->viewport;
+    renderer->last_queued_viewport = renderer->viewport;
+    renderer->viewport_queued = SDL_TRUE;
+    return 0;
+}
+
+static int
+QueueCmdSetClipRect(SDL_Renderer *renderer)
+{
+    SDL_RenderCommand *cmd;
+
+    if (renderer->cliprect_queued &&
+        renderer->clipping_enabled == renderer->last_queued_cliprect_enabled &&
+        SDL_memcmp(&renderer->clip_rect, &renderer->last_queued_cliprect, sizeof(SDL_Rect)) == 0) {
+        return 0;
+    }
+    cmd = AllocateRenderCommand(renderer);
+    if (!cmd) {
+        return -1;
+    }
+    cmd->command = SDL_RENDERCMD_SETCLIPRECT;
+    cmd->data.cliprect.enabled = renderer->clipping_enabled;
+    cmd->data.cliprect.rect = renderer->clip_rect;
+    renderer->last_queued_cliprect_enabled = renderer->clipping_enabled;
+    renderer->last_queued_cliprect = renderer->clip_rect;
+    renderer->cliprect_queued = SDL_TRUE;
+    return 0;
+}
+
+static int
+UpdateViewport(SDL_Renderer *renderer)
+{
+    if (renderer->RunCommandQueue) {
+        /* This is queued along with the next draw */
+        return 0;
+    }
+    return renderer->UpdateViewport(renderer);
+}
+
+static int
+UpdateClipRect(SDL_Renderer *renderer)
+{
+    if (renderer->RunCommandQueue) {
+        /* This is queued along with the next draw */
+        return 0;
+    }
+    return renderer->UpdateClipRect(renderer);
+}
+
+static SDL_RenderCommand *
+PrepQueueCmdDraw(SDL_Renderer *renderer, SDL_RenderCommandType cmdtype,
+                 SDL_Texture *texture)
+{
+    SDL_RenderCommand *cmd;
+    Uint8 r, g, b, a;
+    SDL_BlendMode blend;
+
+    if (QueueCmdSetViewport(renderer) < 0 || QueueCmdSetClipRect(renderer) < 0) {
+        return NULL;
+    }
+
+    if (texture) {
+        r = texture->r;
+        g = texture->g;
+        b = texture->b;
+        a = texture->a;
+        blend = texture->blendMode;
+        texture->last_command_generation = renderer->render_command_generation;
+    } else {
+        r = renderer->r;
+        g = renderer->g;
+        b = renderer->b;
+        a = renderer->a;
+        blend = renderer->blendMode;
+    }
+
+    /* Line strips can't be joined, everything else is a list of primitives */
+    cmd = renderer->render_commands_tail;
+    if (cmd && cmd->command == cmdtype && cmdtype != SDL_RENDERCMD_DRAW_LINES &&
+        cmd->data.draw.texture == texture &&
+        cmd->data.draw.r == r && cmd->data.draw.g == g &&
+        cmd->data.draw.b == b && cmd->data.draw.a == a &&
+        cmd->data.draw.blend == blend) {
+        return cmd;
+    }
+
+    cmd = AllocateRenderCommand(renderer);
+    if (cmd) {
+        /* Start each command's vertex data suitably aligned for any type */
+        renderer->vertex_data_used = (renderer->vertex_data_used + 15) & ~15;
+
+        cmd->command = cmdtype;
+        cmd->data.draw.first = renderer->vertex_data_used;
+        cmd->data.draw.count = 0;
+        cmd->data.draw.r = r;
+        cmd->data.draw.g = g;
+        cmd->data.draw.b = b;
+        cmd->data.draw.a = a;
+        cmd->data.draw.blend = blend;
+        cmd->data.draw.texture = texture;
+    }
+    return cmd;
+}
+
+static int
+FinishQueueCmdDraw(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
+                   size_t vertex_data_used, int count, int status)
+{
+    if (status < 0) {
+        /* Drop whatever this call added */
+        renderer->vertex_data_used = vertex_data_used;
+        if (cmd->data.draw.count == 0) {
+            cmd->command = SDL_RENDERCMD_NO_OP;
+        }
+        return -1;
+    }
+    cmd->data.draw.count += count;
+    return FlushRenderCommandsIfNotBatching(renderer);
+}
+
+static int
+QueueCmdClear(SDL_Renderer *renderer)
+{
+    SDL_RenderCommand *cmd;
+
+    if (!renderer->RunCommandQueue) {
+        return renderer->RenderClear(renderer);
+    }
+
+    if (QueueCmdSetViewport(renderer) < 0 || QueueCmdSetClipRect(renderer) < 0) {
+        return -1;
+    }
+    cmd = AllocateRenderCommand(renderer);
+    if (!cmd) {
+        return -1;
+    }
+    cmd->command = SDL_RENDERCMD_CLEAR;
+    cmd->data.color.r = renderer->r;
+    cmd->data.color.g = renderer->g;
+    cmd->data.color.b = renderer->b;
+    cmd->data.color.a = renderer->a;
+    return FlushRenderCommandsIfNotBatching(renderer);
+}
+
+static int
+QueueCmdDrawPoints(SDL_Renderer *renderer, const SDL_FPoint * points, int count)
+{
+    SDL_RenderCommand *cmd;
+    size_t used;
+
+    if (!renderer->RunCommandQueue) {
+        return renderer->RenderDrawPoints(renderer, points, count);
+    }
+
+    cmd = PrepQueueCmdDraw(renderer, SDL_RENDERCMD_DRAW_POINTS, NULL);
+    if (!cmd) {
+        return -1;
+    }
+    used = renderer->vertex_data_used;
+    return FinishQueueCmdDraw(renderer, cmd, used, count,
+                              renderer->QueueDrawPoints(renderer, cmd, points, count));
+}
+
+static int
+QueueCmdDrawLines(SDL_Renderer *renderer, const SDL_FPoint * points, int count)
+{
+    SDL_RenderCommand *cmd;
+    size_t used;
+
+    if (!renderer->RunCommandQueue) {
+        return renderer->RenderDrawLines(renderer, points, count);
+    }
+
+    cmd = PrepQueueCmdDraw(renderer, SDL_RENDERCMD_DRAW_LINES, NULL);
+    if (!cmd) {
+        return -1;
+    }
+    used = renderer->vertex_data_used;
+    return FinishQueueCmdDraw(renderer, cmd, used, count,
+                              renderer->QueueDrawLines(renderer, cmd, points, count));
+}
+
+static int
+QueueCmdFillRects(SDL_Renderer *renderer, const SDL_FRect * rects, int count)
+{
+    SDL_RenderCommand *cmd;
+    size_t used;
+
+    if (!renderer->RunCommandQueue) {
+        return renderer->RenderFillRects(renderer, rects, count);
+    }
+
+    cmd = PrepQueueCmdDraw(renderer, SDL_RENDERCMD_FILL_RECTS, NULL);
+    if (!cmd) {
+        return -1;
+    }
+    used = renderer->vertex_data_used;
+    return FinishQueueCmdDraw(renderer, cmd, used, count,
+                              renderer->QueueFillRects(renderer, cmd, rects, count));
+}
+
+static int
+QueueCmdCopy(SDL_Renderer *renderer, SDL_Texture * texture,
+             const SDL_Rect * srcrect, const SDL_FRect * dstrect)
+{
+    SDL_RenderCommand *cmd;
+    size_t used;
+
+    if (!renderer->RunCommandQueue) {
+        return renderer->RenderCopy(renderer, texture, srcrect, dstrect);
+    }
+
+    cmd = PrepQueueCmdDraw(renderer, SDL_RENDERCMD_COPY, texture);
+    if (!cmd) {
+        return -1;
+    }
+    used = renderer->vertex_data_used;
+    return FinishQueueCmdDraw(renderer, cmd, used, 1,
+                              renderer->QueueCopy(renderer, cmd, texture, srcrect, dstrect));
+}
+
+static int
+QueueCmdCopyEx(SDL_Renderer *renderer, SDL_Texture * texture,
+               const SDL_Rect * srcrect, const SDL_FRect * dstrect,
+               const double angle, const SDL_FPoint *center, const SDL_RendererFlip flip)
+{
+    SDL_RenderCommand *cmd;
+    size_t used;
+
+    if (!renderer->RunCommandQueue) {
+        return renderer->RenderCopyEx(renderer, texture, srcrect, dstrect, angle, center, flip);
+    }
+
+    cmd = PrepQueueCmdDraw(renderer, SDL_RENDERCMD_COPY_EX, texture);
+    if (!cmd) {
+        return -1;
+    }
+    used = renderer->vertex_data_used;
+    return FinishQueueCmdDraw(renderer, cmd, used, 1,
+                              renderer->QueueCopyEx(renderer, cmd, texture, srcrect, dstrect, angle, center, flip));
+}
+
+static int
+SetTextureModulation(SDL_Renderer *renderer, SDL_Texture * texture,
+                     const SDL_Color *color)
+{
+    int status = 0;
+
+    if (texture->r != color->r || texture->g != color->g || texture->b != color->b) {
+        if (color->r < 255 || color->g < 255 || color->b < 255) {
+            texture->modMode |= SDL_TEXTUREMODULATE_COLOR;
+        } else {
+            texture->modMode &= ~SDL_TEXTUREMODULATE_COLOR;
+        }
+        texture->r = color->r;
+        texture->g = color->g;
+        texture->b = color->b;
+        if (renderer->SetTextureColorMod) {
+            status = renderer->SetTextureColorMod(renderer, texture);
+        }
+    }
+    if (texture->a != color->a) {
+        if (color->a < 255) {
+            texture->modMode |= SDL_TEXTUREMODULATE_ALPHA;
+        } else {
+            texture->modMode &= ~SDL_TEXTUREMODULATE_ALPHA;
+        }
+        texture->a = color->a;
+        if (renderer->SetTextureAlphaMod && status == 0) {
+            status = renderer->SetTextureAlphaMod(renderer, texture);
+        }
+    }
+    return status;
+}
+
+/* For renderers without QueueCopyBatch(), draw each copy on its own with
+   the texture modulation temporarily set to the copy's color */
+static int
+QueueCopyInstances(SDL_Renderer *renderer, SDL_Texture * texture,
+                   const SDL_RenderCopyInstance * instances, int count)
+{
+    SDL_Color saved;
+    int i, status = 0;
+
+    saved.r = texture->r;
+    saved.g = texture->g;
+    saved.b = texture->b;
+    saved.a = texture->a;
+
+    for (i = 0; i < count && status == 0; ++i) {
+        const SDL_RenderCopyInstance *instance = &instances[i];
+
+        status = SetTextureModulation(renderer, texture, &instance->color);
+        if (status < 0) {
+            break;
+        }
+        if (instance->angle == 0.0 && instance->flip == SDL_FLIP_NONE) {
+            status = QueueCmdCopy(renderer, texture, &instance->srcrect, &instance->dstrect);
+        } else if (!renderer->RenderCopyEx && !renderer->QueueCopyEx) {
+            status = SDL_SetError("Renderer does not support RenderCopyEx");
+        } else {
+            status = QueueCmdCopyEx(renderer, texture, &instance->srcrect, &instance->dstrect,
+                                    instance->angle, &instance->center, instance->flip);
+        }
+    }
+
+    if (SetTextureModulation(renderer, texture, &saved) < 0) {
+        status = -1;
+    }
+    return status;
+}
+
+static int
+QueueCmdCopyBatch(SDL_Renderer *renderer, SDL_Texture * texture,
+                  const SDL_RenderCopyInstance * instances, int count)
+{
+    SDL_RenderCommand *cmd;
+    size_t used;
+
+    if (!renderer->QueueCopyBatch) {
+        return QueueCopyInstances(renderer, texture, instances, count);
+    }
+
+    cmd = PrepQueueCmdDraw(renderer, SDL_RENDERCMD_COPY_BATCH, texture);
+    if (!cmd) {
+        return -1;
+    }
+    used = renderer->vertex_data_used;
+    return FinishQueueCmdDraw(renderer, cmd, used, count,
+                              renderer->QueueCopyBatch(renderer, cmd, texture, instances, count));
+}
+
+static int
+QueueCmdGeometry(SDL_Renderer *renderer, SDL_Texture * texture,
+                 const SDL_Vertex * vertices, const int * indices, int count)
+{
+    SDL_RenderCommand *cmd;
+    size_t used;
+
+    cmd = PrepQueueCmdDraw(renderer, SDL_RENDERCMD_GEOMETRY, texture);
+    if (!cmd) {
+        return -1;
+    }
+    used = renderer->vertex_data_used;
+    return FinishQueueCmdDraw(renderer, cmd, used, count,
+                              renderer->QueueGeometry(renderer, cmd, texture, vertices, indices, count,
+                                                      renderer->scale.x, renderer->scale.y));
+}
+
 int
 SDL_GetNumRenderDrivers(void)
 {
@@ -110,6 +580,10 @@ SDL_RendererEventWatch(void *userdata, SDL_Event *event)
     if (event->type == SDL_WINDOWEVENT) {
         SDL_Window *window = SDL_GetWindowFromID(event->window.windowID);
         if (window == renderer->window) {
+            if (event->window.event == SDL_WINDOWEVENT_SIZE_CHANGED) {
+                /* Finish drawing into the old output first */
+                FlushRenderCommands(renderer);
+            }
             if (renderer->WindowEvent) {
                 renderer->WindowEvent(renderer, &event->window);
             }
@@ -143,7 +617,7 @@ SDL_RendererEventWatch(void *userdata, SDL_Event *event)
                         renderer->viewport.y = 0;
                         renderer->viewport.w = w;
                         renderer->viewport.h = h;
-                        renderer->UpdateViewport(renderer);
+                        UpdateViewport(renderer);
                     }
                 }
 
@@ -219,6 +693,7 @@ SDL_CreateRenderer(SDL_Window * window, int index, Uint32 flags)
 #if !SDL_RENDER_DISABLED
     SDL_Renderer *renderer = NULL;
     int n = SDL_GetNumRenderDrivers();
+    SDL_bool batching = SDL_TRUE;
     const char *hint;
 
     if (!window) {
@@ -249,6 +724,8 @@ SDL_CreateRenderer(SDL_Window * window, int index, Uint32 flags)
                 if (SDL_strcasecmp(hint, driver->info.name) == 0) {
                     /* Create a new renderer instance */
                     renderer = driver->CreateRenderer(window, flags);
+                    /* The program may be mixing in calls to this API */
+                    batching = SDL_FALSE;
                     break;
                 }
             }
@@ -280,6 +757,7 @@ SDL_CreateRenderer(SDL_Window * window, int index, Uint32 flags)
         }
         /* Create a new renderer instance */
         renderer = render_drivers[index]->CreateRenderer(window, flags);
+        batching = SDL_FALSE;
     }
 
     if (renderer) {
@@ -288,6 +766,14 @@ SDL_CreateRenderer(SDL_Window * window, int index, Uint32 flags)
         renderer->scale.x = 1.0f;
         renderer->scale.y = 1.0f;
 
+        hint = SDL_GetHint(SDL_HINT_RENDER_BATCHING);
+        if (hint) {
+            batching = (*hint != '0') ? SDL_TRUE : SDL_FALSE;
+        }
+        renderer->batching = batching;
+        /* New textures start out at generation 0, never "in use" */
+        renderer->render_command_generation = 1;
+
         if (SDL_GetWindowFlags(window) & (SDL_WINDOW_HIDDEN|SDL_WINDOW_MINIMIZED)) {
             renderer->hidden = SDL_TRUE;
         } else {
@@ -319,10 +805,16 @@ SDL_CreateSoftwareRenderer(SDL_Surface * surface)
     renderer = SW_CreateRendererForSurface(surface);
 
     if (renderer) {
+        const char *hint = SDL_GetHint(SDL_HINT_RENDER_BATCHING);
+
         renderer->magic = &renderer_magic;
         renderer->scale.x = 1.0f;
         renderer->scale.y = 1.0f;
 
+        /* The program most likely looks at the surface after drawing */
+        renderer->batching = (hint && *hint != '0') ? SDL_TRUE : SDL_FALSE;
+        renderer->render_command_generation = 1;
+
         SDL_RenderSetViewport(renderer, NULL);
     }
     return renderer;
@@ -404,13 +896,13 @@ GetClosestSupportedFormat(SDL_Renderer * renderer, Uint32 format)
     return renderer->info.texture_formats[0];
 }
 
-SDL_Texture *
-SDL_CreateTexture(SDL_Renderer * renderer, Uint32 format, int access, int w, int h)
+/* Create a texture, with the pixels of surface if it isn't NULL */
+static SDL_Texture *
+CreateTexture(SDL_Renderer * renderer, Uint32 format, int access, int w, int h,
+              SDL_Surface * surface)
 {
     SDL_Texture *texture;
 
-    CHECK_RENDERER_MAGIC(renderer, NULL);
-
     if (!format) {
         format = renderer->info.texture_formats[0];
     }
@@ -445,6 +937,7 @@ SDL_CreateTexture(SDL_Renderer * renderer, Uint32 format, int access, int w, int
     texture->g = 255;
     texture->b = 255;
     texture->a = 255;
+    texture->buffers = 1;
     texture->renderer = renderer;
     texture->next = renderer->textures;
     if (renderer->textures) {
@@ -452,7 +945,13 @@ SDL_CreateTexture(SDL_Renderer * renderer, Uint32 format, int access, int w, int
     }
     renderer->textures = texture;
 
-    if (IsSupportedFormat(renderer, format)) {
+    if (surface) {
+        /* The callers made sure the renderer takes this format as is */
+        if (renderer->CreateTextureFromSurface(renderer, texture, surface) < 0) {
+            SDL_DestroyTexture(texture);
+            return NULL;
+        }
+    } else if (IsSupportedFormat(renderer, format)) {
         if (renderer->CreateTexture(renderer, texture) < 0) {
             SDL_DestroyTexture(texture);
             return 0;
@@ -498,6 +997,14 @@ SDL_CreateTexture(SDL_Renderer * renderer, Uint32 format, int access, int w, int
     return texture;
 }
 
+SDL_Texture *
+SDL_CreateTexture(SDL_Renderer * renderer, Uint32 format, int access, int w, int h)
+{
+    CHECK_RENDERER_MAGIC(renderer, NULL);
+
+    return CreateTexture(renderer, format, access, w, h, NULL);
+}
+
 SDL_Texture *
 SDL_CreateTextureFromSurface(SDL_Renderer * renderer, SDL_Surface * surface)
 {
@@ -530,39 +1037,54 @@ SDL_CreateTextureFromSurface(SDL_Renderer * renderer, SDL_Surface * surface)
         }
     }
 
-    texture = SDL_CreateTexture(renderer, format, SDL_TEXTUREACCESS_STATIC,
-                                surface->w, surface->h);
-    if (!texture) {
-        return NULL;
-    }
+    if (format != surface->format->format && renderer->CreateTextureFromSurface) {
+        /* Convert once, straight into the pixels the texture will use */
+        SDL_Surface *temp = SDL_ConvertSurfaceFormat(surface, format, 0);
 
-    if (format == surface->format->format) {
-        if (SDL_MUSTLOCK(surface)) {
-            SDL_LockSurface(surface);
-            SDL_UpdateTexture(texture, NULL, surface->pixels, surface->pitch);
-            SDL_UnlockSurface(surface);
-        } else {
-            SDL_UpdateTexture(texture, NULL, surface->pixels, surface->pitch);
+        if (!temp) {
+            return NULL;
+        }
+        texture = CreateTexture(renderer, format, SDL_TEXTUREACCESS_STATIC,
+                                temp->w, temp->h, temp);
+        SDL_FreeSurface(temp);
+        if (!texture) {
+            return NULL;
         }
     } else {
-        SDL_PixelFormat *dst_fmt;
-        SDL_Surface *temp = NULL;
-
-        /* Set up a destination surface for the texture update */
-        dst_fmt = SDL_AllocFormat(format);
-        if (!dst_fmt) {
-           SDL_DestroyTexture(texture);
-           return NULL;
-        }
-        temp = SDL_ConvertSurface(surface, dst_fmt, 0);
-        SDL_FreeFormat(dst_fmt);
-        if (temp) {
-            SDL_UpdateTexture(texture, NULL, temp->pixels, temp->pitch);
-            SDL_FreeSurface(temp);
-        } else {
-            SDL_DestroyTexture(texture);
+        texture = SDL_CreateTexture(renderer, format, SDL_TEXTUREACCESS_STATIC,
+                                    surface->w, surface->h);
+        if (!texture) {
             return NULL;
         }
+
+        if (format == surface->format->format) {
+            if (SDL_MUSTLOCK(surface)) {
+                SDL_LockSurface(surface);
+                SDL_UpdateTexture(texture, NULL, surface->pixels, surface->pitch);
+                SDL_UnlockSurface(surface);
+            } else {
+                SDL_UpdateTexture(texture, NULL, surface->pixels, surface->pitch);
+            }
+        } else {
+            SDL_PixelFormat *dst_fmt;
+            SDL_Surface *temp = NULL;
+
+            /* Set up a destination surface for the texture update */
+            dst_fmt = SDL_AllocFormat(format);
+            if (!dst_fmt) {
+               SDL_DestroyTexture(texture);
+               return NULL;
+            }
+            temp = SDL_ConvertSurface(surface, dst_fmt, 0);
+            SDL_FreeFormat(dst_fmt);
+            if (temp) {
+                SDL_UpdateTexture(texture, NULL, temp->pixels, temp->pitch);
+                SDL_FreeSurface(temp);
+            } else {
+                SDL_DestroyTexture(texture);
+                return NULL;
+            }
+        }
     }
 
     {
@@ -586,20 +1108,63 @@ SDL_CreateTextureFromSurface(SDL_Renderer * renderer, SDL_Surface * surface)
     return texture;
 }
 
-int
-SDL_QueryTexture(SDL_Texture * texture, Uint32 * format, int *access,
-                 int *w, int *h)
+SDL_Texture *
+SDL_CreateTextureWrappingSurface(SDL_Renderer * renderer, SDL_Surface * surface)
 {
-    CHECK_TEXTURE_MAGIC(texture, -1);
+    SDL_Texture *texture;
+    Uint8 r, g, b, a;
+    SDL_BlendMode blendMode;
 
-    if (format) {
-        *format = texture->format;
+    CHECK_RENDERER_MAGIC(renderer, NULL);
+
+    if (!surface) {
+        SDL_InvalidParamError("surface");
+        return NULL;
     }
-    if (access) {
-        *access = texture->access;
+    if (!renderer->CreateTextureFromSurface) {
+        SDL_Unsupported();
+        return NULL;
     }
-    if (w) {
-        *w = texture->w;
+    if (!IsSupportedFormat(renderer, surface->format->format)) {
+        SDL_SetError("The renderer can't use %s pixels directly",
+                     SDL_GetPixelFormatName(surface->format->format));
+        return NULL;
+    }
+    if (SDL_MUSTLOCK(surface)) {
+        SDL_SetError("The surface needs locking, its pixels can't be shared");
+        return NULL;
+    }
+
+    texture = CreateTexture(renderer, surface->format->format,
+                            SDL_TEXTUREACCESS_STREAMING,
+                            surface->w, surface->h, surface);
+    if (!texture) {
+        return NULL;
+    }
+
+    SDL_GetSurfaceColorMod(surface, &r, &g, &b);
+    SDL_SetTextureColorMod(texture, r, g, b);
+    SDL_GetSurfaceAlphaMod(surface, &a);
+    SDL_SetTextureAlphaMod(texture, a);
+    SDL_GetSurfaceBlendMode(surface, &blendMode);
+    SDL_SetTextureBlendMode(texture, blendMode);
+    return texture;
+}
+
+int
+SDL_QueryTexture(SDL_Texture * texture, Uint32 * format, int *access,
+                 int *w, int *h)
+{
+    CHECK_TEXTURE_MAGIC(texture, -1);
+
+    if (format) {
+        *format = texture->format;
+    }
+    if (access) {
+        *access = texture->access;
+    }
+    if (w) {
+        *w = texture->w;
     }
     if (h) {
         *h = texture->h;
@@ -826,6 +1391,9 @@ SDL_UpdateTexture(SDL_Texture * texture, const SDL_Rect * rect,
         return SDL_UpdateTextureNative(texture, rect, pixels, pitch);
     } else {
         renderer = texture->renderer;
+        if (FlushRenderCommandsIfTextureNeeded(texture) < 0) {
+            return -1;
+        }
         return renderer->UpdateTexture(renderer, texture, rect, pixels, pitch);
     }
 }
@@ -927,6 +1495,9 @@ int SDL_UpdateYUVTexture(SDL_Texture * texture, const SDL_Rect * rect,
         renderer = texture->renderer;
         SDL_assert(renderer->UpdateTextureYUV);
         if (renderer->UpdateTextureYUV) {
+            if (FlushRenderCommandsIfTextureNeeded(texture) < 0) {
+                return -1;
+            }
             return renderer->UpdateTextureYUV(renderer, texture, rect, Yplane, Ypitch, Uplane, Upitch, Vplane, Vpitch);
         } else {
             return SDL_Unsupported();
@@ -945,7 +1516,6 @@ static int
 SDL_LockTextureNative(SDL_Texture * texture, const SDL_Rect * rect,
                       void **pixels, int *pitch)
 {
-    texture->locked_rect = *rect;
     *pixels = (void *) ((Uint8 *) texture->pixels +
                         rect->y * texture->pitch +
                         rect->x * SDL_BYTESPERPIXEL(texture->format));
@@ -953,25 +1523,41 @@ SDL_LockTextureNative(SDL_Texture * texture, const SDL_Rect * rect,
     return 0;
 }
 
-int
-SDL_LockTexture(SDL_Texture * texture, const SDL_Rect * rect,
-                void **pixels, int *pitch)
+static int
+LockTexture(SDL_Texture * texture, const SDL_Rect * rects, int numrects,
+            void **pixels, int *pitch)
 {
     SDL_Renderer *renderer;
-    SDL_Rect full_rect;
-
-    CHECK_TEXTURE_MAGIC(texture, -1);
+    const SDL_Rect *rect = &texture->locked_rect;
+    int i;
 
     if (texture->access != SDL_TEXTUREACCESS_STREAMING) {
         return SDL_SetError("SDL_LockTexture(): texture must be streaming");
     }
 
-    if (!rect) {
-        full_rect.x = 0;
-        full_rect.y = 0;
-        full_rect.w = texture->w;
-        full_rect.h = texture->h;
-        rect = &full_rect;
+    /* The areas are converted and uploaded one by one when unlocking */
+    for (i = 0; i < numrects; ++i) {
+        if (rects[i].x < 0 || rects[i].y < 0 || rects[i].w < 0 || rects[i].h < 0 ||
+            rects[i].w > texture->w - rects[i].x || rects[i].h > texture->h - rects[i].y) {
+            return SDL_SetError("SDL_LockTexture(): rect is outside the texture");
+        }
+    }
+
+    /* Remember the areas, to upload just those when unlocking */
+    if (numrects > texture->max_locked_rects) {
+        SDL_Rect *locked_rects = (SDL_Rect *) SDL_realloc(texture->locked_rects, numrects * sizeof(*rects));
+        if (!locked_rects) {
+            return SDL_OutOfMemory();
+        }
+        texture->locked_rects = locked_rects;
+        texture->max_locked_rects = numrects;
+    }
+    SDL_memcpy(texture->locked_rects, rects, numrects * sizeof(*rects));
+    texture->num_locked_rects = numrects;
+
+    texture->locked_rect = rects[0];
+    for (i = 1; i < numrects; ++i) {
+        SDL_UnionRect(&texture->locked_rect, &rects[i], &texture->locked_rect);
     }
 
     if (texture->yuv) {
@@ -980,10 +1566,44 @@ SDL_LockTexture(SDL_Texture * texture, const SDL_Rect * rect,
         return SDL_LockTextureNative(texture, rect, pixels, pitch);
     } else {
         renderer = texture->renderer;
+        /* With more buffers, the one locked isn't used by queued commands */
+        if (texture->buffers == 1 && FlushRenderCommandsIfTextureNeeded(texture) < 0) {
+            return -1;
+        }
         return renderer->LockTexture(renderer, texture, rect, pixels, pitch);
     }
 }
 
+int
+SDL_LockTexture(SDL_Texture * texture, const SDL_Rect * rect,
+                void **pixels, int *pitch)
+{
+    SDL_Rect full_rect;
+
+    CHECK_TEXTURE_MAGIC(texture, -1);
+
+    if (!rect) {
+        full_rect.x = 0;
+        full_rect.y = 0;
+        full_rect.w = texture->w;
+        full_rect.h = texture->h;
+        rect = &full_rect;
+    }
+    return LockTexture(texture, rect, 1, pixels, pitch);
+}
+
+int
+SDL_LockTextureRects(SDL_Texture * texture, const SDL_Rect * rects,
+                     int numrects, void **pixels, int *pitch)
+{
+    CHECK_TEXTURE_MAGIC(texture, -1);
+
+    if (!rects || numrects < 1) {
+        return SDL_InvalidParamError("rects");
+    }
+    return LockTexture(texture, rects, numrects, pixels, pitch);
+}
+
 static void
 SDL_UnlockTextureYUV(SDL_Texture * texture)
 {
@@ -1011,18 +1631,26 @@ SDL_UnlockTextureNative(SDL_Texture * texture)
     SDL_Texture *native = texture->native;
     void *native_pixels = NULL;
     int native_pitch = 0;
-    const SDL_Rect *rect = &texture->locked_rect;
-    const void* pixels = (void *) ((Uint8 *) texture->pixels +
-                        rect->y * texture->pitch +
-                        rect->x * SDL_BYTESPERPIXEL(texture->format));
-    int pitch = texture->pitch;
+    const SDL_Rect *bounds = &texture->locked_rect;
+    int i;
 
-    if (SDL_LockTexture(native, rect, &native_pixels, &native_pitch) < 0) {
+    if (SDL_LockTextureRects(native, texture->locked_rects, texture->num_locked_rects,
+                             &native_pixels, &native_pitch) < 0) {
         return;
     }
-    SDL_ConvertPixels(rect->w, rect->h,
-                      texture->format, pixels, pitch,
-                      native->format, native_pixels, native_pitch);
+    for (i = 0; i < texture->num_locked_rects; ++i) {
+        const SDL_Rect *rect = &texture->locked_rects[i];
+        const void *pixels = (void *) ((Uint8 *) texture->pixels +
+                            rect->y * texture->pitch +
+                            rect->x * SDL_BYTESPERPIXEL(texture->format));
+        void *dst = (void *) ((Uint8 *) native_pixels +
+                            (rect->y - bounds->y) * native_pitch +
+                            (rect->x - bounds->x) * SDL_BYTESPERPIXEL(native->format));
+
+        SDL_ConvertPixels(rect->w, rect->h,
+                          texture->format, pixels, texture->pitch,
+                          native->format, dst, native_pitch);
+    }
     SDL_UnlockTexture(native);
 }
 
@@ -1042,10 +1670,51 @@ SDL_UnlockTexture(SDL_Texture * texture)
         SDL_UnlockTextureNative(texture);
     } else {
         renderer = texture->renderer;
+        if (texture->buffers > 1) {
+            /* Queued commands draw the buffer shown before this one */
+            FlushRenderCommandsIfTextureNeeded(texture);
+        }
         renderer->UnlockTexture(renderer, texture);
     }
 }
 
+int
+SDL_SetTextureBuffers(SDL_Texture * texture, int buffers)
+{
+    SDL_Renderer *renderer;
+
+    CHECK_TEXTURE_MAGIC(texture, -1);
+
+    if (texture->access != SDL_TEXTUREACCESS_STREAMING) {
+        return SDL_SetError("SDL_SetTextureBuffers(): texture must be streaming");
+    }
+    if (buffers < 1) {
+        return SDL_InvalidParamError("buffers");
+    }
+    if (buffers == texture->buffers) {
+        return 0;
+    }
+
+    if (texture->native) {
+        if (SDL_SetTextureBuffers(texture->native, buffers) < 0) {
+            return -1;
+        }
+    } else {
+        renderer = texture->renderer;
+        if (!renderer->SetTextureBuffers) {
+            return SDL_Unsupported();
+        }
+        if (FlushRenderCommandsIfTextureNeeded(texture) < 0) {
+            return -1;
+        }
+        if (renderer->SetTextureBuffers(renderer, texture, buffers) < 0) {
+            return -1;
+        }
+    }
+    texture->buffers = buffers;
+    return 0;
+}
+
 SDL_bool
 SDL_RenderTargetSupported(SDL_Renderer *renderer)
 {
@@ -1081,6 +1750,11 @@ SDL_SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture)
         }
     }
 
+    /* Everything queued so far goes to the old target */
+    if (FlushRenderCommands(renderer) < 0) {
+        return -1;
+    }
+
     if (texture && !renderer->target) {
         /* Make a backup of the viewport */
         renderer->viewport_backup = renderer->viewport;
@@ -1113,10 +1787,10 @@ SDL_SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture)
         renderer->logical_w = renderer->logical_w_backup;
         renderer->logical_h = renderer->logical_h_backup;
     }
-    if (renderer->UpdateViewport(renderer) < 0) {
+    if (UpdateViewport(renderer) < 0) {
         return -1;
     }
-    if (renderer->UpdateClipRect(renderer) < 0) {
+    if (UpdateClipRect(renderer) < 0) {
         return -1;
     }
 
@@ -1227,7 +1901,7 @@ SDL_RenderSetViewport(SDL_Renderer * renderer, const SDL_Rect * rect)
             return -1;
         }
     }
-    return renderer->UpdateViewport(renderer);
+    return UpdateViewport(renderer);
 }
 
 void
@@ -1258,7 +1932,7 @@ SDL_RenderSetClipRect(SDL_Renderer * renderer, const SDL_Rect * rect)
         renderer->clipping_enabled = SDL_FALSE;
         SDL_zero(renderer->clip_rect);
     }
-    return renderer->UpdateClipRect(renderer);
+    return UpdateClipRect(renderer);
 }
 
 void
@@ -1365,7 +2039,7 @@ SDL_RenderClear(SDL_Renderer * renderer)
     if (renderer->hidden) {
         return 0;
     }
-    return renderer->RenderClear(renderer);
+    return QueueCmdClear(renderer);
 }
 
 int
@@ -1397,7 +2071,7 @@ RenderDrawPointsWithRects(SDL_Renderer * renderer,
         frects[i].h = renderer->scale.y;
     }
 
-    status = renderer->RenderFillRects(renderer, frects, count);
+    status = QueueCmdFillRects(renderer, frects, count);
 
     SDL_stack_free(frects);
 
@@ -1438,13 +2112,74 @@ SDL_RenderDrawPoints(SDL_Renderer * renderer,
         fpoints[i].y = points[i].y * renderer->scale.y;
     }
 
-    status = renderer->RenderDrawPoints(renderer, fpoints, count);
+    status = QueueCmdDrawPoints(renderer, fpoints, count);
 
     SDL_stack_free(fpoints);
 
     return status;
 }
 
+int
+SDL_RenderDrawPointF(SDL_Renderer * renderer, float x, float y)
+{
+    SDL_FPoint fpoint;
+
+    fpoint.x = x;
+    fpoint.y = y;
+    return SDL_RenderDrawPointsF(renderer, &fpoint, 1);
+}
+
+static int
+RenderDrawPointsWithRectsF(SDL_Renderer * renderer,
+                           const SDL_FPoint * fpoints, int count)
+{
+    SDL_FRect *frects;
+    int i;
+    int status;
+
+    frects = SDL_stack_alloc(SDL_FRect, count);
+    if (!frects) {
+        return SDL_OutOfMemory();
+    }
+    for (i = 0; i < count; ++i) {
+        frects[i].x = fpoints[i].x * renderer->scale.x;
+        frects[i].y = fpoints[i].y * renderer->scale.y;
+        frects[i].w = renderer->scale.x;
+        frects[i].h = renderer->scale.y;
+    }
+
+    status = QueueCmdFillRects(renderer, frects, count);
+
+    SDL_stack_free(frects);
+
+    return status;
+}
+
+int
+SDL_RenderDrawPointsF(SDL_Renderer * renderer,
+                      const SDL_FPoint * points, int count)
+{
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (!points) {
+        return SDL_SetError("SDL_RenderDrawPointsF(): Passed NULL points");
+    }
+    if (count < 1) {
+        return 0;
+    }
+    /* Don't draw while we're hidden */
+    if (renderer->hidden) {
+        return 0;
+    }
+
+    if (renderer->scale.x != 1.0f || renderer->scale.y != 1.0f) {
+        return RenderDrawPointsWithRectsF(renderer, points, count);
+    }
+
+    /* Unscaled points go to the renderer as they are */
+    return QueueCmdDrawPoints(renderer, points, count);
+}
+
 int
 SDL_RenderDrawLine(SDL_Renderer * renderer, int x1, int y1, int x2, int y2)
 {
@@ -1499,11 +2234,11 @@ RenderDrawLinesWithRects(SDL_Renderer * renderer,
             fpoints[0].y = points[i].y * renderer->scale.y;
             fpoints[1].x = points[i+1].x * renderer->scale.x;
             fpoints[1].y = points[i+1].y * renderer->scale.y;
-            status += renderer->RenderDrawLines(renderer, fpoints, 2);
+            status += QueueCmdDrawLines(renderer, fpoints, 2);
         }
     }
 
-    status += renderer->RenderFillRects(renderer, frects, nrects);
+    status += QueueCmdFillRects(renderer, frects, nrects);
 
     SDL_stack_free(frects);
 
@@ -1547,13 +2282,106 @@ SDL_RenderDrawLines(SDL_Renderer * renderer,
         fpoints[i].y = points[i].y * renderer->scale.y;
     }
 
-    status = renderer->RenderDrawLines(renderer, fpoints, count);
+    status = QueueCmdDrawLines(renderer, fpoints, count);
 
     SDL_stack_free(fpoints);
 
     return status;
 }
 
+int
+SDL_RenderDrawLineF(SDL_Renderer * renderer, float x1, float y1, float x2, float y2)
+{
+    SDL_FPoint points[2];
+
+    points[0].x = x1;
+    points[0].y = y1;
+    points[1].x = x2;
+    points[1].y = y2;
+    return SDL_RenderDrawLinesF(renderer, points, 2);
+}
+
+static int
+RenderDrawLinesWithRectsF(SDL_Renderer * renderer,
+                          const SDL_FPoint * points, int count)
+{
+    SDL_FRect *frect;
+    SDL_FRect *frects;
+    SDL_FPoint fpoints[2];
+    int i, nrects;
+    int status;
+
+    frects = SDL_stack_alloc(SDL_FRect, count-1);
+    if (!frects) {
+        return SDL_OutOfMemory();
+    }
+
+    status = 0;
+    nrects = 0;
+    for (i = 0; i < count-1; ++i) {
+        if (points[i].x == points[i+1].x) {
+            const float minY = SDL_min(points[i].y, points[i+1].y);
+            const float maxY = SDL_max(points[i].y, points[i+1].y);
+
+            frect = &frects[nrects++];
+            frect->x = points[i].x * renderer->scale.x;
+            frect->y = minY * renderer->scale.y;
+            frect->w = renderer->scale.x;
+            frect->h = (maxY - minY + 1) * renderer->scale.y;
+        } else if (points[i].y == points[i+1].y) {
+            const float minX = SDL_min(points[i].x, points[i+1].x);
+            const float maxX = SDL_max(points[i].x, points[i+1].x);
+
+            frect = &frects[nrects++];
+            frect->x = minX * renderer->scale.x;
+            frect->y = points[i].y * renderer->scale.y;
+            frect->w = (maxX - minX + 1) * renderer->scale.x;
+            frect->h = renderer->scale.y;
+        } else {
+            /* FIXME: We can't use a rect for this line... */
+            fpoints[0].x = points[i].x * renderer->scale.x;
+            fpoints[0].y = points[i].y * renderer->scale.y;
+            fpoints[1].x = points[i+1].x * renderer->scale.x;
+            fpoints[1].y = points[i+1].y * renderer->scale.y;
+            status += QueueCmdDrawLines(renderer, fpoints, 2);
+        }
+    }
+
+    status += QueueCmdFillRects(renderer, frects, nrects);
+
+    SDL_stack_free(frects);
+
+    if (status < 0) {
+        status = -1;
+    }
+    return status;
+}
+
+int
+SDL_RenderDrawLinesF(SDL_Renderer * renderer,
+                     const SDL_FPoint * points, int count)
+{
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (!points) {
+        return SDL_SetError("SDL_RenderDrawLinesF(): Passed NULL points");
+    }
+    if (count < 2) {
+        return 0;
+    }
+    /* Don't draw while we're hidden */
+    if (renderer->hidden) {
+        return 0;
+    }
+
+    if (renderer->scale.x != 1.0f || renderer->scale.y != 1.0f) {
+        return RenderDrawLinesWithRectsF(renderer, points, count);
+    }
+
+    /* Unscaled points go to the renderer as they are */
+    return QueueCmdDrawLines(renderer, points, count);
+}
+
 int
 SDL_RenderDrawRect(SDL_Renderer * renderer, const SDL_Rect * rect)
 {
@@ -1584,28 +2412,87 @@ SDL_RenderDrawRect(SDL_Renderer * renderer, const SDL_Rect * rect)
 }
 
 int
-SDL_RenderDrawRects(SDL_Renderer * renderer,
-                    const SDL_Rect * rects, int count)
+SDL_RenderDrawRectF(SDL_Renderer * renderer, const SDL_FRect * rect)
 {
-    int i;
+    SDL_FRect full_rect;
+    SDL_FPoint points[5];
 
     CHECK_RENDERER_MAGIC(renderer, -1);
 
-    if (!rects) {
-        return SDL_SetError("SDL_RenderDrawRects(): Passed NULL rects");
-    }
-    if (count < 1) {
-        return 0;
+    /* If 'rect' == NULL, then outline the whole surface */
+    if (!rect) {
+        SDL_Rect viewport = { 0, 0, 0, 0 };
+        SDL_RenderGetViewport(renderer, &viewport);
+        full_rect.x = 0.0f;
+        full_rect.y = 0.0f;
+        full_rect.w = (float) viewport.w;
+        full_rect.h = (float) viewport.h;
+        rect = &full_rect;
     }
 
-    /* Don't draw while we're hidden */
-    if (renderer->hidden) {
-        return 0;
-    }
-    for (i = 0; i < count; ++i) {
-        if (SDL_RenderDrawRect(renderer, &rects[i]) < 0) {
-            return -1;
-        }
+    points[0].x = rect->x;
+    points[0].y = rect->y;
+    points[1].x = rect->x+rect->w-1;
+    points[1].y = rect->y;
+    points[2].x = rect->x+rect->w-1;
+    points[2].y = rect->y+rect->h-1;
+    points[3].x = rect->x;
+    points[3].y = rect->y+rect->h-1;
+    points[4].x = rect->x;
+    points[4].y = rect->y;
+    return SDL_RenderDrawLinesF(renderer, points, 5);
+}
+
+int
+SDL_RenderDrawRects(SDL_Renderer * renderer,
+                    const SDL_Rect * rects, int count)
+{
+    int i;
+
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (!rects) {
+        return SDL_SetError("SDL_RenderDrawRects(): Passed NULL rects");
+    }
+    if (count < 1) {
+        return 0;
+    }
+
+    /* Don't draw while we're hidden */
+    if (renderer->hidden) {
+        return 0;
+    }
+    for (i = 0; i < count; ++i) {
+        if (SDL_RenderDrawRect(renderer, &rects[i]) < 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int
+SDL_RenderDrawRectsF(SDL_Renderer * renderer,
+                     const SDL_FRect * rects, int count)
+{
+    int i;
+
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (!rects) {
+        return SDL_SetError("SDL_RenderDrawRectsF(): Passed NULL rects");
+    }
+    if (count < 1) {
+        return 0;
+    }
+
+    /* Don't draw while we're hidden */
+    if (renderer->hidden) {
+        return 0;
+    }
+    for (i = 0; i < count; ++i) {
+        if (SDL_RenderDrawRectF(renderer, &rects[i]) < 0) {
+            return -1;
+        }
     }
     return 0;
 }
@@ -1627,6 +2514,26 @@ SDL_RenderFillRect(SDL_Renderer * renderer, const SDL_Rect * rect)
     return SDL_RenderFillRects(renderer, rect, 1);
 }
 
+int
+SDL_RenderFillRectF(SDL_Renderer * renderer, const SDL_FRect * rect)
+{
+    SDL_FRect full_rect;
+
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    /* If 'rect' == NULL, then outline the whole surface */
+    if (!rect) {
+        SDL_Rect viewport = { 0, 0, 0, 0 };
+        SDL_RenderGetViewport(renderer, &viewport);
+        full_rect.x = 0.0f;
+        full_rect.y = 0.0f;
+        full_rect.w = (float) viewport.w;
+        full_rect.h = (float) viewport.h;
+        rect = &full_rect;
+    }
+    return SDL_RenderFillRectsF(renderer, rect, 1);
+}
+
 int
 SDL_RenderFillRects(SDL_Renderer * renderer,
                     const SDL_Rect * rects, int count)
@@ -1659,7 +2566,51 @@ SDL_RenderFillRects(SDL_Renderer * renderer,
         frects[i].h = rects[i].h * renderer->scale.y;
     }
 
-    status = renderer->RenderFillRects(renderer, frects, count);
+    status = QueueCmdFillRects(renderer, frects, count);
+
+    SDL_stack_free(frects);
+
+    return status;
+}
+
+int
+SDL_RenderFillRectsF(SDL_Renderer * renderer,
+                     const SDL_FRect * rects, int count)
+{
+    SDL_FRect *frects;
+    int i;
+    int status;
+
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (!rects) {
+        return SDL_SetError("SDL_RenderFillRectsF(): Passed NULL rects");
+    }
+    if (count < 1) {
+        return 0;
+    }
+    /* Don't draw while we're hidden */
+    if (renderer->hidden) {
+        return 0;
+    }
+
+    /* Unscaled rects go to the renderer as they are */
+    if (renderer->scale.x == 1.0f && renderer->scale.y == 1.0f) {
+        return QueueCmdFillRects(renderer, rects, count);
+    }
+
+    frects = SDL_stack_alloc(SDL_FRect, count);
+    if (!frects) {
+        return SDL_OutOfMemory();
+    }
+    for (i = 0; i < count; ++i) {
+        frects[i].x = rects[i].x * renderer->scale.x;
+        frects[i].y = rects[i].y * renderer->scale.y;
+        frects[i].w = rects[i].w * renderer->scale.x;
+        frects[i].h = rects[i].h * renderer->scale.y;
+    }
+
+    status = QueueCmdFillRects(renderer, frects, count);
 
     SDL_stack_free(frects);
 
@@ -1715,7 +2666,64 @@ SDL_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
     frect.w = real_dstrect.w * renderer->scale.x;
     frect.h = real_dstrect.h * renderer->scale.y;
 
-    return renderer->RenderCopy(renderer, texture, &real_srcrect, &frect);
+    return QueueCmdCopy(renderer, texture, &real_srcrect, &frect);
+}
+
+int
+SDL_RenderCopyF(SDL_Renderer * renderer, SDL_Texture * texture,
+                const SDL_Rect * srcrect, const SDL_FRect * dstrect)
+{
+    SDL_Rect real_srcrect = { 0, 0, 0, 0 };
+    SDL_Rect viewport = { 0, 0, 0, 0 };
+    SDL_FRect real_dstrect;
+    SDL_FRect frect;
+
+    CHECK_RENDERER_MAGIC(renderer, -1);
+    CHECK_TEXTURE_MAGIC(texture, -1);
+
+    if (renderer != texture->renderer) {
+        return SDL_SetError("Texture was not created with this renderer");
+    }
+
+    real_srcrect.x = 0;
+    real_srcrect.y = 0;
+    real_srcrect.w = texture->w;
+    real_srcrect.h = texture->h;
+    if (srcrect) {
+        if (!SDL_IntersectRect(srcrect, &real_srcrect, &real_srcrect)) {
+            return 0;
+        }
+    }
+
+    SDL_RenderGetViewport(renderer, &viewport);
+    real_dstrect.x = 0.0f;
+    real_dstrect.y = 0.0f;
+    real_dstrect.w = (float) viewport.w;
+    real_dstrect.h = (float) viewport.h;
+    if (dstrect) {
+        if (dstrect->w <= 0.0f || dstrect->h <= 0.0f ||
+            dstrect->x >= real_dstrect.w || dstrect->y >= real_dstrect.h ||
+            dstrect->x + dstrect->w <= 0.0f || dstrect->y + dstrect->h <= 0.0f) {
+            return 0;
+        }
+        real_dstrect = *dstrect;
+    }
+
+    if (texture->native) {
+        texture = texture->native;
+    }
+
+    /* Don't draw while we're hidden */
+    if (renderer->hidden) {
+        return 0;
+    }
+
+    frect.x = real_dstrect.x * renderer->scale.x;
+    frect.y = real_dstrect.y * renderer->scale.y;
+    frect.w = real_dstrect.w * renderer->scale.x;
+    frect.h = real_dstrect.h * renderer->scale.y;
+
+    return QueueCmdCopy(renderer, texture, &real_srcrect, &frect);
 }
 
 
@@ -1736,7 +2744,7 @@ SDL_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
     if (renderer != texture->renderer) {
         return SDL_SetError("Texture was not created with this renderer");
     }
-    if (!renderer->RenderCopyEx) {
+    if (!renderer->RenderCopyEx && !renderer->QueueCopyEx) {
         return SDL_SetError("Renderer does not support RenderCopyEx");
     }
 
@@ -1777,7 +2785,229 @@ SDL_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
     fcenter.x = real_center.x * renderer->scale.x;
     fcenter.y = real_center.y * renderer->scale.y;
 
-    return renderer->RenderCopyEx(renderer, texture, &real_srcrect, &frect, angle, &fcenter, flip);
+    return QueueCmdCopyEx(renderer, texture, &real_srcrect, &frect, angle, &fcenter, flip);
+}
+
+int
+SDL_RenderCopyExF(SDL_Renderer * renderer, SDL_Texture * texture,
+                  const SDL_Rect * srcrect, const SDL_FRect * dstrect,
+                  const double angle, const SDL_FPoint *center, const SDL_RendererFlip flip)
+{
+    SDL_Rect real_srcrect = { 0, 0, 0, 0 };
+    SDL_FRect real_dstrect;
+    SDL_FPoint real_center;
+    SDL_FRect frect;
+    SDL_FPoint fcenter;
+
+    CHECK_RENDERER_MAGIC(renderer, -1);
+    CHECK_TEXTURE_MAGIC(texture, -1);
+
+    if (renderer != texture->renderer) {
+        return SDL_SetError("Texture was not created with this renderer");
+    }
+    if (!renderer->RenderCopyEx && !renderer->QueueCopyEx) {
+        return SDL_SetError("Renderer does not support RenderCopyEx");
+    }
+
+    real_srcrect.x = 0;
+    real_srcrect.y = 0;
+    real_srcrect.w = texture->w;
+    real_srcrect.h = texture->h;
+    if (srcrect) {
+        if (!SDL_IntersectRect(srcrect, &real_srcrect, &real_srcrect)) {
+            return 0;
+        }
+    }
+
+    /* We don't intersect the dstrect with the viewport, as SDL_RenderCopyEx() doesn't */
+    if (dstrect) {
+        real_dstrect = *dstrect;
+    } else {
+        SDL_Rect viewport = { 0, 0, 0, 0 };
+        SDL_RenderGetViewport(renderer, &viewport);
+        real_dstrect.x = 0.0f;
+        real_dstrect.y = 0.0f;
+        real_dstrect.w = (float) viewport.w;
+        real_dstrect.h = (float) viewport.h;
+    }
+
+    if (texture->native) {
+        texture = texture->native;
+    }
+
+    /* Don't draw while we're hidden */
+    if (renderer->hidden) {
+        return 0;
+    }
+
+    if (center) {
+        real_center = *center;
+    } else {
+        real_center.x = real_dstrect.w / 2.0f;
+        real_center.y = real_dstrect.h / 2.0f;
+    }
+
+    frect.x = real_dstrect.x * renderer->scale.x;
+    frect.y = real_dstrect.y * renderer->scale.y;
+    frect.w = real_dstrect.w * renderer->scale.x;
+    frect.h = real_dstrect.h * renderer->scale.y;
+
+    fcenter.x = real_center.x * renderer->scale.x;
+    fcenter.y = real_center.y * renderer->scale.y;
+
+    return QueueCmdCopyEx(renderer, texture, &real_srcrect, &frect, angle, &fcenter, flip);
+}
+
+/* How many copies SDL_RenderCopyBatch() prepares at a time */
+#define COPY_BATCH_SIZE 128
+
+int
+SDL_RenderCopyBatch(SDL_Renderer * renderer, SDL_Texture * texture,
+                    const SDL_Rect * srcrects, const SDL_Rect * dstrects,
+                    const SDL_Color * colors, const double * angles,
+                    const SDL_RendererFlip * flips, int count)
+{
+    SDL_RenderCopyInstance instances[COPY_BATCH_SIZE];
+    SDL_Rect texture_rect;
+    SDL_Rect viewport_rect;
+    SDL_Color color;
+    int i, n;
+
+    CHECK_RENDERER_MAGIC(renderer, -1);
+    CHECK_TEXTURE_MAGIC(texture, -1);
+
+    if (renderer != texture->renderer) {
+        return SDL_SetError("Texture was not created with this renderer");
+    }
+    if (!dstrects) {
+        return SDL_SetError("SDL_RenderCopyBatch(): Passed NULL dstrects");
+    }
+    if (count < 1) {
+        return 0;
+    }
+
+    /* Don't draw while we're hidden */
+    if (renderer->hidden) {
+        return 0;
+    }
+
+    texture_rect.x = 0;
+    texture_rect.y = 0;
+    texture_rect.w = texture->w;
+    texture_rect.h = texture->h;
+
+    SDL_RenderGetViewport(renderer, &viewport_rect);
+    viewport_rect.x = 0;
+    viewport_rect.y = 0;
+
+    color.r = texture->r;
+    color.g = texture->g;
+    color.b = texture->b;
+    color.a = texture->a;
+
+    if (texture->native) {
+        texture = texture->native;
+    }
+
+    n = 0;
+    for (i = 0; i < count; ++i) {
+        SDL_RenderCopyInstance *instance = &instances[n];
+        const SDL_Rect *dstrect = &dstrects[i];
+
+        /* Each copy is clipped the way SDL_RenderCopyEx() would do it,
+           unrotated copies are also culled against the viewport */
+        if (srcrects) {
+            if (!SDL_IntersectRect(&srcrects[i], &texture_rect, &instance->srcrect)) {
+                continue;
+            }
+        } else {
+            instance->srcrect = texture_rect;
+        }
+        instance->angle = angles ? angles[i] : 0.0;
+        if (instance->angle == 0.0 && !SDL_HasIntersection(dstrect, &viewport_rect)) {
+            continue;
+        }
+        instance->flip = flips ? flips[i] : SDL_FLIP_NONE;
+
+        instance->dstrect.x = dstrect->x * renderer->scale.x;
+        instance->dstrect.y = dstrect->y * renderer->scale.y;
+        instance->dstrect.w = dstrect->w * renderer->scale.x;
+        instance->dstrect.h = dstrect->h * renderer->scale.y;
+        instance->center.x = (dstrect->w / 2) * renderer->scale.x;
+        instance->center.y = (dstrect->h / 2) * renderer->scale.y;
+
+        if (colors) {
+            instance->color.r = (Uint8) ((color.r * colors[i].r) / 255);
+            instance->color.g = (Uint8) ((color.g * colors[i].g) / 255);
+            instance->color.b = (Uint8) ((color.b * colors[i].b) / 255);
+            instance->color.a = (Uint8) ((color.a * colors[i].a) / 255);
+        } else {
+            instance->color = color;
+        }
+
+        if (++n == COPY_BATCH_SIZE) {
+            if (QueueCmdCopyBatch(renderer, texture, instances, n) < 0) {
+                return -1;
+            }
+            n = 0;
+        }
+    }
+    if (n > 0) {
+        return QueueCmdCopyBatch(renderer, texture, instances, n);
+    }
+    return 0;
+}
+
+int
+SDL_RenderGeometry(SDL_Renderer * renderer, SDL_Texture * texture,
+                   const SDL_Vertex * vertices, int num_vertices,
+                   const int * indices, int num_indices)
+{
+    int i, count;
+
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (texture) {
+        CHECK_TEXTURE_MAGIC(texture, -1);
+
+        if (renderer != texture->renderer) {
+            return SDL_SetError("Texture was not created with this renderer");
+        }
+    }
+    if (!vertices) {
+        return SDL_SetError("SDL_RenderGeometry(): Passed NULL vertices");
+    }
+    if (!renderer->QueueGeometry) {
+        return SDL_Unsupported();
+    }
+
+    if (indices) {
+        count = num_indices;
+        for (i = 0; i < num_indices; ++i) {
+            if (indices[i] < 0 || indices[i] >= num_vertices) {
+                return SDL_SetError("SDL_RenderGeometry(): Index %d out of range", indices[i]);
+            }
+        }
+    } else {
+        count = num_vertices;
+    }
+    if (count % 3) {
+        return SDL_SetError("SDL_RenderGeometry(): Number of vertices or indices isn't a multiple of 3");
+    }
+    if (count < 3) {
+        return 0;
+    }
+
+    if (texture && texture->native) {
+        texture = texture->native;
+    }
+
+    /* Don't draw while we're hidden */
+    if (renderer->hidden) {
+        return 0;
+    }
+
+    return QueueCmdGeometry(renderer, texture, vertices, indices, count);
 }
 
 int
@@ -1792,6 +3022,10 @@ SDL_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
         return SDL_Unsupported();
     }
 
+    if (FlushRenderCommands(renderer) < 0) {
+        return -1;
+    }
+
     if (!format) {
         format = SDL_GetWindowPixelFormat(renderer->window);
     }
@@ -1822,6 +3056,8 @@ SDL_RenderPresent(SDL_Renderer * renderer)
 {
     CHECK_RENDERER_MAGIC(renderer, );
 
+    FlushRenderCommands(renderer);
+
     /* Don't draw while we're hidden */
     if (renderer->hidden) {
         return;
@@ -1829,6 +3065,63 @@ SDL_RenderPresent(SDL_Renderer * renderer)
     renderer->RenderPresent(renderer);
 }
 
+int
+SDL_RenderFlush(SDL_Renderer * renderer)
+{
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    return FlushRenderCommands(renderer);
+}
+
+int
+SDL_RenderGetDamageRects(SDL_Renderer * renderer, SDL_Rect * rects, int maxrects)
+{
+    const SDL_Rect *damage;
+    SDL_Rect output;
+    int numrects;
+    int i;
+
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (rects && maxrects <= 0) {
+        return SDL_InvalidParamError("maxrects");
+    }
+
+    /* The damage is worked out as the commands are drawn */
+    if (FlushRenderCommands(renderer) < 0) {
+        return -1;
+    }
+
+    if (renderer->GetDamageRects) {
+        numrects = renderer->GetDamageRects(renderer, &damage);
+    } else {
+        output.x = 0;
+        output.y = 0;
+        if (renderer->GetOutputSize) {
+            if (renderer->GetOutputSize(renderer, &output.w, &output.h) < 0) {
+                return -1;
+            }
+        } else {
+            SDL_GetWindowSize(renderer->window, &output.w, &output.h);
+        }
+        damage = &output;
+        numrects = 1;
+    }
+
+    if (!rects) {
+        return numrects;
+    }
+    if (numrects <= maxrects) {
+        SDL_memcpy(rects, damage, numrects * sizeof(*rects));
+        return numrects;
+    }
+    SDL_memcpy(rects, damage, maxrects * sizeof(*rects));
+    for (i = maxrects; i < numrects; ++i) {
+        SDL_UnionRect(&rects[maxrects - 1], &damage[i], &rects[maxrects - 1]);
+    }
+    return maxrects;
+}
+
 void
 SDL_DestroyTexture(SDL_Texture * texture)
 {
@@ -1839,6 +3132,8 @@ SDL_DestroyTexture(SDL_Texture * texture)
     renderer = texture->renderer;
     if (texture == renderer->target) {
         SDL_SetRenderTarget(renderer, NULL);
+    } else {
+        FlushRenderCommandsIfTextureNeeded(texture);
     }
 
     texture->magic = NULL;
@@ -1859,6 +3154,7 @@ SDL_DestroyTexture(SDL_Texture * texture)
         SDL_SW_DestroyYUVTexture(texture->yuv);
     }
     SDL_free(texture->pixels);
+    SDL_free(texture->locked_rects);
 
     renderer->DestroyTexture(renderer, texture);
     SDL_free(texture);
@@ -1883,6 +3179,19 @@ SDL_DestroyRenderer(SDL_Renderer * renderer)
     /* It's no longer magical... */
     renderer->magic = NULL;
 
+    /* Anything still queued is dropped */
+    while (renderer->render_commands) {
+        SDL_RenderCommand *next = renderer->render_commands->next;
+        SDL_free(renderer->render_commands);
+        renderer->render_commands = next;
+    }
+    while (renderer->render_commands_pool) {
+        SDL_RenderCommand *next = renderer->render_commands_pool->next;
+        SDL_free(renderer->render_commands_pool);
+        renderer->render_commands_pool = next;
+    }
+    SDL_free(renderer->vertex_data);
+
     /* Free the renderer instance */
     renderer->DestroyRenderer(renderer);
 }
@@ -1896,6 +3205,8 @@ int SDL_GL_BindTexture(SDL_Texture *texture, float *texw, float *texh)
     if (texture->native) {
         return SDL_GL_BindTexture(texture->native, texw, texh);
     } else if (renderer && renderer->GL_BindTexture) {
+        /* The program is about to draw with GL itself */
+        FlushRenderCommands(renderer);
         return renderer->GL_BindTexture(renderer, texture, texw, texh);
     } else {
         return SDL_Unsupported();
@@ -31,19 +31,57 @@
 
 typedef struct SDL_RenderDriver SDL_RenderDriver;
 
-typedef struct
+/* The commands recorded by the render API, see RunCommandQueue() below */
+typedef enum
 {
-    float x;
-    float y;
-} SDL_FPoint;
-
-typedef struct
+    SDL_RENDERCMD_NO_OP,
+    SDL_RENDERCMD_SETVIEWPORT,
+    SDL_RENDERCMD_SETCLIPRECT,
+    SDL_RENDERCMD_CLEAR,
+    SDL_RENDERCMD_DRAW_POINTS,
+    SDL_RENDERCMD_DRAW_LINES,
+    SDL_RENDERCMD_FILL_RECTS,
+    SDL_RENDERCMD_COPY,
+    SDL_RENDERCMD_COPY_EX,
+    SDL_RENDERCMD_COPY_BATCH,
+    SDL_RENDERCMD_GEOMETRY
+} SDL_RenderCommandType;
+
+/* One copy of an SDL_RenderCopyBatch() call, scaled to output coordinates */
+typedef struct SDL_RenderCopyInstance
+{
+    SDL_Rect srcrect;
+    SDL_FRect dstrect;
+    SDL_FPoint center;
+    double angle;
+    SDL_RendererFlip flip;
+    SDL_Color color;            /**< Texture modulation included */
+} SDL_RenderCopyInstance;
+
+typedef struct SDL_RenderCommand
 {
-    float x;
-    float y;
-    float w;
-    float h;
-} SDL_FRect;
+    SDL_RenderCommandType command;
+    union {
+        struct {
+            SDL_Rect rect;
+        } viewport;
+        struct {
+            SDL_bool enabled;
+            SDL_Rect rect;
+        } cliprect;
+        struct {
+            size_t first;           /**< Offset of the vertex data */
+            size_t count;           /**< Number of primitives queued */
+            Uint8 r, g, b, a;       /**< Draw color or texture modulation */
+            SDL_BlendMode blend;
+            SDL_Texture *texture;
+        } draw;
+        struct {
+            Uint8 r, g, b, a;
+        } color;
+    } data;
+    struct SDL_RenderCommand *next;
+} SDL_RenderCommand;
 
 /* Define the SDL texture structure */
 struct SDL_Texture
@@ -64,7 +102,13 @@ struct SDL_Texture
     SDL_SW_YUVTexture *yuv;
     void *pixels;
     int pitch;
-    SDL_Rect locked_rect;
+    SDL_Rect locked_rect;       /**< Bounds of the areas being changed while locked */
+    SDL_Rect *locked_rects;     /**< The areas being changed while locked */
+    int num_locked_rects;
+    int max_locked_rects;
+    int buffers;                /**< Number of pixel buffers for streaming access */
+
+    Uint32 last_command_generation; /**< Last command queue that used this texture */
 
     void *driverdata;           /**< Driver specific texture representation */
 
@@ -80,6 +124,12 @@ struct SDL_Renderer
     void (*WindowEvent) (SDL_Renderer * renderer, const SDL_WindowEvent *event);
     int (*GetOutputSize) (SDL_Renderer * renderer, int *w, int *h);
     int (*CreateTexture) (SDL_Renderer * renderer, SDL_Texture * texture);
+    /* Optional, sets up the texture to draw straight from the pixels of a
+       surface in the texture format, keeping a reference to the surface.
+       Streaming textures made this way may have their pixels changed by
+       the application at any time. */
+    int (*CreateTextureFromSurface) (SDL_Renderer * renderer, SDL_Texture * texture,
+                                     SDL_Surface * surface);
     int (*SetTextureColorMod) (SDL_Renderer * renderer,
                                SDL_Texture * texture);
     int (*SetTextureAlphaMod) (SDL_Renderer * renderer,
@@ -97,6 +147,12 @@ struct SDL_Renderer
     int (*LockTexture) (SDL_Renderer * renderer, SDL_Texture * texture,
                         const SDL_Rect * rect, void **pixels, int *pitch);
     void (*UnlockTexture) (SDL_Renderer * renderer, SDL_Texture * texture);
+    /* Optional, gives a streaming texture more buffers to lock while the
+       last one unlocked is drawn.  LockTexture() is called without drawing
+       queued commands first when there is more than one, and the areas
+       changed are in the texture's locked_rects. */
+    int (*SetTextureBuffers) (SDL_Renderer * renderer, SDL_Texture * texture,
+                              int buffers);
     int (*SetRenderTarget) (SDL_Renderer * renderer, SDL_Texture * texture);
     int (*UpdateViewport) (SDL_Renderer * renderer);
     int (*UpdateClipRect) (SDL_Renderer * renderer);
@@ -112,8 +168,44 @@ struct SDL_Renderer
     int (*RenderCopyEx) (SDL_Renderer * renderer, SDL_Texture * texture,
                        const SDL_Rect * srcquad, const SDL_FRect * dstrect,
                        const double angle, const SDL_FPoint *center, const SDL_RendererFlip flip);
+
+    /* Renderers that batch their drawing implement these instead of
+       UpdateViewport(), UpdateClipRect() and the Render*() drawing calls.
+       Each Queue*() call appends its vertex data, in whatever layout the
+       renderer likes, with SDL_AllocateRenderVertices(); RunCommandQueue()
+       then draws the whole list of commands against that buffer. */
+    int (*QueueDrawPoints) (SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                            const SDL_FPoint * points, int count);
+    int (*QueueDrawLines) (SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                           const SDL_FPoint * points, int count);
+    int (*QueueFillRects) (SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                           const SDL_FRect * rects, int count);
+    int (*QueueCopy) (SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                      SDL_Texture * texture, const SDL_Rect * srcrect,
+                      const SDL_FRect * dstrect);
+    int (*QueueCopyEx) (SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                        SDL_Texture * texture, const SDL_Rect * srcrect,
+                        const SDL_FRect * dstrect, const double angle,
+                        const SDL_FPoint *center, const SDL_RendererFlip flip);
+    /* Optional, batches are otherwise queued one copy at a time */
+    int (*QueueCopyBatch) (SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                           SDL_Texture * texture,
+                           const SDL_RenderCopyInstance * instances, int count);
+    /* Optional, SDL_RenderGeometry() is unsupported without it.  This
+       queues count triangle vertices, taken in order or through indices,
+       with positions still to be multiplied by the render scale. */
+    int (*QueueGeometry) (SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                          SDL_Texture * texture, const SDL_Vertex * vertices,
+                          const int * indices, int count,
+                          float scale_x, float scale_y);
+    int (*RunCommandQueue) (SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                            void *vertices, size_t vertsize);
+
     int (*RenderReadPixels) (SDL_Renderer * renderer, const SDL_Rect * rect,
                              Uint32 format, void * pixels, int pitch);
+    /* Optional, returns the areas of the output drawn on since the last
+       present, in output pixels.  The whole output is assumed otherwise. */
+    int (*GetDamageRects) (SDL_Renderer * renderer, const SDL_Rect ** rects);
     void (*RenderPresent) (SDL_Renderer * renderer);
     void (*DestroyTexture) (SDL_Renderer * renderer, SDL_Texture * texture);
 
@@ -158,6 +250,22 @@ struct SDL_Renderer
     Uint8 r, g, b, a;                   /**< Color for drawing operations values */
     SDL_BlendMode blendMode;            /**< The drawing blend mode */
 
+    /* The commands waiting for the next RunCommandQueue() */
+    SDL_bool batching;
+    SDL_RenderCommand *render_commands;
+    SDL_RenderCommand *render_commands_tail;
+    SDL_RenderCommand *render_commands_pool;
+    Uint32 render_command_generation;
+    SDL_bool viewport_queued;
+    SDL_Rect last_queued_viewport;
+    SDL_bool cliprect_queued;
+    SDL_bool last_queued_cliprect_enabled;
+    SDL_Rect last_queued_cliprect;
+
+    void *vertex_data;
+    size_t vertex_data_used;
+    size_t vertex_data_allocation;
+
     void *driverdata;
 };
 
@@ -170,6 +278,10 @@ struct SDL_RenderDriver
     SDL_RendererInfo info;
 };
 
+/* Append numbytes of vertex data for the command being queued, returns
+   NULL if out of memory.  The pointer is only good until the next call. */
+extern void *SDL_AllocateRenderVertices(SDL_Renderer *renderer, size_t numbytes);
+
 #if !SDL_RENDER_DISABLED
 
 #if SDL_VIDEO_RENDER_D3D
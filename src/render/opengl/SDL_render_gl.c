@@ -68,20 +68,26 @@ static int GL_LockTexture(SDL_Renderer * renderer, SDL_Texture * texture,
                           const SDL_Rect * rect, void **pixels, int *pitch);
 static void GL_UnlockTexture(SDL_Renderer * renderer, SDL_Texture * texture);
 static int GL_SetRenderTarget(SDL_Renderer * renderer, SDL_Texture * texture);
-static int GL_UpdateViewport(SDL_Renderer * renderer);
-static int GL_UpdateClipRect(SDL_Renderer * renderer);
-static int GL_RenderClear(SDL_Renderer * renderer);
-static int GL_RenderDrawPoints(SDL_Renderer * renderer,
-                               const SDL_FPoint * points, int count);
-static int GL_RenderDrawLines(SDL_Renderer * renderer,
+static int GL_QueueDrawPoints(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
                               const SDL_FPoint * points, int count);
-static int GL_RenderFillRects(SDL_Renderer * renderer,
-                              const SDL_FRect * rects, int count);
-static int GL_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
-                         const SDL_Rect * srcrect, const SDL_FRect * dstrect);
-static int GL_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
-                         const SDL_Rect * srcrect, const SDL_FRect * dstrect,
-                         const double angle, const SDL_FPoint *center, const SDL_RendererFlip flip);
+static int GL_QueueFillRects(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                             const SDL_FRect * rects, int count);
+static int GL_QueueCopy(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                        SDL_Texture * texture, const SDL_Rect * srcrect,
+                        const SDL_FRect * dstrect);
+static int GL_QueueCopyEx(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                          SDL_Texture * texture, const SDL_Rect * srcrect,
+                          const SDL_FRect * dstrect, const double angle,
+                          const SDL_FPoint *center, const SDL_RendererFlip flip);
+static int GL_QueueCopyBatch(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                             SDL_Texture * texture,
+                             const SDL_RenderCopyInstance * instances, int count);
+static int GL_QueueGeometry(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                            SDL_Texture * texture, const SDL_Vertex * vertices,
+                            const int * indices, int count,
+                            float scale_x, float scale_y);
+static int GL_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                              void *vertices, size_t vertsize);
 static int GL_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
                                Uint32 pixel_format, void * pixels, int pitch);
 static void GL_RenderPresent(SDL_Renderer * renderer);
@@ -129,6 +135,15 @@ typedef struct
         int blendMode;
     } current;
 
+    /* The viewport and clip rectangle as of the command being run */
+    struct {
+        SDL_Rect viewport;
+        SDL_bool viewport_dirty;
+        SDL_bool cliprect_enabled;
+        SDL_Rect cliprect;
+        SDL_bool cliprect_dirty;
+    } drawstate;
+
     SDL_bool GL_EXT_framebuffer_object_supported;
     GL_FBOList *framebuffers;
 
@@ -299,7 +314,8 @@ GL_ActivateRenderer(SDL_Renderer * renderer)
         }
         SDL_CurrentContext = data->context;
 
-        GL_UpdateViewport(renderer);
+        data->drawstate.viewport_dirty = SDL_TRUE;
+        data->drawstate.cliprect_dirty = SDL_TRUE;
     }
 
     GL_ClearErrors(renderer);
@@ -314,7 +330,8 @@ GL_ResetState(SDL_Renderer *renderer)
     GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
 
     if (SDL_GL_GetCurrentContext() == data->context) {
-        GL_UpdateViewport(renderer);
+        data->drawstate.viewport_dirty = SDL_TRUE;
+        data->drawstate.cliprect_dirty = SDL_TRUE;
     } else {
         GL_ActivateRenderer(renderer);
     }
@@ -435,14 +452,14 @@ GL_CreateRenderer(SDL_Window * window, Uint32 flags)
     renderer->LockTexture = GL_LockTexture;
     renderer->UnlockTexture = GL_UnlockTexture;
     renderer->SetRenderTarget = GL_SetRenderTarget;
-    renderer->UpdateViewport = GL_UpdateViewport;
-    renderer->UpdateClipRect = GL_UpdateClipRect;
-    renderer->RenderClear = GL_RenderClear;
-    renderer->RenderDrawPoints = GL_RenderDrawPoints;
-    renderer->RenderDrawLines = GL_RenderDrawLines;
-    renderer->RenderFillRects = GL_RenderFillRects;
-    renderer->RenderCopy = GL_RenderCopy;
-    renderer->RenderCopyEx = GL_RenderCopyEx;
+    renderer->QueueDrawPoints = GL_QueueDrawPoints;
+    renderer->QueueDrawLines = GL_QueueDrawPoints;  /* lines and points queue the same way */
+    renderer->QueueFillRects = GL_QueueFillRects;
+    renderer->QueueCopy = GL_QueueCopy;
+    renderer->QueueCopyEx = GL_QueueCopyEx;
+    renderer->QueueCopyBatch = GL_QueueCopyBatch;
+    renderer->QueueGeometry = GL_QueueGeometry;
+    renderer->RunCommandQueue = GL_RunCommandQueue;
     renderer->RenderReadPixels = GL_RenderReadPixels;
     renderer->RenderPresent = GL_RenderPresent;
     renderer->DestroyTexture = GL_DestroyTexture;
@@ -980,6 +997,10 @@ GL_SetRenderTarget(SDL_Renderer * renderer, SDL_Texture * texture)
 
     GL_ActivateRenderer(renderer);
 
+    /* The projection flips with the target, so redo it on the next draw */
+    data->drawstate.viewport_dirty = SDL_TRUE;
+    data->drawstate.cliprect_dirty = SDL_TRUE;
+
     if (texture == NULL) {
         data->glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, 0);
         return 0;
@@ -997,60 +1018,70 @@ GL_SetRenderTarget(SDL_Renderer * renderer, SDL_Texture * texture)
     return 0;
 }
 
-static int
-GL_UpdateViewport(SDL_Renderer * renderer)
+static void
+GL_SetViewport(SDL_Renderer * renderer)
 {
     GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
-
-    if (SDL_CurrentContext != data->context) {
-        /* We'll update the viewport after we rebind the context */
-        return 0;
-    }
+    const SDL_Rect *viewport = &data->drawstate.viewport;
 
     if (renderer->target) {
-        data->glViewport(renderer->viewport.x, renderer->viewport.y,
-                         renderer->viewport.w, renderer->viewport.h);
+        data->glViewport(viewport->x, viewport->y, viewport->w, viewport->h);
     } else {
         int w, h;
 
         SDL_GetRendererOutputSize(renderer, &w, &h);
-        data->glViewport(renderer->viewport.x, (h - renderer->viewport.y - renderer->viewport.h),
-                         renderer->viewport.w, renderer->viewport.h);
+        data->glViewport(viewport->x, (h - viewport->y - viewport->h),
+                         viewport->w, viewport->h);
     }
 
     data->glMatrixMode(GL_PROJECTION);
     data->glLoadIdentity();
-    if (renderer->viewport.w && renderer->viewport.h) {
+    if (viewport->w && viewport->h) {
         if (renderer->target) {
             data->glOrtho((GLdouble) 0,
-                          (GLdouble) renderer->viewport.w,
+                          (GLdouble) viewport->w,
                           (GLdouble) 0,
-                          (GLdouble) renderer->viewport.h,
+                          (GLdouble) viewport->h,
                            0.0, 1.0);
         } else {
             data->glOrtho((GLdouble) 0,
-                          (GLdouble) renderer->viewport.w,
-                          (GLdouble) renderer->viewport.h,
+                          (GLdouble) viewport->w,
+                          (GLdouble) viewport->h,
                           (GLdouble) 0,
                            0.0, 1.0);
         }
     }
-    return GL_CheckError("", renderer);
+    data->glMatrixMode(GL_MODELVIEW);
 }
 
-static int
-GL_UpdateClipRect(SDL_Renderer * renderer)
+static void
+GL_SetClipRect(SDL_Renderer * renderer)
 {
     GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
 
-    if (renderer->clipping_enabled) {
-        const SDL_Rect *rect = &renderer->clip_rect;
+    if (data->drawstate.cliprect_enabled) {
+        const SDL_Rect *rect = &data->drawstate.cliprect;
         data->glEnable(GL_SCISSOR_TEST);
-        data->glScissor(rect->x, renderer->viewport.h - rect->y - rect->h, rect->w, rect->h);
+        data->glScissor(rect->x, data->drawstate.viewport.h - rect->y - rect->h, rect->w, rect->h);
     } else {
         data->glDisable(GL_SCISSOR_TEST);
     }
-    return 0;
+}
+
+/* Bring the viewport and scissor up to date before drawing */
+static void
+GL_SetDrawState(SDL_Renderer * renderer)
+{
+    GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
+
+    if (data->drawstate.viewport_dirty) {
+        GL_SetViewport(renderer);
+        data->drawstate.viewport_dirty = SDL_FALSE;
+    }
+    if (data->drawstate.cliprect_dirty) {
+        GL_SetClipRect(renderer);
+        data->drawstate.cliprect_dirty = SDL_FALSE;
+    }
 }
 
 static void
@@ -1106,143 +1137,281 @@ GL_SetBlendMode(GL_RenderData * data, int blendMode)
 }
 
 static void
-GL_SetDrawingState(SDL_Renderer * renderer)
+GL_SetDrawingState(SDL_Renderer * renderer, const SDL_RenderCommand *cmd)
 {
     GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
 
-    GL_ActivateRenderer(renderer);
+    GL_SetDrawState(renderer);
 
-    GL_SetColor(data, renderer->r,
-                      renderer->g,
-                      renderer->b,
-                      renderer->a);
+    GL_SetColor(data, cmd->data.draw.r,
+                      cmd->data.draw.g,
+                      cmd->data.draw.b,
+                      cmd->data.draw.a);
 
-    GL_SetBlendMode(data, renderer->blendMode);
+    GL_SetBlendMode(data, cmd->data.draw.blend);
 
     GL_SetShader(data, SHADER_SOLID);
 }
 
 static int
-GL_RenderClear(SDL_Renderer * renderer)
+GL_QueueDrawPoints(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                   const SDL_FPoint * points, int count)
 {
-    GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
-
-    GL_ActivateRenderer(renderer);
-
-    data->glClearColor((GLfloat) renderer->r * inv255f,
-                       (GLfloat) renderer->g * inv255f,
-                       (GLfloat) renderer->b * inv255f,
-                       (GLfloat) renderer->a * inv255f);
+    GLfloat *verts = (GLfloat *) SDL_AllocateRenderVertices(renderer, count * 2 * sizeof (GLfloat));
+    int i;
 
-    data->glClear(GL_COLOR_BUFFER_BIT);
+    if (!verts) {
+        return -1;
+    }
 
+    for (i = 0; i < count; ++i) {
+        *(verts++) = 0.5f + points[i].x;
+        *(verts++) = 0.5f + points[i].y;
+    }
     return 0;
 }
 
 static int
-GL_RenderDrawPoints(SDL_Renderer * renderer, const SDL_FPoint * points,
-                    int count)
+GL_QueueFillRects(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                  const SDL_FRect * rects, int count)
 {
-    GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
+    GLfloat *verts = (GLfloat *) SDL_AllocateRenderVertices(renderer, count * 8 * sizeof (GLfloat));
     int i;
 
-    GL_SetDrawingState(renderer);
+    if (!verts) {
+        return -1;
+    }
 
-    data->glBegin(GL_POINTS);
     for (i = 0; i < count; ++i) {
-        data->glVertex2f(0.5f + points[i].x, 0.5f + points[i].y);
-    }
-    data->glEnd();
+        const SDL_FRect *rect = &rects[i];
+        const GLfloat minx = rect->x;
+        const GLfloat miny = rect->y;
+        const GLfloat maxx = rect->x + rect->w;
+        const GLfloat maxy = rect->y + rect->h;
 
+        *(verts++) = minx; *(verts++) = miny;
+        *(verts++) = maxx; *(verts++) = miny;
+        *(verts++) = maxx; *(verts++) = maxy;
+        *(verts++) = minx; *(verts++) = maxy;
+    }
     return 0;
 }
 
+static void
+GL_GetTexCoords(SDL_Texture * texture, const SDL_Rect * srcrect,
+                GLfloat *minu, GLfloat *maxu, GLfloat *minv, GLfloat *maxv)
+{
+    GL_TextureData *texturedata = (GL_TextureData *) texture->driverdata;
+
+    *minu = (GLfloat) srcrect->x / texture->w;
+    *minu *= texturedata->texw;
+    *maxu = (GLfloat) (srcrect->x + srcrect->w) / texture->w;
+    *maxu *= texturedata->texw;
+    *minv = (GLfloat) srcrect->y / texture->h;
+    *minv *= texturedata->texh;
+    *maxv = (GLfloat) (srcrect->y + srcrect->h) / texture->h;
+    *maxv *= texturedata->texh;
+}
+
+/* Copies are queued as quads of interleaved x, y, u, v */
 static int
-GL_RenderDrawLines(SDL_Renderer * renderer, const SDL_FPoint * points,
-                   int count)
+GL_QueueCopy(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+             SDL_Texture * texture, const SDL_Rect * srcrect,
+             const SDL_FRect * dstrect)
 {
-    GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
+    GLfloat *verts = (GLfloat *) SDL_AllocateRenderVertices(renderer, 16 * sizeof (GLfloat));
+    GLfloat minx, miny, maxx, maxy;
+    GLfloat minu, maxu, minv, maxv;
+
+    if (!verts) {
+        return -1;
+    }
+
+    minx = dstrect->x;
+    miny = dstrect->y;
+    maxx = dstrect->x + dstrect->w;
+    maxy = dstrect->y + dstrect->h;
+
+    GL_GetTexCoords(texture, srcrect, &minu, &maxu, &minv, &maxv);
+
+    *(verts++) = minx; *(verts++) = miny; *(verts++) = minu; *(verts++) = minv;
+    *(verts++) = maxx; *(verts++) = miny; *(verts++) = maxu; *(verts++) = minv;
+    *(verts++) = maxx; *(verts++) = maxy; *(verts++) = maxu; *(verts++) = maxv;
+    *(verts++) = minx; *(verts++) = maxy; *(verts++) = minu; *(verts++) = maxv;
+    return 0;
+}
+
+/* The corners of a rotated copy, in the same order as GL_QueueCopy() */
+static void
+GL_GetCopyExCorners(const SDL_FRect * dstrect, const double angle,
+                    const SDL_FPoint *center, const SDL_RendererFlip flip,
+                    GLfloat x[4], GLfloat y[4])
+{
+    GLfloat minx, miny, maxx, maxy;
+    GLfloat centerx, centery;
+    GLfloat s, c;
+    const double radians = angle * (M_PI / 180.0);
     int i;
 
-    GL_SetDrawingState(renderer);
+    centerx = center->x;
+    centery = center->y;
 
-    if (count > 2 &&
-        points[0].x == points[count-1].x && points[0].y == points[count-1].y) {
-        data->glBegin(GL_LINE_LOOP);
-        /* GL_LINE_LOOP takes care of the final segment */
-        --count;
-        for (i = 0; i < count; ++i) {
-            data->glVertex2f(0.5f + points[i].x, 0.5f + points[i].y);
-        }
-        data->glEnd();
-    } else {
-#if defined(__MACOSX__) || defined(__WIN32__)
-#else
-        int x1, y1, x2, y2;
-#endif
+    if (flip & SDL_FLIP_HORIZONTAL) {
+        minx =  dstrect->w - centerx;
+        maxx = -centerx;
+    }
+    else {
+        minx = -centerx;
+        maxx =  dstrect->w - centerx;
+    }
 
-        data->glBegin(GL_LINE_STRIP);
-        for (i = 0; i < count; ++i) {
-            data->glVertex2f(0.5f + points[i].x, 0.5f + points[i].y);
-        }
-        data->glEnd();
+    if (flip & SDL_FLIP_VERTICAL) {
+        miny =  dstrect->h - centery;
+        maxy = -centery;
+    }
+    else {
+        miny = -centery;
+        maxy =  dstrect->h - centery;
+    }
 
-        /* The line is half open, so we need one more point to complete it.
-         * http://www.opengl.org/documentation/specs/version1.1/glspec1.1/node47.html
-         * If we have to, we can use vertical line and horizontal line textures
-         * for vertical and horizontal lines, and then create custom textures
-         * for diagonal lines and software render those.  It's terrible, but at
-         * least it would be pixel perfect.
-         */
-        data->glBegin(GL_POINTS);
-#if defined(__MACOSX__) || defined(__WIN32__)
-        /* Mac OS X and Windows seem to always leave the last point open */
-        data->glVertex2f(0.5f + points[count-1].x, 0.5f + points[count-1].y);
-#else
-        /* Linux seems to leave the right-most or bottom-most point open */
-        x1 = points[0].x;
-        y1 = points[0].y;
-        x2 = points[count-1].x;
-        y2 = points[count-1].y;
+    /* Flip about the center, rotate, then translate to position; this is
+       done here rather than with the matrix stack so copies can batch. */
+    s = (GLfloat) SDL_sin(radians);
+    c = (GLfloat) SDL_cos(radians);
+    x[0] = minx; y[0] = miny;
+    x[1] = maxx; y[1] = miny;
+    x[2] = maxx; y[2] = maxy;
+    x[3] = minx; y[3] = maxy;
+    for (i = 0; i < 4; ++i) {
+        const GLfloat rx = x[i] * c - y[i] * s;
+        const GLfloat ry = x[i] * s + y[i] * c;
+        x[i] = rx + dstrect->x + centerx;
+        y[i] = ry + dstrect->y + centery;
+    }
+}
 
-        if (x1 > x2) {
-            data->glVertex2f(0.5f + x1, 0.5f + y1);
-        } else if (x2 > x1) {
-            data->glVertex2f(0.5f + x2, 0.5f + y2);
+static int
+GL_QueueCopyEx(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+               SDL_Texture * texture, const SDL_Rect * srcrect,
+               const SDL_FRect * dstrect, const double angle,
+               const SDL_FPoint *center, const SDL_RendererFlip flip)
+{
+    GLfloat *verts = (GLfloat *) SDL_AllocateRenderVertices(renderer, 16 * sizeof (GLfloat));
+    GLfloat minu, maxu, minv, maxv;
+    GLfloat x[4], y[4];
+
+    if (!verts) {
+        return -1;
+    }
+
+    GL_GetCopyExCorners(dstrect, angle, center, flip, x, y);
+    GL_GetTexCoords(texture, srcrect, &minu, &maxu, &minv, &maxv);
+
+    *(verts++) = x[0]; *(verts++) = y[0]; *(verts++) = minu; *(verts++) = minv;
+    *(verts++) = x[1]; *(verts++) = y[1]; *(verts++) = maxu; *(verts++) = minv;
+    *(verts++) = x[2]; *(verts++) = y[2]; *(verts++) = maxu; *(verts++) = maxv;
+    *(verts++) = x[3]; *(verts++) = y[3]; *(verts++) = minu; *(verts++) = maxv;
+    return 0;
+}
+
+/* Batched copies and geometry add each vertex's color, packed as 4 bytes,
+   after x, y, u, v */
+typedef struct
+{
+    GLfloat x, y, u, v;
+    SDL_Color color;
+} GL_ColorVertex;
+
+static int
+GL_QueueCopyBatch(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                  SDL_Texture * texture,
+                  const SDL_RenderCopyInstance * instances, int count)
+{
+    GL_ColorVertex *verts = (GL_ColorVertex *) SDL_AllocateRenderVertices(renderer, count * 4 * sizeof (GL_ColorVertex));
+    int i, j;
+
+    if (!verts) {
+        return -1;
+    }
+
+    for (i = 0; i < count; ++i, verts += 4) {
+        const SDL_RenderCopyInstance *instance = &instances[i];
+        GLfloat minu, maxu, minv, maxv;
+        GLfloat x[4], y[4];
+
+        if (instance->angle == 0.0 && instance->flip == SDL_FLIP_NONE) {
+            x[0] = x[3] = instance->dstrect.x;
+            x[1] = x[2] = instance->dstrect.x + instance->dstrect.w;
+            y[0] = y[1] = instance->dstrect.y;
+            y[2] = y[3] = instance->dstrect.y + instance->dstrect.h;
+        } else {
+            GL_GetCopyExCorners(&instance->dstrect, instance->angle,
+                                &instance->center, instance->flip, x, y);
         }
-        if (y1 > y2) {
-            data->glVertex2f(0.5f + x1, 0.5f + y1);
-        } else if (y2 > y1) {
-            data->glVertex2f(0.5f + x2, 0.5f + y2);
+        GL_GetTexCoords(texture, &instance->srcrect, &minu, &maxu, &minv, &maxv);
+
+        verts[0].u = verts[3].u = minu;
+        verts[1].u = verts[2].u = maxu;
+        verts[0].v = verts[1].v = minv;
+        verts[2].v = verts[3].v = maxv;
+        for (j = 0; j < 4; ++j) {
+            verts[j].x = x[j];
+            verts[j].y = y[j];
+            verts[j].color = instance->color;
         }
-#endif
-        data->glEnd();
     }
-    return GL_CheckError("", renderer);
+    return 0;
 }
 
 static int
-GL_RenderFillRects(SDL_Renderer * renderer, const SDL_FRect * rects, int count)
+GL_QueueGeometry(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                 SDL_Texture * texture, const SDL_Vertex * vertices,
+                 const int * indices, int count,
+                 float scale_x, float scale_y)
 {
-    GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
+    GL_ColorVertex *verts = (GL_ColorVertex *) SDL_AllocateRenderVertices(renderer, count * sizeof (GL_ColorVertex));
+    GLfloat texw = 0.0f, texh = 0.0f;
     int i;
 
-    GL_SetDrawingState(renderer);
+    if (!verts) {
+        return -1;
+    }
 
-    for (i = 0; i < count; ++i) {
-        const SDL_FRect *rect = &rects[i];
+    if (texture) {
+        GL_TextureData *texturedata = (GL_TextureData *) texture->driverdata;
+        texw = texturedata->texw;
+        texh = texturedata->texh;
+    }
 
-        data->glRectf(rect->x, rect->y, rect->x + rect->w, rect->y + rect->h);
+    for (i = 0; i < count; ++i, ++verts) {
+        const SDL_Vertex *vertex = &vertices[indices ? indices[i] : i];
+
+        verts->x = vertex->position.x * scale_x;
+        verts->y = vertex->position.y * scale_y;
+        verts->u = vertex->tex_coord.x * texw;
+        verts->v = vertex->tex_coord.y * texh;
+        if (texture) {
+            /* The color array replaces the texture modulation */
+            verts->color.r = (Uint8) ((vertex->color.r * cmd->data.draw.r) / 255);
+            verts->color.g = (Uint8) ((vertex->color.g * cmd->data.draw.g) / 255);
+            verts->color.b = (Uint8) ((vertex->color.b * cmd->data.draw.b) / 255);
+            verts->color.a = (Uint8) ((vertex->color.a * cmd->data.draw.a) / 255);
+        } else {
+            verts->color = vertex->color;
+        }
     }
-    return GL_CheckError("", renderer);
+    return 0;
 }
 
 static int
-GL_SetupCopy(SDL_Renderer * renderer, SDL_Texture * texture)
+GL_SetupCopy(SDL_Renderer * renderer, SDL_Texture * texture,
+             const SDL_RenderCommand *cmd)
 {
     GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
     GL_TextureData *texturedata = (GL_TextureData *) texture->driverdata;
 
+    GL_SetDrawState(renderer);
+
     data->glEnable(texturedata->type);
     if (texturedata->yuv) {
         data->glActiveTextureARB(GL_TEXTURE2_ARB);
@@ -1261,13 +1430,10 @@ GL_SetupCopy(SDL_Renderer * renderer, SDL_Texture * texture)
     }
     data->glBindTexture(texturedata->type, texturedata->texture);
 
-    if (texture->modMode) {
-        GL_SetColor(data, texture->r, texture->g, texture->b, texture->a);
-    } else {
-        GL_SetColor(data, 255, 255, 255, 255);
-    }
+    GL_SetColor(data, cmd->data.draw.r, cmd->data.draw.g,
+                      cmd->data.draw.b, cmd->data.draw.a);
 
-    GL_SetBlendMode(data, texture->blendMode);
+    GL_SetBlendMode(data, cmd->data.draw.blend);
 
     if (texturedata->yuv) {
         GL_SetShader(data, SHADER_YUV);
@@ -1283,116 +1449,213 @@ GL_SetupCopy(SDL_Renderer * renderer, SDL_Texture * texture)
     return 0;
 }
 
+static void
+GL_DrawLines(GL_RenderData * data, const GLfloat *verts, int count)
+{
+    if (count > 2 &&
+        verts[0] == verts[(count-1)*2] && verts[1] == verts[(count-1)*2+1]) {
+        /* GL_LINE_LOOP takes care of the final segment */
+        data->glDrawArrays(GL_LINE_LOOP, 0, count - 1);
+    } else {
+#if defined(__MACOSX__) || defined(__WIN32__)
+#else
+        GLfloat x1, y1, x2, y2;
+#endif
+
+        data->glDrawArrays(GL_LINE_STRIP, 0, count);
+
+        /* The line is half open, so we need one more point to complete it.
+         * http://www.opengl.org/documentation/specs/version1.1/glspec1.1/node47.html
+         * If we have to, we can use vertical line and horizontal line textures
+         * for vertical and horizontal lines, and then create custom textures
+         * for diagonal lines and software render those.  It's terrible, but at
+         * least it would be pixel perfect.
+         */
+        data->glBegin(GL_POINTS);
+#if defined(__MACOSX__) || defined(__WIN32__)
+        /* Mac OS X and Windows seem to always leave the last point open */
+        data->glVertex2f(verts[(count-1)*2], verts[(count-1)*2+1]);
+#else
+        /* Linux seems to leave the right-most or bottom-most point open.
+           The vertices already carry the half pixel offset, so take it
+           back off to snap to the pixel like the integer endpoints did. */
+        x1 = (GLfloat) (int) (verts[0] - 0.5f);
+        y1 = (GLfloat) (int) (verts[1] - 0.5f);
+        x2 = (GLfloat) (int) (verts[(count-1)*2] - 0.5f);
+        y2 = (GLfloat) (int) (verts[(count-1)*2+1] - 0.5f);
+
+        if (x1 > x2) {
+            data->glVertex2f(0.5f + x1, 0.5f + y1);
+        } else if (x2 > x1) {
+            data->glVertex2f(0.5f + x2, 0.5f + y2);
+        }
+        if (y1 > y2) {
+            data->glVertex2f(0.5f + x1, 0.5f + y1);
+        } else if (y2 > y1) {
+            data->glVertex2f(0.5f + x2, 0.5f + y2);
+        }
+#endif
+        data->glEnd();
+    }
+}
+
 static int
-GL_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
-              const SDL_Rect * srcrect, const SDL_FRect * dstrect)
+GL_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                   void *vertices, size_t vertsize)
 {
     GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
-    GL_TextureData *texturedata = (GL_TextureData *) texture->driverdata;
-    GLfloat minx, miny, maxx, maxy;
-    GLfloat minu, maxu, minv, maxv;
 
     GL_ActivateRenderer(renderer);
 
-    if (GL_SetupCopy(renderer, texture) < 0) {
-        return -1;
-    }
+    data->glEnableClientState(GL_VERTEX_ARRAY);
+
+    while (cmd) {
+        switch (cmd->command) {
+            case SDL_RENDERCMD_SETVIEWPORT: {
+                const SDL_Rect *viewport = &cmd->data.viewport.rect;
+                if (SDL_memcmp(viewport, &data->drawstate.viewport, sizeof (*viewport)) != 0) {
+                    SDL_memcpy(&data->drawstate.viewport, viewport, sizeof (*viewport));
+                    data->drawstate.viewport_dirty = SDL_TRUE;
+                    /* The scissor is flipped against the viewport height */
+                    data->drawstate.cliprect_dirty = SDL_TRUE;
+                }
+                break;
+            }
 
-    minx = dstrect->x;
-    miny = dstrect->y;
-    maxx = dstrect->x + dstrect->w;
-    maxy = dstrect->y + dstrect->h;
+            case SDL_RENDERCMD_SETCLIPRECT: {
+                const SDL_Rect *rect = &cmd->data.cliprect.rect;
+                if (data->drawstate.cliprect_enabled != cmd->data.cliprect.enabled) {
+                    data->drawstate.cliprect_enabled = cmd->data.cliprect.enabled;
+                    data->drawstate.cliprect_dirty = SDL_TRUE;
+                }
+                if (SDL_memcmp(rect, &data->drawstate.cliprect, sizeof (*rect)) != 0) {
+                    SDL_memcpy(&data->drawstate.cliprect, rect, sizeof (*rect));
+                    data->drawstate.cliprect_dirty = SDL_TRUE;
+                }
+                break;
+            }
 
-    minu = (GLfloat) srcrect->x / texture->w;
-    minu *= texturedata->texw;
-    maxu = (GLfloat) (srcrect->x + srcrect->w) / texture->w;
-    maxu *= texturedata->texw;
-    minv = (GLfloat) srcrect->y / texture->h;
-    minv *= texturedata->texh;
-    maxv = (GLfloat) (srcrect->y + srcrect->h) / texture->h;
-    maxv *= texturedata->texh;
-
-    data->glBegin(GL_TRIANGLE_STRIP);
-    data->glTexCoord2f(minu, minv);
-    data->glVertex2f(minx, miny);
-    data->glTexCoord2f(maxu, minv);
-    data->glVertex2f(maxx, miny);
-    data->glTexCoord2f(minu, maxv);
-    data->glVertex2f(minx, maxy);
-    data->glTexCoord2f(maxu, maxv);
-    data->glVertex2f(maxx, maxy);
-    data->glEnd();
+            case SDL_RENDERCMD_CLEAR: {
+                GL_SetDrawState(renderer);
 
-    data->glDisable(texturedata->type);
+                data->glClearColor((GLfloat) cmd->data.color.r * inv255f,
+                                   (GLfloat) cmd->data.color.g * inv255f,
+                                   (GLfloat) cmd->data.color.b * inv255f,
+                                   (GLfloat) cmd->data.color.a * inv255f);
 
-    return GL_CheckError("", renderer);
-}
+                data->glClear(GL_COLOR_BUFFER_BIT);
+                break;
+            }
 
-static int
-GL_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
-              const SDL_Rect * srcrect, const SDL_FRect * dstrect,
-              const double angle, const SDL_FPoint *center, const SDL_RendererFlip flip)
-{
-    GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
-    GL_TextureData *texturedata = (GL_TextureData *) texture->driverdata;
-    GLfloat minx, miny, maxx, maxy;
-    GLfloat centerx, centery;
-    GLfloat minu, maxu, minv, maxv;
+            case SDL_RENDERCMD_DRAW_POINTS: {
+                const GLfloat *verts = (const GLfloat *) (((Uint8 *) vertices) + cmd->data.draw.first);
+                GL_SetDrawingState(renderer, cmd);
+                data->glVertexPointer(2, GL_FLOAT, 0, verts);
+                data->glDrawArrays(GL_POINTS, 0, (GLsizei) cmd->data.draw.count);
+                break;
+            }
 
-    GL_ActivateRenderer(renderer);
+            case SDL_RENDERCMD_DRAW_LINES: {
+                const GLfloat *verts = (const GLfloat *) (((Uint8 *) vertices) + cmd->data.draw.first);
+                GL_SetDrawingState(renderer, cmd);
+                data->glVertexPointer(2, GL_FLOAT, 0, verts);
+                GL_DrawLines(data, verts, (int) cmd->data.draw.count);
+                break;
+            }
 
-    if (GL_SetupCopy(renderer, texture) < 0) {
-        return -1;
-    }
+            case SDL_RENDERCMD_FILL_RECTS: {
+                const GLfloat *verts = (const GLfloat *) (((Uint8 *) vertices) + cmd->data.draw.first);
+                GL_SetDrawingState(renderer, cmd);
+                data->glVertexPointer(2, GL_FLOAT, 0, verts);
+                data->glDrawArrays(GL_QUADS, 0, (GLsizei) cmd->data.draw.count * 4);
+                break;
+            }
 
-    centerx = center->x;
-    centery = center->y;
+            case SDL_RENDERCMD_COPY:
+            case SDL_RENDERCMD_COPY_EX: {
+                SDL_Texture *texture = cmd->data.draw.texture;
+                GL_TextureData *texturedata = (GL_TextureData *) texture->driverdata;
+                const GLfloat *verts = (const GLfloat *) (((Uint8 *) vertices) + cmd->data.draw.first);
 
-    if (flip & SDL_FLIP_HORIZONTAL) {
-        minx =  dstrect->w - centerx;
-        maxx = -centerx;
-    }
-    else {
-        minx = -centerx;
-        maxx =  dstrect->w - centerx;
-    }
+                if (GL_SetupCopy(renderer, texture, cmd) < 0) {
+                    break;
+                }
+                data->glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+                data->glVertexPointer(2, GL_FLOAT, 4 * sizeof (GLfloat), verts);
+                data->glTexCoordPointer(2, GL_FLOAT, 4 * sizeof (GLfloat), verts + 2);
+                data->glDrawArrays(GL_QUADS, 0, (GLsizei) cmd->data.draw.count * 4);
+                data->glDisableClientState(GL_TEXTURE_COORD_ARRAY);
 
-    if (flip & SDL_FLIP_VERTICAL) {
-        miny =  dstrect->h - centery;
-        maxy = -centery;
-    }
-    else {
-        miny = -centery;
-        maxy =  dstrect->h - centery;
-    }
+                data->glDisable(texturedata->type);
+                break;
+            }
 
-    minu = (GLfloat) srcrect->x / texture->w;
-    minu *= texturedata->texw;
-    maxu = (GLfloat) (srcrect->x + srcrect->w) / texture->w;
-    maxu *= texturedata->texw;
-    minv = (GLfloat) srcrect->y / texture->h;
-    minv *= texturedata->texh;
-    maxv = (GLfloat) (srcrect->y + srcrect->h) / texture->h;
-    maxv *= texturedata->texh;
-
-    /* Translate to flip, rotate, translate to position */
-    data->glPushMatrix();
-    data->glTranslatef((GLfloat)dstrect->x + centerx, (GLfloat)dstrect->y + centery, (GLfloat)0.0);
-    data->glRotated(angle, (GLdouble)0.0, (GLdouble)0.0, (GLdouble)1.0);
-
-    data->glBegin(GL_TRIANGLE_STRIP);
-    data->glTexCoord2f(minu, minv);
-    data->glVertex2f(minx, miny);
-    data->glTexCoord2f(maxu, minv);
-    data->glVertex2f(maxx, miny);
-    data->glTexCoord2f(minu, maxv);
-    data->glVertex2f(minx, maxy);
-    data->glTexCoord2f(maxu, maxv);
-    data->glVertex2f(maxx, maxy);
-    data->glEnd();
-    data->glPopMatrix();
+            case SDL_RENDERCMD_COPY_BATCH: {
+                SDL_Texture *texture = cmd->data.draw.texture;
+                GL_TextureData *texturedata = (GL_TextureData *) texture->driverdata;
+                const GL_ColorVertex *verts = (const GL_ColorVertex *) (((Uint8 *) vertices) + cmd->data.draw.first);
 
-    data->glDisable(texturedata->type);
+                if (GL_SetupCopy(renderer, texture, cmd) < 0) {
+                    break;
+                }
+                data->glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+                data->glEnableClientState(GL_COLOR_ARRAY);
+                data->glVertexPointer(2, GL_FLOAT, sizeof (*verts), &verts->x);
+                data->glTexCoordPointer(2, GL_FLOAT, sizeof (*verts), &verts->u);
+                data->glColorPointer(4, GL_UNSIGNED_BYTE, sizeof (*verts), &verts->color);
+                data->glDrawArrays(GL_QUADS, 0, (GLsizei) cmd->data.draw.count * 4);
+                data->glDisableClientState(GL_COLOR_ARRAY);
+                data->glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+
+                /* The current color is left undefined by the color array */
+                data->glColor4f(0.0f, 0.0f, 0.0f, 0.0f);
+                data->current.color = 0;
+
+                data->glDisable(texturedata->type);
+                break;
+            }
+
+            case SDL_RENDERCMD_GEOMETRY: {
+                SDL_Texture *texture = cmd->data.draw.texture;
+                const GL_ColorVertex *verts = (const GL_ColorVertex *) (((Uint8 *) vertices) + cmd->data.draw.first);
+
+                if (texture) {
+                    if (GL_SetupCopy(renderer, texture, cmd) < 0) {
+                        break;
+                    }
+                    data->glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+                    data->glTexCoordPointer(2, GL_FLOAT, sizeof (*verts), &verts->u);
+                } else {
+                    GL_SetDrawState(renderer);
+                    GL_SetBlendMode(data, cmd->data.draw.blend);
+                    GL_SetShader(data, SHADER_SOLID);
+                }
+                data->glEnableClientState(GL_COLOR_ARRAY);
+                data->glVertexPointer(2, GL_FLOAT, sizeof (*verts), &verts->x);
+                data->glColorPointer(4, GL_UNSIGNED_BYTE, sizeof (*verts), &verts->color);
+                data->glDrawArrays(GL_TRIANGLES, 0, (GLsizei) cmd->data.draw.count);
+                data->glDisableClientState(GL_COLOR_ARRAY);
+
+                /* The current color is left undefined by the color array */
+                data->glColor4f(0.0f, 0.0f, 0.0f, 0.0f);
+                data->current.color = 0;
+
+                if (texture) {
+                    GL_TextureData *texturedata = (GL_TextureData *) texture->driverdata;
+                    data->glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+                    data->glDisable(texturedata->type);
+                }
+                break;
+            }
+
+            case SDL_RENDERCMD_NO_OP:
+                break;
+        }
+
+        cmd = cmd->next;
+    }
+
+    data->glDisableClientState(GL_VERTEX_ARRAY);
 
     return GL_CheckError("", renderer);
 }
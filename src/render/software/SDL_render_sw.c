@@ -33,6 +33,8 @@
 #include "SDL_drawline.h"
 #include "SDL_drawpoint.h"
 #include "SDL_rotate.h"
+#include "SDL_triangle.h"
+#include "../../thread/SDL_thread_c.h"
 
 /* SDL surface based renderer implementation */
 
@@ -41,35 +43,40 @@ static void SW_WindowEvent(SDL_Renderer * renderer,
                            const SDL_WindowEvent *event);
 static int SW_GetOutputSize(SDL_Renderer * renderer, int *w, int *h);
 static int SW_CreateTexture(SDL_Renderer * renderer, SDL_Texture * texture);
-static int SW_SetTextureColorMod(SDL_Renderer * renderer,
-                                 SDL_Texture * texture);
-static int SW_SetTextureAlphaMod(SDL_Renderer * renderer,
-                                 SDL_Texture * texture);
-static int SW_SetTextureBlendMode(SDL_Renderer * renderer,
-                                  SDL_Texture * texture);
+static int SW_CreateTextureFromSurface(SDL_Renderer * renderer, SDL_Texture * texture,
+                                       SDL_Surface * surface);
 static int SW_UpdateTexture(SDL_Renderer * renderer, SDL_Texture * texture,
                             const SDL_Rect * rect, const void *pixels,
                             int pitch);
 static int SW_LockTexture(SDL_Renderer * renderer, SDL_Texture * texture,
                           const SDL_Rect * rect, void **pixels, int *pitch);
 static void SW_UnlockTexture(SDL_Renderer * renderer, SDL_Texture * texture);
+static int SW_SetTextureBuffers(SDL_Renderer * renderer, SDL_Texture * texture,
+                                int buffers);
 static int SW_SetRenderTarget(SDL_Renderer * renderer, SDL_Texture * texture);
-static int SW_UpdateViewport(SDL_Renderer * renderer);
-static int SW_UpdateClipRect(SDL_Renderer * renderer);
-static int SW_RenderClear(SDL_Renderer * renderer);
-static int SW_RenderDrawPoints(SDL_Renderer * renderer,
-                               const SDL_FPoint * points, int count);
-static int SW_RenderDrawLines(SDL_Renderer * renderer,
+static int SW_QueueDrawPoints(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
                               const SDL_FPoint * points, int count);
-static int SW_RenderFillRects(SDL_Renderer * renderer,
-                              const SDL_FRect * rects, int count);
-static int SW_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
-                         const SDL_Rect * srcrect, const SDL_FRect * dstrect);
-static int SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
-                          const SDL_Rect * srcrect, const SDL_FRect * dstrect,
-                          const double angle, const SDL_FPoint * center, const SDL_RendererFlip flip);
+static int SW_QueueFillRects(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                             const SDL_FRect * rects, int count);
+static int SW_QueueCopy(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                        SDL_Texture * texture, const SDL_Rect * srcrect,
+                        const SDL_FRect * dstrect);
+static int SW_QueueCopyEx(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                          SDL_Texture * texture, const SDL_Rect * srcrect,
+                          const SDL_FRect * dstrect, const double angle,
+                          const SDL_FPoint * center, const SDL_RendererFlip flip);
+static int SW_QueueCopyBatch(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                             SDL_Texture * texture,
+                             const SDL_RenderCopyInstance * instances, int count);
+static int SW_QueueGeometry(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                            SDL_Texture * texture, const SDL_Vertex * vertices,
+                            const int * indices, int count,
+                            float scale_x, float scale_y);
+static int SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                              void *vertices, size_t vertsize);
 static int SW_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
                                Uint32 format, void * pixels, int pitch);
+static int SW_GetDamageRects(SDL_Renderer * renderer, const SDL_Rect ** rects);
 static void SW_RenderPresent(SDL_Renderer * renderer);
 static void SW_DestroyTexture(SDL_Renderer * renderer, SDL_Texture * texture);
 static void SW_DestroyRenderer(SDL_Renderer * renderer);
@@ -95,12 +102,148 @@ SDL_RenderDriver SW_RenderDriver = {
      0}
 };
 
+/* The width and height of the tiles drawn in parallel */
+#define SW_TILE_SIZE    64
+
+/* The most separate areas of a surface kept as changed */
+#define SW_MAX_DAMAGE_RECTS 8
+
+/* The most pixel buffers of a streaming texture */
+#define SW_MAX_TEXTURE_BUFFERS  3
+
+/* The buffers of a streaming texture with more than one.  The texture's
+   driverdata is the buffer drawn, and each buffer's userdata points here. */
+typedef struct
+{
+    SDL_Surface *buffers[SW_MAX_TEXTURE_BUFFERS];
+    int num_buffers;
+    int front;                  /* The buffer drawn */
+    int locked;                 /* The buffer handed out by SW_LockTexture() */
+
+    /* The areas where each buffer differs from the front one */
+    SDL_Rect stale[SW_MAX_TEXTURE_BUFFERS][SW_MAX_DAMAGE_RECTS];
+    int num_stale[SW_MAX_TEXTURE_BUFFERS];
+} SW_TextureBuffers;
+
+/* A run of primitives from one command, to be drawn in a tile */
+typedef struct
+{
+    const SDL_RenderCommand *cmd;
+    const SDL_Rect *cliprect;   /* NULL for the whole target */
+    int source;                 /* The texture as an index into sources, or -1 */
+    int first;
+    int count;
+} SW_TileItem;
+
+/* The drawing in one tile, in the order it was queued */
+typedef struct
+{
+    SW_TileItem *items;
+    int num_items;
+    int max_items;
+} SW_TileBin;
+
+/* A texture drawn in tiles.  Each thread reads it through a surface of its
+   own, as blitting changes the blit mapping of the source surface.  These
+   are kept until the texture is destroyed, or draws another buffer. */
+typedef struct
+{
+    SDL_Texture *texture;
+    SDL_Surface *surface;       /* The surface the views share pixels with */
+    SDL_Surface *views[SDL_MAX_PARALLEL_THREADS];
+} SW_TileSource;
+
 typedef struct
 {
     SDL_Surface *surface;
     SDL_Surface *window;
+
+    /* The parts of the window surface drawn since the last present */
+    SDL_Rect damage[SW_MAX_DAMAGE_RECTS];
+    int num_damage;
+
+    /* Kept between frames for SW_RunCommandQueueTiled() */
+    SW_TileBin *bins;
+    int num_bins;
+    SW_TileSource *sources;
+    int num_sources;
+    int max_sources;
+    int last_source;            /* Where the last texture looked up was */
 } SW_RenderData;
 
+/* The vertex data queued for a rotated copy */
+typedef struct
+{
+    SDL_Rect srcrect;
+    SDL_Rect dstrect;
+    double angle;
+    SDL_FPoint center;
+    SDL_RendererFlip flip;
+} SW_CopyExData;
+
+/* The vertex data queued for each copy of a batch */
+typedef struct
+{
+    SW_CopyExData copy;
+    SDL_Color color;
+} SW_CopyBatchData;
+
+
+/* Add an area of a surface to its damage, merging it with the areas
+   already there when that covers no more pixels than keeping them apart,
+   or when there are too many */
+static void
+SW_AddDamage(SDL_Rect * damage, int *num_damage, const SDL_Rect * rect)
+{
+    SDL_Rect area = *rect;
+    SDL_Rect merged;
+    int i, best, best_growth;
+
+    i = 0;
+    while (i < *num_damage) {
+        SDL_UnionRect(&damage[i], &area, &merged);
+        if (merged.w * merged.h <= damage[i].w * damage[i].h + area.w * area.h) {
+            area = merged;
+            damage[i] = damage[--*num_damage];
+            i = 0;  /* The bigger area may take in ones passed over */
+        } else {
+            ++i;
+        }
+    }
+
+    if (*num_damage == SW_MAX_DAMAGE_RECTS) {
+        best = 0;
+        best_growth = 0;
+        for (i = 0; i < *num_damage; ++i) {
+            int growth;
+
+            SDL_UnionRect(&damage[i], &area, &merged);
+            growth = merged.w * merged.h - damage[i].w * damage[i].h;
+            if (i == 0 || growth < best_growth) {
+                best = i;
+                best_growth = growth;
+            }
+        }
+        SDL_UnionRect(&damage[best], &area, &area);
+        damage[best] = damage[--*num_damage];
+        SW_AddDamage(damage, num_damage, &area);
+        return;
+    }
+    damage[(*num_damage)++] = area;
+}
+
+/* The whole window needs to be uploaded at the next present */
+static void
+SW_DamageWindow(SW_RenderData * data)
+{
+    if (data->window) {
+        data->damage[0].x = 0;
+        data->damage[0].y = 0;
+        data->damage[0].w = data->window->w;
+        data->damage[0].h = data->window->h;
+        data->num_damage = 1;
+    }
+}
 
 static SDL_Surface *
 SW_ActivateRenderer(SDL_Renderer * renderer)
@@ -114,9 +257,7 @@ SW_ActivateRenderer(SDL_Renderer * renderer)
         SDL_Surface *surface = SDL_GetWindowSurface(renderer->window);
         if (surface) {
             data->surface = data->window = surface;
-
-            SW_UpdateViewport(renderer);
-            SW_UpdateClipRect(renderer);
+            SW_DamageWindow(data);
         }
     }
     return data->surface;
@@ -151,22 +292,22 @@ SW_CreateRendererForSurface(SDL_Surface * surface)
     renderer->WindowEvent = SW_WindowEvent;
     renderer->GetOutputSize = SW_GetOutputSize;
     renderer->CreateTexture = SW_CreateTexture;
-    renderer->SetTextureColorMod = SW_SetTextureColorMod;
-    renderer->SetTextureAlphaMod = SW_SetTextureAlphaMod;
-    renderer->SetTextureBlendMode = SW_SetTextureBlendMode;
+    renderer->CreateTextureFromSurface = SW_CreateTextureFromSurface;
     renderer->UpdateTexture = SW_UpdateTexture;
     renderer->LockTexture = SW_LockTexture;
     renderer->UnlockTexture = SW_UnlockTexture;
+    renderer->SetTextureBuffers = SW_SetTextureBuffers;
     renderer->SetRenderTarget = SW_SetRenderTarget;
-    renderer->UpdateViewport = SW_UpdateViewport;
-    renderer->UpdateClipRect = SW_UpdateClipRect;
-    renderer->RenderClear = SW_RenderClear;
-    renderer->RenderDrawPoints = SW_RenderDrawPoints;
-    renderer->RenderDrawLines = SW_RenderDrawLines;
-    renderer->RenderFillRects = SW_RenderFillRects;
-    renderer->RenderCopy = SW_RenderCopy;
-    renderer->RenderCopyEx = SW_RenderCopyEx;
+    renderer->QueueDrawPoints = SW_QueueDrawPoints;
+    renderer->QueueDrawLines = SW_QueueDrawPoints;  /* lines and points queue the same way */
+    renderer->QueueFillRects = SW_QueueFillRects;
+    renderer->QueueCopy = SW_QueueCopy;
+    renderer->QueueCopyEx = SW_QueueCopyEx;
+    renderer->QueueCopyBatch = SW_QueueCopyBatch;
+    renderer->QueueGeometry = SW_QueueGeometry;
+    renderer->RunCommandQueue = SW_RunCommandQueue;
     renderer->RenderReadPixels = SW_RenderReadPixels;
+    renderer->GetDamageRects = SW_GetDamageRects;
     renderer->RenderPresent = SW_RenderPresent;
     renderer->DestroyTexture = SW_DestroyTexture;
     renderer->DestroyRenderer = SW_DestroyRenderer;
@@ -182,12 +323,17 @@ SDL_Renderer *
 SW_CreateRenderer(SDL_Window * window, Uint32 flags)
 {
     SDL_Surface *surface;
+    SDL_Renderer *renderer;
 
     surface = SDL_GetWindowSurface(window);
     if (!surface) {
         return NULL;
     }
-    return SW_CreateRendererForSurface(surface);
+    renderer = SW_CreateRendererForSurface(surface);
+    if (renderer) {
+        SW_DamageWindow((SW_RenderData *) renderer->driverdata);
+    }
+    return renderer;
 }
 
 static void
@@ -195,9 +341,19 @@ SW_WindowEvent(SDL_Renderer * renderer, const SDL_WindowEvent *event)
 {
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
 
-    if (event->event == SDL_WINDOWEVENT_SIZE_CHANGED) {
+    switch (event->event) {
+    case SDL_WINDOWEVENT_SIZE_CHANGED:
         data->surface = NULL;
         data->window = NULL;
+        break;
+    case SDL_WINDOWEVENT_SHOWN:
+    case SDL_WINDOWEVENT_EXPOSED:
+    case SDL_WINDOWEVENT_RESTORED:
+        /* The window system may have lost what was shown */
+        SW_DamageWindow(data);
+        break;
+    default:
+        break;
     }
 }
 
@@ -220,55 +376,129 @@ SW_GetOutputSize(SDL_Renderer * renderer, int *w, int *h)
     }
 }
 
+static int
+GetScaleQuality(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY);
+
+    if (!hint || *hint == '0' || SDL_strcasecmp(hint, "nearest") == 0) {
+        return 0;
+    } else {
+        return 1;
+    }
+}
+
+static void
+SW_SetupTextureSurface(SDL_Texture * texture, SDL_Surface * surface)
+{
+    SDL_SetSurfaceColorMod(surface, texture->r, texture->g, texture->b);
+    SDL_SetSurfaceAlphaMod(surface, texture->a);
+    SDL_SetSurfaceBlendMode(surface, texture->blendMode);
+
+    if (GetScaleQuality()) {
+        /* Filtered copies need the plain pixels, so skip RLE for these */
+        SDL_SetSurfaceScaleMode(surface, SDL_SCALEMODE_LINEAR);
+    } else if (texture->access == SDL_TEXTUREACCESS_STATIC) {
+        SDL_SetSurfaceRLE(surface, 1);
+    }
+}
+
 static int
 SW_CreateTexture(SDL_Renderer * renderer, SDL_Texture * texture)
 {
     int bpp;
     Uint32 Rmask, Gmask, Bmask, Amask;
+    SDL_Surface *surface;
 
     if (!SDL_PixelFormatEnumToMasks
         (texture->format, &bpp, &Rmask, &Gmask, &Bmask, &Amask)) {
         return SDL_SetError("Unknown texture format");
     }
 
-    texture->driverdata =
-        SDL_CreateRGBSurface(0, texture->w, texture->h, bpp, Rmask, Gmask,
-                             Bmask, Amask);
-    SDL_SetSurfaceColorMod(texture->driverdata, texture->r, texture->g,
-                           texture->b);
-    SDL_SetSurfaceAlphaMod(texture->driverdata, texture->a);
-    SDL_SetSurfaceBlendMode(texture->driverdata, texture->blendMode);
-
-    if (texture->access == SDL_TEXTUREACCESS_STATIC) {
-        SDL_SetSurfaceRLE(texture->driverdata, 1);
+    surface = SDL_CreateRGBSurface(0, texture->w, texture->h, bpp, Rmask, Gmask,
+                                   Bmask, Amask);
+    if (!surface) {
+        return -1;
     }
+    SW_SetupTextureSurface(texture, surface);
+    texture->driverdata = surface;
+    return 0;
+}
 
-    if (!texture->driverdata) {
+static int
+SW_CreateTextureFromSurface(SDL_Renderer * renderer, SDL_Texture * texture,
+                            SDL_Surface * surface)
+{
+    const SDL_PixelFormat *fmt = surface->format;
+    SDL_Surface *view;
+
+    /* The texture gets a surface of its own over the same pixels, so the
+       texture state never changes the settings of the one passed in */
+    view = SDL_CreateRGBSurfaceFrom(surface->pixels, surface->w, surface->h,
+                                    fmt->BitsPerPixel, surface->pitch,
+                                    fmt->Rmask, fmt->Gmask, fmt->Bmask, fmt->Amask);
+    if (!view) {
         return -1;
     }
+
+    /* Keep the pixels alive until SW_DestroyTexture() */
+    ++surface->refcount;
+    view->userdata = surface;
+
+    SW_SetupTextureSurface(texture, view);
+    texture->driverdata = view;
     return 0;
 }
 
-static int
-SW_SetTextureColorMod(SDL_Renderer * renderer, SDL_Texture * texture)
+/* The buffers of a streaming texture, or NULL if it has just one.  Textures
+   converted to a native one have no surface, their buffers are the native's. */
+static SW_TextureBuffers *
+SW_GetTextureBuffers(SDL_Texture * texture)
 {
     SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
-    return SDL_SetSurfaceColorMod(surface, texture->r, texture->g,
-                                  texture->b);
+
+    if (surface && texture->buffers > 1) {
+        return (SW_TextureBuffers *) surface->userdata;
+    }
+    return NULL;
 }
 
-static int
-SW_SetTextureAlphaMod(SDL_Renderer * renderer, SDL_Texture * texture)
+static void
+SW_CopyRect(SDL_Surface * src, SDL_Surface * dst, const SDL_Rect * rect)
 {
-    SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
-    return SDL_SetSurfaceAlphaMod(surface, texture->a);
+    const int offset = rect->y * src->pitch + rect->x * src->format->BytesPerPixel;
+    const size_t length = rect->w * src->format->BytesPerPixel;
+    const Uint8 *srcrow = (const Uint8 *) src->pixels + offset;
+    Uint8 *dstrow = (Uint8 *) dst->pixels + offset;
+    int row;
+
+    for (row = 0; row < rect->h; ++row) {
+        SDL_memcpy(dstrow, srcrow, length);
+        srcrow += src->pitch;
+        dstrow += dst->pitch;
+    }
 }
 
-static int
-SW_SetTextureBlendMode(SDL_Renderer * renderer, SDL_Texture * texture)
+/* Note that the other buffers differ from the front one in an area */
+static void
+SW_MarkBuffersStale(SDL_Texture * texture, SW_TextureBuffers * buffers,
+                    const SDL_Rect * rect)
 {
-    SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
-    return SDL_SetSurfaceBlendMode(surface, texture->blendMode);
+    SDL_Rect bounds, area;
+    int i;
+
+    bounds.x = 0;
+    bounds.y = 0;
+    bounds.w = texture->w;
+    bounds.h = texture->h;
+    if (!SDL_IntersectRect(rect, &bounds, &area)) {
+        return;
+    }
+    for (i = 0; i < buffers->num_buffers; ++i) {
+        if (i != buffers->front) {
+            SW_AddDamage(buffers->stale[i], &buffers->num_stale[i], &area);
+        }
+    }
 }
 
 static int
@@ -276,6 +506,7 @@ SW_UpdateTexture(SDL_Renderer * renderer, SDL_Texture * texture,
                  const SDL_Rect * rect, const void *pixels, int pitch)
 {
     SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
+    SW_TextureBuffers *buffers = SW_GetTextureBuffers(texture);
     Uint8 *src, *dst;
     int row;
     size_t length;
@@ -294,6 +525,10 @@ SW_UpdateTexture(SDL_Renderer * renderer, SDL_Texture * texture,
     }
     if(SDL_MUSTLOCK(surface))
         SDL_UnlockSurface(surface);
+
+    if (buffers) {
+        SW_MarkBuffersStale(texture, buffers, rect);
+    }
     return 0;
 }
 
@@ -302,6 +537,34 @@ SW_LockTexture(SDL_Renderer * renderer, SDL_Texture * texture,
                const SDL_Rect * rect, void **pixels, int *pitch)
 {
     SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
+    SW_TextureBuffers *buffers = SW_GetTextureBuffers(texture);
+
+    if (buffers) {
+        /* Hand out the buffer drawn longest ago, first bringing it up to
+           date with the front one, apart from areas about to be written */
+        const int back = (buffers->front + 1) % buffers->num_buffers;
+        int i, j;
+
+        for (i = 0; i < buffers->num_stale[back]; ++i) {
+            const SDL_Rect *stale = &buffers->stale[back][i];
+
+            for (j = 0; j < texture->num_locked_rects; ++j) {
+                const SDL_Rect *locked = &texture->locked_rects[j];
+
+                if (locked->x <= stale->x && locked->y <= stale->y &&
+                    locked->x + locked->w >= stale->x + stale->w &&
+                    locked->y + locked->h >= stale->y + stale->h) {
+                    break;
+                }
+            }
+            if (j == texture->num_locked_rects) {
+                SW_CopyRect(surface, buffers->buffers[back], stale);
+            }
+        }
+        buffers->num_stale[back] = 0;
+        buffers->locked = back;
+        surface = buffers->buffers[back];
+    }
 
     *pixels =
         (void *) ((Uint8 *) surface->pixels + rect->y * surface->pitch +
@@ -313,296 +576,253 @@ SW_LockTexture(SDL_Renderer * renderer, SDL_Texture * texture,
 static void
 SW_UnlockTexture(SDL_Renderer * renderer, SDL_Texture * texture)
 {
+    SW_TextureBuffers *buffers = SW_GetTextureBuffers(texture);
+    int i;
+
+    if (buffers) {
+        /* Show the buffer written, the others now differ where it was */
+        buffers->front = buffers->locked;
+        texture->driverdata = buffers->buffers[buffers->front];
+        for (i = 0; i < texture->num_locked_rects; ++i) {
+            SW_MarkBuffersStale(texture, buffers, &texture->locked_rects[i]);
+        }
+    }
 }
 
 static int
-SW_SetRenderTarget(SDL_Renderer * renderer, SDL_Texture * texture)
+SW_SetTextureBuffers(SDL_Renderer * renderer, SDL_Texture * texture,
+                     int buffers)
 {
-    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+    SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
+    const SDL_PixelFormat *fmt = surface->format;
+    SW_TextureBuffers *old_buffers = SW_GetTextureBuffers(texture);
+    SW_TextureBuffers *new_buffers = NULL;
+    int i;
 
-    if (texture ) {
-        data->surface = (SDL_Surface *) texture->driverdata;
-    } else {
-        data->surface = data->window;
+    if (buffers > SW_MAX_TEXTURE_BUFFERS) {
+        return SDL_SetError("Textures can have at most %d buffers", SW_MAX_TEXTURE_BUFFERS);
+    }
+    if (surface->flags & SDL_PREALLOC) {
+        return SDL_SetError("Textures using the pixels of a surface have one buffer");
+    }
+
+    if (buffers > 1) {
+        new_buffers = (SW_TextureBuffers *) SDL_calloc(1, sizeof(*new_buffers));
+        if (!new_buffers) {
+            return SDL_OutOfMemory();
+        }
+        new_buffers->num_buffers = buffers;
+        new_buffers->buffers[0] = surface;
+        for (i = 1; i < buffers; ++i) {
+            SDL_Surface *buffer = SDL_CreateRGBSurface(0, surface->w, surface->h,
+                                                       fmt->BitsPerPixel, fmt->Rmask,
+                                                       fmt->Gmask, fmt->Bmask, fmt->Amask);
+            if (!buffer) {
+                while (--i > 0) {
+                    SDL_FreeSurface(new_buffers->buffers[i]);
+                }
+                SDL_free(new_buffers);
+                return -1;
+            }
+            SW_SetupTextureSurface(texture, buffer);
+            buffer->userdata = new_buffers;
+
+            /* Copied from the front buffer when first locked */
+            new_buffers->stale[i][0].w = surface->w;
+            new_buffers->stale[i][0].h = surface->h;
+            new_buffers->num_stale[i] = 1;
+            new_buffers->buffers[i] = buffer;
+        }
+    }
+
+    if (old_buffers) {
+        for (i = 0; i < old_buffers->num_buffers; ++i) {
+            if (old_buffers->buffers[i] != surface) {
+                SDL_FreeSurface(old_buffers->buffers[i]);
+            }
+        }
+        SDL_free(old_buffers);
     }
+    surface->userdata = new_buffers;
     return 0;
 }
 
 static int
-SW_UpdateViewport(SDL_Renderer * renderer)
+SW_SetRenderTarget(SDL_Renderer * renderer, SDL_Texture * texture)
 {
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
-    SDL_Surface *surface = data->surface;
 
-    if (!surface) {
-        /* We'll update the viewport after we recreate the surface */
-        return 0;
+    if (texture ) {
+        data->surface = (SDL_Surface *) texture->driverdata;
+    } else {
+        data->surface = data->window;
     }
-
-    SDL_SetClipRect(data->surface, &renderer->viewport);
     return 0;
 }
 
-static int
-SW_UpdateClipRect(SDL_Renderer * renderer)
+/* Round the edges of a float rectangle to whole pixels, covering the pixels
+   whose centers are inside it, as the hardware renderers do.  Rounding the
+   edges rather than truncating position and size keeps the size of a moving
+   rectangle steady. */
+static void
+SW_RoundRect(const SDL_FRect * frect, int x, int y, SDL_Rect * rect)
 {
-    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
-    SDL_Surface *surface = data->surface;
-    if (surface) {
-        if (renderer->clipping_enabled) {
-            SDL_SetClipRect(surface, &renderer->clip_rect);
-        } else {
-            SDL_SetClipRect(surface, NULL);
-        }
-    }
-    return 0;
+    const int x1 = (int) SDL_floor(frect->x + 0.5f);
+    const int y1 = (int) SDL_floor(frect->y + 0.5f);
+    const int x2 = (int) SDL_floor(frect->x + frect->w + 0.5f);
+    const int y2 = (int) SDL_floor(frect->y + frect->h + 0.5f);
+
+    rect->x = x + x1;
+    rect->y = y + y1;
+    rect->w = x2 - x1;
+    rect->h = y2 - y1;
 }
 
 static int
-SW_RenderClear(SDL_Renderer * renderer)
+SW_QueueDrawPoints(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                   const SDL_FPoint * points, int count)
 {
-    SDL_Surface *surface = SW_ActivateRenderer(renderer);
-    Uint32 color;
-    SDL_Rect clip_rect;
+    SDL_Point *verts = (SDL_Point *) SDL_AllocateRenderVertices(renderer, count * sizeof(SDL_Point));
+    const int x = renderer->viewport.x;
+    const int y = renderer->viewport.y;
+    int i;
 
-    if (!surface) {
+    if (!verts) {
         return -1;
     }
-
-    color = SDL_MapRGBA(surface->format,
-                        renderer->r, renderer->g, renderer->b, renderer->a);
-
-    /* By definition the clear ignores the clip rect */
-    clip_rect = surface->clip_rect;
-    SDL_SetClipRect(surface, NULL);
-    SDL_FillRect(surface, NULL, color);
-    SDL_SetClipRect(surface, &clip_rect);
+    for (i = 0; i < count; ++i) {
+        verts[i].x = x + (int) SDL_floor(points[i].x);
+        verts[i].y = y + (int) SDL_floor(points[i].y);
+    }
     return 0;
 }
 
 static int
-SW_RenderDrawPoints(SDL_Renderer * renderer, const SDL_FPoint * points,
-                    int count)
+SW_QueueFillRects(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                  const SDL_FRect * rects, int count)
 {
-    SDL_Surface *surface = SW_ActivateRenderer(renderer);
-    SDL_Point *final_points;
-    int i, status;
+    SDL_Rect *verts = (SDL_Rect *) SDL_AllocateRenderVertices(renderer, count * sizeof(SDL_Rect));
+    const int x = renderer->viewport.x;
+    const int y = renderer->viewport.y;
+    int i;
 
-    if (!surface) {
+    if (!verts) {
         return -1;
     }
-
-    final_points = SDL_stack_alloc(SDL_Point, count);
-    if (!final_points) {
-        return SDL_OutOfMemory();
-    }
-    if (renderer->viewport.x || renderer->viewport.y) {
-        int x = renderer->viewport.x;
-        int y = renderer->viewport.y;
-
-        for (i = 0; i < count; ++i) {
-            final_points[i].x = (int)(x + points[i].x);
-            final_points[i].y = (int)(y + points[i].y);
-        }
-    } else {
-        for (i = 0; i < count; ++i) {
-            final_points[i].x = (int)points[i].x;
-            final_points[i].y = (int)points[i].y;
-        }
-    }
-
-    /* Draw the points! */
-    if (renderer->blendMode == SDL_BLENDMODE_NONE) {
-        Uint32 color = SDL_MapRGBA(surface->format,
-                                   renderer->r, renderer->g, renderer->b,
-                                   renderer->a);
-
-        status = SDL_DrawPoints(surface, final_points, count, color);
-    } else {
-        status = SDL_BlendPoints(surface, final_points, count,
-                                renderer->blendMode,
-                                renderer->r, renderer->g, renderer->b,
-                                renderer->a);
+    for (i = 0; i < count; ++i) {
+        SW_RoundRect(&rects[i], x, y, &verts[i]);
+        verts[i].w = SDL_max(verts[i].w, 1);
+        verts[i].h = SDL_max(verts[i].h, 1);
     }
-    SDL_stack_free(final_points);
-
-    return status;
+    return 0;
 }
 
 static int
-SW_RenderDrawLines(SDL_Renderer * renderer, const SDL_FPoint * points,
-                   int count)
+SW_QueueCopy(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+             SDL_Texture * texture, const SDL_Rect * srcrect,
+             const SDL_FRect * dstrect)
 {
-    SDL_Surface *surface = SW_ActivateRenderer(renderer);
-    SDL_Point *final_points;
-    int i, status;
+    SDL_Rect *verts = (SDL_Rect *) SDL_AllocateRenderVertices(renderer, 2 * sizeof(SDL_Rect));
 
-    if (!surface) {
+    if (!verts) {
         return -1;
     }
-
-    final_points = SDL_stack_alloc(SDL_Point, count);
-    if (!final_points) {
-        return SDL_OutOfMemory();
-    }
-    if (renderer->viewport.x || renderer->viewport.y) {
-        int x = renderer->viewport.x;
-        int y = renderer->viewport.y;
-
-        for (i = 0; i < count; ++i) {
-            final_points[i].x = (int)(x + points[i].x);
-            final_points[i].y = (int)(y + points[i].y);
-        }
-    } else {
-        for (i = 0; i < count; ++i) {
-            final_points[i].x = (int)points[i].x;
-            final_points[i].y = (int)points[i].y;
-        }
-    }
-
-    /* Draw the lines! */
-    if (renderer->blendMode == SDL_BLENDMODE_NONE) {
-        Uint32 color = SDL_MapRGBA(surface->format,
-                                   renderer->r, renderer->g, renderer->b,
-                                   renderer->a);
-
-        status = SDL_DrawLines(surface, final_points, count, color);
-    } else {
-        status = SDL_BlendLines(surface, final_points, count,
-                                renderer->blendMode,
-                                renderer->r, renderer->g, renderer->b,
-                                renderer->a);
-    }
-    SDL_stack_free(final_points);
-
-    return status;
+    verts[0] = *srcrect;
+    SW_RoundRect(dstrect, renderer->viewport.x, renderer->viewport.y, &verts[1]);
+    return 0;
 }
 
 static int
-SW_RenderFillRects(SDL_Renderer * renderer, const SDL_FRect * rects, int count)
+SW_QueueCopyEx(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+               SDL_Texture * texture, const SDL_Rect * srcrect,
+               const SDL_FRect * dstrect, const double angle,
+               const SDL_FPoint * center, const SDL_RendererFlip flip)
 {
-    SDL_Surface *surface = SW_ActivateRenderer(renderer);
-    SDL_Rect *final_rects;
-    int i, status;
+    SW_CopyExData *verts = (SW_CopyExData *) SDL_AllocateRenderVertices(renderer, sizeof(SW_CopyExData));
 
-    if (!surface) {
+    if (!verts) {
         return -1;
     }
-
-    final_rects = SDL_stack_alloc(SDL_Rect, count);
-    if (!final_rects) {
-        return SDL_OutOfMemory();
-    }
-    if (renderer->viewport.x || renderer->viewport.y) {
-        int x = renderer->viewport.x;
-        int y = renderer->viewport.y;
-
-        for (i = 0; i < count; ++i) {
-            final_rects[i].x = (int)(x + rects[i].x);
-            final_rects[i].y = (int)(y + rects[i].y);
-            final_rects[i].w = SDL_max((int)rects[i].w, 1);
-            final_rects[i].h = SDL_max((int)rects[i].h, 1);
-        }
-    } else {
-        for (i = 0; i < count; ++i) {
-            final_rects[i].x = (int)rects[i].x;
-            final_rects[i].y = (int)rects[i].y;
-            final_rects[i].w = SDL_max((int)rects[i].w, 1);
-            final_rects[i].h = SDL_max((int)rects[i].h, 1);
-        }
-    }
-
-    if (renderer->blendMode == SDL_BLENDMODE_NONE) {
-        Uint32 color = SDL_MapRGBA(surface->format,
-                                   renderer->r, renderer->g, renderer->b,
-                                   renderer->a);
-        status = SDL_FillRects(surface, final_rects, count, color);
-    } else {
-        status = SDL_BlendFillRects(surface, final_rects, count,
-                                    renderer->blendMode,
-                                    renderer->r, renderer->g, renderer->b,
-                                    renderer->a);
-    }
-    SDL_stack_free(final_rects);
-
-    return status;
+    verts->srcrect = *srcrect;
+    SW_RoundRect(dstrect, renderer->viewport.x, renderer->viewport.y, &verts->dstrect);
+    verts->angle = angle;
+    verts->center = *center;
+    verts->flip = flip;
+    return 0;
 }
 
 static int
-SW_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
-              const SDL_Rect * srcrect, const SDL_FRect * dstrect)
+SW_QueueCopyBatch(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                  SDL_Texture * texture,
+                  const SDL_RenderCopyInstance * instances, int count)
 {
-    SDL_Surface *surface = SW_ActivateRenderer(renderer);
-    SDL_Surface *src = (SDL_Surface *) texture->driverdata;
-    SDL_Rect final_rect;
+    SW_CopyBatchData *verts = (SW_CopyBatchData *) SDL_AllocateRenderVertices(renderer, count * sizeof(SW_CopyBatchData));
+    int i;
 
-    if (!surface) {
+    if (!verts) {
         return -1;
     }
-
-    if (renderer->viewport.x || renderer->viewport.y) {
-        final_rect.x = (int)(renderer->viewport.x + dstrect->x);
-        final_rect.y = (int)(renderer->viewport.y + dstrect->y);
-    } else {
-        final_rect.x = (int)dstrect->x;
-        final_rect.y = (int)dstrect->y;
-    }
-    final_rect.w = (int)dstrect->w;
-    final_rect.h = (int)dstrect->h;
-
-    if ( srcrect->w == final_rect.w && srcrect->h == final_rect.h ) {
-        return SDL_BlitSurface(src, srcrect, surface, &final_rect);
-    } else {
-        return SDL_BlitScaled(src, srcrect, surface, &final_rect);
+    for (i = 0; i < count; ++i, ++verts) {
+        const SDL_RenderCopyInstance *instance = &instances[i];
+
+        verts->copy.srcrect = instance->srcrect;
+        SW_RoundRect(&instance->dstrect, renderer->viewport.x, renderer->viewport.y, &verts->copy.dstrect);
+        verts->copy.angle = instance->angle;
+        verts->copy.center = instance->center;
+        verts->copy.flip = instance->flip;
+        verts->color = instance->color;
     }
+    return 0;
 }
 
 static int
-GetScaleQuality(void)
+SW_QueueGeometry(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                 SDL_Texture * texture, const SDL_Vertex * vertices,
+                 const int * indices, int count,
+                 float scale_x, float scale_y)
 {
-    const char *hint = SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY);
-
-    if (!hint || *hint == '0' || SDL_strcasecmp(hint, "nearest") == 0) {
-        return 0;
-    } else {
-        return 1;
+    SDL_TriangleVertex *verts = (SDL_TriangleVertex *) SDL_AllocateRenderVertices(renderer, count * sizeof(SDL_TriangleVertex));
+    const float x = (float) renderer->viewport.x;
+    const float y = (float) renderer->viewport.y;
+    const float w = texture ? (float) texture->w : 0.0f;
+    const float h = texture ? (float) texture->h : 0.0f;
+    int i;
+
+    if (!verts) {
+        return -1;
+    }
+    for (i = 0; i < count; ++i, ++verts) {
+        const SDL_Vertex *vertex = &vertices[indices ? indices[i] : i];
+
+        verts->x = x + vertex->position.x * scale_x;
+        verts->y = y + vertex->position.y * scale_y;
+        verts->color = vertex->color;
+        verts->u = vertex->tex_coord.x * w;
+        verts->v = vertex->tex_coord.y * h;
     }
+    return 0;
 }
 
+/* Rotate through scratch surfaces, for targets SDL_DrawQuad() can't draw to */
 static int
-SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
-                const SDL_Rect * srcrect, const SDL_FRect * dstrect,
-                const double angle, const SDL_FPoint * center, const SDL_RendererFlip flip)
+SW_RenderCopyExRotozoom(SDL_Surface * surface, SDL_Surface * src,
+                        const SDL_Rect * srcrect, const SDL_Rect * final_rect,
+                        const double angle, const SDL_FPoint * center, const SDL_RendererFlip flip)
 {
-    SDL_Surface *surface = SW_ActivateRenderer(renderer);
-    SDL_Surface *src = (SDL_Surface *) texture->driverdata;
-    SDL_Rect final_rect, tmp_rect;
+    SDL_Rect tmp_rect;
     SDL_Surface *surface_rotated, *surface_scaled;
-    Uint32 colorkey;
+    Uint32 colorkey = 0;
+    SDL_BlendMode blendMode;
     int retval, dstwidth, dstheight, abscenterx, abscentery;
     double cangle, sangle, px, py, p1x, p1y, p2x, p2y, p3x, p3y, p4x, p4y;
 
-    if (!surface) {
-        return -1;
-    }
-
-    if (renderer->viewport.x || renderer->viewport.y) {
-        final_rect.x = (int)(renderer->viewport.x + dstrect->x);
-        final_rect.y = (int)(renderer->viewport.y + dstrect->y);
-    } else {
-        final_rect.x = (int)dstrect->x;
-        final_rect.y = (int)dstrect->y;
-    }
-    final_rect.w = (int)dstrect->w;
-    final_rect.h = (int)dstrect->h;
-
-    surface_scaled = SDL_CreateRGBSurface(SDL_SWSURFACE, final_rect.w, final_rect.h, src->format->BitsPerPixel,
+    surface_scaled = SDL_CreateRGBSurface(SDL_SWSURFACE, final_rect->w, final_rect->h, src->format->BitsPerPixel,
                                           src->format->Rmask, src->format->Gmask,
                                           src->format->Bmask, src->format->Amask );
     if (surface_scaled) {
         SDL_GetColorKey(src, &colorkey);
         SDL_SetColorKey(surface_scaled, SDL_TRUE, colorkey);
-        tmp_rect = final_rect;
+        tmp_rect = *final_rect;
         tmp_rect.x = 0;
         tmp_rect.y = 0;
 
@@ -611,33 +831,42 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
             SDLgfx_rotozoomSurfaceSizeTrig(tmp_rect.w, tmp_rect.h, -angle, &dstwidth, &dstheight, &cangle, &sangle);
             surface_rotated = SDLgfx_rotateSurface(surface_scaled, -angle, dstwidth/2, dstheight/2, GetScaleQuality(), flip & SDL_FLIP_HORIZONTAL, flip & SDL_FLIP_VERTICAL, dstwidth, dstheight, cangle, sangle);
             if(surface_rotated) {
+                /* The corners uncovered by the rotation are keyed out, or left
+                   fully transparent when blending; the target blitters only
+                   handle one of the two at a time */
+                SDL_GetSurfaceBlendMode(src, &blendMode);
+                SDL_SetSurfaceBlendMode(surface_rotated, blendMode);
+                if (blendMode != SDL_BLENDMODE_NONE && surface_rotated->format->Amask) {
+                    SDL_SetColorKey(surface_rotated, SDL_FALSE, 0);
+                }
+
                 /* Find out where the new origin is by rotating the four final_rect points around the center and then taking the extremes */
-                abscenterx = final_rect.x + (int)center->x;
-                abscentery = final_rect.y + (int)center->y;
+                abscenterx = final_rect->x + (int)center->x;
+                abscentery = final_rect->y + (int)center->y;
                 /* Compensate the angle inversion to match the behaviour of the other backends */
                 sangle = -sangle;
 
                 /* Top Left */
-                px = final_rect.x - abscenterx;
-                py = final_rect.y - abscentery;
+                px = final_rect->x - abscenterx;
+                py = final_rect->y - abscentery;
                 p1x = px * cangle - py * sangle + abscenterx;
                 p1y = px * sangle + py * cangle + abscentery;
 
                 /* Top Right */
-                px = final_rect.x + final_rect.w - abscenterx;
-                py = final_rect.y - abscentery;
+                px = final_rect->x + final_rect->w - abscenterx;
+                py = final_rect->y - abscentery;
                 p2x = px * cangle - py * sangle + abscenterx;
                 p2y = px * sangle + py * cangle + abscentery;
 
                 /* Bottom Left */
-                px = final_rect.x - abscenterx;
-                py = final_rect.y + final_rect.h - abscentery;
+                px = final_rect->x - abscenterx;
+                py = final_rect->y + final_rect->h - abscentery;
                 p3x = px * cangle - py * sangle + abscenterx;
                 p3y = px * sangle + py * cangle + abscentery;
 
                 /* Bottom Right */
-                px = final_rect.x + final_rect.w - abscenterx;
-                py = final_rect.y + final_rect.h - abscentery;
+                px = final_rect->x + final_rect->w - abscenterx;
+                py = final_rect->y + final_rect->h - abscentery;
                 p4x = px * cangle - py * sangle + abscenterx;
                 p4y = px * sangle + py * cangle + abscentery;
 
@@ -658,57 +887,1073 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
     return -1;
 }
 
+/* The corners of a rotated copy on the target, clockwise from the one that
+   is top left before rotating */
+static void
+SW_GetCopyExCorners(const SDL_Rect * final_rect, const double angle,
+                    const SDL_FPoint * center, SDL_FPoint corners[4])
+{
+    const float cx = final_rect->x + center->x;
+    const float cy = final_rect->y + center->y;
+    const float cangle = (float) SDL_cos(angle * (M_PI / 180.0));
+    const float sangle = (float) SDL_sin(angle * (M_PI / 180.0));
+    int i;
+
+    corners[0].x = (float) final_rect->x;
+    corners[0].y = (float) final_rect->y;
+    corners[1].x = (float) (final_rect->x + final_rect->w);
+    corners[1].y = (float) final_rect->y;
+    corners[2].x = (float) (final_rect->x + final_rect->w);
+    corners[2].y = (float) (final_rect->y + final_rect->h);
+    corners[3].x = (float) final_rect->x;
+    corners[3].y = (float) (final_rect->y + final_rect->h);
+    for (i = 0; i < 4; ++i) {
+        const float px = corners[i].x - cx;
+        const float py = corners[i].y - cy;
+
+        corners[i].x = px * cangle - py * sangle + cx;
+        corners[i].y = px * sangle + py * cangle + cy;
+    }
+}
+
 static int
-SW_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
-                    Uint32 format, void * pixels, int pitch)
+SW_BlitCopy(SDL_Surface * src, const SDL_Rect * srcrect,
+            SDL_Surface * surface, const SDL_Rect * dstrect)
 {
-    SDL_Surface *surface = SW_ActivateRenderer(renderer);
-    Uint32 src_format;
-    void *src_pixels;
-    SDL_Rect final_rect;
+    SDL_Rect final_srcrect = *srcrect;
+    SDL_Rect final_dstrect = *dstrect;
 
-    if (!surface) {
-        return -1;
+    if (srcrect->w == dstrect->w && srcrect->h == dstrect->h) {
+        return SDL_BlitSurface(src, &final_srcrect, surface, &final_dstrect);
+    } else {
+        return SDL_BlitScaled(src, &final_srcrect, surface, &final_dstrect);
     }
+}
 
-    if (renderer->viewport.x || renderer->viewport.y) {
-        final_rect.x = renderer->viewport.x + rect->x;
-        final_rect.y = renderer->viewport.y + rect->y;
-        final_rect.w = rect->w;
-        final_rect.h = rect->h;
-        rect = &final_rect;
+/* Straight copies are blitted the same way as SDL_RenderCopy().  Rotated
+   and flipped ones sample the texture at pixel centers, which picks the same
+   pixels as the blit only when they aren't scaled. */
+static int
+SW_RenderCopyEx(SDL_Surface * surface, SDL_Surface * src,
+                const SDL_Rect * srcrect, const SDL_Rect * final_rect,
+                const double angle, const SDL_FPoint * center, const SDL_RendererFlip flip)
+{
+    SDL_FPoint positions[4];
+    float u0 = (float) srcrect->x, u1 = (float) (srcrect->x + srcrect->w);
+    float v0 = (float) srcrect->y, v1 = (float) (srcrect->y + srcrect->h);
+    SDL_TriangleVertex corners[4];
+    SDL_BlendMode blendMode;
+    Uint8 r, g, b, a;
+    int i;
+
+    if (angle == 0.0 && flip == SDL_FLIP_NONE) {
+        return SW_BlitCopy(src, srcrect, surface, final_rect);
+    }
+    if (surface->format->BytesPerPixel < 2) {
+        return SW_RenderCopyExRotozoom(surface, src, srcrect, final_rect, angle, center, flip);
     }
 
-    if (rect->x < 0 || rect->x+rect->w > surface->w ||
-        rect->y < 0 || rect->y+rect->h > surface->h) {
-        return SDL_SetError("Tried to read outside of surface bounds");
+    if (flip & SDL_FLIP_HORIZONTAL) {
+        const float tmp = u0; u0 = u1; u1 = tmp;
+    }
+    if (flip & SDL_FLIP_VERTICAL) {
+        const float tmp = v0; v0 = v1; v1 = tmp;
     }
 
-    src_format = surface->format->format;
-    src_pixels = (void*)((Uint8 *) surface->pixels +
-                    rect->y * surface->pitch +
-                    rect->x * surface->format->BytesPerPixel);
+    /* Map the corners straight to the target, the texture is sampled back
+       through the same transform one pixel at a time */
+    SW_GetCopyExCorners(final_rect, angle, center, positions);
+    corners[0].u = u0;
+    corners[0].v = v0;
+    corners[1].u = u1;
+    corners[1].v = v0;
+    corners[2].u = u1;
+    corners[2].v = v1;
+    corners[3].u = u0;
+    corners[3].v = v1;
+    for (i = 0; i < 4; ++i) {
+        corners[i].x = positions[i].x;
+        corners[i].y = positions[i].y;
+        corners[i].color.r = corners[i].color.g = corners[i].color.b = corners[i].color.a = 255;
+    }
 
-    return SDL_ConvertPixels(rect->w, rect->h,
-                             src_format, src_pixels, surface->pitch,
+    SDL_GetSurfaceColorMod(src, &r, &g, &b);
+    SDL_GetSurfaceAlphaMod(src, &a);
+    SDL_GetSurfaceBlendMode(src, &blendMode);
+    return SDL_DrawQuad(surface, src, srcrect, corners, blendMode, r, g, b, a);
+}
+
+/* The viewport and clip rectangle as of the command being run */
+typedef struct
+{
+    const SDL_Rect *viewport;
+    const SDL_Rect *cliprect;
+    SDL_bool surface_cliprect_dirty;
+} SW_DrawStateCache;
+
+static void
+SetDrawState(SDL_Surface *surface, SW_DrawStateCache *drawstate)
+{
+    if (drawstate->surface_cliprect_dirty) {
+        if (drawstate->cliprect) {
+            SDL_SetClipRect(surface, drawstate->cliprect);
+        } else {
+            SDL_SetClipRect(surface, drawstate->viewport);
+        }
+        drawstate->surface_cliprect_dirty = SDL_FALSE;
+    }
+}
+
+static void
+SetTextureState(SDL_Surface *src, const SDL_RenderCommand *cmd)
+{
+    SDL_SetSurfaceColorMod(src, cmd->data.draw.r, cmd->data.draw.g, cmd->data.draw.b);
+    SDL_SetSurfaceAlphaMod(src, cmd->data.draw.a);
+    SDL_SetSurfaceBlendMode(src, cmd->data.draw.blend);
+}
+
+/* Draw the primitives first to first + count - 1 of a command, within the
+   clip rect of the surface.  A clear fills the clip rect, and a line strip
+   is always drawn whole. */
+static int
+SW_DrawPrimitives(SDL_Surface * surface, SDL_Surface * src,
+                  const SDL_RenderCommand * cmd, const void * vertices,
+                  int first, int count)
+{
+    const Uint8 *verts = (const Uint8 *) vertices;
+    int status = 0;
+    int i;
+
+    switch (cmd->command) {
+    case SDL_RENDERCMD_CLEAR: {
+        const Uint32 color = SDL_MapRGBA(surface->format,
+                                         cmd->data.color.r, cmd->data.color.g,
+                                         cmd->data.color.b, cmd->data.color.a);
+
+        return SDL_FillRect(surface, NULL, color);
+    }
+
+    case SDL_RENDERCMD_DRAW_POINTS:
+    case SDL_RENDERCMD_DRAW_LINES: {
+        const SDL_Point *points = (const SDL_Point *) (verts + cmd->data.draw.first) + first;
+        const SDL_bool lines = (cmd->command == SDL_RENDERCMD_DRAW_LINES);
+
+        if (cmd->data.draw.blend == SDL_BLENDMODE_NONE) {
+            const Uint32 color = SDL_MapRGBA(surface->format,
+                                             cmd->data.draw.r, cmd->data.draw.g,
+                                             cmd->data.draw.b, cmd->data.draw.a);
+            if (lines) {
+                return SDL_DrawLines(surface, points, count, color);
+            } else {
+                return SDL_DrawPoints(surface, points, count, color);
+            }
+        } else if (lines) {
+            return SDL_BlendLines(surface, points, count, cmd->data.draw.blend,
+                                  cmd->data.draw.r, cmd->data.draw.g,
+                                  cmd->data.draw.b, cmd->data.draw.a);
+        } else {
+            return SDL_BlendPoints(surface, points, count, cmd->data.draw.blend,
+                                   cmd->data.draw.r, cmd->data.draw.g,
+                                   cmd->data.draw.b, cmd->data.draw.a);
+        }
+    }
+
+    case SDL_RENDERCMD_FILL_RECTS: {
+        const SDL_Rect *rects = (const SDL_Rect *) (verts + cmd->data.draw.first) + first;
+
+        if (cmd->data.draw.blend == SDL_BLENDMODE_NONE) {
+            const Uint32 color = SDL_MapRGBA(surface->format,
+                                             cmd->data.draw.r, cmd->data.draw.g,
+                                             cmd->data.draw.b, cmd->data.draw.a);
+            return SDL_FillRects(surface, rects, count, color);
+        } else {
+            return SDL_BlendFillRects(surface, rects, count, cmd->data.draw.blend,
+                                      cmd->data.draw.r, cmd->data.draw.g,
+                                      cmd->data.draw.b, cmd->data.draw.a);
+        }
+    }
+
+    case SDL_RENDERCMD_COPY: {
+        const SDL_Rect *rects = (const SDL_Rect *) (verts + cmd->data.draw.first) + 2 * first;
+
+        SetTextureState(src, cmd);
+
+        for (i = 0; i < count; ++i, rects += 2) {
+            if (SW_BlitCopy(src, &rects[0], surface, &rects[1]) < 0) {
+                status = -1;
+            }
+        }
+        return status;
+    }
+
+    case SDL_RENDERCMD_COPY_EX: {
+        const SW_CopyExData *copydata = (const SW_CopyExData *) (verts + cmd->data.draw.first) + first;
+
+        SetTextureState(src, cmd);
+
+        for (i = 0; i < count; ++i, ++copydata) {
+            if (SW_RenderCopyEx(surface, src, &copydata->srcrect, &copydata->dstrect,
+                                copydata->angle, &copydata->center, copydata->flip) < 0) {
+                status = -1;
+            }
+        }
+        return status;
+    }
+
+    case SDL_RENDERCMD_COPY_BATCH: {
+        const SW_CopyBatchData *copydata = (const SW_CopyBatchData *) (verts + cmd->data.draw.first) + first;
+        SDL_Color color;
+
+        SetTextureState(src, cmd);
+        color.r = cmd->data.draw.r;
+        color.g = cmd->data.draw.g;
+        color.b = cmd->data.draw.b;
+        color.a = cmd->data.draw.a;
+
+        for (i = 0; i < count; ++i, ++copydata) {
+            const SW_CopyExData *copy = &copydata->copy;
+            int result;
+
+            if (copydata->color.r != color.r || copydata->color.g != color.g ||
+                copydata->color.b != color.b || copydata->color.a != color.a) {
+                color = copydata->color;
+                SDL_SetSurfaceColorMod(src, color.r, color.g, color.b);
+                SDL_SetSurfaceAlphaMod(src, color.a);
+            }
+
+            if (copy->angle != 0.0 || copy->flip != SDL_FLIP_NONE) {
+                result = SW_RenderCopyEx(surface, src, &copy->srcrect, &copy->dstrect,
+                                         copy->angle, &copy->center, copy->flip);
+            } else {
+                result = SW_BlitCopy(src, &copy->srcrect, surface, &copy->dstrect);
+            }
+            if (result < 0) {
+                status = -1;
+            }
+        }
+        return status;
+    }
+
+    case SDL_RENDERCMD_GEOMETRY: {
+        const SDL_TriangleVertex *triangles = (const SDL_TriangleVertex *) (verts + cmd->data.draw.first) + first;
+
+        /* Solid triangles take their color from the vertices alone */
+        if (src) {
+            return SDL_DrawTriangles(surface, src, triangles, count, cmd->data.draw.blend,
+                                     cmd->data.draw.r, cmd->data.draw.g,
+                                     cmd->data.draw.b, cmd->data.draw.a);
+        } else {
+            return SDL_DrawTriangles(surface, NULL, triangles, count,
+                                     cmd->data.draw.blend, 255, 255, 255, 255);
+        }
+    }
+
+    default:
+        return 0;
+    }
+}
+
+/* Drawing in tiles
+ *
+ * The queue is sorted into SW_TILE_SIZE square tiles of the target, and
+ * threads take turns drawing whole tiles, so no two draw the same pixel.
+ * Each thread draws through surfaces of its own that share the pixels of
+ * the target and the textures, with the clip rect cut down to the tile.
+ *
+ * Only primitives that draw exactly the same pixels however they're clipped
+ * can be drawn piecewise like this.  Sloped lines and scaled blits step from
+ * where they were clipped, so when one of those crosses tiles, the tiles
+ * queued so far are drawn and then it is drawn whole, before sorting goes on.
+ */
+typedef struct
+{
+    SW_RenderData *data;
+    SDL_Surface *surface;
+    const void *vertices;
+    int threads;
+    int tiles_x;
+    int num_tiles;
+    int queued;                 /* Items in the bins that haven't been drawn */
+    SDL_atomic_t next_tile;
+    SDL_Surface *targets[SDL_MAX_PARALLEL_THREADS];
+    int status[SDL_MAX_PARALLEL_THREADS];
+} SW_TileJob;
+
+static int
+SW_GetThreads(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_RENDER_SOFTWARE_THREADS);
+    int threads = hint ? SDL_atoi(hint) : 1;
+
+    if (threads <= 0) {
+        threads = SDL_GetCPUCount();
+    }
+    return SDL_min(threads, SDL_MAX_PARALLEL_THREADS);
+}
+
+/* A surface sharing the pixels of another, with a clip rect and blit
+   mapping of its own */
+static SDL_Surface *
+SW_CreateSurfaceView(SDL_Surface * surface)
+{
+    const SDL_PixelFormat *fmt = surface->format;
+    SDL_Surface *view;
+    SDL_ScaleMode scaleMode;
+
+    view = SDL_CreateRGBSurfaceFrom(surface->pixels, surface->w, surface->h,
+                                    fmt->BitsPerPixel, surface->pitch,
+                                    fmt->Rmask, fmt->Gmask, fmt->Bmask, fmt->Amask);
+    if (view && SDL_GetSurfaceScaleMode(surface, &scaleMode) == 0) {
+        SDL_SetSurfaceScaleMode(view, scaleMode);
+    }
+    return view;
+}
+
+/* Free the views of a texture, if it was drawn in tiles */
+static void
+SW_FreeTileSourceViews(SW_TileSource *source)
+{
+    int i;
+
+    for (i = 0; i < SDL_MAX_PARALLEL_THREADS; ++i) {
+        SDL_FreeSurface(source->views[i]);
+        source->views[i] = NULL;
+    }
+}
+
+/* Find the views of a texture for each thread, making them if needed */
+static int
+SW_GetTileSource(SW_TileJob *job, SDL_Texture *texture)
+{
+    SW_RenderData *data = job->data;
+    SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
+    SW_TileSource *source;
+    int i;
+
+    /* Runs of copies of the same texture are common */
+    i = data->last_source;
+    if (i >= data->num_sources || data->sources[i].texture != texture) {
+        for (i = 0; i < data->num_sources; ++i) {
+            if (data->sources[i].texture == texture) {
+                break;
+            }
+        }
+    }
+
+    if (i == data->num_sources) {
+        if (data->num_sources == data->max_sources) {
+            const int max_sources = data->max_sources ? 2 * data->max_sources : 16;
+            SW_TileSource *sources = (SW_TileSource *) SDL_realloc(data->sources, max_sources * sizeof(*sources));
+
+            if (!sources) {
+                return SDL_OutOfMemory();
+            }
+            data->sources = sources;
+            data->max_sources = max_sources;
+        }
+        SDL_zerop(&data->sources[i]);
+        data->sources[i].texture = texture;
+        ++data->num_sources;
+    }
+    source = &data->sources[i];
+    data->last_source = i;
+
+    /* Streaming textures with several buffers draw a different one after
+       each lock */
+    if (source->surface != surface) {
+        SW_FreeTileSourceViews(source);
+        source->surface = surface;
+    }
+    for (i = 0; i < job->threads; ++i) {
+        if (!source->views[i]) {
+            source->views[i] = SW_CreateSurfaceView(surface);
+            if (!source->views[i]) {
+                return -1;
+            }
+        }
+    }
+    return data->last_source;
+}
+
+static void
+SW_DrawTileBins(void *userdata, int thread)
+{
+    SW_TileJob *job = (SW_TileJob *) userdata;
+    SW_RenderData *data = job->data;
+    SDL_Surface *target = job->targets[thread];
+    int tile;
+
+    while ((tile = SDL_AtomicAdd(&job->next_tile, 1)) < job->num_tiles) {
+        const SW_TileBin *bin = &data->bins[tile];
+        SDL_Rect tilerect;
+        int i;
+
+        tilerect.x = (tile % job->tiles_x) * SW_TILE_SIZE;
+        tilerect.y = (tile / job->tiles_x) * SW_TILE_SIZE;
+        tilerect.w = SW_TILE_SIZE;
+        tilerect.h = SW_TILE_SIZE;
+
+        for (i = 0; i < bin->num_items; ++i) {
+            const SW_TileItem *item = &bin->items[i];
+            SDL_Surface *src = NULL;
+            SDL_Rect clip;
+
+            if (item->cliprect) {
+                if (!SDL_IntersectRect(item->cliprect, &tilerect, &clip)) {
+                    continue;
+                }
+                SDL_SetClipRect(target, &clip);
+            } else {
+                SDL_SetClipRect(target, &tilerect);
+            }
+            if (item->source >= 0) {
+                src = data->sources[item->source].views[thread];
+            }
+            if (SW_DrawPrimitives(target, src, item->cmd, job->vertices,
+                                  item->first, item->count) < 0) {
+                job->status[thread] = -1;
+            }
+        }
+    }
+}
+
+/* Blended copies of static textures blit through their RLE encoding, which
+   rounds differently from the plain pixels of the views, so they're drawn
+   whole to come out the same as without threads */
+static SDL_bool
+SW_IsRLECopy(const SDL_RenderCommand *cmd)
+{
+    const SDL_Surface *src = (SDL_Surface *) cmd->data.draw.texture->driverdata;
+
+    if (cmd->command != SDL_RENDERCMD_COPY &&
+        cmd->command != SDL_RENDERCMD_COPY_EX &&
+        cmd->command != SDL_RENDERCMD_COPY_BATCH) {
+        return SDL_FALSE;
+    }
+    return (cmd->data.draw.blend == SDL_BLENDMODE_BLEND &&
+            (src->map->info.flags & SDL_COPY_RLE_DESIRED)) ? SDL_TRUE : SDL_FALSE;
+}
+
+/* Draw everything sorted into the tiles so far */
+static void
+SW_DrawTiles(SW_TileJob *job)
+{
+    int i;
+
+    if (job->queued == 0) {
+        return;
+    }
+
+    SDL_AtomicSet(&job->next_tile, 0);
+    SDL_RunParallel(SW_DrawTileBins, job, job->threads, job->threads);
+
+    for (i = 0; i < job->num_tiles; ++i) {
+        job->data->bins[i].num_items = 0;
+    }
+    job->queued = 0;
+}
+
+/* Draw primitives across the whole target, after the tiles queued so far */
+static int
+SW_DrawWhole(SW_TileJob *job, const SDL_RenderCommand *cmd,
+             const SDL_Rect *cliprect, int first, int count)
+{
+    SDL_Surface *src = NULL;
+
+    if (cmd->command != SDL_RENDERCMD_CLEAR && cmd->data.draw.texture) {
+        src = (SDL_Surface *) cmd->data.draw.texture->driverdata;
+    }
+    SW_DrawTiles(job);
+    SDL_SetClipRect(job->surface, cliprect);
+    return SW_DrawPrimitives(job->surface, src, cmd, job->vertices, first, count);
+}
+
+/* Sort primitives first to first + count - 1 of a command into the tiles
+   that bounds touch.  If they can't be drawn piecewise and touch more than
+   one tile, they're drawn whole instead. */
+static int
+SW_QueueTilePrimitives(void *userdata, const SDL_RenderCommand *cmd,
+                       const SDL_Rect *cliprect, const SDL_Rect *bounds,
+                       SDL_bool piecewise, int first, int count)
+{
+    SW_TileJob *job = (SW_TileJob *) userdata;
+    SDL_Surface *surface = job->surface;
+    SW_TileBin *bins = job->data->bins;
+    int source = -1;
+    SDL_Rect rect;
+    int tx0, ty0, tx1, ty1, tx, ty;
+
+    rect.x = 0;
+    rect.y = 0;
+    rect.w = surface->w;
+    rect.h = surface->h;
+    if ((cliprect && !SDL_IntersectRect(cliprect, &rect, &rect)) ||
+        !SDL_IntersectRect(bounds, &rect, &rect)) {
+        return 0;
+    }
+    tx0 = rect.x / SW_TILE_SIZE;
+    ty0 = rect.y / SW_TILE_SIZE;
+    tx1 = (rect.x + rect.w - 1) / SW_TILE_SIZE;
+    ty1 = (rect.y + rect.h - 1) / SW_TILE_SIZE;
+
+    if (!piecewise && (tx0 != tx1 || ty0 != ty1)) {
+        return SW_DrawWhole(job, cmd, cliprect, first, count);
+    }
+    if (cmd->command != SDL_RENDERCMD_CLEAR && cmd->data.draw.texture) {
+        if (SW_IsRLECopy(cmd)) {
+            return SW_DrawWhole(job, cmd, cliprect, first, count);
+        }
+        source = SW_GetTileSource(job, cmd->data.draw.texture);
+        if (source < 0) {
+            return SW_DrawWhole(job, cmd, cliprect, first, count);
+        }
+    }
+
+    /* Make room in every tile first, so it's drawn in all of them or none */
+    for (ty = ty0; ty <= ty1; ++ty) {
+        for (tx = tx0; tx <= tx1; ++tx) {
+            SW_TileBin *bin = &bins[ty * job->tiles_x + tx];
+
+            if (bin->num_items == bin->max_items) {
+                const int max_items = bin->max_items ? 2 * bin->max_items : 32;
+                SW_TileItem *items = (SW_TileItem *) SDL_realloc(bin->items, max_items * sizeof(*items));
+
+                if (!items) {
+                    return SW_DrawWhole(job, cmd, cliprect, first, count);
+                }
+                bin->items = items;
+                bin->max_items = max_items;
+            }
+        }
+    }
+
+    for (ty = ty0; ty <= ty1; ++ty) {
+        for (tx = tx0; tx <= tx1; ++tx) {
+            SW_TileBin *bin = &bins[ty * job->tiles_x + tx];
+            SW_TileItem *item;
+
+            /* Primitives that follow each other in a command stay together */
+            if (bin->num_items > 0) {
+                item = &bin->items[bin->num_items - 1];
+                if (item->cmd == cmd && item->first + item->count == first) {
+                    item->count += count;
+                    continue;
+                }
+            }
+            item = &bin->items[bin->num_items++];
+            item->cmd = cmd;
+            item->cliprect = cliprect;
+            item->source = source;
+            item->first = first;
+            item->count = count;
+            ++job->queued;
+        }
+    }
+    return 0;
+}
+
+/* The pixels a shape with these corners might touch */
+static void
+SW_GetBounds(const SDL_FPoint * points, int count, SDL_Rect * rect)
+{
+    /* Far enough out to be off any surface, and still convert to int */
+    const float limit = (float) (1 << 24);
+    float minx = limit, miny = limit, maxx = -limit, maxy = -limit;
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        minx = SDL_min(minx, points[i].x);
+        miny = SDL_min(miny, points[i].y);
+        maxx = SDL_max(maxx, points[i].x);
+        maxy = SDL_max(maxy, points[i].y);
+    }
+    minx = SDL_max(minx, -limit);
+    miny = SDL_max(miny, -limit);
+    maxx = SDL_min(maxx, limit);
+    maxy = SDL_min(maxy, limit);
+
+    rect->x = (int) SDL_floor(minx) - 1;
+    rect->y = (int) SDL_floor(miny) - 1;
+    rect->w = (int) SDL_ceil(maxx) + 1 - rect->x + 1;
+    rect->h = (int) SDL_ceil(maxy) + 1 - rect->y + 1;
+}
+
+static void
+SW_GetCopyExBounds(const SW_CopyExData * copy, SDL_Rect * rect)
+{
+    SDL_FPoint corners[4];
+
+    SW_GetCopyExCorners(&copy->dstrect, copy->angle, &copy->center, corners);
+    SW_GetBounds(corners, 4, rect);
+}
+
+/* Called by SW_VisitPrimitives() with the bounds of primitives first to
+   first + count - 1 of a command, and whether clipping them to part of
+   those bounds draws the same pixels there as drawing them whole */
+typedef int (*SW_PrimitiveFunc) (void *userdata, const SDL_RenderCommand *cmd,
+                                 const SDL_Rect *cliprect, const SDL_Rect *bounds,
+                                 SDL_bool piecewise, int first, int count);
+
+/* Go through the primitives of a draw command one at a time, or a line
+   strip at once */
+static int
+SW_VisitPrimitives(const SDL_RenderCommand *cmd, const void *vertices,
+                   const SDL_Rect *cliprect, SW_PrimitiveFunc func, void *userdata)
+{
+    const Uint8 *verts = (const Uint8 *) vertices + cmd->data.draw.first;
+    const int count = (int) cmd->data.draw.count;
+    SDL_Rect bounds;
+    int status = 0;
+    int i;
+
+#define VISIT_PRIMITIVES(piecewise, first, count) \
+    if (func(userdata, cmd, cliprect, &bounds, piecewise, first, count) < 0) { \
+        status = -1; \
+    }
+
+    switch (cmd->command) {
+    case SDL_RENDERCMD_DRAW_POINTS: {
+        const SDL_Point *points = (const SDL_Point *) verts;
+
+        for (i = 0; i < count; ++i) {
+            bounds.x = points[i].x;
+            bounds.y = points[i].y;
+            bounds.w = 1;
+            bounds.h = 1;
+            VISIT_PRIMITIVES(SDL_TRUE, i, 1)
+        }
+        break;
+    }
+
+    case SDL_RENDERCMD_DRAW_LINES: {
+        const SDL_Point *points = (const SDL_Point *) verts;
+        SDL_bool straight = SDL_TRUE;
+
+        /* Only sloped lines step differently from where they're clipped */
+        for (i = 1; i < count; ++i) {
+            const int dx = SDL_abs(points[i].x - points[i - 1].x);
+            const int dy = SDL_abs(points[i].y - points[i - 1].y);
+
+            if (dx != 0 && dy != 0 && dx != dy) {
+                straight = SDL_FALSE;
+                break;
+            }
+        }
+        if (count > 0 && SDL_EnclosePoints(points, count, NULL, &bounds)) {
+            VISIT_PRIMITIVES(straight, 0, count)
+        }
+        break;
+    }
+
+    case SDL_RENDERCMD_FILL_RECTS: {
+        const SDL_Rect *rects = (const SDL_Rect *) verts;
+
+        for (i = 0; i < count; ++i) {
+            bounds = rects[i];
+            VISIT_PRIMITIVES(SDL_TRUE, i, 1)
+        }
+        break;
+    }
+
+    case SDL_RENDERCMD_COPY: {
+        const SDL_Rect *rects = (const SDL_Rect *) verts;
+
+        for (i = 0; i < count; ++i, rects += 2) {
+            const SDL_bool scaled = (rects[0].w != rects[1].w || rects[0].h != rects[1].h);
+
+            bounds = rects[1];
+            VISIT_PRIMITIVES(!scaled, i, 1)
+        }
+        break;
+    }
+
+    case SDL_RENDERCMD_COPY_EX: {
+        const SW_CopyExData *copydata = (const SW_CopyExData *) verts;
+
+        for (i = 0; i < count; ++i, ++copydata) {
+            if (copydata->angle != 0.0 || copydata->flip != SDL_FLIP_NONE) {
+                SW_GetCopyExBounds(copydata, &bounds);
+                VISIT_PRIMITIVES(SDL_TRUE, i, 1)
+            } else {
+                const SDL_bool scaled = (copydata->srcrect.w != copydata->dstrect.w ||
+                                         copydata->srcrect.h != copydata->dstrect.h);
+
+                bounds = copydata->dstrect;
+                VISIT_PRIMITIVES(!scaled, i, 1)
+            }
+        }
+        break;
+    }
+
+    case SDL_RENDERCMD_COPY_BATCH: {
+        const SW_CopyBatchData *copydata = (const SW_CopyBatchData *) verts;
+
+        for (i = 0; i < count; ++i, ++copydata) {
+            const SW_CopyExData *copy = &copydata->copy;
+
+            if (copy->angle != 0.0 || copy->flip != SDL_FLIP_NONE) {
+                SW_GetCopyExBounds(copy, &bounds);
+                VISIT_PRIMITIVES(SDL_TRUE, i, 1)
+            } else {
+                const SDL_bool scaled = (copy->srcrect.w != copy->dstrect.w ||
+                                         copy->srcrect.h != copy->dstrect.h);
+
+                bounds = copy->dstrect;
+                VISIT_PRIMITIVES(!scaled, i, 1)
+            }
+        }
+        break;
+    }
+
+    case SDL_RENDERCMD_GEOMETRY: {
+        const SDL_TriangleVertex *triangles = (const SDL_TriangleVertex *) verts;
+
+        for (i = 0; i + 2 < count; i += 3) {
+            SDL_FPoint corners[3];
+            int j;
+
+            for (j = 0; j < 3; ++j) {
+                corners[j].x = triangles[i + j].x;
+                corners[j].y = triangles[i + j].y;
+            }
+            SW_GetBounds(corners, 3, &bounds);
+            VISIT_PRIMITIVES(SDL_TRUE, i, 3)
+        }
+        break;
+    }
+
+    default:
+        break;
+    }
+#undef VISIT_PRIMITIVES
+
+    return status;
+}
+
+/* Set up the bins and a target surface for each thread */
+static int
+SW_PrepareTiles(SW_TileJob *job, SW_RenderData *data, SDL_Surface *surface,
+                int threads, void *vertices)
+{
+    int i;
+
+    SDL_zerop(job);
+    job->data = data;
+    job->surface = surface;
+    job->vertices = vertices;
+    job->threads = threads;
+    job->tiles_x = (surface->w + SW_TILE_SIZE - 1) / SW_TILE_SIZE;
+    job->num_tiles = job->tiles_x * ((surface->h + SW_TILE_SIZE - 1) / SW_TILE_SIZE);
+
+    if (job->num_tiles > data->num_bins) {
+        SW_TileBin *bins = (SW_TileBin *) SDL_realloc(data->bins, job->num_tiles * sizeof(*bins));
+
+        if (!bins) {
+            return SDL_OutOfMemory();
+        }
+        SDL_memset(&bins[data->num_bins], 0, (job->num_tiles - data->num_bins) * sizeof(*bins));
+        data->bins = bins;
+        data->num_bins = job->num_tiles;
+    }
+    for (i = 0; i < threads; ++i) {
+        job->targets[i] = SW_CreateSurfaceView(surface);
+        if (!job->targets[i]) {
+            while (i--) {
+                SDL_FreeSurface(job->targets[i]);
+            }
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int
+SW_RunCommandQueueTiled(SW_TileJob *job, SDL_RenderCommand *cmd)
+{
+    const SDL_Rect *viewport = NULL;
+    const SDL_Rect *cliprect = NULL;
+    int status = 0;
+    int i;
+
+    for (; cmd; cmd = cmd->next) {
+        switch (cmd->command) {
+        case SDL_RENDERCMD_SETVIEWPORT:
+            viewport = &cmd->data.viewport.rect;
+            break;
+
+        case SDL_RENDERCMD_SETCLIPRECT:
+            cliprect = cmd->data.cliprect.enabled ? &cmd->data.cliprect.rect : NULL;
+            break;
+
+        case SDL_RENDERCMD_CLEAR: {
+            SDL_Rect bounds;
+
+            /* By definition the clear ignores the clip rect */
+            bounds.x = 0;
+            bounds.y = 0;
+            bounds.w = job->surface->w;
+            bounds.h = job->surface->h;
+            if (SW_QueueTilePrimitives(job, cmd, NULL, &bounds, SDL_TRUE, 0, 1) < 0) {
+                status = -1;
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_DRAW_POINTS:
+        case SDL_RENDERCMD_DRAW_LINES:
+        case SDL_RENDERCMD_FILL_RECTS:
+        case SDL_RENDERCMD_COPY:
+        case SDL_RENDERCMD_COPY_EX:
+        case SDL_RENDERCMD_COPY_BATCH:
+        case SDL_RENDERCMD_GEOMETRY:
+            if (SW_VisitPrimitives(cmd, job->vertices, cliprect ? cliprect : viewport,
+                                   SW_QueueTilePrimitives, job) < 0) {
+                status = -1;
+            }
+            break;
+
+        case SDL_RENDERCMD_NO_OP:
+            break;
+        }
+    }
+    SW_DrawTiles(job);
+
+    for (i = 0; i < job->threads; ++i) {
+        if (job->status[i] < 0) {
+            status = -1;
+        }
+    }
+    for (i = 0; i < job->threads; ++i) {
+        SDL_FreeSurface(job->targets[i]);
+    }
+    return status;
+}
+
+static int
+SW_DamagePrimitives(void *userdata, const SDL_RenderCommand *cmd,
+                    const SDL_Rect *cliprect, const SDL_Rect *bounds,
+                    SDL_bool piecewise, int first, int count)
+{
+    SW_RenderData *data = (SW_RenderData *) userdata;
+    SDL_Rect rect;
+
+    rect.x = 0;
+    rect.y = 0;
+    rect.w = data->window->w;
+    rect.h = data->window->h;
+    if (SDL_IntersectRect(bounds, &rect, &rect) &&
+        (!cliprect || SDL_IntersectRect(cliprect, &rect, &rect))) {
+        SW_AddDamage(data->damage, &data->num_damage, &rect);
+    }
+    return 0;
+}
+
+/* Note the parts of the window surface the commands will draw on */
+static void
+SW_DamageCommands(SW_RenderData * data, const SDL_RenderCommand *cmd,
+                  const void *vertices)
+{
+    const SDL_Rect *viewport = NULL;
+    const SDL_Rect *cliprect = NULL;
+
+    for (; cmd; cmd = cmd->next) {
+        switch (cmd->command) {
+        case SDL_RENDERCMD_SETVIEWPORT:
+            viewport = &cmd->data.viewport.rect;
+            break;
+
+        case SDL_RENDERCMD_SETCLIPRECT:
+            cliprect = cmd->data.cliprect.enabled ? &cmd->data.cliprect.rect : NULL;
+            break;
+
+        case SDL_RENDERCMD_CLEAR:
+            SW_DamageWindow(data);
+            break;
+
+        case SDL_RENDERCMD_DRAW_POINTS:
+        case SDL_RENDERCMD_DRAW_LINES:
+        case SDL_RENDERCMD_FILL_RECTS:
+        case SDL_RENDERCMD_COPY:
+        case SDL_RENDERCMD_COPY_EX:
+        case SDL_RENDERCMD_COPY_BATCH:
+        case SDL_RENDERCMD_GEOMETRY:
+            SW_VisitPrimitives(cmd, vertices, cliprect ? cliprect : viewport,
+                               SW_DamagePrimitives, data);
+            break;
+
+        case SDL_RENDERCMD_NO_OP:
+            break;
+        }
+    }
+}
+
+static int
+SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                   void *vertices, size_t vertsize)
+{
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+    SDL_Surface *surface = SW_ActivateRenderer(renderer);
+    SW_DrawStateCache drawstate;
+    int threads;
+    int status = 0;
+
+    if (!surface) {
+        return -1;
+    }
+
+    if (surface == data->window) {
+        SW_DamageCommands(data, cmd, vertices);
+    }
+
+    /* Palettized targets need the rotozoom path, which isn't exact per tile */
+    threads = SW_GetThreads();
+    if (threads > 1 && surface->format->BytesPerPixel >= 2 && !SDL_MUSTLOCK(surface) &&
+        (surface->w > SW_TILE_SIZE || surface->h > SW_TILE_SIZE)) {
+        SW_TileJob job;
+
+        if (SW_PrepareTiles(&job, data, surface, threads, vertices) == 0) {
+            return SW_RunCommandQueueTiled(&job, cmd);
+        }
+        /* Draw on this thread after all */
+    }
+
+    drawstate.viewport = NULL;
+    drawstate.cliprect = NULL;
+    drawstate.surface_cliprect_dirty = SDL_TRUE;
+
+    for (; cmd; cmd = cmd->next) {
+        SDL_Surface *src = NULL;
+
+        switch (cmd->command) {
+        case SDL_RENDERCMD_SETVIEWPORT:
+            drawstate.viewport = &cmd->data.viewport.rect;
+            drawstate.surface_cliprect_dirty = SDL_TRUE;
+            break;
+
+        case SDL_RENDERCMD_SETCLIPRECT:
+            drawstate.cliprect = cmd->data.cliprect.enabled ? &cmd->data.cliprect.rect : NULL;
+            drawstate.surface_cliprect_dirty = SDL_TRUE;
+            break;
+
+        case SDL_RENDERCMD_CLEAR:
+            /* By definition the clear ignores the clip rect */
+            SDL_SetClipRect(surface, NULL);
+            if (SW_DrawPrimitives(surface, NULL, cmd, vertices, 0, 1) < 0) {
+                status = -1;
+            }
+            drawstate.surface_cliprect_dirty = SDL_TRUE;
+            break;
+
+        case SDL_RENDERCMD_DRAW_POINTS:
+        case SDL_RENDERCMD_DRAW_LINES:
+        case SDL_RENDERCMD_FILL_RECTS:
+        case SDL_RENDERCMD_COPY:
+        case SDL_RENDERCMD_COPY_EX:
+        case SDL_RENDERCMD_COPY_BATCH:
+        case SDL_RENDERCMD_GEOMETRY:
+            SetDrawState(surface, &drawstate);
+            if (cmd->data.draw.texture) {
+                src = (SDL_Surface *) cmd->data.draw.texture->driverdata;
+            }
+            if (SW_DrawPrimitives(surface, src, cmd, vertices, 0, (int) cmd->data.draw.count) < 0) {
+                status = -1;
+            }
+            break;
+
+        case SDL_RENDERCMD_NO_OP:
+            break;
+        }
+    }
+    return status;
+}
+
+static int
+SW_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
+                    Uint32 format, void * pixels, int pitch)
+{
+    SDL_Surface *surface = SW_ActivateRenderer(renderer);
+    Uint32 src_format;
+    void *src_pixels;
+    SDL_Rect final_rect;
+
+    if (!surface) {
+        return -1;
+    }
+
+    if (renderer->viewport.x || renderer->viewport.y) {
+        final_rect.x = renderer->viewport.x + rect->x;
+        final_rect.y = renderer->viewport.y + rect->y;
+        final_rect.w = rect->w;
+        final_rect.h = rect->h;
+        rect = &final_rect;
+    }
+
+    if (rect->x < 0 || rect->x+rect->w > surface->w ||
+        rect->y < 0 || rect->y+rect->h > surface->h) {
+        return SDL_SetError("Tried to read outside of surface bounds");
+    }
+
+    src_format = surface->format->format;
+    src_pixels = (void*)((Uint8 *) surface->pixels +
+                    rect->y * surface->pitch +
+                    rect->x * surface->format->BytesPerPixel);
+
+    return SDL_ConvertPixels(rect->w, rect->h,
+                             src_format, src_pixels, surface->pitch,
                              format, pixels, pitch);
 }
 
+static int
+SW_GetDamageRects(SDL_Renderer * renderer, const SDL_Rect ** rects)
+{
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+
+    *rects = data->damage;
+    return data->num_damage;
+}
+
 static void
 SW_RenderPresent(SDL_Renderer * renderer)
 {
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
     SDL_Window *window = renderer->window;
 
-    if (window) {
-        SDL_UpdateWindowSurface(window);
+    /* Only what was drawn on goes to the screen */
+    if (window && data->num_damage > 0) {
+        SDL_UpdateWindowSurfaceRects(window, data->damage, data->num_damage);
     }
+    data->num_damage = 0;
 }
 
 static void
 SW_DestroyTexture(SDL_Renderer * renderer, SDL_Texture * texture)
 {
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
     SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
+    SW_TextureBuffers *buffers = SW_GetTextureBuffers(texture);
+    int i;
+
+    /* The views of the texture share its pixels */
+    for (i = 0; i < data->num_sources; ++i) {
+        if (data->sources[i].texture == texture) {
+            SW_FreeTileSourceViews(&data->sources[i]);
+            data->sources[i] = data->sources[--data->num_sources];
+            break;
+        }
+    }
+
+    if (buffers) {
+        for (i = 0; i < buffers->num_buffers; ++i) {
+            SDL_FreeSurface(buffers->buffers[i]);
+        }
+        SDL_free(buffers);
+        return;
+    }
 
+    if (surface) {
+        /* The surface whose pixels it uses, for SW_CreateTextureFromSurface() */
+        SDL_FreeSurface((SDL_Surface *) surface->userdata);
+    }
     SDL_FreeSurface(surface);
 }
 
@@ -716,7 +1961,18 @@ static void
 SW_DestroyRenderer(SDL_Renderer * renderer)
 {
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+    int i;
 
+    if (data) {
+        for (i = 0; i < data->num_bins; ++i) {
+            SDL_free(data->bins[i].items);
+        }
+        SDL_free(data->bins);
+        for (i = 0; i < data->num_sources; ++i) {
+            SW_FreeTileSourceViews(&data->sources[i]);
+        }
+        SDL_free(data->sources);
+    }
     SDL_free(data);
     SDL_free(renderer);
 }
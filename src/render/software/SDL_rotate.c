@@ -120,6 +120,14 @@ SDLgfx_rotozoomSurfaceSizeTrig(int width, int height, double angle,
     radangle = angle * (M_PI / 180.0);
     *sangle = SDL_sin(radangle);
     *cangle = SDL_cos(radangle);
+    /*
+    * Right angles are exact, the rounding error would otherwise grow the
+    * destination by two pixels and shift the rotated image
+    */
+    if (angle / 90.0 == SDL_floor(angle / 90.0)) {
+        *sangle = SDL_floor(*sangle + 0.5);
+        *cangle = SDL_floor(*cangle + 0.5);
+    }
     x = (double)(width / 2);
     y = (double)(height / 2);
     cx = *cangle * x;
@@ -232,6 +240,12 @@ _transformSurfaceRGBA(SDL_Surface * src, SDL_Surface * dst, int cx, int cy, int
             pc = (tColorRGBA *) ((Uint8 *) pc + gap);
         }
     } else {
+        /*
+        * Sample at the destination pixel centers, so right angles hit
+        * every source pixel exactly once
+        */
+        xd += (icos - isin) / 2;
+        yd += (icos + isin) / 2;
         for (y = 0; y < dst->h; y++) {
             dy = cy - y;
             sdx = (ax + (isin * dy)) + xd;
@@ -287,6 +301,11 @@ transformSurfaceY(SDL_Surface * src, SDL_Surface * dst, int cx, int cy, int isin
     yd = ((src->h - dst->h) << 15);
     ax = (cx << 16) - (icos * cx);
     ay = (cy << 16) - (isin * cx);
+    /*
+    * Sample at the destination pixel centers
+    */
+    xd += (icos - isin) / 2;
+    yd += (icos + isin) / 2;
     pc = (tColorY*) dst->pixels;
     gap = dst->pitch - dst->w;
     /*
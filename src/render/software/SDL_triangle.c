@@ -0,0 +1,906 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2014 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../../SDL_internal.h"
+
+#if !SDL_RENDER_DISABLED
+
+#include "SDL_surface.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_triangle.h"
+#include "../../video/SDL_blit.h"
+
+#if SDL_ASSEMBLY_ROUTINES
+#if defined(__SSE2__)
+#define HAVE_SSE2_TRIANGLE 1
+#endif
+#endif
+
+/* Triangles are rasterized with edge functions in fixed point, a tile of
+   pixels at a time.  Tiles outside any edge are skipped, tiles inside all
+   three edges are shaded a row at a time without testing pixels, and only
+   the tiles along the edges test each pixel center.  A pixel center lying
+   exactly on an edge is drawn only for top and left edges, so triangles
+   that share an edge never draw a pixel twice.
+ */
+
+#define SUBPIXEL_BITS   4
+#define SUBPIXEL_ONE    (1 << SUBPIXEL_BITS)
+#define TILE_SIZE       8
+
+/* Beyond this the edge functions could overflow 64 bits */
+#define MAX_COORDINATE  (float)(1 << 24)
+
+typedef struct
+{
+    Sint64 c;                   /**< Value at the first pixel, bias included */
+    Sint64 dx, dy;              /**< Change per pixel */
+} TriangleEdge;
+
+/* A triangle in fixed point, wound with a positive area */
+typedef struct
+{
+    const SDL_TriangleVertex *v[3];
+    Sint64 x[3], y[3];
+    Sint64 area;
+    int minx, miny, maxx, maxy; /**< The pixels to test, within the clip rect */
+} Triangle;
+
+/* An attribute in 16.16 fixed point, the value at pixel x0 + x, y0 + y is
+   origin + dx * x + dy * y.  Every pixel is evaluated the same way however
+   its span is clipped, so a triangle drawn in pieces has no seams. */
+typedef struct
+{
+    Sint64 origin;
+    Sint32 dx, dy;
+} AttributePlane;
+
+typedef struct
+{
+    AttributePlane r, g, b, a, u, v;
+} TriangleAttributes;
+
+typedef struct
+{
+    SDL_Surface *dst;
+    SDL_Surface *src;
+    SDL_BlendMode blendMode;
+    SDL_bool fast;              /**< 32-bit surfaces with 8-bit channels */
+    SDL_bool flat;              /**< All vertices have the same color */
+    SDL_bool modulate;          /**< The color isn't opaque white */
+    SDL_bool linear;            /**< Filter the source bilinearly */
+    SDL_bool simd;              /**< Flat textured spans can take the SSE2 loop */
+    int minu, minv, maxu, maxv; /**< The texels that may be sampled */
+    Uint32 r, g, b, a;          /**< The color of a flat triangle */
+    Uint32 src_alpha;           /**< 0xFF when the source has no alpha */
+    int x0, y0;                 /**< The pixel the attribute origin is at */
+    TriangleAttributes planes;
+} TriangleSetup;
+
+SDL_FORCE_INLINE void
+BlendPixel(SDL_BlendMode blendMode, Uint32 srcR, Uint32 srcG, Uint32 srcB,
+           Uint32 srcA, Uint32 *dstR, Uint32 *dstG, Uint32 *dstB, Uint32 *dstA)
+{
+    /* The same arithmetic as the blitters in SDL_blit_auto.c */
+    switch (blendMode) {
+    case SDL_BLENDMODE_NONE:
+        *dstR = srcR;
+        *dstG = srcG;
+        *dstB = srcB;
+        *dstA = srcA;
+        break;
+    case SDL_BLENDMODE_BLEND:
+        if (srcA < 255) {
+            srcR = (srcR * srcA) / 255;
+            srcG = (srcG * srcA) / 255;
+            srcB = (srcB * srcA) / 255;
+        }
+        *dstR = srcR + ((255 - srcA) * *dstR) / 255;
+        *dstG = srcG + ((255 - srcA) * *dstG) / 255;
+        *dstB = srcB + ((255 - srcA) * *dstB) / 255;
+        *dstA = srcA + ((255 - srcA) * *dstA) / 255;
+        break;
+    case SDL_BLENDMODE_ADD:
+        if (srcA < 255) {
+            srcR = (srcR * srcA) / 255;
+            srcG = (srcG * srcA) / 255;
+            srcB = (srcB * srcA) / 255;
+        }
+        *dstR = SDL_min(srcR + *dstR, 255);
+        *dstG = SDL_min(srcG + *dstG, 255);
+        *dstB = SDL_min(srcB + *dstB, 255);
+        break;
+    case SDL_BLENDMODE_MOD:
+        *dstR = (srcR * *dstR) / 255;
+        *dstG = (srcG * *dstG) / 255;
+        *dstB = (srcB * *dstB) / 255;
+        break;
+    }
+}
+
+/* The values interpolated along a span, in 16.16 fixed point */
+typedef struct
+{
+    Sint32 r, g, b, a, u, v;
+} SpanValues;
+
+/* A color along a span.  The planes can overshoot slightly along the edges,
+   there the span steps between its clamped ends so no pixel needs clamping. */
+static void
+SetupColor(const AttributePlane *plane, Sint64 ox, Sint64 oy, int w,
+           Sint32 *start, Sint32 *step)
+{
+    const Sint64 max = (Sint64) 255 << 16;
+    Sint64 first = plane->origin + plane->dx * ox + plane->dy * oy;
+    Sint64 last = first + (Sint64) plane->dx * (w - 1);
+
+    if (first < 0 || first > max + 0xFFFF || last < 0 || last > max + 0xFFFF) {
+        first = SDL_max(SDL_min(first, max), 0);
+        last = SDL_max(SDL_min(last, max), 0);
+        *step = (w > 1) ? (Sint32) ((last - first) / (w - 1)) : 0;
+    } else {
+        *step = plane->dx;
+    }
+    *start = (Sint32) first;
+}
+
+/* Weigh two pixels by 256 - f and f, two channels at a time */
+SDL_FORCE_INLINE Uint32
+LerpPixel(Uint32 a, Uint32 b, Uint32 f)
+{
+    const Uint32 rb = (((a & 0x00FF00FF) * (256 - f) + (b & 0x00FF00FF) * f) >> 8) & 0x00FF00FF;
+    const Uint32 ag = (((a >> 8) & 0x00FF00FF) * (256 - f) + ((b >> 8) & 0x00FF00FF) * f) & 0xFF00FF00;
+    return rb | ag;
+}
+
+/* Filter the four 32-bit texels around the 16.16 position u, v.  Texel
+   centers lie halfway between whole coordinates. */
+SDL_FORCE_INLINE Uint32
+SampleLinear(const Uint8 *pixels, int pitch, Sint32 u, Sint32 v,
+             int minu, int minv, int maxu, int maxv)
+{
+    const Sint32 su = u - 0x8000;
+    const Sint32 sv = v - 0x8000;
+    const Uint32 fx = (Uint32) (su >> 8) & 0xFF;
+    const Uint32 fy = (Uint32) (sv >> 8) & 0xFF;
+    int x0 = su >> 16, y0 = sv >> 16;
+    int x1 = x0 + 1, y1 = y0 + 1;
+    const Uint32 *row0, *row1;
+
+    x0 = SDL_max(SDL_min(x0, maxu), minu);
+    x1 = SDL_max(SDL_min(x1, maxu), minu);
+    y0 = SDL_max(SDL_min(y0, maxv), minv);
+    y1 = SDL_max(SDL_min(y1, maxv), minv);
+    row0 = (const Uint32 *) (pixels + y0 * pitch);
+    row1 = (const Uint32 *) (pixels + y1 * pitch);
+    return LerpPixel(LerpPixel(row0[x0], row1[x0], fy),
+                     LerpPixel(row0[x1], row1[x1], fy), fx);
+}
+
+SDL_FORCE_INLINE const Uint8 *
+SampleNearest(const Uint8 *pixels, int pitch, int bpp, Sint32 u, Sint32 v,
+              int minu, int minv, int maxu, int maxv)
+{
+    int tx = u >> 16;
+    int ty = v >> 16;
+
+    tx = SDL_max(SDL_min(tx, maxu), minu);
+    ty = SDL_max(SDL_min(ty, maxv), minv);
+    return pixels + ty * pitch + tx * bpp;
+}
+
+static void
+SetupSpan(const TriangleSetup *setup, int x, int y, int w,
+          SpanValues *start, SpanValues *step)
+{
+    const Sint64 ox = x - setup->x0;
+    const Sint64 oy = y - setup->y0;
+
+    if (setup->flat) {
+        start->r = setup->r << 16;
+        start->g = setup->g << 16;
+        start->b = setup->b << 16;
+        start->a = setup->a << 16;
+        step->r = step->g = step->b = step->a = 0;
+    } else {
+        SetupColor(&setup->planes.r, ox, oy, w, &start->r, &step->r);
+        SetupColor(&setup->planes.g, ox, oy, w, &start->g, &step->g);
+        SetupColor(&setup->planes.b, ox, oy, w, &start->b, &step->b);
+        SetupColor(&setup->planes.a, ox, oy, w, &start->a, &step->a);
+    }
+
+    if (setup->src) {
+        const AttributePlane *u = &setup->planes.u;
+        const AttributePlane *v = &setup->planes.v;
+
+        start->u = (Sint32) (u->origin + u->dx * ox + u->dy * oy);
+        start->v = (Sint32) (v->origin + v->dx * ox + v->dy * oy);
+        step->u = u->dx;
+        step->v = v->dx;
+    } else {
+        start->u = start->v = 0;
+        step->u = step->v = 0;
+    }
+}
+
+/* Shade w pixels; the constant arguments let the compiler specialize the
+   loop for each blend mode and surface layout.  Everything is read into
+   locals first, as the stores to dst could alias any of it. */
+SDL_FORCE_INLINE void
+ShadePixels(const TriangleSetup *setup, Uint8 *dst, int w,
+            const SpanValues *start, const SpanValues *step,
+            SDL_BlendMode blendMode, SDL_bool textured, SDL_bool fast)
+{
+    const SDL_PixelFormat *dstfmt = setup->dst->format;
+    const int dstbpp = dstfmt->BytesPerPixel;
+    const Uint32 Rshift = dstfmt->Rshift, Gshift = dstfmt->Gshift;
+    const Uint32 Bshift = dstfmt->Bshift, Ashift = dstfmt->Ashift;
+    const Uint32 Amask = dstfmt->Amask;
+    const SDL_PixelFormat *srcfmt = textured ? setup->src->format : NULL;
+    const Uint32 srcRshift = textured ? srcfmt->Rshift : 0;
+    const Uint32 srcGshift = textured ? srcfmt->Gshift : 0;
+    const Uint32 srcBshift = textured ? srcfmt->Bshift : 0;
+    const Uint32 srcAshift = textured ? srcfmt->Ashift : 0;
+    const Uint8 *srcpixels = textured ? (const Uint8 *) setup->src->pixels : NULL;
+    const int srcpitch = textured ? setup->src->pitch : 0;
+    const int srcbpp = textured ? srcfmt->BytesPerPixel : 0;
+    const int minu = setup->minu, minv = setup->minv;
+    const int maxu = setup->maxu, maxv = setup->maxv;
+    const SDL_bool linear = setup->linear;
+    const Uint32 src_alpha = setup->src_alpha;
+    const SDL_bool modulate = setup->modulate;
+    const Sint32 dr = step->r, dg = step->g, db = step->b, da = step->a;
+    const Sint32 du = step->u, dv = step->v;
+    Sint32 r = start->r, g = start->g, b = start->b, a = start->a;
+    Sint32 u = start->u, v = start->v;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstR = 0, dstG = 0, dstB = 0, dstA = 0;
+    Uint32 pixel;
+
+    while (w--) {
+        if (textured) {
+            if (fast) {
+                if (linear) {
+                    pixel = SampleLinear(srcpixels, srcpitch, u, v, minu, minv, maxu, maxv);
+                } else {
+                    pixel = *(const Uint32 *) SampleNearest(srcpixels, srcpitch, 4, u, v, minu, minv, maxu, maxv);
+                }
+                srcR = (pixel >> srcRshift) & 0xFF;
+                srcG = (pixel >> srcGshift) & 0xFF;
+                srcB = (pixel >> srcBshift) & 0xFF;
+                srcA = ((pixel >> srcAshift) & 0xFF) | src_alpha;
+            } else {
+                const Uint8 *texel = SampleNearest(srcpixels, srcpitch, srcbpp, u, v, minu, minv, maxu, maxv);
+                DISEMBLE_RGBA(texel, srcbpp, srcfmt, pixel, srcR, srcG, srcB, srcA);
+            }
+            if (modulate) {
+                srcR = (srcR * (Uint32) (r >> 16)) / 255;
+                srcG = (srcG * (Uint32) (g >> 16)) / 255;
+                srcB = (srcB * (Uint32) (b >> 16)) / 255;
+                srcA = (srcA * (Uint32) (a >> 16)) / 255;
+            }
+            u += du;
+            v += dv;
+        } else {
+            srcR = (Uint32) (r >> 16);
+            srcG = (Uint32) (g >> 16);
+            srcB = (Uint32) (b >> 16);
+            srcA = (Uint32) (a >> 16);
+        }
+        r += dr;
+        g += dg;
+        b += db;
+        a += da;
+
+        if (fast) {
+            if (blendMode != SDL_BLENDMODE_NONE) {
+                pixel = *(Uint32 *) dst;
+                dstR = (pixel >> Rshift) & 0xFF;
+                dstG = (pixel >> Gshift) & 0xFF;
+                dstB = (pixel >> Bshift) & 0xFF;
+                dstA = (pixel >> Ashift) & 0xFF;
+            }
+            BlendPixel(blendMode, srcR, srcG, srcB, srcA, &dstR, &dstG, &dstB, &dstA);
+            *(Uint32 *) dst = (dstR << Rshift) | (dstG << Gshift) |
+                              (dstB << Bshift) | ((dstA << Ashift) & Amask);
+        } else {
+            DISEMBLE_RGBA(dst, dstbpp, dstfmt, pixel, dstR, dstG, dstB, dstA);
+            BlendPixel(blendMode, srcR, srcG, srcB, srcA, &dstR, &dstG, &dstB, &dstA);
+            ASSEMBLE_RGBA(dst, dstbpp, dstfmt, dstR, dstG, dstB, dstA);
+        }
+        dst += dstbpp;
+    }
+}
+
+#define SHADE_SPAN_8888(textured) \
+    switch (setup->blendMode) { \
+    case SDL_BLENDMODE_NONE: \
+        ShadePixels(setup, dst, w, &p, &step, SDL_BLENDMODE_NONE, textured, SDL_TRUE); \
+        break; \
+    case SDL_BLENDMODE_BLEND: \
+        ShadePixels(setup, dst, w, &p, &step, SDL_BLENDMODE_BLEND, textured, SDL_TRUE); \
+        break; \
+    case SDL_BLENDMODE_ADD: \
+        ShadePixels(setup, dst, w, &p, &step, SDL_BLENDMODE_ADD, textured, SDL_TRUE); \
+        break; \
+    case SDL_BLENDMODE_MOD: \
+        ShadePixels(setup, dst, w, &p, &step, SDL_BLENDMODE_MOD, textured, SDL_TRUE); \
+        break; \
+    }
+
+#if HAVE_SSE2_TRIANGLE
+/* x / 255, exact for any product of two bytes */
+SDL_FORCE_INLINE __m128i
+Divide255SSE2(__m128i x)
+{
+    x = _mm_add_epi16(_mm_add_epi16(x, _mm_set1_epi16(1)), _mm_srli_epi16(x, 8));
+    return _mm_srli_epi16(x, 8);
+}
+
+/* Blend two pixels, unpacked to 16 bits per channel with alpha in the top
+   lane of each, with the same results as BlendPixel() */
+SDL_FORCE_INLINE __m128i
+BlendSSE2(SDL_BlendMode blendMode, __m128i src, __m128i dst)
+{
+    const __m128i alpha_lanes = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+    const __m128i max = _mm_set1_epi16(255);
+    __m128i srcA;
+
+    switch (blendMode) {
+    case SDL_BLENDMODE_BLEND:
+        srcA = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src, 0xFF), 0xFF);
+        src = Divide255SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_andnot_si128(alpha_lanes, srcA),
+                                                             _mm_and_si128(alpha_lanes, max))));
+        return _mm_add_epi16(src, Divide255SSE2(_mm_mullo_epi16(dst, _mm_sub_epi16(max, srcA))));
+    case SDL_BLENDMODE_ADD:
+        srcA = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src, 0xFF), 0xFF);
+        src = Divide255SSE2(_mm_mullo_epi16(src, srcA));
+        src = _mm_min_epi16(_mm_add_epi16(src, dst), max);
+        return _mm_or_si128(_mm_andnot_si128(alpha_lanes, src), _mm_and_si128(alpha_lanes, dst));
+    case SDL_BLENDMODE_MOD:
+        src = Divide255SSE2(_mm_mullo_epi16(src, dst));
+        return _mm_or_si128(_mm_andnot_si128(alpha_lanes, src), _mm_and_si128(alpha_lanes, dst));
+    default:
+        return src;
+    }
+}
+
+/* How ShadeTexelsSSE2() fetches the source */
+typedef enum
+{
+    SAMPLE_NEAREST,             /**< Every texel is known to be inside */
+    SAMPLE_NEAREST_CLAMPED,
+    SAMPLE_LINEAR
+} SampleMode;
+
+SDL_FORCE_INLINE int
+ShadeTexelsSSE2(const TriangleSetup *setup, Uint8 *dst, int w, SpanValues *p,
+                const SpanValues *step, SampleMode sampling)
+{
+    const SDL_PixelFormat *dstfmt = setup->dst->format;
+    const SDL_Surface *src = setup->src;
+    const Uint8 *srcpixels = (const Uint8 *) src->pixels;
+    const int srcpitch = src->pitch;
+    const int minu = setup->minu, minv = setup->minv;
+    const int maxu = setup->maxu, maxv = setup->maxv;
+    const SDL_bool modulate = setup->modulate;
+    const SDL_BlendMode blendMode = setup->blendMode;
+    const Sint32 du = step->u, dv = step->v;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i src_alpha = _mm_set1_epi32((int) (setup->src_alpha << 24));
+    const __m128i dst_mask = _mm_set1_epi32((int) (0x00FFFFFF | dstfmt->Amask));
+    Uint16 mod[4];
+    __m128i modulation;
+    Sint32 u = p->u, v = p->v;
+    int i, k;
+
+    mod[dstfmt->Rshift / 8] = (Uint16) setup->r;
+    mod[dstfmt->Gshift / 8] = (Uint16) setup->g;
+    mod[dstfmt->Bshift / 8] = (Uint16) setup->b;
+    mod[3] = (Uint16) setup->a;
+    modulation = _mm_set_epi16(mod[3], mod[2], mod[1], mod[0], mod[3], mod[2], mod[1], mod[0]);
+
+    for (i = 0; i + 4 <= w; i += 4, dst += 16) {
+        __m128i texels[4], pixels, lo, hi;
+
+        /* Gather in registers, a store and a wide reload would stall */
+        for (k = 0; k < 4; ++k) {
+            Uint32 texel;
+
+            if (sampling == SAMPLE_LINEAR) {
+                texel = SampleLinear(srcpixels, srcpitch, u, v, minu, minv, maxu, maxv);
+            } else if (sampling == SAMPLE_NEAREST_CLAMPED) {
+                texel = *(const Uint32 *) SampleNearest(srcpixels, srcpitch, 4, u, v, minu, minv, maxu, maxv);
+            } else {
+                texel = *(const Uint32 *) (srcpixels + (v >> 16) * srcpitch + (u >> 16) * 4);
+            }
+            texels[k] = _mm_cvtsi32_si128((int) texel);
+            u += du;
+            v += dv;
+        }
+        pixels = _mm_unpacklo_epi64(_mm_unpacklo_epi32(texels[0], texels[1]),
+                                    _mm_unpacklo_epi32(texels[2], texels[3]));
+        pixels = _mm_or_si128(pixels, src_alpha);
+        lo = _mm_unpacklo_epi8(pixels, zero);
+        hi = _mm_unpackhi_epi8(pixels, zero);
+        if (modulate) {
+            lo = Divide255SSE2(_mm_mullo_epi16(lo, modulation));
+            hi = Divide255SSE2(_mm_mullo_epi16(hi, modulation));
+        }
+        if (blendMode != SDL_BLENDMODE_NONE) {
+            pixels = _mm_loadu_si128((const __m128i *) dst);
+            lo = BlendSSE2(blendMode, lo, _mm_unpacklo_epi8(pixels, zero));
+            hi = BlendSSE2(blendMode, hi, _mm_unpackhi_epi8(pixels, zero));
+        }
+        _mm_storeu_si128((__m128i *) dst, _mm_and_si128(_mm_packus_epi16(lo, hi), dst_mask));
+    }
+    p->u = u;
+    p->v = v;
+    return i;
+}
+
+/* Shade a textured span of a flat triangle four pixels at a time, when the
+   source and destination share a layout with alpha in the top byte.
+   Returns how many pixels were shaded; the rest are left to ShadePixels(). */
+static int
+ShadeSpanSSE2(const TriangleSetup *setup, Uint8 *dst, int w, SpanValues *p,
+              const SpanValues *step)
+{
+    const Sint64 u0 = p->u, u1 = u0 + (Sint64) step->u * (w - 1);
+    const Sint64 v0 = p->v, v1 = v0 + (Sint64) step->v * (w - 1);
+
+    if (setup->linear) {
+        return ShadeTexelsSSE2(setup, dst, w, p, step, SAMPLE_LINEAR);
+    }
+
+    /* The coordinates change linearly, so if both ends of the span are
+       inside the source, every pixel in between is too */
+    if ((SDL_min(u0, u1) >> 16) >= setup->minu && (SDL_max(u0, u1) >> 16) <= setup->maxu &&
+        (SDL_min(v0, v1) >> 16) >= setup->minv && (SDL_max(v0, v1) >> 16) <= setup->maxv) {
+        return ShadeTexelsSSE2(setup, dst, w, p, step, SAMPLE_NEAREST);
+    }
+    return ShadeTexelsSSE2(setup, dst, w, p, step, SAMPLE_NEAREST_CLAMPED);
+}
+#endif /* HAVE_SSE2_TRIANGLE */
+
+/* Shade the pixels x to x + w - 1 of row y */
+static void
+ShadeSpan(const TriangleSetup *setup, int x, int y, int w)
+{
+    const SDL_PixelFormat *dstfmt = setup->dst->format;
+    Uint8 *dst = (Uint8 *) setup->dst->pixels + y * setup->dst->pitch + x * dstfmt->BytesPerPixel;
+    SpanValues p, step;
+
+    if (!setup->src && setup->flat && setup->blendMode == SDL_BLENDMODE_NONE && setup->fast) {
+        /* A solid span, store the same pixel throughout */
+        Uint32 *row = (Uint32 *) dst;
+        const Uint32 pixel = (setup->r << dstfmt->Rshift) | (setup->g << dstfmt->Gshift) |
+                             (setup->b << dstfmt->Bshift) | ((setup->a << dstfmt->Ashift) & dstfmt->Amask);
+        while (w--) {
+            *row++ = pixel;
+        }
+        return;
+    }
+
+    SetupSpan(setup, x, y, w, &p, &step);
+
+#if HAVE_SSE2_TRIANGLE
+    if (setup->simd && setup->flat && setup->src) {
+        const int done = ShadeSpanSSE2(setup, dst, w, &p, &step);
+        dst += done * 4;
+        w -= done;
+    }
+#endif
+
+    if (!setup->fast) {
+        ShadePixels(setup, dst, w, &p, &step, setup->blendMode, setup->src != NULL, SDL_FALSE);
+    } else if (setup->src) {
+        SHADE_SPAN_8888(SDL_TRUE)
+    } else {
+        SHADE_SPAN_8888(SDL_FALSE)
+    }
+}
+
+static void
+ShadeRows(const TriangleSetup *setup, int x0, int x1, int y0, int y1)
+{
+    int y;
+
+    for (y = y0; y <= y1; ++y) {
+        ShadeSpan(setup, x0, y, x1 - x0 + 1);
+    }
+}
+
+/* The plane through three vertex values, relative to the first pixel, with
+   bias added to every value */
+static void
+SetupPlane(const TriangleEdge edges[3], double area, float a0, float a1, float a2,
+           double bias, AttributePlane *plane)
+{
+    const double origin = ((double) edges[0].c * a0 + (double) edges[1].c * a1 + (double) edges[2].c * a2) / area;
+    const double dx = ((double) edges[0].dx * a0 + (double) edges[1].dx * a1 + (double) edges[2].dx * a2) / area;
+    const double dy = ((double) edges[0].dy * a0 + (double) edges[1].dy * a1 + (double) edges[2].dy * a2) / area;
+
+    plane->origin = (Sint64) ((origin + bias) * 65536.0);
+    plane->dx = (Sint32) (dx * 65536.0);
+    plane->dy = (Sint32) (dy * 65536.0);
+}
+
+static void
+SetupEdge(TriangleEdge *edge, Sint64 ax, Sint64 ay, Sint64 bx, Sint64 by,
+          Sint64 px, Sint64 py)
+{
+    /* Positive on the inside, for a triangle wound with a positive area */
+    edge->c = (bx - ax) * (py - ay) - (by - ay) * (px - ax);
+    edge->dx = (ay - by) * SUBPIXEL_ONE;
+    edge->dy = (bx - ax) * SUBPIXEL_ONE;
+}
+
+/* Convert a triangle to fixed point and find the pixels it might cover.
+   Returns SDL_FALSE if it has no area or is too far out to draw. */
+static SDL_bool
+PrepareTriangle(const SDL_Rect *clip, const SDL_TriangleVertex *v0,
+                const SDL_TriangleVertex *v1, const SDL_TriangleVertex *v2,
+                Triangle *tri)
+{
+    int i;
+
+    tri->v[0] = v0;
+    tri->v[1] = v1;
+    tri->v[2] = v2;
+    for (i = 0; i < 3; ++i) {
+        if (!(SDL_fabs(tri->v[i]->x) < MAX_COORDINATE && SDL_fabs(tri->v[i]->y) < MAX_COORDINATE)) {
+            return SDL_FALSE;
+        }
+        tri->x[i] = (Sint64) SDL_floor(tri->v[i]->x * SUBPIXEL_ONE + 0.5);
+        tri->y[i] = (Sint64) SDL_floor(tri->v[i]->y * SUBPIXEL_ONE + 0.5);
+    }
+
+    tri->area = (tri->x[1] - tri->x[0]) * (tri->y[2] - tri->y[0]) -
+                (tri->y[1] - tri->y[0]) * (tri->x[2] - tri->x[0]);
+    if (tri->area == 0) {
+        return SDL_FALSE;
+    }
+    if (tri->area < 0) {
+        const SDL_TriangleVertex *tmpv = tri->v[1];
+        Sint64 tmp;
+
+        tri->v[1] = tri->v[2];
+        tri->v[2] = tmpv;
+        tmp = tri->x[1]; tri->x[1] = tri->x[2]; tri->x[2] = tmp;
+        tmp = tri->y[1]; tri->y[1] = tri->y[2]; tri->y[2] = tmp;
+        tri->area = -tri->area;
+    }
+
+    /* The pixels whose centers might be covered, within the clip rect */
+    tri->minx = (int) ((SDL_min(tri->x[0], SDL_min(tri->x[1], tri->x[2])) - SUBPIXEL_ONE / 2) >> SUBPIXEL_BITS);
+    tri->miny = (int) ((SDL_min(tri->y[0], SDL_min(tri->y[1], tri->y[2])) - SUBPIXEL_ONE / 2) >> SUBPIXEL_BITS);
+    tri->maxx = (int) ((SDL_max(tri->x[0], SDL_max(tri->x[1], tri->x[2])) - SUBPIXEL_ONE / 2) >> SUBPIXEL_BITS);
+    tri->maxy = (int) ((SDL_max(tri->y[0], SDL_max(tri->y[1], tri->y[2])) - SUBPIXEL_ONE / 2) >> SUBPIXEL_BITS);
+    tri->minx = SDL_max(tri->minx, clip->x);
+    tri->miny = SDL_max(tri->miny, clip->y);
+    tri->maxx = SDL_min(tri->maxx, clip->x + clip->w - 1);
+    tri->maxy = SDL_min(tri->maxy, clip->y + clip->h - 1);
+    return SDL_TRUE;
+}
+
+/* The edges of a triangle, relative to pixel x, y.  Edge i is opposite
+   vertex i. */
+static void
+SetupEdges(const Triangle *tri, int x, int y, TriangleEdge edges[3])
+{
+    int i;
+
+    for (i = 0; i < 3; ++i) {
+        const int a = (i + 1) % 3;
+        const int b = (i + 2) % 3;
+
+        SetupEdge(&edges[i], tri->x[a], tri->y[a], tri->x[b], tri->y[b],
+                  (Sint64) x * SUBPIXEL_ONE + SUBPIXEL_ONE / 2,
+                  (Sint64) y * SUBPIXEL_ONE + SUBPIXEL_ONE / 2);
+    }
+}
+
+/* Interpolate the color and texture coordinates of a triangle, relative to
+   pixel setup->x0, setup->y0 */
+static void
+SetupAttributes(TriangleSetup *setup, const Triangle *tri, const Uint8 mod[4])
+{
+    const SDL_TriangleVertex * const *v = tri->v;
+    const double area = (double) tri->area;
+    TriangleEdge edges[3];
+    float colors[3][4];
+    int i;
+
+    /* Each edge weighs the attributes of the vertex opposite it */
+    SetupEdges(tri, setup->x0, setup->y0, edges);
+
+    setup->flat = SDL_TRUE;
+    for (i = 0; i < 3; ++i) {
+        colors[i][0] = (float) (v[i]->color.r * mod[0]) / 255.0f;
+        colors[i][1] = (float) (v[i]->color.g * mod[1]) / 255.0f;
+        colors[i][2] = (float) (v[i]->color.b * mod[2]) / 255.0f;
+        colors[i][3] = (float) (v[i]->color.a * mod[3]) / 255.0f;
+        if (SDL_memcmp(&v[i]->color, &v[0]->color, sizeof(SDL_Color)) != 0) {
+            setup->flat = SDL_FALSE;
+        }
+    }
+    if (setup->flat) {
+        setup->r = (v[0]->color.r * mod[0]) / 255;
+        setup->g = (v[0]->color.g * mod[1]) / 255;
+        setup->b = (v[0]->color.b * mod[2]) / 255;
+        setup->a = (v[0]->color.a * mod[3]) / 255;
+        setup->modulate = (setup->r & setup->g & setup->b & setup->a) != 255;
+    } else {
+        setup->modulate = SDL_TRUE;
+        /* Round rather than truncate when converting back to bytes */
+        SetupPlane(edges, area, colors[0][0], colors[1][0], colors[2][0], 0.5, &setup->planes.r);
+        SetupPlane(edges, area, colors[0][1], colors[1][1], colors[2][1], 0.5, &setup->planes.g);
+        SetupPlane(edges, area, colors[0][2], colors[1][2], colors[2][2], 0.5, &setup->planes.b);
+        SetupPlane(edges, area, colors[0][3], colors[1][3], colors[2][3], 0.5, &setup->planes.a);
+    }
+    if (setup->src) {
+        SetupPlane(edges, area, v[0]->u, v[1]->u, v[2]->u, 0.0, &setup->planes.u);
+        SetupPlane(edges, area, v[0]->v, v[1]->v, v[2]->v, 0.0, &setup->planes.v);
+    }
+}
+
+/* Shade the pixels a prepared triangle covers */
+static void
+RasterizeTriangle(const TriangleSetup *setup, const Triangle *tri)
+{
+    const int minx = tri->minx, miny = tri->miny;
+    const int maxx = tri->maxx, maxy = tri->maxy;
+    TriangleEdge edges[3];
+    int tx, ty, i, j;
+
+    if (minx > maxx || miny > maxy) {
+        return;
+    }
+
+    SetupEdges(tri, minx, miny, edges);
+
+    /* Apply the fill rule: pixel centers on an edge that isn't a top or a
+       left edge are outside */
+    for (i = 0; i < 3; ++i) {
+        const int a = (i + 1) % 3;
+        const int b = (i + 2) % 3;
+        const SDL_bool top = (tri->y[a] == tri->y[b] && tri->x[b] > tri->x[a]);
+        const SDL_bool left = (tri->y[b] < tri->y[a]);
+
+        if (!top && !left) {
+            edges[i].c -= 1;
+        }
+    }
+
+    /* Tiles are aligned to the surface so neighboring triangles agree.
+       Consecutive tiles inside the triangle are shaded as one run. */
+    for (ty = miny & ~(TILE_SIZE - 1); ty <= maxy; ty += TILE_SIZE) {
+        const int y0 = SDL_max(ty, miny);
+        const int y1 = SDL_min(ty + TILE_SIZE - 1, maxy);
+        int run = -1, run_end = -1;
+
+        for (tx = minx & ~(TILE_SIZE - 1); tx <= maxx; tx += TILE_SIZE) {
+            const int x0 = SDL_max(tx, minx);
+            const int x1 = SDL_min(tx + TILE_SIZE - 1, maxx);
+            Sint64 e[3];
+            SDL_bool inside = SDL_TRUE;
+            SDL_bool outside = SDL_FALSE;
+            int yy;
+
+            for (i = 0; i < 3; ++i) {
+                const Sint64 stepx = edges[i].dx * (x1 - x0);
+                const Sint64 stepy = edges[i].dy * (y1 - y0);
+                Sint64 emin, emax;
+
+                e[i] = edges[i].c + edges[i].dx * (x0 - minx) + edges[i].dy * (y0 - miny);
+                emin = e[i] + SDL_min(stepx, 0) + SDL_min(stepy, 0);
+                emax = e[i] + SDL_max(stepx, 0) + SDL_max(stepy, 0);
+                if (emax < 0) {
+                    outside = SDL_TRUE;
+                    break;
+                }
+                if (emin < 0) {
+                    inside = SDL_FALSE;
+                }
+            }
+            if (inside && !outside) {
+                if (run < 0) {
+                    run = x0;
+                }
+                run_end = x1;
+                continue;
+            }
+            if (run >= 0) {
+                ShadeRows(setup, run, run_end, y0, y1);
+                run = -1;
+            }
+            if (outside) {
+                continue;
+            }
+
+            /* Along an edge, the covered pixels of a row are contiguous */
+            for (yy = y0; yy <= y1; ++yy) {
+                Sint64 e0 = e[0], e1 = e[1], e2 = e[2];
+                int start = -1, end = -1;
+
+                for (j = x0; j <= x1; ++j) {
+                    if ((e0 | e1 | e2) >= 0) {
+                        if (start < 0) {
+                            start = j;
+                        }
+                        end = j;
+                    } else if (start >= 0) {
+                        break;
+                    }
+                    e0 += edges[0].dx;
+                    e1 += edges[1].dx;
+                    e2 += edges[2].dx;
+                }
+                if (start >= 0) {
+                    ShadeSpan(setup, start, yy, end - start + 1);
+                }
+                e[0] += edges[0].dy;
+                e[1] += edges[1].dy;
+                e[2] += edges[2].dy;
+            }
+        }
+        if (run >= 0) {
+            ShadeRows(setup, run, run_end, y0, y1);
+        }
+    }
+}
+
+static void
+DrawTriangle(TriangleSetup *setup, const SDL_TriangleVertex *v0,
+             const SDL_TriangleVertex *v1, const SDL_TriangleVertex *v2,
+             const Uint8 mod[4])
+{
+    Triangle tri;
+
+    if (!PrepareTriangle(&setup->dst->clip_rect, v0, v1, v2, &tri) ||
+        tri.minx > tri.maxx || tri.miny > tri.maxy) {
+        return;
+    }
+    /* The attributes don't depend on the clip rect */
+    setup->x0 = (int) (tri.x[0] >> SUBPIXEL_BITS);
+    setup->y0 = (int) (tri.y[0] >> SUBPIXEL_BITS);
+    SetupAttributes(setup, &tri, mod);
+    RasterizeTriangle(setup, &tri);
+}
+
+static SDL_bool
+Is8888(const SDL_PixelFormat *fmt)
+{
+    return (fmt->BytesPerPixel == 4 && fmt->Rloss == 0 && fmt->Gloss == 0 &&
+            fmt->Bloss == 0 && (fmt->Aloss == 0 || fmt->Amask == 0));
+}
+
+static int
+SetupDraw(TriangleSetup *setup, SDL_Surface *dst, SDL_Surface *src,
+          SDL_BlendMode blendMode)
+{
+    if (!dst) {
+        return SDL_SetError("Passed NULL destination surface");
+    }
+
+    /* This function doesn't work on surfaces < 8 bpp or palettized ones */
+    if (dst->format->BytesPerPixel < 2 || (src && src->format->BytesPerPixel < 2)) {
+        return SDL_SetError("Unsupported surface format for triangle drawing");
+    }
+
+    SDL_zerop(setup);
+    setup->dst = dst;
+    setup->src = src;
+    setup->blendMode = blendMode;
+    setup->fast = Is8888(dst->format) && (!src || Is8888(src->format));
+    if (src) {
+        const SDL_PixelFormat *srcfmt = src->format;
+        const SDL_PixelFormat *dstfmt = dst->format;
+
+        setup->src_alpha = srcfmt->Amask ? 0 : 0xFF;
+        setup->maxu = src->w - 1;
+        setup->maxv = src->h - 1;
+        /* Only 32-bit sources are filtered, as SDL_BlitScaled() does */
+        setup->linear = setup->fast && (src->map->info.flags & SDL_COPY_LINEAR);
+#if HAVE_SSE2_TRIANGLE
+        setup->simd = setup->fast && SDL_HasSSE2() &&
+                      srcfmt->Rshift == dstfmt->Rshift && srcfmt->Gshift == dstfmt->Gshift &&
+                      srcfmt->Bshift == dstfmt->Bshift &&
+                      SDL_max(dstfmt->Rshift, SDL_max(dstfmt->Gshift, dstfmt->Bshift)) <= 16;
+#endif
+    }
+    return 0;
+}
+
+int
+SDL_DrawTriangles(SDL_Surface * dst, SDL_Surface * src,
+                  const SDL_TriangleVertex * vertices, int count,
+                  SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    TriangleSetup setup;
+    Uint8 mod[4];
+    int i;
+
+    if (SetupDraw(&setup, dst, src, blendMode) < 0) {
+        return -1;
+    }
+    mod[0] = r;
+    mod[1] = g;
+    mod[2] = b;
+    mod[3] = a;
+
+    for (i = 0; i + 2 < count; i += 3) {
+        DrawTriangle(&setup, &vertices[i], &vertices[i + 1], &vertices[i + 2], mod);
+    }
+    return 0;
+}
+
+int
+SDL_DrawQuad(SDL_Surface * dst, SDL_Surface * src, const SDL_Rect * srcrect,
+             const SDL_TriangleVertex * corners, SDL_BlendMode blendMode,
+             Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    TriangleSetup setup;
+    Triangle tri[2];
+    SDL_bool draw[2];
+    Uint8 mod[4];
+    int i;
+
+    if (SetupDraw(&setup, dst, src, blendMode) < 0) {
+        return -1;
+    }
+    if (src && srcrect) {
+        setup.minu = srcrect->x;
+        setup.minv = srcrect->y;
+        setup.maxu = srcrect->x + srcrect->w - 1;
+        setup.maxv = srcrect->y + srcrect->h - 1;
+    }
+    mod[0] = r;
+    mod[1] = g;
+    mod[2] = b;
+    mod[3] = a;
+
+    /* Both halves share the attributes of the first, so the diagonal
+       doesn't show */
+    if (!PrepareTriangle(&dst->clip_rect, &corners[0], &corners[1], &corners[2], &tri[0])) {
+        return 0;
+    }
+    draw[0] = (tri[0].minx <= tri[0].maxx && tri[0].miny <= tri[0].maxy);
+    draw[1] = PrepareTriangle(&dst->clip_rect, &corners[0], &corners[2], &corners[3], &tri[1]) &&
+              (tri[1].minx <= tri[1].maxx && tri[1].miny <= tri[1].maxy);
+    if (!draw[0] && !draw[1]) {
+        return 0;
+    }
+    setup.x0 = (int) (tri[0].x[0] >> SUBPIXEL_BITS);
+    setup.y0 = (int) (tri[0].y[0] >> SUBPIXEL_BITS);
+    SetupAttributes(&setup, &tri[0], mod);
+
+    for (i = 0; i < 2; ++i) {
+        if (draw[i]) {
+            RasterizeTriangle(&setup, &tri[i]);
+        }
+    }
+    return 0;
+}
+
+#endif /* !SDL_RENDER_DISABLED */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,42 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2014 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../../SDL_internal.h"
+
+/* A triangle vertex in surface coordinates, with texture coordinates in
+   texels of the source surface */
+typedef struct
+{
+    float x, y;
+    SDL_Color color;
+    float u, v;
+} SDL_TriangleVertex;
+
+/* Draw count / 3 triangles, textured with src unless it is NULL.  The
+   vertex colors are modulated by r, g, b and a.  32-bit sources set to
+   SDL_SCALEMODE_LINEAR are filtered bilinearly. */
+extern int SDL_DrawTriangles(SDL_Surface * dst, SDL_Surface * src, const SDL_TriangleVertex * vertices, int count, SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+
+/* Draw the parallelogram with the four corners in order around it, as two
+   triangles sharing one interpolation.  Texels outside srcrect are never
+   sampled, so neighbors in a texture atlas don't bleed in. */
+extern int SDL_DrawQuad(SDL_Surface * dst, SDL_Surface * src, const SDL_Rect * srcrect, const SDL_TriangleVertex * corners, SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+
+/* vi: set ts=4 sw=4 expandtab: */
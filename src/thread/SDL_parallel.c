@@ -0,0 +1,214 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2014 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+/* A pool of worker threads that SDL uses to split up big jobs */
+
+#include "SDL_thread.h"
+#include "SDL_atomic.h"
+#include "SDL_mutex.h"
+#include "SDL_thread_c.h"
+
+typedef struct SDL_ThreadPool
+{
+    SDL_mutex *lock;
+    SDL_cond *wake;             /* a job was posted, or the pool is quitting */
+    SDL_cond *done;             /* a worker left the current job */
+    SDL_Thread *workers[SDL_MAX_PARALLEL_THREADS];
+    int num_workers;
+    int active;                 /* workers inside the current job */
+    SDL_bool quit;
+
+    /* The current job, protected by the lock */
+    Uint32 generation;
+    SDL_ParallelFunc fn;
+    void *data;
+    int count;
+    SDL_atomic_t next;          /* the next index to hand out */
+} SDL_ThreadPool;
+
+static SDL_ThreadPool *SDL_thread_pool;
+
+/* Held for the duration of a job, only one runs at a time */
+static SDL_SpinLock SDL_thread_pool_busy;
+
+static void
+SDL_RunParallelIndices(SDL_ParallelFunc fn, void *data, int count,
+                       SDL_atomic_t *next)
+{
+    int index;
+
+    while ((index = SDL_AtomicAdd(next, 1)) < count) {
+        fn(data, index);
+    }
+}
+
+static int SDLCALL
+SDL_ParallelWorker(void *data)
+{
+    SDL_ThreadPool *pool = (SDL_ThreadPool *) data;
+    Uint32 generation = 0;
+    SDL_ParallelFunc fn;
+    void *fndata;
+    int count;
+
+    SDL_LockMutex(pool->lock);
+    for ( ; ; ) {
+        while (!pool->quit && pool->generation == generation) {
+            SDL_CondWait(pool->wake, pool->lock);
+        }
+        if (pool->quit) {
+            break;
+        }
+
+        /* Join the job, it can't be replaced until we leave it again */
+        generation = pool->generation;
+        fn = pool->fn;
+        fndata = pool->data;
+        count = pool->count;
+        ++pool->active;
+        SDL_UnlockMutex(pool->lock);
+
+        SDL_RunParallelIndices(fn, fndata, count, &pool->next);
+
+        SDL_LockMutex(pool->lock);
+        if (--pool->active == 0) {
+            SDL_CondSignal(pool->done);
+        }
+    }
+    SDL_UnlockMutex(pool->lock);
+    return 0;
+}
+
+/* This is called with SDL_thread_pool_busy held */
+static SDL_ThreadPool *
+SDL_GetThreadPool(int workers)
+{
+    SDL_ThreadPool *pool = SDL_thread_pool;
+
+    if (!pool) {
+        pool = (SDL_ThreadPool *) SDL_calloc(1, sizeof(*pool));
+        if (!pool) {
+            return NULL;
+        }
+        pool->lock = SDL_CreateMutex();
+        pool->wake = SDL_CreateCond();
+        pool->done = SDL_CreateCond();
+        if (!pool->lock || !pool->wake || !pool->done) {
+            SDL_DestroyCond(pool->done);
+            SDL_DestroyCond(pool->wake);
+            SDL_DestroyMutex(pool->lock);
+            SDL_free(pool);
+            return NULL;
+        }
+        SDL_thread_pool = pool;
+    }
+
+    while (pool->num_workers < workers) {
+        SDL_Thread *thread = SDL_CreateThreadInternal(SDL_ParallelWorker, "SDLWorker", pool, NULL);
+        if (!thread) {
+            break;
+        }
+        pool->workers[pool->num_workers++] = thread;
+    }
+    return pool;
+}
+
+void
+SDL_RunParallel(SDL_ParallelFunc fn, void *data, int count, int threads)
+{
+    SDL_ThreadPool *pool = NULL;
+    int index;
+
+    if (threads > count) {
+        threads = count;
+    }
+    if (threads > SDL_MAX_PARALLEL_THREADS) {
+        threads = SDL_MAX_PARALLEL_THREADS;
+    }
+
+    /* Nested and concurrent jobs run on the calling thread */
+    if (threads > 1 && SDL_AtomicTryLock(&SDL_thread_pool_busy)) {
+        pool = SDL_GetThreadPool(threads - 1);
+        if (!pool || pool->num_workers == 0) {
+            SDL_AtomicUnlock(&SDL_thread_pool_busy);
+            pool = NULL;
+        }
+    }
+    if (!pool) {
+        for (index = 0; index < count; ++index) {
+            fn(data, index);
+        }
+        return;
+    }
+
+    /* Wait for stragglers from the last job before replacing it */
+    SDL_LockMutex(pool->lock);
+    while (pool->active > 0) {
+        SDL_CondWait(pool->done, pool->lock);
+    }
+    pool->fn = fn;
+    pool->data = data;
+    pool->count = count;
+    SDL_AtomicSet(&pool->next, 0);
+    ++pool->generation;
+    SDL_CondBroadcast(pool->wake);
+    SDL_UnlockMutex(pool->lock);
+
+    SDL_RunParallelIndices(fn, data, count, &pool->next);
+
+    /* Every index has been handed out, wait for the ones still running */
+    SDL_LockMutex(pool->lock);
+    while (pool->active > 0) {
+        SDL_CondWait(pool->done, pool->lock);
+    }
+    SDL_UnlockMutex(pool->lock);
+
+    SDL_AtomicUnlock(&SDL_thread_pool_busy);
+}
+
+void
+SDL_QuitParallel(void)
+{
+    SDL_ThreadPool *pool;
+    int i;
+
+    SDL_AtomicLock(&SDL_thread_pool_busy);
+    pool = SDL_thread_pool;
+    if (pool) {
+        SDL_LockMutex(pool->lock);
+        pool->quit = SDL_TRUE;
+        SDL_CondBroadcast(pool->wake);
+        SDL_UnlockMutex(pool->lock);
+
+        for (i = 0; i < pool->num_workers; ++i) {
+            SDL_WaitThread(pool->workers[i], NULL);
+        }
+        SDL_DestroyCond(pool->done);
+        SDL_DestroyCond(pool->wake);
+        SDL_DestroyMutex(pool->lock);
+        SDL_free(pool);
+        SDL_thread_pool = NULL;
+    }
+    SDL_AtomicUnlock(&SDL_thread_pool_busy);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -30,7 +30,7 @@
 
 /* This function creates a thread, passing args to SDL_RunThread(),
    saves a system-dependent thread id in thread->id, and returns 0
-   on success.
+   on success. It should honor thread->attributes.stacksize if it can.
 */
 #ifdef SDL_PASSED_BEGINTHREAD_ENDTHREAD
 extern int SDL_SYS_CreateThread(SDL_Thread * thread, void *args,
@@ -46,6 +46,9 @@ extern void SDL_SYS_SetupThread(const char *name);
 /* This function sets the current thread priority */
 extern int SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority);
 
+/* This function sets the CPUs the current thread may run on */
+extern int SDL_SYS_SetThreadAffinity(Uint64 mask);
+
 /* This function waits for the thread to finish and frees any data
    allocated by SDL_SYS_CreateThread()
  */
@@ -36,12 +36,22 @@ SDL_TLSCreate()
     return SDL_AtomicIncRef(&SDL_tls_id)+1;
 }
 
+#ifdef SDL_THREAD_LOCAL
+/* The storage lives in a compiler thread-local, the system TLS isn't used */
+static SDL_THREAD_LOCAL SDL_TLSData *SDL_tls_storage;
+#define SDL_GetTLSStorage() SDL_tls_storage
+#define SDL_SetTLSStorage(data) ((void) (SDL_tls_storage = (data)), 0)
+#else
+#define SDL_GetTLSStorage() SDL_SYS_GetTLSData()
+#define SDL_SetTLSStorage(data) SDL_SYS_SetTLSData(data)
+#endif
+
 void *
 SDL_TLSGet(SDL_TLSID id)
 {
     SDL_TLSData *storage;
 
-    storage = SDL_SYS_GetTLSData();
+    storage = SDL_GetTLSStorage();
     if (!storage || id == 0 || id > storage->limit) {
         return NULL;
     }
@@ -57,7 +67,7 @@ SDL_TLSSet(SDL_TLSID id, const void *value, void (*destructor)(void *))
         return SDL_InvalidParamError("id");
     }
 
-    storage = SDL_SYS_GetTLSData();
+    storage = SDL_GetTLSStorage();
     if (!storage || (id > storage->limit)) {
         unsigned int i, oldlimit, newlimit;
 
@@ -72,7 +82,7 @@ SDL_TLSSet(SDL_TLSID id, const void *value, void (*destructor)(void *))
             storage->array[i].data = NULL;
             storage->array[i].destructor = NULL;
         }
-        if (SDL_SYS_SetTLSData(storage) != 0) {
+        if (SDL_SetTLSStorage(storage) != 0) {
             return -1;
         }
     }
@@ -87,7 +97,7 @@ SDL_TLSCleanup()
 {
     SDL_TLSData *storage;
 
-    storage = SDL_SYS_GetTLSData();
+    storage = SDL_GetTLSStorage();
     if (storage) {
         unsigned int i;
         for (i = 0; i < storage->limit; ++i) {
@@ -95,7 +105,7 @@ SDL_TLSCleanup()
                 storage->array[i].destructor(storage->array[i].data);
             }
         }
-        SDL_SYS_SetTLSData(NULL);
+        (void) SDL_SetTLSStorage(NULL);
         SDL_free(storage);
     }
 }
@@ -104,99 +114,101 @@ SDL_TLSCleanup()
 /* This is a generic implementation of thread-local storage which doesn't
    require additional OS support.
 
-   It is not especially efficient and doesn't clean up thread-local storage
-   as threads exit.  If there is a real OS that doesn't support thread-local
-   storage this implementation should be improved to be production quality.
+   Entries live in a small hash table keyed by thread ID. Each thread only
+   ever writes its own entry, so lookups don't need a lock: entries are
+   published with an atomic compare-and-swap onto their bucket and are
+   never freed, only released for reuse by a later thread. Like before,
+   it doesn't clean up thread-local storage for threads that SDL didn't
+   create.
 */
 
 typedef struct SDL_TLSEntry {
+    SDL_atomic_t in_use;
     SDL_threadID thread;
     SDL_TLSData *storage;
     struct SDL_TLSEntry *next;
 } SDL_TLSEntry;
 
-static SDL_mutex *SDL_generic_TLS_mutex;
-static SDL_TLSEntry *SDL_generic_TLS;
+#define SDL_GENERIC_TLS_BUCKETS 64  /* Must be a power of two */
 
+static SDL_TLSEntry *SDL_generic_TLS[SDL_GENERIC_TLS_BUCKETS];
 
-SDL_TLSData *
-SDL_Generic_GetTLSData()
+static SDL_TLSEntry **
+SDL_Generic_GetTLSBucket(SDL_threadID thread)
+{
+    /* Thread IDs are often aligned pointers, so mix in the high bits */
+    Uint64 hash = (Uint64) thread * 0x9E3779B97F4A7C15ULL;
+    return &SDL_generic_TLS[(hash >> 32) & (SDL_GENERIC_TLS_BUCKETS - 1)];
+}
+
+static SDL_TLSEntry *
+SDL_Generic_FindTLSEntry(SDL_TLSEntry **bucket, SDL_threadID thread)
 {
-    SDL_threadID thread = SDL_ThreadID();
     SDL_TLSEntry *entry;
-    SDL_TLSData *storage = NULL;
 
-#if !SDL_THREADS_DISABLED
-    if (!SDL_generic_TLS_mutex) {
-        static SDL_SpinLock tls_lock;
-        SDL_AtomicLock(&tls_lock);
-        if (!SDL_generic_TLS_mutex) {
-            SDL_mutex *mutex = SDL_CreateMutex();
-            SDL_MemoryBarrierRelease();
-            SDL_generic_TLS_mutex = mutex;
-            if (!SDL_generic_TLS_mutex) {
-                SDL_AtomicUnlock(&tls_lock);
-                return NULL;
-            }
+    entry = (SDL_TLSEntry *) SDL_AtomicGetPtr((void **) bucket);
+    for ( ; entry; entry = entry->next) {
+        if (SDL_AtomicGet(&entry->in_use) && entry->thread == thread) {
+            return entry;
         }
-        SDL_AtomicUnlock(&tls_lock);
     }
-#endif /* SDL_THREADS_DISABLED */
+    return NULL;
+}
 
-    SDL_MemoryBarrierAcquire();
-    SDL_LockMutex(SDL_generic_TLS_mutex);
-    for (entry = SDL_generic_TLS; entry; entry = entry->next) {
-        if (entry->thread == thread) {
-            storage = entry->storage;
-            break;
-        }
-    }
-#if !SDL_THREADS_DISABLED
-    SDL_UnlockMutex(SDL_generic_TLS_mutex);
-#endif
+SDL_TLSData *
+SDL_Generic_GetTLSData()
+{
+    SDL_threadID thread = SDL_ThreadID();
+    SDL_TLSEntry *entry;
 
-    return storage;
+    entry = SDL_Generic_FindTLSEntry(SDL_Generic_GetTLSBucket(thread), thread);
+    return entry ? entry->storage : NULL;
 }
 
 int
 SDL_Generic_SetTLSData(SDL_TLSData *storage)
 {
     SDL_threadID thread = SDL_ThreadID();
-    SDL_TLSEntry *prev, *entry;
-
-    /* SDL_Generic_GetTLSData() is always called first, so we can assume SDL_generic_TLS_mutex */
-    SDL_LockMutex(SDL_generic_TLS_mutex);
-    prev = NULL;
-    for (entry = SDL_generic_TLS; entry; entry = entry->next) {
-        if (entry->thread == thread) {
-            if (storage) {
-                entry->storage = storage;
-            } else {
-                if (prev) {
-                    prev->next = entry->next;
-                } else {
-                    SDL_generic_TLS = entry->next;
-                }
-                SDL_free(entry);
-            }
-            break;
+    SDL_TLSEntry **bucket = SDL_Generic_GetTLSBucket(thread);
+    SDL_TLSEntry *entry, *head;
+
+    entry = SDL_Generic_FindTLSEntry(bucket, thread);
+    if (entry) {
+        if (storage) {
+            entry->storage = storage;
+        } else {
+            /* Hand the entry back for another thread to claim */
+            entry->thread = 0;
+            entry->storage = NULL;
+            SDL_AtomicSet(&entry->in_use, 0);
         }
-        prev = entry;
+        return 0;
     }
-    if (!entry) {
-        entry = (SDL_TLSEntry *)SDL_malloc(sizeof(*entry));
-        if (entry) {
+    if (!storage) {
+        return 0;
+    }
+
+    /* Claim a released entry, if there is one */
+    head = (SDL_TLSEntry *) SDL_AtomicGetPtr((void **) bucket);
+    for (entry = head; entry; entry = entry->next) {
+        if (SDL_AtomicCAS(&entry->in_use, 0, 1)) {
             entry->thread = thread;
             entry->storage = storage;
-            entry->next = SDL_generic_TLS;
-            SDL_generic_TLS = entry;
+            return 0;
         }
     }
-    SDL_UnlockMutex(SDL_generic_TLS_mutex);
 
+    entry = (SDL_TLSEntry *)SDL_malloc(sizeof(*entry));
     if (!entry) {
         return SDL_OutOfMemory();
     }
+    SDL_AtomicSet(&entry->in_use, 1);
+    entry->thread = thread;
+    entry->storage = storage;
+    do {
+        head = (SDL_TLSEntry *) SDL_AtomicGetPtr((void **) bucket);
+        entry->next = head;
+    } while (!SDL_AtomicCASPtr((void **) bucket, head, entry));
     return 0;
 }
 
@@ -204,6 +216,10 @@ SDL_Generic_SetTLSData(SDL_TLSData *storage)
 SDL_error *
 SDL_GetErrBuf(void)
 {
+#ifdef SDL_THREAD_LOCAL
+    static SDL_THREAD_LOCAL SDL_error SDL_thread_errbuf;
+    return &SDL_thread_errbuf;
+#else
     static SDL_SpinLock tls_lock;
     static SDL_bool tls_being_created;
     static SDL_TLSID tls_errbuf;
@@ -248,6 +264,7 @@ SDL_GetErrBuf(void)
         SDL_TLSSet(tls_errbuf, errbuf, SDL_free);
     }
     return errbuf;
+#endif /* SDL_THREAD_LOCAL */
 }
 
 
@@ -275,6 +292,17 @@ SDL_RunThread(void *data)
     /* Get the thread id */
     thread->threadid = SDL_ThreadID();
 
+    /* Apply the scheduling attributes from inside the thread, failures aren't fatal */
+    if (thread->attributes.setpriority) {
+        if (SDL_SYS_SetThreadPriority(thread->attributes.priority) < 0 &&
+            thread->attributes.priority == SDL_THREAD_PRIORITY_TIME_CRITICAL) {
+            SDL_SYS_SetThreadPriority(SDL_THREAD_PRIORITY_HIGH);
+        }
+    }
+    if (thread->attributes.affinity) {
+        SDL_SYS_SetThreadAffinity(thread->attributes.affinity);
+    }
+
     /* Wake up the parent thread */
     SDL_SemPost(args->wait);
 
@@ -299,20 +327,26 @@ SDL_RunThread(void *data)
 #ifdef SDL_CreateThread
 #undef SDL_CreateThread
 #endif
+#ifdef SDL_CreateThreadWithAttributes
+#undef SDL_CreateThreadWithAttributes
+#endif
 #if SDL_DYNAMIC_API
 #define SDL_CreateThread SDL_CreateThread_REAL
+#define SDL_CreateThreadWithAttributes SDL_CreateThreadWithAttributes_REAL
 #endif
 
 #ifdef SDL_PASSED_BEGINTHREAD_ENDTHREAD
 DECLSPEC SDL_Thread *SDLCALL
-SDL_CreateThread(int (SDLCALL * fn) (void *),
-                 const char *name, void *data,
-                 pfnSDL_CurrentBeginThread pfnBeginThread,
-                 pfnSDL_CurrentEndThread pfnEndThread)
+SDL_CreateThreadWithAttributes(int (SDLCALL * fn) (void *),
+                               const char *name, void *data,
+                               const SDL_ThreadAttributes *attributes,
+                               pfnSDL_CurrentBeginThread pfnBeginThread,
+                               pfnSDL_CurrentEndThread pfnEndThread)
 #else
 DECLSPEC SDL_Thread *SDLCALL
-SDL_CreateThread(int (SDLCALL * fn) (void *),
-                 const char *name, void *data)
+SDL_CreateThreadWithAttributes(int (SDLCALL * fn) (void *),
+                               const char *name, void *data,
+                               const SDL_ThreadAttributes *attributes)
 #endif
 {
     SDL_Thread *thread;
@@ -328,6 +362,9 @@ SDL_CreateThread(int (SDLCALL * fn) (void *),
     SDL_zerop(thread);
     thread->status = -1;
     SDL_AtomicSet(&thread->state, SDL_THREAD_STATE_ALIVE);
+    if (attributes) {
+        thread->attributes = *attributes;
+    }
 
     /* Set up the arguments for the thread */
     if (name != NULL) {
@@ -386,6 +423,37 @@ SDL_CreateThread(int (SDLCALL * fn) (void *),
     return (thread);
 }
 
+#ifdef SDL_PASSED_BEGINTHREAD_ENDTHREAD
+DECLSPEC SDL_Thread *SDLCALL
+SDL_CreateThread(int (SDLCALL * fn) (void *),
+                 const char *name, void *data,
+                 pfnSDL_CurrentBeginThread pfnBeginThread,
+                 pfnSDL_CurrentEndThread pfnEndThread)
+{
+    return SDL_CreateThreadWithAttributes(fn, name, data, NULL,
+                                          pfnBeginThread, pfnEndThread);
+}
+#else
+DECLSPEC SDL_Thread *SDLCALL
+SDL_CreateThread(int (SDLCALL * fn) (void *),
+                 const char *name, void *data)
+{
+    return SDL_CreateThreadWithAttributes(fn, name, data, NULL);
+}
+#endif
+
+SDL_Thread *
+SDL_CreateThreadInternal(int (SDLCALL * fn) (void *),
+                         const char *name, void *data,
+                         const SDL_ThreadAttributes *attributes)
+{
+#ifdef SDL_PASSED_BEGINTHREAD_ENDTHREAD
+    return SDL_CreateThreadWithAttributes(fn, name, data, attributes, NULL, NULL);
+#else
+    return SDL_CreateThreadWithAttributes(fn, name, data, attributes);
+#endif
+}
+
 SDL_threadID
 SDL_GetThreadID(SDL_Thread * thread)
 {
@@ -415,6 +483,15 @@ SDL_SetThreadPriority(SDL_ThreadPriority priority)
     return SDL_SYS_SetThreadPriority(priority);
 }
 
+int
+SDL_SetThreadAffinity(Uint64 mask)
+{
+    if (!mask) {
+        return SDL_InvalidParamError("mask");
+    }
+    return SDL_SYS_SetThreadAffinity(mask);
+}
+
 void
 SDL_WaitThread(SDL_Thread * thread, int *status)
 {
@@ -42,6 +42,17 @@
 #endif
 #include "../SDL_error_c.h"
 
+/* Compiler-provided thread-local variables, used to skip the TLS lookups.
+   These are only enabled where the toolchains are known to get them right
+   in shared libraries; define SDL_THREAD_LOCAL to override.
+ */
+#if !defined(SDL_THREAD_LOCAL) && !SDL_THREADS_DISABLED
+#if defined(__GNUC__) && !defined(__ANDROID__) && \
+    (defined(__LINUX__) || defined(__FREEBSD__) || defined(__NETBSD__))
+#define SDL_THREAD_LOCAL __thread
+#endif
+#endif
+
 typedef enum SDL_ThreadState
 {
     SDL_THREAD_STATE_ALIVE,
@@ -59,12 +70,32 @@ struct SDL_Thread
     SDL_atomic_t state;  /* SDL_THREAD_STATE_* */
     SDL_error errbuf;
     char *name;
+    SDL_ThreadAttributes attributes;
     void *data;
 };
 
 /* This is the function called to run a thread */
 extern void SDL_RunThread(void *data);
 
+/* This creates a thread for SDL's own use, with the SDL library's C runtime */
+extern SDL_Thread *SDL_CreateThreadInternal(int (SDLCALL * fn) (void *),
+                                            const char *name, void *data,
+                                            const SDL_ThreadAttributes *attributes);
+
+/* The most threads SDL_RunParallel() will use, the caller's included */
+#define SDL_MAX_PARALLEL_THREADS    64
+
+typedef void (*SDL_ParallelFunc) (void *data, int index);
+
+/* Call fn(data, index) for every index from 0 to count-1, spread over up to
+   'threads' threads including the calling one, and return when all are done.
+   Jobs that can't get the worker threads run on the calling thread.
+ */
+extern void SDL_RunParallel(SDL_ParallelFunc fn, void *data, int count, int threads);
+
+/* Stop the worker threads used by SDL_RunParallel() */
+extern void SDL_QuitParallel(void);
+
 /* This is the system-independent thread local storage structure */
 typedef struct {
     unsigned int limit;
@@ -77,13 +108,13 @@ typedef struct {
 /* This is how many TLS entries we allocate at once */
 #define TLS_ALLOC_CHUNKSIZE 4
 
-/* Get cross-platform, slow, thread local storage for this thread.
+/* Get cross-platform thread local storage for this thread.
    This is only intended as a fallback if getting real thread-local
    storage fails or isn't supported on this platform.
  */
 extern SDL_TLSData *SDL_Generic_GetTLSData();
 
-/* Set cross-platform, slow, thread local storage for this thread.
+/* Set cross-platform thread local storage for this thread.
    This is only intended as a fallback if getting real thread-local
    storage fails or isn't supported on this platform.
  */
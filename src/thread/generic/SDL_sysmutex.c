@@ -56,6 +56,13 @@ SDL_CreateMutex(void)
     return mutex;
 }
 
+/* Recursive locking costs nothing extra here, so just hand out a regular mutex */
+SDL_mutex *
+SDL_CreateNonRecursiveMutex(void)
+{
+    return SDL_CreateMutex();
+}
+
 /* Free the mutex */
 void
 SDL_DestroyMutex(SDL_mutex * mutex)
@@ -0,0 +1,183 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2014 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../../SDL_internal.h"
+
+/* An implementation of reader-writer locks using a mutex and a condition
+   variable, for platforms without a native one */
+
+#include "SDL_thread.h"
+
+struct SDL_RWLock
+{
+    SDL_mutex *lock;
+    SDL_cond *released;
+    int readers;
+    SDL_bool writer;
+};
+
+SDL_RWLock *
+SDL_CreateRWLock(void)
+{
+    SDL_RWLock *rwlock;
+
+    /* Allocate the structure */
+    rwlock = (SDL_RWLock *) SDL_calloc(1, sizeof(*rwlock));
+    if (rwlock) {
+#if !SDL_THREADS_DISABLED
+        rwlock->lock = SDL_CreateNonRecursiveMutex();
+        rwlock->released = SDL_CreateCond();
+        if (!rwlock->lock || !rwlock->released) {
+            SDL_DestroyRWLock(rwlock);
+            rwlock = NULL;
+        }
+#endif
+    } else {
+        SDL_OutOfMemory();
+    }
+    return rwlock;
+}
+
+void
+SDL_DestroyRWLock(SDL_RWLock * rwlock)
+{
+    if (rwlock) {
+        if (rwlock->released) {
+            SDL_DestroyCond(rwlock->released);
+        }
+        if (rwlock->lock) {
+            SDL_DestroyMutex(rwlock->lock);
+        }
+        SDL_free(rwlock);
+    }
+}
+
+int
+SDL_LockRWLockForReading(SDL_RWLock * rwlock)
+{
+#if SDL_THREADS_DISABLED
+    return 0;
+#else
+    if (rwlock == NULL) {
+        return SDL_SetError("Passed a NULL rwlock");
+    }
+
+    SDL_LockMutex(rwlock->lock);
+    while (rwlock->writer) {
+        SDL_CondWait(rwlock->released, rwlock->lock);
+    }
+    ++rwlock->readers;
+    SDL_UnlockMutex(rwlock->lock);
+    return 0;
+#endif /* SDL_THREADS_DISABLED */
+}
+
+int
+SDL_LockRWLockForWriting(SDL_RWLock * rwlock)
+{
+#if SDL_THREADS_DISABLED
+    return 0;
+#else
+    if (rwlock == NULL) {
+        return SDL_SetError("Passed a NULL rwlock");
+    }
+
+    SDL_LockMutex(rwlock->lock);
+    while (rwlock->writer || rwlock->readers > 0) {
+        SDL_CondWait(rwlock->released, rwlock->lock);
+    }
+    rwlock->writer = SDL_TRUE;
+    SDL_UnlockMutex(rwlock->lock);
+    return 0;
+#endif /* SDL_THREADS_DISABLED */
+}
+
+int
+SDL_TryLockRWLockForReading(SDL_RWLock * rwlock)
+{
+#if SDL_THREADS_DISABLED
+    return 0;
+#else
+    int retval = SDL_MUTEX_TIMEDOUT;
+
+    if (rwlock == NULL) {
+        return SDL_SetError("Passed a NULL rwlock");
+    }
+
+    SDL_LockMutex(rwlock->lock);
+    if (!rwlock->writer) {
+        ++rwlock->readers;
+        retval = 0;
+    }
+    SDL_UnlockMutex(rwlock->lock);
+    return retval;
+#endif /* SDL_THREADS_DISABLED */
+}
+
+int
+SDL_TryLockRWLockForWriting(SDL_RWLock * rwlock)
+{
+#if SDL_THREADS_DISABLED
+    return 0;
+#else
+    int retval = SDL_MUTEX_TIMEDOUT;
+
+    if (rwlock == NULL) {
+        return SDL_SetError("Passed a NULL rwlock");
+    }
+
+    SDL_LockMutex(rwlock->lock);
+    if (!rwlock->writer && rwlock->readers == 0) {
+        rwlock->writer = SDL_TRUE;
+        retval = 0;
+    }
+    SDL_UnlockMutex(rwlock->lock);
+    return retval;
+#endif /* SDL_THREADS_DISABLED */
+}
+
+int
+SDL_UnlockRWLock(SDL_RWLock * rwlock)
+{
+#if SDL_THREADS_DISABLED
+    return 0;
+#else
+    if (rwlock == NULL) {
+        return SDL_SetError("Passed a NULL rwlock");
+    }
+
+    SDL_LockMutex(rwlock->lock);
+    if (rwlock->writer) {
+        rwlock->writer = SDL_FALSE;
+        SDL_CondBroadcast(rwlock->released);
+    } else if (rwlock->readers > 0) {
+        if (--rwlock->readers == 0) {
+            SDL_CondBroadcast(rwlock->released);
+        }
+    } else {
+        SDL_UnlockMutex(rwlock->lock);
+        return SDL_SetError("rwlock not locked");
+    }
+    SDL_UnlockMutex(rwlock->lock);
+    return 0;
+#endif /* SDL_THREADS_DISABLED */
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -56,6 +56,12 @@ SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority)
     return (0);
 }
 
+int
+SDL_SYS_SetThreadAffinity(Uint64 mask)
+{
+    return SDL_Unsupported();
+}
+
 void
 SDL_SYS_WaitThread(SDL_Thread * thread)
 {
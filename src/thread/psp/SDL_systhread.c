@@ -45,6 +45,7 @@ int SDL_SYS_CreateThread(SDL_Thread *thread, void *args)
 {
     SceKernelThreadInfo status;
     int priority = 32;
+    int stacksize = 0x8000;
 
     /* Set priority of new thread to the same as the current thread */
     status.size = sizeof(SceKernelThreadInfo);
@@ -52,8 +53,12 @@ int SDL_SYS_CreateThread(SDL_Thread *thread, void *args)
         priority = status.currentPriority;
     }
 
+    if (thread->attributes.stacksize > 0) {
+        stacksize = (int) thread->attributes.stacksize;
+    }
+
     thread->handle = sceKernelCreateThread("SDL thread", ThreadEntry,
-                           priority, 0x8000,
+                           priority, stacksize,
                            PSP_THREAD_ATTR_VFPU, NULL);
     if (thread->handle < 0) {
         return SDL_SetError("sceKernelCreateThread() failed");
@@ -96,7 +101,7 @@ int SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority)
 
     if (priority == SDL_THREAD_PRIORITY_LOW) {
         value = 19;
-    } else if (priority == SDL_THREAD_PRIORITY_HIGH) {
+    } else if (priority >= SDL_THREAD_PRIORITY_HIGH) {
         value = -20;
     } else {
         value = 0;
@@ -106,6 +111,12 @@ int SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority)
 
 }
 
+int SDL_SYS_SetThreadAffinity(Uint64 mask)
+{
+    /* The PSP has a single CPU available to applications */
+    return SDL_Unsupported();
+}
+
 #endif /* SDL_THREAD_PSP */
 
 /* vim: ts=4 sw=4
@@ -32,15 +32,52 @@
 struct SDL_cond
 {
     pthread_cond_t cond;
+#if SDL_USE_FUTEX
+    /* Waiters holding a futex based mutex sleep on 'seq' instead */
+    int seq;
+    int futex_waiters;
+#endif
 };
 
+#if SDL_USE_FUTEX
+static int
+SDL_FutexCondWait(SDL_cond * cond, SDL_mutex * mutex, Uint32 ms)
+{
+    int seq;
+    int result;
+
+    /* Both of these happen while we still hold the mutex, so a signal sent
+       after the caller's predicate changed can't be missed. */
+    seq = cond->seq;
+    __sync_fetch_and_add(&cond->futex_waiters, 1);
+
+    SDL_FutexUnlock(&mutex->futex);
+    result = SDL_FutexWait(&cond->seq, seq, ms);
+
+    /* Other threads may be queued up behind us, so take it contended */
+    SDL_FutexLockContended(&mutex->futex);
+    __sync_fetch_and_sub(&cond->futex_waiters, 1);
+
+    return (result == ETIMEDOUT) ? SDL_MUTEX_TIMEDOUT : 0;
+}
+
+static void
+SDL_FutexCondWake(SDL_cond * cond, int count)
+{
+    if (cond->futex_waiters > 0) {
+        __sync_fetch_and_add(&cond->seq, 1);
+        SDL_FutexWake(&cond->seq, count);
+    }
+}
+#endif /* SDL_USE_FUTEX */
+
 /* Create a condition variable */
 SDL_cond *
 SDL_CreateCond(void)
 {
     SDL_cond *cond;
 
-    cond = (SDL_cond *) SDL_malloc(sizeof(SDL_cond));
+    cond = (SDL_cond *) SDL_calloc(1, sizeof(SDL_cond));
     if (cond) {
         if (pthread_cond_init(&cond->cond, NULL) < 0) {
             SDL_SetError("pthread_cond_init() failed");
@@ -71,6 +108,10 @@ SDL_CondSignal(SDL_cond * cond)
         return SDL_SetError("Passed a NULL condition variable");
     }
 
+#if SDL_USE_FUTEX
+    SDL_FutexCondWake(cond, 1);
+#endif
+
     retval = 0;
     if (pthread_cond_signal(&cond->cond) != 0) {
         return SDL_SetError("pthread_cond_signal() failed");
@@ -88,6 +129,10 @@ SDL_CondBroadcast(SDL_cond * cond)
         return SDL_SetError("Passed a NULL condition variable");
     }
 
+#if SDL_USE_FUTEX
+    SDL_FutexCondWake(cond, 0x7FFFFFFF);
+#endif
+
     retval = 0;
     if (pthread_cond_broadcast(&cond->cond) != 0) {
         return SDL_SetError("pthread_cond_broadcast() failed");
@@ -108,6 +153,12 @@ SDL_CondWaitTimeout(SDL_cond * cond, SDL_mutex * mutex, Uint32 ms)
         return SDL_SetError("Passed a NULL condition variable");
     }
 
+#if SDL_USE_FUTEX
+    if (mutex->futex_based) {
+        return SDL_FutexCondWait(cond, mutex, ms);
+    }
+#endif
+
 #ifdef HAVE_CLOCK_GETTIME
     clock_gettime(CLOCK_REALTIME, &abstime);
 
@@ -149,7 +200,13 @@ SDL_CondWait(SDL_cond * cond, SDL_mutex * mutex)
 {
     if (!cond) {
         return SDL_SetError("Passed a NULL condition variable");
-    } else if (pthread_cond_wait(&cond->cond, &mutex->id) != 0) {
+    }
+#if SDL_USE_FUTEX
+    if (mutex->futex_based) {
+        return SDL_FutexCondWait(cond, mutex, SDL_FUTEX_WAIT_FOREVER);
+    }
+#endif
+    if (pthread_cond_wait(&cond->cond, &mutex->id) != 0) {
         return SDL_SetError("pthread_cond_wait() failed");
     }
     return 0;
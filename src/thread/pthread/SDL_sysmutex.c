@@ -27,20 +27,7 @@
 #include <errno.h>
 
 #include "SDL_thread.h"
-
-#if !SDL_THREAD_PTHREAD_RECURSIVE_MUTEX && \
-    !SDL_THREAD_PTHREAD_RECURSIVE_MUTEX_NP
-#define FAKE_RECURSIVE_MUTEX 1
-#endif
-
-struct SDL_mutex
-{
-    pthread_mutex_t id;
-#if FAKE_RECURSIVE_MUTEX
-    int recursive;
-    pthread_t owner;
-#endif
-};
+#include "SDL_sysmutex_c.h"
 
 SDL_mutex *
 SDL_CreateMutex(void)
@@ -70,10 +57,41 @@ SDL_CreateMutex(void)
     return (mutex);
 }
 
+SDL_mutex *
+SDL_CreateNonRecursiveMutex(void)
+{
+    SDL_mutex *mutex;
+
+    /* Allocate the structure */
+    mutex = (SDL_mutex *) SDL_calloc(1, sizeof(*mutex));
+    if (mutex) {
+#if SDL_USE_FUTEX
+        /* Nothing to set up, the lock word starts out unlocked */
+        mutex->futex_based = SDL_TRUE;
+#else
+        /* The default mutex type is the cheapest one pthreads has */
+        if (pthread_mutex_init(&mutex->id, NULL) != 0) {
+            SDL_SetError("pthread_mutex_init() failed");
+            SDL_free(mutex);
+            mutex = NULL;
+        }
+#endif
+    } else {
+        SDL_OutOfMemory();
+    }
+    return (mutex);
+}
+
 void
 SDL_DestroyMutex(SDL_mutex * mutex)
 {
     if (mutex) {
+#if SDL_USE_FUTEX
+        if (mutex->futex_based) {
+            SDL_free(mutex);
+            return;
+        }
+#endif
         pthread_mutex_destroy(&mutex->id);
         SDL_free(mutex);
     }
@@ -91,6 +109,15 @@ SDL_LockMutex(SDL_mutex * mutex)
         return SDL_SetError("Passed a NULL mutex");
     }
 
+#if SDL_USE_FUTEX
+    if (mutex->futex_based) {
+        if (!SDL_FutexTryLock(&mutex->futex)) {
+            SDL_FutexLockContended(&mutex->futex);
+        }
+        return 0;
+    }
+#endif
+
 #if FAKE_RECURSIVE_MUTEX
     this_thread = pthread_self();
     if (mutex->owner == this_thread) {
@@ -127,6 +154,12 @@ SDL_TryLockMutex(SDL_mutex * mutex)
         return SDL_SetError("Passed a NULL mutex");
     }
 
+#if SDL_USE_FUTEX
+    if (mutex->futex_based) {
+        return SDL_FutexTryLock(&mutex->futex) ? 0 : SDL_MUTEX_TIMEDOUT;
+    }
+#endif
+
     retval = 0;
 #if FAKE_RECURSIVE_MUTEX
     this_thread = pthread_self();
@@ -165,6 +198,13 @@ SDL_UnlockMutex(SDL_mutex * mutex)
         return SDL_SetError("Passed a NULL mutex");
     }
 
+#if SDL_USE_FUTEX
+    if (mutex->futex_based) {
+        SDL_FutexUnlock(&mutex->futex);
+        return 0;
+    }
+#endif
+
 #if FAKE_RECURSIVE_MUTEX
     /* We can only unlock the mutex if we own it */
     if (pthread_self() == mutex->owner) {
@@ -23,9 +23,25 @@
 #ifndef _SDL_mutex_c_h
 #define _SDL_mutex_c_h
 
+#include "../../core/linux/SDL_futex.h"
+
+#if !SDL_THREAD_PTHREAD_RECURSIVE_MUTEX && \
+    !SDL_THREAD_PTHREAD_RECURSIVE_MUTEX_NP
+#define FAKE_RECURSIVE_MUTEX 1
+#endif
+
 struct SDL_mutex
 {
     pthread_mutex_t id;
+#if FAKE_RECURSIVE_MUTEX
+    int recursive;
+    pthread_t owner;
+#endif
+#if SDL_USE_FUTEX
+    /* Non-recursive mutexes skip pthreads and lock this word directly */
+    SDL_bool futex_based;
+    int futex;
+#endif
 };
 
 #endif /* _SDL_mutex_c_h */
@@ -0,0 +1,242 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2014 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../../SDL_internal.h"
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <pthread.h>
+#include <errno.h>
+
+#include "SDL_thread.h"
+#include "../../core/linux/SDL_futex.h"
+
+#if SDL_USE_FUTEX
+
+/* On Linux the lock is a single word: the number of readers holding it,
+   or -1 while a writer does.  Sleepers wait on a separate sequence word
+   that is bumped whenever the lock becomes free, so releasing an
+   uncontended lock never makes a syscall.
+
+   There is no writer preference, so a continuous stream of overlapping
+   readers can starve a writer; that's the right tradeoff for the read
+   mostly data this is meant for.
+ */
+struct SDL_RWLock
+{
+    int state;
+    int seq;
+    int waiters;
+};
+
+static SDL_bool
+SDL_FutexTryLockForReading(SDL_RWLock * rwlock)
+{
+    int state = rwlock->state;
+    while (state >= 0) {
+        if (__sync_bool_compare_and_swap(&rwlock->state, state, state + 1)) {
+            return SDL_TRUE;
+        }
+        state = rwlock->state;
+    }
+    return SDL_FALSE;
+}
+
+static SDL_bool
+SDL_FutexTryLockForWriting(SDL_RWLock * rwlock)
+{
+    return __sync_bool_compare_and_swap(&rwlock->state, 0, -1) ? SDL_TRUE : SDL_FALSE;
+}
+
+static void
+SDL_FutexLockRWLock(SDL_RWLock * rwlock, SDL_bool (*trylock)(SDL_RWLock *))
+{
+    int seq;
+
+    while (!trylock(rwlock)) {
+        /* Register as a waiter before checking again, so the unlocking
+           thread either sees us or we see the lock free. */
+        seq = rwlock->seq;
+        __sync_fetch_and_add(&rwlock->waiters, 1);
+        if (trylock(rwlock)) {
+            __sync_fetch_and_sub(&rwlock->waiters, 1);
+            break;
+        }
+        SDL_FutexWait(&rwlock->seq, seq, SDL_FUTEX_WAIT_FOREVER);
+        __sync_fetch_and_sub(&rwlock->waiters, 1);
+    }
+}
+
+#else
+
+struct SDL_RWLock
+{
+    pthread_rwlock_t id;
+};
+
+#endif /* SDL_USE_FUTEX */
+
+SDL_RWLock *
+SDL_CreateRWLock(void)
+{
+    SDL_RWLock *rwlock;
+
+    /* Allocate the structure */
+    rwlock = (SDL_RWLock *) SDL_calloc(1, sizeof(*rwlock));
+    if (rwlock) {
+#if !SDL_USE_FUTEX
+        if (pthread_rwlock_init(&rwlock->id, NULL) != 0) {
+            SDL_SetError("pthread_rwlock_init() failed");
+            SDL_free(rwlock);
+            rwlock = NULL;
+        }
+#endif
+    } else {
+        SDL_OutOfMemory();
+    }
+    return (rwlock);
+}
+
+void
+SDL_DestroyRWLock(SDL_RWLock * rwlock)
+{
+    if (rwlock) {
+#if !SDL_USE_FUTEX
+        pthread_rwlock_destroy(&rwlock->id);
+#endif
+        SDL_free(rwlock);
+    }
+}
+
+int
+SDL_LockRWLockForReading(SDL_RWLock * rwlock)
+{
+    if (rwlock == NULL) {
+        return SDL_SetError("Passed a NULL rwlock");
+    }
+
+#if SDL_USE_FUTEX
+    SDL_FutexLockRWLock(rwlock, SDL_FutexTryLockForReading);
+#else
+    if (pthread_rwlock_rdlock(&rwlock->id) != 0) {
+        return SDL_SetError("pthread_rwlock_rdlock() failed");
+    }
+#endif
+    return 0;
+}
+
+int
+SDL_LockRWLockForWriting(SDL_RWLock * rwlock)
+{
+    if (rwlock == NULL) {
+        return SDL_SetError("Passed a NULL rwlock");
+    }
+
+#if SDL_USE_FUTEX
+    SDL_FutexLockRWLock(rwlock, SDL_FutexTryLockForWriting);
+#else
+    if (pthread_rwlock_wrlock(&rwlock->id) != 0) {
+        return SDL_SetError("pthread_rwlock_wrlock() failed");
+    }
+#endif
+    return 0;
+}
+
+int
+SDL_TryLockRWLockForReading(SDL_RWLock * rwlock)
+{
+#if !SDL_USE_FUTEX
+    int result;
+#endif
+
+    if (rwlock == NULL) {
+        return SDL_SetError("Passed a NULL rwlock");
+    }
+
+#if SDL_USE_FUTEX
+    return SDL_FutexTryLockForReading(rwlock) ? 0 : SDL_MUTEX_TIMEDOUT;
+#else
+    result = pthread_rwlock_tryrdlock(&rwlock->id);
+    if (result == 0) {
+        return 0;
+    } else if (result == EBUSY) {
+        return SDL_MUTEX_TIMEDOUT;
+    }
+    return SDL_SetError("pthread_rwlock_tryrdlock() failed");
+#endif
+}
+
+int
+SDL_TryLockRWLockForWriting(SDL_RWLock * rwlock)
+{
+#if !SDL_USE_FUTEX
+    int result;
+#endif
+
+    if (rwlock == NULL) {
+        return SDL_SetError("Passed a NULL rwlock");
+    }
+
+#if SDL_USE_FUTEX
+    return SDL_FutexTryLockForWriting(rwlock) ? 0 : SDL_MUTEX_TIMEDOUT;
+#else
+    result = pthread_rwlock_trywrlock(&rwlock->id);
+    if (result == 0) {
+        return 0;
+    } else if (result == EBUSY) {
+        return SDL_MUTEX_TIMEDOUT;
+    }
+    return SDL_SetError("pthread_rwlock_trywrlock() failed");
+#endif
+}
+
+int
+SDL_UnlockRWLock(SDL_RWLock * rwlock)
+{
+#if SDL_USE_FUTEX
+    int state;
+#endif
+
+    if (rwlock == NULL) {
+        return SDL_SetError("Passed a NULL rwlock");
+    }
+
+#if SDL_USE_FUTEX
+    if (rwlock->state == -1) {
+        /* We're the writer, nobody else can touch the state right now */
+        __sync_bool_compare_and_swap(&rwlock->state, -1, 0);
+        state = 0;
+    } else {
+        state = __sync_sub_and_fetch(&rwlock->state, 1);
+    }
+    if (state == 0 && rwlock->waiters > 0) {
+        __sync_fetch_and_add(&rwlock->seq, 1);
+        SDL_FutexWake(&rwlock->seq, 0x7FFFFFFF);
+    }
+#else
+    if (pthread_rwlock_unlock(&rwlock->id) != 0) {
+        return SDL_SetError("pthread_rwlock_unlock() failed");
+    }
+#endif
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -106,6 +106,11 @@ SDL_SYS_CreateThread(SDL_Thread * thread, void *args)
     }
     pthread_attr_setdetachstate(&type, PTHREAD_CREATE_JOINABLE);
 
+    /* Set caller-requested stack size, the OS default is used if it's refused. */
+    if (thread->attributes.stacksize > 0) {
+        pthread_attr_setstacksize(&type, thread->attributes.stacksize);
+    }
+
     /* Create the thread and go! */
     if (pthread_create(&thread->handle, &type, RunThread, args) != 0) {
         return SDL_SetError("Not enough resources to create thread");
@@ -178,6 +183,28 @@ SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority)
     return 0;
 #elif __LINUX__
     int value;
+    struct sched_param sched;
+    int policy;
+    pthread_t thread = pthread_self();
+
+    /* Real-time scheduling needs CAP_SYS_NICE or an RLIMIT_RTPRIO grant */
+    if (pthread_getschedparam(thread, &policy, &sched) != 0) {
+        return SDL_SetError("pthread_getschedparam() failed");
+    }
+    if (priority == SDL_THREAD_PRIORITY_TIME_CRITICAL) {
+        int min_priority = sched_get_priority_min(SCHED_RR);
+        int max_priority = sched_get_priority_max(SCHED_RR);
+        sched.sched_priority = (min_priority + (max_priority - min_priority) / 2);
+        if (pthread_setschedparam(thread, SCHED_RR, &sched) != 0) {
+            return SDL_SetError("pthread_setschedparam() failed");
+        }
+        return 0;
+    }
+    if (policy != SCHED_OTHER) {
+        /* Leaving the real-time class, nice values don't apply to it */
+        sched.sched_priority = 0;
+        pthread_setschedparam(thread, SCHED_OTHER, &sched);
+    }
 
     if (priority == SDL_THREAD_PRIORITY_LOW) {
         value = 19;
@@ -201,7 +228,10 @@ SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority)
     if (pthread_getschedparam(thread, &policy, &sched) < 0) {
         return SDL_SetError("pthread_getschedparam() failed");
     }
-    if (priority == SDL_THREAD_PRIORITY_LOW) {
+    if (priority == SDL_THREAD_PRIORITY_TIME_CRITICAL) {
+        policy = SCHED_RR;
+        sched.sched_priority = sched_get_priority_max(policy);
+    } else if (priority == SDL_THREAD_PRIORITY_LOW) {
         sched.sched_priority = sched_get_priority_min(policy);
     } else if (priority == SDL_THREAD_PRIORITY_HIGH) {
         sched.sched_priority = sched_get_priority_max(policy);
@@ -217,6 +247,30 @@ SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority)
 #endif /* linux */
 }
 
+int
+SDL_SYS_SetThreadAffinity(Uint64 mask)
+{
+#if defined(__LINUX__) && defined(SYS_sched_setaffinity)
+    /* The kernel takes an array of longs, avoiding the _GNU_SOURCE cpu_set_t */
+    unsigned long cpus[(sizeof(mask) + sizeof(unsigned long) - 1) / sizeof(unsigned long)];
+    const int bits = (int) (sizeof(unsigned long) * 8);
+    int i;
+
+    SDL_zero(cpus);
+    for (i = 0; i < 64; ++i) {
+        if (mask & ((Uint64) 1 << i)) {
+            cpus[i / bits] |= 1UL << (i % bits);
+        }
+    }
+    if (syscall(SYS_sched_setaffinity, syscall(SYS_gettid), sizeof(cpus), cpus) < 0) {
+        return SDL_SetError("sched_setaffinity() failed");
+    }
+    return 0;
+#else
+    return SDL_Unsupported();
+#endif
+}
+
 void
 SDL_SYS_WaitThread(SDL_Thread * thread)
 {
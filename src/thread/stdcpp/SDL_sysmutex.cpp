@@ -50,6 +50,14 @@ SDL_CreateMutex(void)
     }
 }
 
+/* std::recursive_mutex is all we have, so just hand out a regular mutex */
+extern "C"
+SDL_mutex *
+SDL_CreateNonRecursiveMutex(void)
+{
+    return SDL_CreateMutex();
+}
+
 /* Free the mutex */
 extern "C"
 void
@@ -110,6 +110,16 @@ SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority)
     return (0);
 }
 
+extern "C"
+int
+SDL_SYS_SetThreadAffinity(Uint64 mask)
+{
+    // std::thread has no notion of affinity, and WinRT doesn't allow
+    // setting it.  Stack sizes can't be picked either, so
+    // SDL_SYS_CreateThread ignores thread->attributes.stacksize.
+    return SDL_Unsupported();
+}
+
 extern "C"
 void
 SDL_SYS_WaitThread(SDL_Thread * thread)
@@ -25,6 +25,7 @@
 #include "SDL_atomic.h"
 #include "SDL_cpuinfo.h"
 #include "SDL_thread.h"
+#include "../thread/SDL_thread_c.h"
 
 /* #define DEBUG_TIMERS */
 
@@ -209,7 +210,8 @@ SDL_TimerInit(void)
 
     if (!data->active) {
         const char *name = "SDLTimer";
-        data->timermap_lock = SDL_CreateMutex();
+        SDL_ThreadAttributes attributes;
+        data->timermap_lock = SDL_CreateNonRecursiveMutex();
         if (!data->timermap_lock) {
             return -1;
         }
@@ -221,17 +223,10 @@ SDL_TimerInit(void)
         }
 
         data->active = SDL_TRUE;
-        /* !!! FIXME: this is nasty. */
-#if defined(__WIN32__) && !defined(HAVE_LIBC)
-#undef SDL_CreateThread
-#if SDL_DYNAMIC_API
-        data->thread = SDL_CreateThread_REAL(SDL_TimerThread, name, data, NULL, NULL);
-#else
-        data->thread = SDL_CreateThread(SDL_TimerThread, name, data, NULL, NULL);
-#endif
-#else
-        data->thread = SDL_CreateThread(SDL_TimerThread, name, data);
-#endif
+        SDL_zero(attributes);
+        attributes.setpriority = SDL_TRUE;
+        attributes.priority = SDL_THREAD_PRIORITY_HIGH;
+        data->thread = SDL_CreateThreadInternal(SDL_TimerThread, name, data, &attributes);
         if (!data->thread) {
             SDL_TimerQuit();
             return -1;
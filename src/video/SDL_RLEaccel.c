@@ -58,6 +58,10 @@
  *   The end of the sequence is marked by a zero <skip>,<run> pair at the *
  *   beginning of a line.
  *
+ *   8-bit indexed sources with a different target format are translated
+ *   through the palette map of the blit, so the runs can still be copied
+ *   straight to the target.
+ *
  * Encoding of surfaces with per-pixel alpha:
  *
  *   The sequence begins with a struct RLEDestFormat describing the target
@@ -83,11 +87,18 @@
  *
  *   The end of the sequence is marked by a zero <skip>,<run> pair at the
  *   beginning of an opaque line.
+ *
+ * The surface keeps its pixels while it is encoded, and the offset of each
+ * encoded scan line is kept alongside the sequence. Writing to the surface
+ * only marks the rows it touched as stale, and those rows are encoded again
+ * in place by the next blit, so locking and unlocking the surface doesn't
+ * cost a full decode and encode.
  */
 
 #include "SDL_video.h"
 #include "SDL_sysvideo.h"
 #include "SDL_blit.h"
+#include "SDL_blit_simd.h"
 #include "SDL_RLEaccel_c.h"
 
 #ifndef MAX
@@ -303,6 +314,118 @@
 #define ALPHA_BLIT16_555_50(to, from, length, bpp, alpha)       \
     ALPHA_BLIT16_50(to, from, length, bpp, alpha, 0xfbde)
 
+/*
+ * Runs of 32bpp pixels blended at a per-surface alpha go through a function
+ * chosen for the CPU once per blit. The vector versions work on each byte
+ * separately, which gives exactly the same results as the packed arithmetic
+ * above: the low byte of (s - d) * alpha >> 8 doesn't depend on the bits
+ * that carry in from the neighbouring component.
+ */
+typedef void (*RLEBlend32Func) (Uint32 * dst, const Uint32 * src, int n,
+                                unsigned alpha);
+
+static void
+RLEBlend32(Uint32 * to, const Uint32 * from, int n, unsigned alpha)
+{
+    if (alpha == 128) {
+        ALPHA_BLIT32_888_50(to, from, n, 4, alpha);
+    } else {
+        ALPHA_BLIT32_888(to, from, n, 4, alpha);
+    }
+}
+
+#if HAVE_SSE2_BLITTERS
+/* Blend 4 pixels, a holds the alpha of each byte widened to 16 bits */
+#define RLE_BLEND_SSE2(s, d, alo, ahi)                                  \
+    _mm_packus_epi16(                                                   \
+        _mm_and_si128(_mm_add_epi16(_mm_unpacklo_epi8(d, zero),         \
+            _mm_srli_epi16(_mm_mullo_epi16(                             \
+                _mm_sub_epi16(_mm_unpacklo_epi8(s, zero),               \
+                              _mm_unpacklo_epi8(d, zero)), alo), 8)), lobyte), \
+        _mm_and_si128(_mm_add_epi16(_mm_unpackhi_epi8(d, zero),         \
+            _mm_srli_epi16(_mm_mullo_epi16(                             \
+                _mm_sub_epi16(_mm_unpackhi_epi8(s, zero),               \
+                              _mm_unpackhi_epi8(d, zero)), ahi), 8)), lobyte))
+
+static void
+RLEBlend32SSE2(Uint32 * dst, const Uint32 * src, int n, unsigned alpha)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lobyte = _mm_set1_epi16(0x00ff);
+    const __m128i rgbmask = _mm_set1_epi32(0x00ffffff);
+    const __m128i a = _mm_set1_epi16((short) alpha);
+
+    for (; n >= 4; n -= 4, src += 4, dst += 4) {
+        const __m128i s = _mm_loadu_si128((const __m128i *) src);
+        const __m128i d = _mm_loadu_si128((const __m128i *) dst);
+        _mm_storeu_si128((__m128i *) dst,
+                         _mm_and_si128(RLE_BLEND_SSE2(s, d, a, a), rgbmask));
+    }
+    RLEBlend32(dst, src, n, alpha);
+}
+#endif /* HAVE_SSE2_BLITTERS */
+
+#if HAVE_AVX2_BLITTERS
+#define RLE_BLEND_AVX2(s, d, alo, ahi)                                  \
+    _mm256_packus_epi16(                                                \
+        _mm256_and_si256(_mm256_add_epi16(_mm256_unpacklo_epi8(d, zero), \
+            _mm256_srli_epi16(_mm256_mullo_epi16(                       \
+                _mm256_sub_epi16(_mm256_unpacklo_epi8(s, zero),         \
+                                 _mm256_unpacklo_epi8(d, zero)), alo), 8)), lobyte), \
+        _mm256_and_si256(_mm256_add_epi16(_mm256_unpackhi_epi8(d, zero), \
+            _mm256_srli_epi16(_mm256_mullo_epi16(                       \
+                _mm256_sub_epi16(_mm256_unpackhi_epi8(s, zero),         \
+                                 _mm256_unpackhi_epi8(d, zero)), ahi), 8)), lobyte))
+
+SDL_TARGETING_AVX2 static void
+RLEBlend32AVX2(Uint32 * dst, const Uint32 * src, int n, unsigned alpha)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i lobyte = _mm256_set1_epi16(0x00ff);
+    const __m256i rgbmask = _mm256_set1_epi32(0x00ffffff);
+    const __m256i a = _mm256_set1_epi16((short) alpha);
+
+    for (; n >= 8; n -= 8, src += 8, dst += 8) {
+        const __m256i s = _mm256_loadu_si256((const __m256i *) src);
+        const __m256i d = _mm256_loadu_si256((const __m256i *) dst);
+        _mm256_storeu_si256((__m256i *) dst,
+                            _mm256_and_si256(RLE_BLEND_AVX2(s, d, a, a), rgbmask));
+    }
+    if (n > 0) {
+        /* the masked lanes are neither read nor written */
+        const __m256i mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(n),
+                                 _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        const __m256i s = _mm256_maskload_epi32((const int *) src, mask);
+        const __m256i d = _mm256_maskload_epi32((const int *) dst, mask);
+        _mm256_maskstore_epi32((int *) dst, mask,
+                               _mm256_and_si256(RLE_BLEND_AVX2(s, d, a, a), rgbmask));
+    }
+}
+#endif /* HAVE_AVX2_BLITTERS */
+
+static RLEBlend32Func
+RLEGetBlend32Func(void)
+{
+    const Uint32 features = SDL_GetBlitCPUFeatures();
+
+#if HAVE_AVX2_BLITTERS
+    if (features & SDL_CPU_AVX2) {
+        return RLEBlend32AVX2;
+    }
+#endif
+#if HAVE_SSE2_BLITTERS
+    if (features & SDL_CPU_SSE2) {
+        return RLEBlend32SSE2;
+    }
+#endif
+    (void) features;
+    return RLEBlend32;
+}
+
+/* needs a local blend32, set up with RLEGetBlend32Func() */
+#define ALPHA_BLIT32_888_RUN(to, from, length, bpp, alpha)      \
+    blend32((Uint32 *)(to), (const Uint32 *)(from), (int)(length), alpha)
+
 #define CHOOSE_BLIT(blitter, alpha, fmt)                        \
     do {                                                        \
         if (alpha == 255) {                                     \
@@ -361,11 +484,7 @@
                 if ((fmt->Rmask | fmt->Gmask | fmt->Bmask) == 0x00ffffff \
                     && (fmt->Gmask == 0xff00 || fmt->Rmask == 0xff00 \
                     || fmt->Bmask == 0xff00)) {                 \
-                    if (alpha == 128) {                         \
-                        blitter(4, Uint16, ALPHA_BLIT32_888_50); \
-                    } else {                                    \
-                        blitter(4, Uint16, ALPHA_BLIT32_888);   \
-                    }                                           \
+                    blitter(4, Uint16, ALPHA_BLIT32_888_RUN);   \
                 } else                                          \
                     blitter(4, Uint16, ALPHA_BLIT_ANY);         \
                 break;                                          \
@@ -373,6 +492,84 @@
         }                                                       \
     } while(0)
 
+/* used to save the destination format in the encoding. Designed to be
+   macro-compatible with SDL_PixelFormat but without the unneeded fields */
+typedef struct
+{
+    Uint8 BytesPerPixel;
+    Uint8 padding[3];
+    Uint32 Rmask;
+    Uint32 Gmask;
+    Uint32 Bmask;
+    Uint32 Amask;
+    Uint8 Rloss;
+    Uint8 Gloss;
+    Uint8 Bloss;
+    Uint8 Aloss;
+    Uint8 Rshift;
+    Uint8 Gshift;
+    Uint8 Bshift;
+    Uint8 Ashift;
+} RLEDestFormat;
+
+typedef Uint32(*getpix_func) (const Uint8 *);
+
+typedef int (*copy_func) (void *, const Uint32 *, int,
+                          SDL_PixelFormat *, RLEDestFormat *);
+
+/*
+ * The encoded surface, kept in surface->map->data while it is accelerated,
+ * with what is needed to encode stale rows again.
+ */
+typedef struct SDL_RLEData
+{
+    Uint8 *stream;              /* the encoded sequence */
+    size_t size;                /* bytes used in the sequence */
+    size_t capacity;            /* bytes allocated for the sequence */
+    int header;                 /* bytes before the first row */
+    int row_max;                /* worst case size of one encoded row */
+    int end_size;               /* size of the end marker */
+    int dirty_top;              /* rows dirty_top to dirty_bottom - 1 */
+    int dirty_bottom;           /* changed since they were encoded */
+    Uint8 *(*encode_row) (SDL_Surface *, const Uint8 *, Uint8 *);
+
+    /* colorkey encoding */
+    int bpp;                    /* bytes per source pixel */
+    int dst_bpp;                /* bytes per encoded pixel */
+    Uint32 ckey;
+    Uint32 rgbmask;
+    getpix_func getpix;
+
+    /* per-pixel alpha encoding */
+    RLEDestFormat df;
+    copy_func copy_opaque;
+    copy_func copy_transl;
+    int max_opaque_run;
+
+    Uint32 rows[1];             /* offset of each row, and of the end */
+} SDL_RLEData;
+
+static int RLEEncodeDirtyRows(SDL_Surface * surface);
+
+/*
+ * Encode the rows that changed since the last blit. If that fails the
+ * acceleration is dropped, and the caller should blit with whatever
+ * surface->map->blit is now.
+ */
+static int
+RLEPrepareBlit(SDL_Surface * surface)
+{
+    SDL_RLEData *rle = (SDL_RLEData *) surface->map->data;
+
+    if (rle->dirty_top < rle->dirty_bottom && RLEEncodeDirtyRows(surface) < 0) {
+        if (SDL_CalculateBlit(surface) < 0) {
+            return -1;
+        }
+        return 1;
+    }
+    return 0;
+}
+
 /*
  * This takes care of the case when the surface is clipped on the left and/or
  * right. Top clipping has already been taken care of.
@@ -382,6 +579,7 @@ RLEClipBlit(int w, Uint8 * srcbuf, SDL_Surface * surf_dst,
             Uint8 * dstbuf, SDL_Rect * srcrect, unsigned alpha)
 {
     SDL_PixelFormat *fmt = surf_dst->format;
+    RLEBlend32Func blend32 = RLEGetBlend32Func();
 
 #define RLECLIPBLIT(bpp, Type, do_blit)                         \
     do {                                                        \
@@ -445,71 +643,38 @@ SDL_RLEBlit(SDL_Surface * surf_src, SDL_Rect * srcrect,
     int x, y;
     int w = surf_src->w;
     unsigned alpha;
+    SDL_RLEData *rle;
+    RLEBlend32Func blend32;
 
-    /* Lock the destination if necessary */
-    if (SDL_MUSTLOCK(surf_dst)) {
-        if (SDL_LockSurface(surf_dst) < 0) {
-            return (-1);
-        }
+    switch (RLEPrepareBlit(surf_src)) {
+    case 0:
+        break;
+    case 1:
+        return surf_src->map->blit(surf_src, srcrect, surf_dst, dstrect);
+    default:
+        return -1;
     }
 
-    /* Set up the source and destination pointers */
+    /* The destination keeps its pixels even if it is RLE encoded */
+    SDL_RLEInvalidateRows(surf_dst, dstrect->y, srcrect->h);
+
+    /* Set up the source and destination pointers, skipping lines at the
+       top if necessary */
     x = dstrect->x;
     y = dstrect->y;
     dstbuf = (Uint8 *) surf_dst->pixels
-        + y * surf_dst->pitch + x * surf_src->format->BytesPerPixel;
-    srcbuf = (Uint8 *) surf_src->map->data;
-
-    {
-        /* skip lines at the top if necessary */
-        int vskip = srcrect->y;
-        int ofs = 0;
-        if (vskip) {
-
-#define RLESKIP(bpp, Type)          \
-        for(;;) {           \
-            int run;            \
-            ofs += *(Type *)srcbuf; \
-            run = ((Type *)srcbuf)[1];  \
-            srcbuf += sizeof(Type) * 2; \
-            if(run) {           \
-            srcbuf += run * bpp;    \
-            ofs += run;     \
-            } else if(!ofs)     \
-            goto done;      \
-            if(ofs == w) {      \
-            ofs = 0;        \
-            if(!--vskip)        \
-                break;      \
-            }               \
-        }
-
-            switch (surf_src->format->BytesPerPixel) {
-            case 1:
-                RLESKIP(1, Uint8);
-                break;
-            case 2:
-                RLESKIP(2, Uint8);
-                break;
-            case 3:
-                RLESKIP(3, Uint8);
-                break;
-            case 4:
-                RLESKIP(4, Uint16);
-                break;
-            }
-
-#undef RLESKIP
-
-        }
-    }
+        + y * surf_dst->pitch + x * surf_dst->format->BytesPerPixel;
+    rle = (SDL_RLEData *) surf_src->map->data;
+    srcbuf = rle->stream + rle->rows[srcrect->y];
 
     alpha = surf_src->map->info.a;
     /* if left or right edge clipping needed, call clip blit */
     if (srcrect->x || srcrect->w != surf_src->w) {
         RLEClipBlit(w, srcbuf, surf_dst, dstbuf, srcrect, alpha);
     } else {
-        SDL_PixelFormat *fmt = surf_src->format;
+        SDL_PixelFormat *fmt = surf_dst->format;
+
+        blend32 = RLEGetBlend32Func();
 
 #define RLEBLIT(bpp, Type, do_blit)                       \
         do {                                  \
@@ -540,11 +705,6 @@ SDL_RLEBlit(SDL_Surface * surf_src, SDL_Rect * srcrect,
 #undef RLEBLIT
     }
 
-  done:
-    /* Unlock the destination if necessary */
-    if (SDL_MUSTLOCK(surf_dst)) {
-        SDL_UnlockSurface(surf_dst);
-    }
     return (0);
 }
 
@@ -601,25 +761,111 @@ SDL_RLEBlit(SDL_Surface * surf_src, SDL_Rect * srcrect,
     dst = (Uint16)(d | d >> 16);            \
     } while(0)
 
-/* used to save the destination format in the encoding. Designed to be
-   macro-compatible with SDL_PixelFormat but without the unneeded fields */
-typedef struct
+/* blend a run of translucent pixels */
+#define BLIT_TRANSL_RUN(do_blend, dst, src, n)  \
+    do {                                        \
+        int i;                                  \
+        for (i = 0; i < (int)(n); i++)          \
+            do_blend((src)[i], (dst)[i]);       \
+    } while(0)
+
+#define BLIT_TRANSL_565_RUN(dst, src, n)        \
+    BLIT_TRANSL_RUN(BLIT_TRANSL_565, dst, src, n)
+
+#define BLIT_TRANSL_555_RUN(dst, src, n)        \
+    BLIT_TRANSL_RUN(BLIT_TRANSL_555, dst, src, n)
+
+/*
+ * The 32bpp translucent runs have vector versions like the per-surface
+ * blends above, with the alpha of each pixel spread over its bytes.
+ */
+typedef void (*RLETransl32Func) (Uint32 * dst, const Uint32 * src, int n);
+
+static void
+RLETransl32(Uint32 * dst, const Uint32 * src, int n)
 {
-    Uint8 BytesPerPixel;
-    Uint8 padding[3];
-    Uint32 Rmask;
-    Uint32 Gmask;
-    Uint32 Bmask;
-    Uint32 Amask;
-    Uint8 Rloss;
-    Uint8 Gloss;
-    Uint8 Bloss;
-    Uint8 Aloss;
-    Uint8 Rshift;
-    Uint8 Gshift;
-    Uint8 Bshift;
-    Uint8 Ashift;
-} RLEDestFormat;
+    BLIT_TRANSL_RUN(BLIT_TRANSL_888, dst, src, n);
+}
+
+#if HAVE_SSE2_BLITTERS
+static void
+RLETransl32SSE2(Uint32 * dst, const Uint32 * src, int n)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lobyte = _mm_set1_epi16(0x00ff);
+    const __m128i amask = _mm_set1_epi32(0xff000000);
+
+    for (; n >= 4; n -= 4, src += 4, dst += 4) {
+        const __m128i s = _mm_loadu_si128((const __m128i *) src);
+        const __m128i d = _mm_loadu_si128((const __m128i *) dst);
+        const __m128i alo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(
+                                _mm_unpacklo_epi8(s, zero), 0xff), 0xff);
+        const __m128i ahi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(
+                                _mm_unpackhi_epi8(s, zero), 0xff), 0xff);
+        _mm_storeu_si128((__m128i *) dst,
+                         _mm_or_si128(RLE_BLEND_SSE2(s, d, alo, ahi), amask));
+    }
+    RLETransl32(dst, src, n);
+}
+#endif /* HAVE_SSE2_BLITTERS */
+
+#if HAVE_AVX2_BLITTERS
+SDL_TARGETING_AVX2 static void
+RLETransl32AVX2(Uint32 * dst, const Uint32 * src, int n)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i lobyte = _mm256_set1_epi16(0x00ff);
+    const __m256i amask = _mm256_set1_epi32(0xff000000);
+    __m256i s, d, alo, ahi;
+
+    for (; n >= 8; n -= 8, src += 8, dst += 8) {
+        s = _mm256_loadu_si256((const __m256i *) src);
+        d = _mm256_loadu_si256((const __m256i *) dst);
+        alo = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(
+                  _mm256_unpacklo_epi8(s, zero), 0xff), 0xff);
+        ahi = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(
+                  _mm256_unpackhi_epi8(s, zero), 0xff), 0xff);
+        _mm256_storeu_si256((__m256i *) dst,
+                            _mm256_or_si256(RLE_BLEND_AVX2(s, d, alo, ahi), amask));
+    }
+    if (n > 0) {
+        /* the masked lanes are neither read nor written */
+        const __m256i mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(n),
+                                 _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        s = _mm256_maskload_epi32((const int *) src, mask);
+        d = _mm256_maskload_epi32((const int *) dst, mask);
+        alo = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(
+                  _mm256_unpacklo_epi8(s, zero), 0xff), 0xff);
+        ahi = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(
+                  _mm256_unpackhi_epi8(s, zero), 0xff), 0xff);
+        _mm256_maskstore_epi32((int *) dst, mask,
+                               _mm256_or_si256(RLE_BLEND_AVX2(s, d, alo, ahi), amask));
+    }
+}
+#endif /* HAVE_AVX2_BLITTERS */
+
+static RLETransl32Func
+RLEGetTransl32Func(void)
+{
+    const Uint32 features = SDL_GetBlitCPUFeatures();
+
+#if HAVE_AVX2_BLITTERS
+    if (features & SDL_CPU_AVX2) {
+        return RLETransl32AVX2;
+    }
+#endif
+#if HAVE_SSE2_BLITTERS
+    if (features & SDL_CPU_SSE2) {
+        return RLETransl32SSE2;
+    }
+#endif
+    (void) features;
+    return RLETransl32;
+}
+
+/* needs a local transl32, set up with RLEGetTransl32Func() */
+#define BLIT_TRANSL_888_RUN(dst, src, n)        \
+    transl32((Uint32 *)(dst), (const Uint32 *)(src), (int)(n))
 
 /* blit a pixel-alpha RLE surface clipped at the right and/or left edges */
 static void
@@ -627,10 +873,11 @@ RLEAlphaClipBlit(int w, Uint8 * srcbuf, SDL_Surface * surf_dst,
                  Uint8 * dstbuf, SDL_Rect * srcrect)
 {
     SDL_PixelFormat *df = surf_dst->format;
+    RLETransl32Func transl32 = RLEGetTransl32Func();
     /*
      * clipped blitter: Ptype is the destination pixel type,
      * Ctype the translucent count type, and do_blend the macro
-     * to blend one pixel.
+     * to blend a run of pixels.
      */
 #define RLEALPHACLIPBLIT(Ptype, Ctype, do_blend)              \
     do {                                  \
@@ -685,13 +932,9 @@ RLEAlphaClipBlit(int w, Uint8 * srcbuf, SDL_Surface * surf_dst,
             }                             \
             if(crun > right - cofs)               \
             crun = right - cofs;                  \
-            if(crun > 0) {                    \
-            Ptype *dst = (Ptype *)dstbuf + cofs;          \
-            Uint32 *src = (Uint32 *)srcbuf + (cofs - ofs);    \
-            int i;                        \
-            for(i = 0; i < crun; i++)             \
-                do_blend(src[i], dst[i]);             \
-            }                             \
+            if(crun > 0)                      \
+            do_blend((Ptype *)dstbuf + cofs,          \
+                 (Uint32 *)srcbuf + (cofs - ofs), crun);  \
             srcbuf += run * 4;                    \
             ofs += run;                       \
         }                             \
@@ -703,12 +946,12 @@ RLEAlphaClipBlit(int w, Uint8 * srcbuf, SDL_Surface * surf_dst,
     switch (df->BytesPerPixel) {
     case 2:
         if (df->Gmask == 0x07e0 || df->Rmask == 0x07e0 || df->Bmask == 0x07e0)
-            RLEALPHACLIPBLIT(Uint16, Uint8, BLIT_TRANSL_565);
+            RLEALPHACLIPBLIT(Uint16, Uint8, BLIT_TRANSL_565_RUN);
         else
-            RLEALPHACLIPBLIT(Uint16, Uint8, BLIT_TRANSL_555);
+            RLEALPHACLIPBLIT(Uint16, Uint8, BLIT_TRANSL_555_RUN);
         break;
     case 4:
-        RLEALPHACLIPBLIT(Uint32, Uint16, BLIT_TRANSL_888);
+        RLEALPHACLIPBLIT(Uint32, Uint16, BLIT_TRANSL_888_RUN);
         break;
     }
 }
@@ -722,84 +965,39 @@ SDL_RLEAlphaBlit(SDL_Surface * surf_src, SDL_Rect * srcrect,
     int w = surf_src->w;
     Uint8 *srcbuf, *dstbuf;
     SDL_PixelFormat *df = surf_dst->format;
+    SDL_RLEData *rle;
+    RLETransl32Func transl32;
 
-    /* Lock the destination if necessary */
-    if (SDL_MUSTLOCK(surf_dst)) {
-        if (SDL_LockSurface(surf_dst) < 0) {
-            return -1;
-        }
+    switch (RLEPrepareBlit(surf_src)) {
+    case 0:
+        break;
+    case 1:
+        return surf_src->map->blit(surf_src, srcrect, surf_dst, dstrect);
+    default:
+        return -1;
     }
 
+    /* The destination keeps its pixels even if it is RLE encoded */
+    SDL_RLEInvalidateRows(surf_dst, dstrect->y, srcrect->h);
+
+    /* skip lines at the top if necessary */
     x = dstrect->x;
     y = dstrect->y;
     dstbuf = (Uint8 *) surf_dst->pixels + y * surf_dst->pitch + x * df->BytesPerPixel;
-    srcbuf = (Uint8 *) surf_src->map->data + sizeof(RLEDestFormat);
-
-    {
-        /* skip lines at the top if necessary */
-        int vskip = srcrect->y;
-        if (vskip) {
-            int ofs;
-            if (df->BytesPerPixel == 2) {
-                /* the 16/32 interleaved format */
-                do {
-                    /* skip opaque line */
-                    ofs = 0;
-                    do {
-                        int run;
-                        ofs += srcbuf[0];
-                        run = srcbuf[1];
-                        srcbuf += 2;
-                        if (run) {
-                            srcbuf += 2 * run;
-                            ofs += run;
-                        } else if (!ofs)
-                            goto done;
-                    } while (ofs < w);
-
-                    /* skip padding */
-                    srcbuf += (uintptr_t) srcbuf & 2;
-
-                    /* skip translucent line */
-                    ofs = 0;
-                    do {
-                        int run;
-                        ofs += ((Uint16 *) srcbuf)[0];
-                        run = ((Uint16 *) srcbuf)[1];
-                        srcbuf += 4 * (run + 1);
-                        ofs += run;
-                    } while (ofs < w);
-                } while (--vskip);
-            } else {
-                /* the 32/32 interleaved format */
-                vskip <<= 1;    /* opaque and translucent have same format */
-                do {
-                    ofs = 0;
-                    do {
-                        int run;
-                        ofs += ((Uint16 *) srcbuf)[0];
-                        run = ((Uint16 *) srcbuf)[1];
-                        srcbuf += 4;
-                        if (run) {
-                            srcbuf += 4 * run;
-                            ofs += run;
-                        } else if (!ofs)
-                            goto done;
-                    } while (ofs < w);
-                } while (--vskip);
-            }
-        }
-    }
+    rle = (SDL_RLEData *) surf_src->map->data;
+    srcbuf = rle->stream + rle->rows[srcrect->y];
 
     /* if left or right edge clipping needed, call clip blit */
     if (srcrect->x || srcrect->w != surf_src->w) {
         RLEAlphaClipBlit(w, srcbuf, surf_dst, dstbuf, srcrect);
     } else {
 
+        transl32 = RLEGetTransl32Func();
+
         /*
          * non-clipped blitter. Ptype is the destination pixel type,
          * Ctype the translucent count type, and do_blend the
-         * macro to blend one pixel.
+         * macro to blend a run of pixels.
          */
 #define RLEALPHABLIT(Ptype, Ctype, do_blend)                 \
     do {                                 \
@@ -831,14 +1029,8 @@ SDL_RLEAlphaBlit(SDL_Surface * surf_src, SDL_Rect * srcrect,
             run = ((Uint16 *)srcbuf)[1];             \
             srcbuf += 4;                     \
             if(run) {                        \
-            Ptype *dst = (Ptype *)dstbuf + ofs;      \
-            unsigned i;                  \
-            for(i = 0; i < run; i++) {           \
-                Uint32 src = *(Uint32 *)srcbuf;      \
-                do_blend(src, *dst);             \
-                srcbuf += 4;                 \
-                dst++;                   \
-            }                        \
+            do_blend((Ptype *)dstbuf + ofs, (Uint32 *)srcbuf, run); \
+            srcbuf += run * 4;                   \
             ofs += run;                  \
             }                            \
         } while(ofs < w);                    \
@@ -850,21 +1042,17 @@ SDL_RLEAlphaBlit(SDL_Surface * surf_src, SDL_Rect * srcrect,
         case 2:
             if (df->Gmask == 0x07e0 || df->Rmask == 0x07e0
                 || df->Bmask == 0x07e0)
-                RLEALPHABLIT(Uint16, Uint8, BLIT_TRANSL_565);
+                RLEALPHABLIT(Uint16, Uint8, BLIT_TRANSL_565_RUN);
             else
-                RLEALPHABLIT(Uint16, Uint8, BLIT_TRANSL_555);
+                RLEALPHABLIT(Uint16, Uint8, BLIT_TRANSL_555_RUN);
             break;
         case 4:
-            RLEALPHABLIT(Uint32, Uint16, BLIT_TRANSL_888);
+            RLEALPHABLIT(Uint32, Uint16, BLIT_TRANSL_888_RUN);
             break;
         }
     }
 
   done:
-    /* Unlock the destination if necessary */
-    if (SDL_MUSTLOCK(surf_dst)) {
-        SDL_UnlockSurface(surf_dst);
-    }
     return 0;
 }
 
@@ -872,16 +1060,14 @@ SDL_RLEAlphaBlit(SDL_Surface * surf_src, SDL_Rect * srcrect,
  * Auxiliary functions:
  * The encoding functions take 32bpp rgb + a, and
  * return the number of bytes copied to the destination.
- * The decoding functions copy to 32bpp rgb + a, and
- * return the number of bytes copied from the source.
- * These are only used in the encoder and un-RLE code and are therefore not
+ * These are only used in the encoder and are therefore not
  * highly optimised.
  */
 
 /* encode 32bpp rgb + a into 16bpp rgb, losing alpha */
 static int
-copy_opaque_16(void *dst, Uint32 * src, int n,
-               SDL_PixelFormat * sfmt, SDL_PixelFormat * dfmt)
+copy_opaque_16(void *dst, const Uint32 * src, int n,
+               SDL_PixelFormat * sfmt, RLEDestFormat * dfmt)
 {
     int i;
     Uint16 *d = dst;
@@ -895,30 +1081,10 @@ copy_opaque_16(void *dst, Uint32 * src, int n,
     return n * 2;
 }
 
-/* decode opaque pixels from 16bpp to 32bpp rgb + a */
-static int
-uncopy_opaque_16(Uint32 * dst, void *src, int n,
-                 RLEDestFormat * sfmt, SDL_PixelFormat * dfmt)
-{
-    int i;
-    Uint16 *s = src;
-    unsigned alpha = dfmt->Amask ? 255 : 0;
-    for (i = 0; i < n; i++) {
-        unsigned r, g, b;
-        RGB_FROM_PIXEL(*s, sfmt, r, g, b);
-        PIXEL_FROM_RGBA(*dst, dfmt, r, g, b, alpha);
-        s++;
-        dst++;
-    }
-    return n * 2;
-}
-
-
-
 /* encode 32bpp rgb + a into 32bpp G0RAB format for blitting into 565 */
 static int
-copy_transl_565(void *dst, Uint32 * src, int n,
-                SDL_PixelFormat * sfmt, SDL_PixelFormat * dfmt)
+copy_transl_565(void *dst, const Uint32 * src, int n,
+                SDL_PixelFormat * sfmt, RLEDestFormat * dfmt)
 {
     int i;
     Uint32 *d = dst;
@@ -936,8 +1102,8 @@ copy_transl_565(void *dst, Uint32 * src, int n,
 
 /* encode 32bpp rgb + a into 32bpp G0RAB format for blitting into 555 */
 static int
-copy_transl_555(void *dst, Uint32 * src, int n,
-                SDL_PixelFormat * sfmt, SDL_PixelFormat * dfmt)
+copy_transl_555(void *dst, const Uint32 * src, int n,
+                SDL_PixelFormat * sfmt, RLEDestFormat * dfmt)
 {
     int i;
     Uint32 *d = dst;
@@ -953,29 +1119,10 @@ copy_transl_555(void *dst, Uint32 * src, int n,
     return n * 4;
 }
 
-/* decode translucent pixels from 32bpp GORAB to 32bpp rgb + a */
-static int
-uncopy_transl_16(Uint32 * dst, void *src, int n,
-                 RLEDestFormat * sfmt, SDL_PixelFormat * dfmt)
-{
-    int i;
-    Uint32 *s = src;
-    for (i = 0; i < n; i++) {
-        unsigned r, g, b, a;
-        Uint32 pix = *s++;
-        a = (pix & 0x3e0) >> 2;
-        pix = (pix & ~0x3e0) | pix >> 16;
-        RGB_FROM_PIXEL(pix, sfmt, r, g, b);
-        PIXEL_FROM_RGBA(*dst, dfmt, r, g, b, a);
-        dst++;
-    }
-    return n * 4;
-}
-
 /* encode 32bpp rgba into 32bpp rgba, keeping alpha (dual purpose) */
 static int
-copy_32(void *dst, Uint32 * src, int n,
-        SDL_PixelFormat * sfmt, SDL_PixelFormat * dfmt)
+copy_32(void *dst, const Uint32 * src, int n,
+        SDL_PixelFormat * sfmt, RLEDestFormat * dfmt)
 {
     int i;
     Uint32 *d = dst;
@@ -989,44 +1136,116 @@ copy_32(void *dst, Uint32 * src, int n,
     return n * 4;
 }
 
-/* decode 32bpp rgba into 32bpp rgba, keeping alpha (dual purpose) */
-static int
-uncopy_32(Uint32 * dst, void *src, int n,
-          RLEDestFormat * sfmt, SDL_PixelFormat * dfmt)
-{
-    int i;
-    Uint32 *s = src;
-    for (i = 0; i < n; i++) {
-        unsigned r, g, b, a;
-        Uint32 pixel = *s++;
-        RGB_FROM_PIXEL(pixel, sfmt, r, g, b);
-        a = pixel >> 24;
-        PIXEL_FROM_RGBA(*dst, dfmt, r, g, b, a);
-        dst++;
-    }
-    return n * 4;
-}
-
 #define ISOPAQUE(pixel, fmt) ((((pixel) & fmt->Amask) >> fmt->Ashift) == 255)
 
 #define ISTRANSL(pixel, fmt)    \
     ((unsigned)((((pixel) & fmt->Amask) >> fmt->Ashift) - 1U) < 254U)
 
-/* convert surface to be quickly alpha-blittable onto dest, if possible */
+/* encode one scan line of a surface with per-pixel alpha */
+static Uint8 *
+RLEAlphaRow(SDL_Surface * surface, const Uint8 * srcbuf, Uint8 * dst)
+{
+    SDL_RLEData *rle = (SDL_RLEData *) surface->map->data;
+    SDL_PixelFormat *sf = surface->format;
+    RLEDestFormat *df = &rle->df;
+    const Uint32 *src = (const Uint32 *) srcbuf;
+    const int max_opaque_run = rle->max_opaque_run;
+    const int max_transl_run = 65535;
+    int w = surface->w;
+    int x;
+
+    /* opaque counts are 8 or 16 bits, depending on target depth */
+#define ADD_OPAQUE_COUNTS(n, m)         \
+    if(df->BytesPerPixel == 4) {        \
+        ((Uint16 *)dst)[0] = n;     \
+        ((Uint16 *)dst)[1] = m;     \
+        dst += 4;               \
+    } else {                \
+        dst[0] = n;             \
+        dst[1] = m;             \
+        dst += 2;               \
+    }
+
+    /* translucent counts are always 16 bit */
+#define ADD_TRANSL_COUNTS(n, m)     \
+    (((Uint16 *)dst)[0] = n, ((Uint16 *)dst)[1] = m, dst += 4)
+
+    /* First encode all opaque pixels of a scan line */
+    x = 0;
+    do {
+        int run, skip, len;
+        int runstart, skipstart = x;
+        while (x < w && !ISOPAQUE(src[x], sf))
+            x++;
+        runstart = x;
+        while (x < w && ISOPAQUE(src[x], sf))
+            x++;
+        skip = runstart - skipstart;
+        run = x - runstart;
+        while (skip > max_opaque_run) {
+            ADD_OPAQUE_COUNTS(max_opaque_run, 0);
+            skip -= max_opaque_run;
+        }
+        len = MIN(run, max_opaque_run);
+        ADD_OPAQUE_COUNTS(skip, len);
+        dst += rle->copy_opaque(dst, src + runstart, len, sf, df);
+        runstart += len;
+        run -= len;
+        while (run) {
+            len = MIN(run, max_opaque_run);
+            ADD_OPAQUE_COUNTS(0, len);
+            dst += rle->copy_opaque(dst, src + runstart, len, sf, df);
+            runstart += len;
+            run -= len;
+        }
+    } while (x < w);
+
+    /* Make sure the next output address is 32-bit aligned */
+    dst += (uintptr_t) dst & 2;
+
+    /* Next, encode all translucent pixels of the same scan line */
+    x = 0;
+    do {
+        int run, skip, len;
+        int runstart, skipstart = x;
+        while (x < w && !ISTRANSL(src[x], sf))
+            x++;
+        runstart = x;
+        while (x < w && ISTRANSL(src[x], sf))
+            x++;
+        skip = runstart - skipstart;
+        run = x - runstart;
+        while (skip > max_transl_run) {
+            ADD_TRANSL_COUNTS(max_transl_run, 0);
+            skip -= max_transl_run;
+        }
+        len = MIN(run, max_transl_run);
+        ADD_TRANSL_COUNTS(skip, len);
+        dst += rle->copy_transl(dst, src + runstart, len, sf, df);
+        runstart += len;
+        run -= len;
+        while (run) {
+            len = MIN(run, max_transl_run);
+            ADD_TRANSL_COUNTS(0, len);
+            dst += rle->copy_transl(dst, src + runstart, len, sf, df);
+            runstart += len;
+            run -= len;
+        }
+    } while (x < w);
+
+#undef ADD_OPAQUE_COUNTS
+#undef ADD_TRANSL_COUNTS
+
+    return dst;
+}
+
+/* set up surface to be quickly alpha-blittable onto dest, if possible */
 static int
-RLEAlphaSurface(SDL_Surface * surface)
+RLEAlphaSurface(SDL_Surface * surface, SDL_RLEData * rle)
 {
     SDL_Surface *dest;
     SDL_PixelFormat *df;
-    int maxsize = 0;
-    int max_opaque_run;
-    int max_transl_run = 65535;
     unsigned masksum;
-    Uint8 *rlebuf, *dst;
-    int (*copy_opaque) (void *, Uint32 *, int,
-                        SDL_PixelFormat *, SDL_PixelFormat *);
-    int (*copy_transl) (void *, Uint32 *, int,
-                        SDL_PixelFormat *, SDL_PixelFormat *);
 
     dest = surface->map->dst;
     if (!dest)
@@ -1036,7 +1255,7 @@ RLEAlphaSurface(SDL_Surface * surface)
         return -1;              /* only 32bpp source supported */
 
     /* find out whether the destination is one we support,
-       and determine the max size of the encoded result */
+       and determine the max size of an encoded line */
     masksum = df->Rmask | df->Gmask | df->Bmask;
     switch (df->BytesPerPixel) {
     case 2:
@@ -1045,201 +1264,84 @@ RLEAlphaSurface(SDL_Surface * surface)
         case 0xffff:
             if (df->Gmask == 0x07e0
                 || df->Rmask == 0x07e0 || df->Bmask == 0x07e0) {
-                copy_opaque = copy_opaque_16;
-                copy_transl = copy_transl_565;
+                rle->copy_opaque = copy_opaque_16;
+                rle->copy_transl = copy_transl_565;
             } else
                 return -1;
             break;
         case 0x7fff:
             if (df->Gmask == 0x03e0
                 || df->Rmask == 0x03e0 || df->Bmask == 0x03e0) {
-                copy_opaque = copy_opaque_16;
-                copy_transl = copy_transl_555;
+                rle->copy_opaque = copy_opaque_16;
+                rle->copy_transl = copy_transl_555;
             } else
                 return -1;
             break;
         default:
             return -1;
         }
-        max_opaque_run = 255;   /* runs stored as bytes */
+        rle->max_opaque_run = 255;      /* runs stored as bytes */
 
         /* worst case is alternating opaque and translucent pixels,
            with room for alignment padding between lines */
-        maxsize = surface->h * (2 + (4 + 2) * (surface->w + 1)) + 2;
+        rle->row_max = 2 + (4 + 2) * (surface->w + 1);
+        rle->end_size = 2;
         break;
     case 4:
         if (masksum != 0x00ffffff)
             return -1;          /* requires unused high byte */
-        copy_opaque = copy_32;
-        copy_transl = copy_32;
-        max_opaque_run = 255;   /* runs stored as short ints */
+        rle->copy_opaque = copy_32;
+        rle->copy_transl = copy_32;
+        rle->max_opaque_run = 255;      /* runs stored as short ints */
 
         /* worst case is alternating opaque and translucent pixels */
-        maxsize = surface->h * 2 * 4 * (surface->w + 1) + 4;
+        rle->row_max = 2 * 4 * (surface->w + 1);
+        rle->end_size = 4;
         break;
     default:
         return -1;              /* anything else unsupported right now */
     }
 
-    maxsize += sizeof(RLEDestFormat);
-    rlebuf = (Uint8 *) SDL_malloc(maxsize);
-    if (!rlebuf) {
-        return SDL_OutOfMemory();
-    }
-    {
-        /* save the destination format so we can undo the encoding later */
-        RLEDestFormat *r = (RLEDestFormat *) rlebuf;
-        r->BytesPerPixel = df->BytesPerPixel;
-        r->Rmask = df->Rmask;
-        r->Gmask = df->Gmask;
-        r->Bmask = df->Bmask;
-        r->Amask = df->Amask;
-        r->Rloss = df->Rloss;
-        r->Gloss = df->Gloss;
-        r->Bloss = df->Bloss;
-        r->Aloss = df->Aloss;
-        r->Rshift = df->Rshift;
-        r->Gshift = df->Gshift;
-        r->Bshift = df->Bshift;
-        r->Ashift = df->Ashift;
-    }
-    dst = rlebuf + sizeof(RLEDestFormat);
-
-    /* Do the actual encoding */
-    {
-        int x, y;
-        int h = surface->h, w = surface->w;
-        SDL_PixelFormat *sf = surface->format;
-        Uint32 *src = (Uint32 *) surface->pixels;
-        Uint8 *lastline = dst;  /* end of last non-blank line */
-
-        /* opaque counts are 8 or 16 bits, depending on target depth */
-#define ADD_OPAQUE_COUNTS(n, m)         \
-    if(df->BytesPerPixel == 4) {        \
-        ((Uint16 *)dst)[0] = n;     \
-        ((Uint16 *)dst)[1] = m;     \
-        dst += 4;               \
-    } else {                \
-        dst[0] = n;             \
-        dst[1] = m;             \
-        dst += 2;               \
-    }
-
-        /* translucent counts are always 16 bit */
-#define ADD_TRANSL_COUNTS(n, m)     \
-    (((Uint16 *)dst)[0] = n, ((Uint16 *)dst)[1] = m, dst += 4)
-
-        for (y = 0; y < h; y++) {
-            int runstart, skipstart;
-            int blankline = 0;
-            /* First encode all opaque pixels of a scan line */
-            x = 0;
-            do {
-                int run, skip, len;
-                skipstart = x;
-                while (x < w && !ISOPAQUE(src[x], sf))
-                    x++;
-                runstart = x;
-                while (x < w && ISOPAQUE(src[x], sf))
-                    x++;
-                skip = runstart - skipstart;
-                if (skip == w)
-                    blankline = 1;
-                run = x - runstart;
-                while (skip > max_opaque_run) {
-                    ADD_OPAQUE_COUNTS(max_opaque_run, 0);
-                    skip -= max_opaque_run;
-                }
-                len = MIN(run, max_opaque_run);
-                ADD_OPAQUE_COUNTS(skip, len);
-                dst += copy_opaque(dst, src + runstart, len, sf, df);
-                runstart += len;
-                run -= len;
-                while (run) {
-                    len = MIN(run, max_opaque_run);
-                    ADD_OPAQUE_COUNTS(0, len);
-                    dst += copy_opaque(dst, src + runstart, len, sf, df);
-                    runstart += len;
-                    run -= len;
-                }
-            } while (x < w);
-
-            /* Make sure the next output address is 32-bit aligned */
-            dst += (uintptr_t) dst & 2;
-
-            /* Next, encode all translucent pixels of the same scan line */
-            x = 0;
-            do {
-                int run, skip, len;
-                skipstart = x;
-                while (x < w && !ISTRANSL(src[x], sf))
-                    x++;
-                runstart = x;
-                while (x < w && ISTRANSL(src[x], sf))
-                    x++;
-                skip = runstart - skipstart;
-                blankline &= (skip == w);
-                run = x - runstart;
-                while (skip > max_transl_run) {
-                    ADD_TRANSL_COUNTS(max_transl_run, 0);
-                    skip -= max_transl_run;
-                }
-                len = MIN(run, max_transl_run);
-                ADD_TRANSL_COUNTS(skip, len);
-                dst += copy_transl(dst, src + runstart, len, sf, df);
-                runstart += len;
-                run -= len;
-                while (run) {
-                    len = MIN(run, max_transl_run);
-                    ADD_TRANSL_COUNTS(0, len);
-                    dst += copy_transl(dst, src + runstart, len, sf, df);
-                    runstart += len;
-                    run -= len;
-                }
-                if (!blankline)
-                    lastline = dst;
-            } while (x < w);
-
-            src += surface->pitch >> 2;
-        }
-        dst = lastline;         /* back up past trailing blank lines */
-        ADD_OPAQUE_COUNTS(0, 0);
-    }
-
-#undef ADD_OPAQUE_COUNTS
-#undef ADD_TRANSL_COUNTS
-
-    /* Now that we have it encoded, release the original pixels */
-    if (!(surface->flags & SDL_PREALLOC)) {
-        SDL_free(surface->pixels);
-        surface->pixels = NULL;
-    }
-
-    /* realloc the buffer to release unused memory */
-    {
-        Uint8 *p = SDL_realloc(rlebuf, dst - rlebuf);
-        if (!p)
-            p = rlebuf;
-        surface->map->data = p;
+    /* save the destination format, it goes in front of the encoding */
+    rle->df.BytesPerPixel = df->BytesPerPixel;
+    rle->df.Rmask = df->Rmask;
+    rle->df.Gmask = df->Gmask;
+    rle->df.Bmask = df->Bmask;
+    rle->df.Amask = df->Amask;
+    rle->df.Rloss = df->Rloss;
+    rle->df.Gloss = df->Gloss;
+    rle->df.Bloss = df->Bloss;
+    rle->df.Aloss = df->Aloss;
+    rle->df.Rshift = df->Rshift;
+    rle->df.Gshift = df->Gshift;
+    rle->df.Bshift = df->Bshift;
+    rle->df.Ashift = df->Ashift;
+    if (df->BytesPerPixel == 4) {
+        /* the 32-bit blitters take alpha from the unused high byte */
+        rle->df.Amask = 0xff000000;
+        rle->df.Aloss = 0;
+        rle->df.Ashift = 24;
     }
+    rle->header = sizeof(RLEDestFormat);
+    rle->encode_row = RLEAlphaRow;
 
     return 0;
 }
 
 static Uint32
-getpix_8(Uint8 * srcbuf)
+getpix_8(const Uint8 * srcbuf)
 {
     return *srcbuf;
 }
 
 static Uint32
-getpix_16(Uint8 * srcbuf)
+getpix_16(const Uint8 * srcbuf)
 {
-    return *(Uint16 *) srcbuf;
+    return *(const Uint16 *) srcbuf;
 }
 
 static Uint32
-getpix_24(Uint8 * srcbuf)
+getpix_24(const Uint8 * srcbuf)
 {
 #if SDL_BYTEORDER == SDL_LIL_ENDIAN
     return srcbuf[0] + (srcbuf[1] << 8) + (srcbuf[2] << 16);
@@ -1249,68 +1351,66 @@ getpix_24(Uint8 * srcbuf)
 }
 
 static Uint32
-getpix_32(Uint8 * srcbuf)
+getpix_32(const Uint8 * srcbuf)
 {
-    return *(Uint32 *) srcbuf;
+    return *(const Uint32 *) srcbuf;
 }
 
-typedef Uint32(*getpix_func) (Uint8 *);
-
 static const getpix_func getpixes[4] = {
     getpix_8, getpix_16, getpix_24, getpix_32
 };
 
-static int
-RLEColorkeySurface(SDL_Surface * surface)
+/* copy a run of opaque pixels, translating indexed pixels if needed */
+static Uint8 *
+copy_colorkey_run(SDL_Surface * surface, Uint8 * dst, const Uint8 * src,
+                  int n)
 {
-    Uint8 *rlebuf, *dst;
-    int maxn;
-    int y;
-    Uint8 *srcbuf, *lastline;
-    int maxsize = 0;
-    int bpp = surface->format->BytesPerPixel;
-    getpix_func getpix;
-    Uint32 ckey, rgbmask;
-    int w, h;
+    SDL_RLEData *rle = (SDL_RLEData *) surface->map->data;
+    const Uint8 *table = surface->map->info.table;
+    int i;
 
-    /* calculate the worst case size for the compressed surface */
-    switch (bpp) {
+    if (surface->map->identity) {
+        SDL_memcpy(dst, src, n * rle->bpp);
+        return dst + n * rle->bpp;
+    }
+
+    /* 8-bit source, the palette map holds target pixels in memory order */
+    switch (rle->dst_bpp) {
     case 1:
-        /* worst case is alternating opaque and transparent pixels,
-           starting with an opaque pixel */
-        maxsize = surface->h * 3 * (surface->w / 2 + 1) + 2;
+        for (i = 0; i < n; i++)
+            dst[i] = table[src[i]];
         break;
     case 2:
+        for (i = 0; i < n; i++)
+            ((Uint16 *) dst)[i] = ((const Uint16 *) table)[src[i]];
+        break;
     case 3:
-        /* worst case is solid runs, at most 255 pixels wide */
-        maxsize = surface->h * (2 * (surface->w / 255 + 1)
-                                + surface->w * bpp) + 2;
+        for (i = 0; i < n; i++)
+            SDL_memcpy(dst + i * 3, table + src[i] * 4, 3);
         break;
     case 4:
-        /* worst case is solid runs, at most 65535 pixels wide */
-        maxsize = surface->h * (4 * (surface->w / 65535 + 1)
-                                + surface->w * 4) + 4;
+        for (i = 0; i < n; i++)
+            ((Uint32 *) dst)[i] = ((const Uint32 *) table)[src[i]];
         break;
     }
+    return dst + n * rle->dst_bpp;
+}
 
-    rlebuf = (Uint8 *) SDL_malloc(maxsize);
-    if (rlebuf == NULL) {
-        return SDL_OutOfMemory();
-    }
-
-    /* Set up the conversion */
-    srcbuf = (Uint8 *) surface->pixels;
-    maxn = bpp == 4 ? 65535 : 255;
-    dst = rlebuf;
-    rgbmask = ~surface->format->Amask;
-    ckey = surface->map->info.colorkey & rgbmask;
-    lastline = dst;
-    getpix = getpixes[bpp - 1];
-    w = surface->w;
-    h = surface->h;
+/* encode one scan line of a colorkeyed surface */
+static Uint8 *
+RLEColorkeyRow(SDL_Surface * surface, const Uint8 * srcbuf, Uint8 * dst)
+{
+    SDL_RLEData *rle = (SDL_RLEData *) surface->map->data;
+    const int bpp = rle->bpp;
+    const int maxn = rle->dst_bpp == 4 ? 65535 : 255;
+    const Uint32 ckey = rle->ckey;
+    const Uint32 rgbmask = rle->rgbmask;
+    getpix_func getpix = rle->getpix;
+    int w = surface->w;
+    int x = 0;
 
 #define ADD_COUNTS(n, m)            \
-    if(bpp == 4) {              \
+    if(rle->dst_bpp == 4) {         \
         ((Uint16 *)dst)[0] = n;     \
         ((Uint16 *)dst)[1] = m;     \
         dst += 4;               \
@@ -1320,81 +1420,257 @@ RLEColorkeySurface(SDL_Surface * surface)
         dst += 2;               \
     }
 
-    for (y = 0; y < h; y++) {
-        int x = 0;
-        int blankline = 0;
-        do {
-            int run, skip, len;
-            int runstart;
-            int skipstart = x;
-
-            /* find run of transparent, then opaque pixels */
-            while (x < w && (getpix(srcbuf + x * bpp) & rgbmask) == ckey)
-                x++;
-            runstart = x;
-            while (x < w && (getpix(srcbuf + x * bpp) & rgbmask) != ckey)
-                x++;
-            skip = runstart - skipstart;
-            if (skip == w)
-                blankline = 1;
-            run = x - runstart;
-
-            /* encode segment */
-            while (skip > maxn) {
-                ADD_COUNTS(maxn, 0);
-                skip -= maxn;
-            }
+    do {
+        int run, skip, len;
+        int runstart;
+        int skipstart = x;
+
+        /* find run of transparent, then opaque pixels */
+        while (x < w && (getpix(srcbuf + x * bpp) & rgbmask) == ckey)
+            x++;
+        runstart = x;
+        while (x < w && (getpix(srcbuf + x * bpp) & rgbmask) != ckey)
+            x++;
+        skip = runstart - skipstart;
+        run = x - runstart;
+
+        /* encode segment */
+        while (skip > maxn) {
+            ADD_COUNTS(maxn, 0);
+            skip -= maxn;
+        }
+        len = MIN(run, maxn);
+        ADD_COUNTS(skip, len);
+        dst = copy_colorkey_run(surface, dst, srcbuf + runstart * bpp, len);
+        run -= len;
+        runstart += len;
+        while (run) {
             len = MIN(run, maxn);
-            ADD_COUNTS(skip, len);
-            SDL_memcpy(dst, srcbuf + runstart * bpp, len * bpp);
-            dst += len * bpp;
-            run -= len;
+            ADD_COUNTS(0, len);
+            dst = copy_colorkey_run(surface, dst, srcbuf + runstart * bpp, len);
             runstart += len;
-            while (run) {
-                len = MIN(run, maxn);
-                ADD_COUNTS(0, len);
-                SDL_memcpy(dst, srcbuf + runstart * bpp, len * bpp);
-                dst += len * bpp;
-                runstart += len;
-                run -= len;
-            }
-            if (!blankline)
-                lastline = dst;
-        } while (x < w);
+            run -= len;
+        }
+    } while (x < w);
 
-        srcbuf += surface->pitch;
+#undef ADD_COUNTS
+
+    return dst;
+}
+
+/* set up surface to be quickly colorkey-blittable onto dest, if possible */
+static int
+RLEColorkeySurface(SDL_Surface * surface, SDL_RLEData * rle)
+{
+    SDL_BlitMap *map = surface->map;
+    int bpp = surface->format->BytesPerPixel;
+    int dst_bpp = bpp;
+    int w = surface->w;
+
+    if (!map->identity) {
+        /* 8-bit sources are translated through the palette map, but
+           there is no 8bpp alpha blitting */
+        if (bpp != 1 || !map->dst || !map->info.table) {
+            return -1;
+        }
+        dst_bpp = map->dst->format->BytesPerPixel;
+        if (dst_bpp == 1 && map->info.a != 255) {
+            return -1;
+        }
     }
-    dst = lastline;             /* back up bast trailing blank lines */
-    ADD_COUNTS(0, 0);
 
-#undef ADD_COUNTS
+    /* calculate the worst case size for a compressed line */
+    switch (dst_bpp) {
+    case 1:
+        /* worst case is alternating opaque and transparent pixels,
+           starting with an opaque pixel */
+        rle->row_max = 3 * (w / 2 + 1);
+        break;
+    case 2:
+    case 3:
+        /* worst case is solid runs, at most 255 pixels wide */
+        rle->row_max = 2 * (w / 255 + 1) + w * dst_bpp;
+        break;
+    case 4:
+        /* worst case is solid runs, at most 65535 pixels wide */
+        rle->row_max = 4 * (w / 65535 + 1) + w * 4;
+        break;
+    default:
+        return -1;
+    }
+    rle->end_size = (dst_bpp == 4) ? 4 : 2;
+
+    rle->bpp = bpp;
+    rle->dst_bpp = dst_bpp;
+    rle->rgbmask = ~surface->format->Amask;
+    rle->ckey = map->info.colorkey & rle->rgbmask;
+    rle->getpix = getpixes[bpp - 1];
+    rle->header = 0;
+    rle->encode_row = RLEColorkeyRow;
+
+    return 0;
+}
+
+/* write the end marker, a zero <skip>,<run> pair at the start of a line */
+static void
+RLEAddEnd(SDL_RLEData * rle, Uint8 * dst)
+{
+    SDL_memset(dst, 0, rle->end_size);
+}
 
-    /* Now that we have it encoded, release the original pixels */
-    if (!(surface->flags & SDL_PREALLOC)) {
-        SDL_free(surface->pixels);
-        surface->pixels = NULL;
+/* encode the whole surface into a new sequence */
+static int
+RLEEncodeSurface(SDL_Surface * surface)
+{
+    SDL_RLEData *rle = (SDL_RLEData *) surface->map->data;
+    const Uint8 *srcbuf = (const Uint8 *) surface->pixels;
+    size_t maxsize;
+    Uint8 *rlebuf, *dst;
+    int y;
+
+    /* Let the allocator reuse the old sequence for the new one */
+    SDL_free(rle->stream);
+    rle->stream = NULL;
+    rle->size = rle->capacity = 0;
+
+    maxsize = rle->header + (size_t) surface->h * rle->row_max + rle->end_size;
+    rlebuf = (Uint8 *) SDL_malloc(maxsize);
+    if (!rlebuf) {
+        return SDL_OutOfMemory();
+    }
+    if (rle->header) {
+        SDL_memcpy(rlebuf, &rle->df, sizeof(rle->df));
     }
 
+    dst = rlebuf + rle->header;
+    for (y = 0; y < surface->h; y++) {
+        rle->rows[y] = (Uint32) (dst - rlebuf);
+        dst = rle->encode_row(surface, srcbuf, dst);
+        srcbuf += surface->pitch;
+    }
+    rle->rows[y] = (Uint32) (dst - rlebuf);
+    RLEAddEnd(rle, dst);
+    dst += rle->end_size;
+
     /* realloc the buffer to release unused memory */
     {
         /* If realloc returns NULL, the original block is left intact */
         Uint8 *p = SDL_realloc(rlebuf, dst - rlebuf);
-        if (!p)
+        if (!p) {
+            rle->capacity = maxsize;
             p = rlebuf;
-        surface->map->data = p;
+        } else {
+            rle->capacity = dst - rlebuf;
+        }
+        rle->stream = p;
+        rle->size = dst - rlebuf;
     }
+    rle->dirty_top = rle->dirty_bottom = 0;
 
-    return (0);
+    return 0;
+}
+
+/*
+ * Encode the rows that changed since the last time, and splice them into
+ * the sequence in place of their old encoding. Every row is encoded to a
+ * multiple of 4 bytes for 16-bit counts or 32-bit pixels, so the rows
+ * after them keep their alignment when they move.
+ */
+static int
+RLEEncodeDirtyRows(SDL_Surface * surface)
+{
+    SDL_RLEData *rle = (SDL_RLEData *) surface->map->data;
+    const int top = rle->dirty_top;
+    const int bottom = rle->dirty_bottom;
+    const Uint8 *srcbuf;
+    Uint32 start, old_len, new_len;
+    Uint8 *rowbuf, *dst;
+    size_t size;
+    int y;
+
+    if (top == 0 && bottom == surface->h) {
+        return RLEEncodeSurface(surface);
+    }
+
+    rowbuf = (Uint8 *) SDL_malloc((size_t) (bottom - top) * rle->row_max);
+    if (!rowbuf) {
+        return SDL_OutOfMemory();
+    }
+    start = rle->rows[top];
+    old_len = rle->rows[bottom] - start;
+
+    /* rows[top] to rows[bottom - 1] are relative to rowbuf for now */
+    srcbuf = (const Uint8 *) surface->pixels + top * surface->pitch;
+    dst = rowbuf;
+    for (y = top; y < bottom; y++) {
+        rle->rows[y] = (Uint32) (dst - rowbuf);
+        dst = rle->encode_row(surface, srcbuf, dst);
+        srcbuf += surface->pitch;
+    }
+    new_len = (Uint32) (dst - rowbuf);
+
+    size = rle->size - old_len + new_len;
+    if (size > rle->capacity) {
+        Uint8 *p = (Uint8 *) SDL_realloc(rle->stream, size);
+        if (!p) {
+            SDL_free(rowbuf);
+            return SDL_OutOfMemory();
+        }
+        rle->stream = p;
+        rle->capacity = size;
+    }
+    SDL_memmove(rle->stream + start + new_len, rle->stream + start + old_len,
+                rle->size - start - old_len);
+    SDL_memcpy(rle->stream + start, rowbuf, new_len);
+    SDL_free(rowbuf);
+
+    for (y = top; y < bottom; y++) {
+        rle->rows[y] += start;
+    }
+    for (y = bottom; y <= surface->h; y++) {
+        rle->rows[y] = rle->rows[y] - old_len + new_len;
+    }
+    rle->size = size;
+    rle->dirty_top = rle->dirty_bottom = 0;
+
+    return 0;
+}
+
+void
+SDL_RLEInvalidateRows(SDL_Surface * surface, int y, int h)
+{
+    SDL_RLEData *rle;
+    int bottom;
+
+    if (!(surface->flags & SDL_RLEACCEL) ||
+        !(surface->map->info.flags & (SDL_COPY_RLE_COLORKEY | SDL_COPY_RLE_ALPHAKEY))) {
+        return;
+    }
+    rle = (SDL_RLEData *) surface->map->data;
+
+    bottom = MIN(y + h, surface->h);
+    y = MAX(y, 0);
+    if (y >= bottom) {
+        return;
+    }
+    if (rle->dirty_top < rle->dirty_bottom) {
+        y = MIN(y, rle->dirty_top);
+        bottom = MAX(bottom, rle->dirty_bottom);
+    }
+    rle->dirty_top = y;
+    rle->dirty_bottom = bottom;
 }
 
 int
 SDL_RLESurface(SDL_Surface * surface)
 {
     int flags;
+    SDL_RLEData *rle;
+    int alphakey;
 
     /* Clear any previous RLE conversion */
     if ((surface->flags & SDL_RLEACCEL) == SDL_RLEACCEL) {
-        SDL_UnRLESurface(surface, 1);
+        SDL_UnRLESurface(surface);
     }
 
     /* We don't support RLE encoding of bitmaps */
@@ -1421,22 +1697,31 @@ SDL_RLESurface(SDL_Surface * surface)
         return -1;
     }
 
+    rle = (SDL_RLEData *) SDL_calloc(1, sizeof(*rle) +
+                                     surface->h * sizeof(rle->rows[0]));
+    if (!rle) {
+        return SDL_OutOfMemory();
+    }
+
     /* Encode and set up the blit */
-    if (!surface->format->Amask || !(flags & SDL_COPY_BLEND)) {
-        if (!surface->map->identity) {
-            return -1;
-        }
-        if (RLEColorkeySurface(surface) < 0) {
-            return -1;
-        }
-        surface->map->blit = SDL_RLEBlit;
-        surface->map->info.flags |= SDL_COPY_RLE_COLORKEY;
-    } else {
-        if (RLEAlphaSurface(surface) < 0) {
-            return -1;
-        }
+    alphakey = (surface->format->Amask && (flags & SDL_COPY_BLEND));
+    if ((alphakey ? RLEAlphaSurface(surface, rle) :
+                    RLEColorkeySurface(surface, rle)) < 0) {
+        SDL_free(rle);
+        return -1;
+    }
+    surface->map->data = rle;
+    if (RLEEncodeSurface(surface) < 0) {
+        SDL_free(rle);
+        surface->map->data = NULL;
+        return -1;
+    }
+    if (alphakey) {
         surface->map->blit = SDL_RLEAlphaBlit;
         surface->map->info.flags |= SDL_COPY_RLE_ALPHAKEY;
+    } else {
+        surface->map->blit = SDL_RLEBlit;
+        surface->map->info.flags |= SDL_COPY_RLE_COLORKEY;
     }
 
     /* The surface is now accelerated */
@@ -1445,123 +1730,21 @@ SDL_RLESurface(SDL_Surface * surface)
     return (0);
 }
 
-/*
- * Un-RLE a surface with pixel alpha
- * This may not give back exactly the image before RLE-encoding; all
- * completely transparent pixels will be lost, and color and alpha depth
- * may have been reduced (when encoding for 16bpp targets).
- */
-static SDL_bool
-UnRLEAlpha(SDL_Surface * surface)
-{
-    Uint8 *srcbuf;
-    Uint32 *dst;
-    SDL_PixelFormat *sf = surface->format;
-    RLEDestFormat *df = surface->map->data;
-    int (*uncopy_opaque) (Uint32 *, void *, int,
-                          RLEDestFormat *, SDL_PixelFormat *);
-    int (*uncopy_transl) (Uint32 *, void *, int,
-                          RLEDestFormat *, SDL_PixelFormat *);
-    int w = surface->w;
-    int bpp = df->BytesPerPixel;
-
-    if (bpp == 2) {
-        uncopy_opaque = uncopy_opaque_16;
-        uncopy_transl = uncopy_transl_16;
-    } else {
-        uncopy_opaque = uncopy_transl = uncopy_32;
-    }
-
-    surface->pixels = SDL_malloc(surface->h * surface->pitch);
-    if (!surface->pixels) {
-        return (SDL_FALSE);
-    }
-    /* fill background with transparent pixels */
-    SDL_memset(surface->pixels, 0, surface->h * surface->pitch);
-
-    dst = surface->pixels;
-    srcbuf = (Uint8 *) (df + 1);
-    for (;;) {
-        /* copy opaque pixels */
-        int ofs = 0;
-        do {
-            unsigned run;
-            if (bpp == 2) {
-                ofs += srcbuf[0];
-                run = srcbuf[1];
-                srcbuf += 2;
-            } else {
-                ofs += ((Uint16 *) srcbuf)[0];
-                run = ((Uint16 *) srcbuf)[1];
-                srcbuf += 4;
-            }
-            if (run) {
-                srcbuf += uncopy_opaque(dst + ofs, srcbuf, run, df, sf);
-                ofs += run;
-            } else if (!ofs)
-                return (SDL_TRUE);
-        } while (ofs < w);
-
-        /* skip padding if needed */
-        if (bpp == 2)
-            srcbuf += (uintptr_t) srcbuf & 2;
-
-        /* copy translucent pixels */
-        ofs = 0;
-        do {
-            unsigned run;
-            ofs += ((Uint16 *) srcbuf)[0];
-            run = ((Uint16 *) srcbuf)[1];
-            srcbuf += 4;
-            if (run) {
-                srcbuf += uncopy_transl(dst + ofs, srcbuf, run, df, sf);
-                ofs += run;
-            }
-        } while (ofs < w);
-        dst += surface->pitch >> 2;
-    }
-    /* Make the compiler happy */
-    return (SDL_TRUE);
-}
-
 void
-SDL_UnRLESurface(SDL_Surface * surface, int recode)
+SDL_UnRLESurface(SDL_Surface * surface)
 {
     if (surface->flags & SDL_RLEACCEL) {
-        surface->flags &= ~SDL_RLEACCEL;
+        SDL_RLEData *rle = (SDL_RLEData *) surface->map->data;
 
-        if (recode && !(surface->flags & SDL_PREALLOC)) {
-            if (surface->map->info.flags & SDL_COPY_RLE_COLORKEY) {
-                SDL_Rect full;
-
-                /* re-create the original surface */
-                surface->pixels = SDL_malloc(surface->h * surface->pitch);
-                if (!surface->pixels) {
-                    /* Oh crap... */
-                    surface->flags |= SDL_RLEACCEL;
-                    return;
-                }
-
-                /* fill it with the background color */
-                SDL_FillRect(surface, NULL, surface->map->info.colorkey);
-
-                /* now render the encoded surface */
-                full.x = full.y = 0;
-                full.w = surface->w;
-                full.h = surface->h;
-                SDL_RLEBlit(surface, &full, surface, &full);
-            } else {
-                if (!UnRLEAlpha(surface)) {
-                    /* Oh crap... */
-                    surface->flags |= SDL_RLEACCEL;
-                    return;
-                }
-            }
-        }
+        surface->flags &= ~SDL_RLEACCEL;
         surface->map->info.flags &=
             ~(SDL_COPY_RLE_COLORKEY | SDL_COPY_RLE_ALPHAKEY);
 
-        SDL_free(surface->map->data);
+        /* The pixels are still there, only the encoding goes */
+        if (rle) {
+            SDL_free(rle->stream);
+            SDL_free(rle);
+        }
         surface->map->data = NULL;
     }
 }
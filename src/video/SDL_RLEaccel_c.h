@@ -27,5 +27,6 @@ extern int SDL_RLEBlit(SDL_Surface * src, SDL_Rect * srcrect,
                        SDL_Surface * dst, SDL_Rect * dstrect);
 extern int SDL_RLEAlphaBlit(SDL_Surface * src, SDL_Rect * srcrect,
                             SDL_Surface * dst, SDL_Rect * dstrect);
-extern void SDL_UnRLESurface(SDL_Surface * surface, int recode);
+extern void SDL_UnRLESurface(SDL_Surface * surface);
+extern void SDL_RLEInvalidateRows(SDL_Surface * surface, int y, int h);
 /* vi: set ts=4 sw=4 expandtab: */
@@ -26,8 +26,66 @@
 #include "SDL_blit_auto.h"
 #include "SDL_blit_copy.h"
 #include "SDL_blit_slow.h"
+#include "SDL_blit_simd.h"
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
+#include "SDL_hints.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_atomic.h"
+#include "../thread/SDL_thread_c.h"
+
+/* Blits are split into bands of at least this many pixels, one per thread */
+#define SDL_BLIT_BAND_PIXELS    (64 * 1024)
+
+typedef struct
+{
+    SDL_BlitFunc blit;
+    const SDL_BlitInfo *info;
+    int bands;
+} SDL_BlitBands;
+
+static void
+SDL_BlitBand(void *data, int index)
+{
+    const SDL_BlitBands *job = (const SDL_BlitBands *) data;
+    SDL_BlitInfo info = *job->info;
+    const int first = (info.dst_h * index) / job->bands;
+    const int last = (info.dst_h * (index + 1)) / job->bands;
+
+    info.src += first * info.src_pitch;
+    info.dst += first * info.dst_pitch;
+    info.src_h = info.dst_h = last - first;
+    job->blit(&info);
+}
+
+static void
+SDL_RunBlit(SDL_BlitFunc blit, SDL_BlitInfo * info)
+{
+    const int pixels = info->dst_w * info->dst_h;
+
+    /* Scaled blits step through the source from the top, so aren't split */
+    if (pixels >= 2 * SDL_BLIT_BAND_PIXELS &&
+        info->src_w == info->dst_w && info->src_h == info->dst_h) {
+        const char *hint = SDL_GetHint(SDL_HINT_BLIT_THREADS);
+        int threads = hint ? SDL_atoi(hint) : 1;
+        int bands;
+
+        if (threads <= 0) {
+            threads = SDL_GetCPUCount();
+        }
+        bands = SDL_min(threads, pixels / SDL_BLIT_BAND_PIXELS);
+        if (bands > 1) {
+            SDL_BlitBands job;
+
+            job.blit = blit;
+            job.info = info;
+            job.bands = bands;
+            SDL_RunParallel(SDL_BlitBand, &job, bands, threads);
+            return;
+        }
+    }
+    blit(info);
+}
 
 /* The general purpose software blit routine */
 static int
@@ -36,20 +94,14 @@ SDL_SoftBlit(SDL_Surface * src, SDL_Rect * srcrect,
 {
     int okay;
     int src_locked;
-    int dst_locked;
 
     /* Everything is okay at the beginning...  */
     okay = 1;
 
-    /* Lock the destination if it's in hardware */
-    dst_locked = 0;
-    if (SDL_MUSTLOCK(dst)) {
-        if (SDL_LockSurface(dst) < 0) {
-            okay = 0;
-        } else {
-            dst_locked = 1;
-        }
-    }
+    /* An RLE encoded destination keeps its pixels, only the rows written
+       have to be encoded again */
+    SDL_RLEInvalidateRows(dst, dstrect->y, dstrect->h);
+
     /* Lock the source if it's in hardware */
     src_locked = 0;
     if (SDL_MUSTLOCK(src)) {
@@ -85,13 +137,10 @@ SDL_SoftBlit(SDL_Surface * src, SDL_Rect * srcrect,
         RunBlit = (SDL_BlitFunc) src->map->data;
 
         /* Run the actual software blit */
-        RunBlit(info);
+        SDL_RunBlit(RunBlit, info);
     }
 
     /* We need to unlock the surfaces if they're locked */
-    if (dst_locked) {
-        SDL_UnlockSurface(dst);
-    }
     if (src_locked) {
         SDL_UnlockSurface(src);
     }
@@ -124,44 +173,88 @@ SDL_UseAltivecPrefetch()
 }
 #endif /* __MACOSX__ */
 
-static SDL_BlitFunc
-SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
-                   SDL_BlitFuncEntry * entries)
+/* The CPU features the blitters may use, worked out on first use.  Setting
+   SDL_HINT_BLIT_CPU_FEATURES makes the next call work them out again, which
+   is how the tests switch between the scalar and the vector code. */
+static Uint32 SDL_blit_features = 0xffffffff;
+static SDL_bool SDL_blit_features_watched = SDL_FALSE;
+static SDL_SpinLock SDL_blit_features_lock = 0;
+
+static void SDLCALL
+SDL_BlitCPUFeaturesChanged(void *userdata, const char *name,
+                           const char *oldValue, const char *hint)
 {
-    int i, flagcheck;
-    static Uint32 features = 0xffffffff;
+    SDL_blit_features = 0xffffffff;
+}
 
-    /* Get the available CPU features */
-    if (features == 0xffffffff) {
-        const char *override = SDL_getenv("SDL_BLIT_CPU_FEATURES");
+Uint32
+SDL_GetBlitCPUFeatures(void)
+{
+    Uint32 features = SDL_blit_features;
+    const char *override;
 
-        features = SDL_CPU_ANY;
+    if (features != 0xffffffff) {
+        return features;
+    }
 
-        /* Allow an override for testing .. */
-        if (override) {
-            SDL_sscanf(override, "%u", &features);
-        } else {
-            if (SDL_HasMMX()) {
-                features |= SDL_CPU_MMX;
-            }
-            if (SDL_Has3DNow()) {
-                features |= SDL_CPU_3DNOW;
-            }
-            if (SDL_HasSSE()) {
-                features |= SDL_CPU_SSE;
-            }
-            if (SDL_HasSSE2()) {
-                features |= SDL_CPU_SSE2;
-            }
-            if (SDL_HasAltiVec()) {
-                if (SDL_UseAltivecPrefetch()) {
-                    features |= SDL_CPU_ALTIVEC_PREFETCH;
-                } else {
-                    features |= SDL_CPU_ALTIVEC_NOPREFETCH;
-                }
+    SDL_AtomicLock(&SDL_blit_features_lock);
+    if (!SDL_blit_features_watched) {
+        SDL_AddHintCallback(SDL_HINT_BLIT_CPU_FEATURES, SDL_BlitCPUFeaturesChanged, NULL);
+        SDL_blit_features_watched = SDL_TRUE;
+    }
+
+    features = SDL_CPU_ANY;
+
+    /* Allow an override for testing .. */
+    override = SDL_GetHint(SDL_HINT_BLIT_CPU_FEATURES);
+    if (override && *override) {
+        SDL_sscanf(override, "%u", &features);
+    } else {
+        if (SDL_HasMMX()) {
+            features |= SDL_CPU_MMX;
+        }
+        if (SDL_Has3DNow()) {
+            features |= SDL_CPU_3DNOW;
+        }
+        if (SDL_HasSSE()) {
+            features |= SDL_CPU_SSE;
+        }
+        if (SDL_HasSSE2()) {
+            features |= SDL_CPU_SSE2;
+        }
+        if (SDL_HasAVX2()) {
+            features |= SDL_CPU_AVX2;
+        }
+        if (SDL_HasAltiVec()) {
+            if (SDL_UseAltivecPrefetch()) {
+                features |= SDL_CPU_ALTIVEC_PREFETCH;
+            } else {
+                features |= SDL_CPU_ALTIVEC_NOPREFETCH;
             }
         }
     }
+    SDL_blit_features = features;
+    SDL_AtomicUnlock(&SDL_blit_features_lock);
+
+    return features;
+}
+
+/* SDL_ClearHints() dropped the hint callback */
+void
+SDL_QuitBlitCPUFeatures(void)
+{
+    SDL_AtomicLock(&SDL_blit_features_lock);
+    SDL_blit_features_watched = SDL_FALSE;
+    SDL_blit_features = 0xffffffff;
+    SDL_AtomicUnlock(&SDL_blit_features_lock);
+}
+
+static SDL_BlitFunc
+SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
+                   SDL_BlitFuncEntry * entries)
+{
+    int i, flagcheck;
+    const Uint32 features = SDL_GetBlitCPUFeatures();
 
     for (i = 0; entries[i].func; ++i) {
         /* Check for matching pixel formats */
@@ -221,7 +314,7 @@ SDL_CalculateBlit(SDL_Surface * surface)
 
     /* Clean everything out to start */
     if ((surface->flags & SDL_RLEACCEL) == SDL_RLEACCEL) {
-        SDL_UnRLESurface(surface, 1);
+        SDL_UnRLESurface(surface);
     }
     map->blit = SDL_SoftBlit;
     map->info.src_fmt = surface->format;
@@ -237,8 +330,26 @@ SDL_CalculateBlit(SDL_Surface * surface)
     }
 
     /* Choose a standard blit function */
-    if (map->identity && !(map->info.flags & ~SDL_COPY_RLE_DESIRED)) {
+    if (map->identity &&
+        !(map->info.flags & ~(SDL_COPY_RLE_DESIRED | SDL_COPY_LINEAR))) {
         blit = SDL_BlitCopy;
+    } else if (!(map->info.flags & ~(SDL_COPY_RLE_MASK | SDL_COPY_LINEAR)) &&
+               (blit = SDL_ChooseBlitFunc(surface->format->format,
+                                          dst->format->format,
+                                          map->info.flags,
+                                          SDL_SIMDConvertFuncTable)) != NULL) {
+        /* Vectorized format conversion, see SDL_blit_simd.c */
+    } else if (surface->format->BytesPerPixel == 4 &&
+               dst->format->BytesPerPixel == 4 &&
+               (map->info.flags & (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA |
+                                   SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD |
+                                   SDL_COPY_COLORKEY)) &&
+               !(map->info.flags & SDL_COPY_NEAREST) &&
+               (blit = SDL_ChooseBlitFunc(surface->format->format,
+                                          dst->format->format,
+                                          map->info.flags,
+                                          SDL_SIMDBlitFuncTable)) != NULL) {
+        /* Vectorized per-channel arithmetic, see SDL_blit_simd.c */
     } else if (surface->format->BitsPerPixel < 8 &&
                SDL_ISPIXELFORMAT_INDEXED(surface->format->format)) {
         blit = SDL_CalculateBlit0(surface);
@@ -255,8 +366,7 @@ SDL_CalculateBlit(SDL_Surface * surface)
         Uint32 dst_format = dst->format->format;
 
         blit =
-            SDL_ChooseBlitFunc(src_format, dst_format, map->info.flags,
-                               SDL_GeneratedBlitFuncTable);
+            SDL_GetGeneratedBlitFunc(src_format, dst_format, map->info.flags);
     }
 #ifndef TEST_SLOW_BLIT
     if (blit == NULL)
@@ -38,6 +38,7 @@ extern Uint8* SDL_expand_byte[9];
 #define SDL_COPY_MOD                0x00000040
 #define SDL_COPY_COLORKEY           0x00000100
 #define SDL_COPY_NEAREST            0x00000200
+#define SDL_COPY_LINEAR             0x00000400
 #define SDL_COPY_RLE_DESIRED        0x00001000
 #define SDL_COPY_RLE_COLORKEY       0x00002000
 #define SDL_COPY_RLE_ALPHAKEY       0x00004000
@@ -51,6 +52,7 @@ extern Uint8* SDL_expand_byte[9];
 #define SDL_CPU_SSE2                0x00000008
 #define SDL_CPU_ALTIVEC_PREFETCH    0x00000010
 #define SDL_CPU_ALTIVEC_NOPREFETCH  0x00000020
+#define SDL_CPU_AVX2                0x00000040
 
 typedef struct
 {
@@ -81,6 +83,24 @@ typedef struct
     SDL_BlitFunc func;
 } SDL_BlitFuncEntry;
 
+/* A mapping to a destination that isn't the current one, kept so that
+   switching back to it doesn't need the blit to be recalculated. */
+typedef struct
+{
+    SDL_PixelFormat *dst_fmt;   /* we hold a reference on this */
+    SDL_Palette *dst_palette;   /* and on this, if it's not NULL */
+    Uint32 dst_palette_version;
+    Uint32 src_palette_version;
+    int flags;
+    Uint8 r, g, b, a;
+    int identity;
+    SDL_blit blit;
+    SDL_BlitFunc func;
+    Uint8 *table;
+} SDL_BlitMapCache;
+
+#define SDL_BLITMAP_CACHE_SIZE  4
+
 /* Blit mapping definition */
 typedef struct SDL_BlitMap
 {
@@ -94,10 +114,18 @@ typedef struct SDL_BlitMap
        an invalid mapping */
     Uint32 dst_palette_version;
     Uint32 src_palette_version;
+
+    /* Previously used mappings, most recently used first */
+    SDL_BlitMapCache cache[SDL_BLITMAP_CACHE_SIZE];
+    int num_cached;
+
+    /* Filtered pixels for SDL_LowerBlitScaled() to blit from */
+    SDL_Surface *scratch;
 } SDL_BlitMap;
 
 /* Functions found in SDL_blit.c */
 extern int SDL_CalculateBlit(SDL_Surface * surface);
+extern Uint32 SDL_GetBlitCPUFeatures(void);
 
 /* Functions found in SDL_blit_*.c */
 extern SDL_BlitFunc SDL_CalculateBlit0(SDL_Surface * surface);
@@ -528,7 +528,7 @@ SDL_CalculateBlit1(SDL_Surface * surface)
     } else {
         which = dstfmt->BytesPerPixel;
     }
-    switch (surface->map->info.flags & ~SDL_COPY_RLE_MASK) {
+    switch (surface->map->info.flags & ~(SDL_COPY_RLE_MASK | SDL_COPY_LINEAR)) {
     case 0:
         return one_blit[which];
 
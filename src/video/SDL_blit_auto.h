@@ -23,7 +23,8 @@
 
 /* *INDENT-OFF* */
 
-extern SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[];
+/* Returns the generated blitter for exactly these copy flags, or NULL */
+extern SDL_BlitFunc SDL_GetGeneratedBlitFunc(Uint32 src_format, Uint32 dst_format, int flags);
 
 /* *INDENT-ON* */
 
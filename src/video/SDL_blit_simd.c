@@ -0,0 +1,1010 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2014 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#include "SDL_video.h"
+#include "SDL_blit.h"
+#include "SDL_blit_simd.h"
+
+/* Vectorized versions of the generated 8888 blitters, for modulation,
+   blending and colorkeying.  The arithmetic matches SDL_blit_auto.c
+   exactly, (x * y) / 255 included, and colorkeys are matched the way
+   BlitNtoNKey() does.
+
+   All pixels are converted to ARGB8888 channel order first.  Every 8888
+   layout is a rotation of ARGB8888 by 0 or 8 bits, optionally with the
+   red and blue channels swapped, so the conversion is branch free.
+ */
+
+typedef struct
+{
+    int src_rot, src_swap;      /* source layout relative to ARGB8888 */
+    int dst_rot, dst_swap;      /* destination layout relative to ARGB8888 */
+    Uint32 src_alpha;           /* set when the source has no alpha channel */
+    Uint32 dst_mask;            /* clears the destination's unused channel */
+    Uint32 ckey_mask, ckey;     /* (pixel & ckey_mask) == ckey isn't drawn */
+    Uint32 modulate;            /* ARGB8888, 0xFF in channels not modulated */
+    int op;                     /* SDL_COPY_BLEND, SDL_COPY_ADD, SDL_COPY_MOD or 0 */
+} Blit8888Params;
+
+static void
+GetLayout8888(Uint32 format, int *rot, int *swap)
+{
+    switch (format) {
+    case SDL_PIXELFORMAT_RGBA8888:
+        *rot = 8;
+        *swap = 0;
+        break;
+    case SDL_PIXELFORMAT_BGRA8888:
+        *rot = 8;
+        *swap = 1;
+        break;
+    case SDL_PIXELFORMAT_ABGR8888:
+    case SDL_PIXELFORMAT_BGR888:
+        *rot = 0;
+        *swap = 1;
+        break;
+    default:
+        *rot = 0;
+        *swap = 0;
+        break;
+    }
+}
+
+static void
+SetupBlit8888(const SDL_BlitInfo *info, Blit8888Params *p)
+{
+    const int flags = info->flags;
+    Uint32 modR = 0xFF, modG = 0xFF, modB = 0xFF, modA = 0xFF;
+
+    GetLayout8888(info->src_fmt->format, &p->src_rot, &p->src_swap);
+    GetLayout8888(info->dst_fmt->format, &p->dst_rot, &p->dst_swap);
+    p->src_alpha = info->src_fmt->Amask ? 0 : 0xFF000000;
+    p->dst_mask = info->dst_fmt->Amask ? 0xFFFFFFFF : 0x00FFFFFF;
+    if (flags & SDL_COPY_COLORKEY) {
+        p->ckey_mask = ~info->src_fmt->Amask;
+        p->ckey = info->colorkey & p->ckey_mask;
+    } else {
+        /* Never matches */
+        p->ckey_mask = 0;
+        p->ckey = 1;
+    }
+    if (flags & SDL_COPY_MODULATE_COLOR) {
+        modR = info->r;
+        modG = info->g;
+        modB = info->b;
+    }
+    if (flags & SDL_COPY_MODULATE_ALPHA) {
+        modA = info->a;
+    }
+    p->modulate = (modA << 24) | (modR << 16) | (modG << 8) | modB;
+    p->op = flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD);
+}
+
+static SDL_INLINE Uint32
+SwapRB(Uint32 pixel)
+{
+    return (pixel & 0xFF00FF00) | ((pixel >> 16) & 0xFF) | ((pixel & 0xFF) << 16);
+}
+
+/* Blit pixels one at a time, for the ends of rows */
+static void
+Blit8888Pixels(const Uint32 *src, Uint32 *dst, int n, const Blit8888Params *p)
+{
+    const Uint32 modulateR = (Uint8)(p->modulate >> 16);
+    const Uint32 modulateG = (Uint8)(p->modulate >> 8);
+    const Uint32 modulateB = (Uint8)p->modulate;
+    const Uint32 modulateA = (Uint8)(p->modulate >> 24);
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+
+    while (n--) {
+        srcpixel = *src++;
+        if ((srcpixel & p->ckey_mask) == p->ckey) {
+            ++dst;
+            continue;
+        }
+        if (p->src_rot) {
+            srcpixel = (srcpixel >> p->src_rot) | (srcpixel << (32 - p->src_rot));
+        }
+        if (p->src_swap) {
+            srcpixel = SwapRB(srcpixel);
+        }
+        srcpixel |= p->src_alpha;
+        dstpixel = *dst;
+        if (p->dst_rot) {
+            dstpixel = (dstpixel >> p->dst_rot) | (dstpixel << (32 - p->dst_rot));
+        }
+        if (p->dst_swap) {
+            dstpixel = SwapRB(dstpixel);
+        }
+        srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = (Uint8)(srcpixel >> 24);
+        dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel; dstA = (Uint8)(dstpixel >> 24);
+
+        srcR = (srcR * modulateR) / 255;
+        srcG = (srcG * modulateG) / 255;
+        srcB = (srcB * modulateB) / 255;
+        srcA = (srcA * modulateA) / 255;
+        if (p->op & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+            srcR = (srcR * srcA) / 255;
+            srcG = (srcG * srcA) / 255;
+            srcB = (srcB * srcA) / 255;
+        }
+        switch (p->op) {
+        case 0:
+            dstR = srcR;
+            dstG = srcG;
+            dstB = srcB;
+            dstA = srcA;
+            break;
+        case SDL_COPY_BLEND:
+            dstR = srcR + ((255 - srcA) * dstR) / 255;
+            dstG = srcG + ((255 - srcA) * dstG) / 255;
+            dstB = srcB + ((255 - srcA) * dstB) / 255;
+            dstA = srcA + ((255 - srcA) * dstA) / 255;
+            break;
+        case SDL_COPY_ADD:
+            dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+            dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+            dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+            break;
+        case SDL_COPY_MOD:
+            dstR = (srcR * dstR) / 255;
+            dstG = (srcG * dstG) / 255;
+            dstB = (srcB * dstB) / 255;
+            break;
+        }
+        dstpixel = ((dstA << 24) | (dstR << 16) | (dstG << 8) | dstB) & p->dst_mask;
+        if (p->dst_swap) {
+            dstpixel = SwapRB(dstpixel);
+        }
+        if (p->dst_rot) {
+            dstpixel = (dstpixel << p->dst_rot) | (dstpixel >> (32 - p->dst_rot));
+        }
+        *dst++ = dstpixel;
+    }
+}
+
+#if HAVE_SSE2_BLITTERS
+
+/* (a * b) / 255 on 16-bit channels, exactly */
+static SDL_INLINE __m128i
+MulDiv255_SSE2(__m128i a, __m128i b)
+{
+    __m128i t = _mm_add_epi16(_mm_mullo_epi16(a, b), _mm_set1_epi16(1));
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+/* Spread the alpha of each 16-bit channel pixel over all its channels */
+static SDL_INLINE __m128i
+Alpha_SSE2(__m128i x)
+{
+    return _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, 0xFF), 0xFF);
+}
+
+SDL_FORCE_INLINE void
+Blit8888Rows_SSE2(SDL_BlitInfo *info, const Blit8888Params *p, const int op)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i src_rotr = _mm_cvtsi32_si128(p->src_rot);
+    const __m128i src_rotl = _mm_cvtsi32_si128(32 - p->src_rot);
+    const __m128i src_keep = _mm_set1_epi32(p->src_swap ? 0xFF00FF00 : 0xFFFFFFFF);
+    const __m128i src_lo = _mm_set1_epi32(p->src_swap ? 0x000000FF : 0);
+    const __m128i src_hi = _mm_set1_epi32(p->src_swap ? 0x00FF0000 : 0);
+    const __m128i dst_rotr = _mm_cvtsi32_si128(p->dst_rot);
+    const __m128i dst_rotl = _mm_cvtsi32_si128(32 - p->dst_rot);
+    const __m128i dst_keep = _mm_set1_epi32(p->dst_swap ? 0xFF00FF00 : 0xFFFFFFFF);
+    const __m128i dst_lo = _mm_set1_epi32(p->dst_swap ? 0x000000FF : 0);
+    const __m128i dst_hi = _mm_set1_epi32(p->dst_swap ? 0x00FF0000 : 0);
+    const __m128i src_alpha = _mm_set1_epi32(p->src_alpha);
+    const __m128i dst_mask = _mm_set1_epi32(p->dst_mask);
+    const __m128i ckey_mask = _mm_set1_epi32(p->ckey_mask);
+    const __m128i ckey = _mm_set1_epi32(p->ckey);
+    const __m128i modulate = _mm_unpacklo_epi8(_mm_set1_epi32(p->modulate), zero);
+    const __m128i rgb_mask = _mm_set1_epi32(0x00FFFFFF);
+    const __m128i alpha_mask = _mm_set1_epi32(0xFF000000);
+    const __m128i rgb_mask16 = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+    const __m128i alpha_one16 = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+    const __m128i max16 = _mm_set1_epi16(255);
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        for ( ; n >= 4; n -= 4, src += 4, dst += 4) {
+            __m128i s = _mm_loadu_si128((const __m128i *)src);
+            __m128i d = _mm_loadu_si128((const __m128i *)dst);
+            __m128i keep = _mm_cmpeq_epi32(_mm_and_si128(s, ckey_mask), ckey);
+            __m128i s_lo, s_hi, d_lo, d_hi, r;
+
+            /* Convert both to ARGB8888 */
+            s = _mm_or_si128(_mm_srl_epi32(s, src_rotr), _mm_sll_epi32(s, src_rotl));
+            s = _mm_or_si128(_mm_and_si128(s, src_keep),
+                             _mm_or_si128(_mm_and_si128(_mm_srli_epi32(s, 16), src_lo),
+                                          _mm_and_si128(_mm_slli_epi32(s, 16), src_hi)));
+            s = _mm_or_si128(s, src_alpha);
+            r = _mm_or_si128(_mm_srl_epi32(d, dst_rotr), _mm_sll_epi32(d, dst_rotl));
+            r = _mm_or_si128(_mm_and_si128(r, dst_keep),
+                             _mm_or_si128(_mm_and_si128(_mm_srli_epi32(r, 16), dst_lo),
+                                          _mm_and_si128(_mm_slli_epi32(r, 16), dst_hi)));
+
+            s_lo = MulDiv255_SSE2(_mm_unpacklo_epi8(s, zero), modulate);
+            s_hi = MulDiv255_SSE2(_mm_unpackhi_epi8(s, zero), modulate);
+            if (op == SDL_COPY_BLEND || op == SDL_COPY_ADD) {
+                s_lo = MulDiv255_SSE2(s_lo, _mm_or_si128(_mm_and_si128(Alpha_SSE2(s_lo), rgb_mask16), alpha_one16));
+                s_hi = MulDiv255_SSE2(s_hi, _mm_or_si128(_mm_and_si128(Alpha_SSE2(s_hi), rgb_mask16), alpha_one16));
+            }
+            if (op == SDL_COPY_BLEND) {
+                d_lo = _mm_unpacklo_epi8(r, zero);
+                d_hi = _mm_unpackhi_epi8(r, zero);
+                d_lo = _mm_add_epi16(s_lo, MulDiv255_SSE2(d_lo, _mm_sub_epi16(max16, Alpha_SSE2(s_lo))));
+                d_hi = _mm_add_epi16(s_hi, MulDiv255_SSE2(d_hi, _mm_sub_epi16(max16, Alpha_SSE2(s_hi))));
+                r = _mm_packus_epi16(d_lo, d_hi);
+            } else if (op == SDL_COPY_ADD) {
+                r = _mm_or_si128(_mm_and_si128(_mm_adds_epu8(_mm_packus_epi16(s_lo, s_hi), r), rgb_mask),
+                                 _mm_and_si128(r, alpha_mask));
+            } else if (op == SDL_COPY_MOD) {
+                d_lo = MulDiv255_SSE2(s_lo, _mm_unpacklo_epi8(r, zero));
+                d_hi = MulDiv255_SSE2(s_hi, _mm_unpackhi_epi8(r, zero));
+                r = _mm_or_si128(_mm_and_si128(_mm_packus_epi16(d_lo, d_hi), rgb_mask),
+                                 _mm_and_si128(r, alpha_mask));
+            } else {
+                r = _mm_packus_epi16(s_lo, s_hi);
+            }
+            r = _mm_and_si128(r, dst_mask);
+
+            /* Back to the destination layout, skipping colorkeyed pixels */
+            r = _mm_or_si128(_mm_and_si128(r, dst_keep),
+                             _mm_or_si128(_mm_and_si128(_mm_srli_epi32(r, 16), dst_lo),
+                                          _mm_and_si128(_mm_slli_epi32(r, 16), dst_hi)));
+            r = _mm_or_si128(_mm_sll_epi32(r, dst_rotr), _mm_srl_epi32(r, dst_rotl));
+            r = _mm_or_si128(_mm_and_si128(keep, d), _mm_andnot_si128(keep, r));
+            _mm_storeu_si128((__m128i *)dst, r);
+        }
+        Blit8888Pixels(src, dst, n, p);
+
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void
+Blit8888_SSE2(SDL_BlitInfo *info)
+{
+    Blit8888Params p;
+
+    SetupBlit8888(info, &p);
+    switch (p.op) {
+    case SDL_COPY_BLEND:
+        Blit8888Rows_SSE2(info, &p, SDL_COPY_BLEND);
+        break;
+    case SDL_COPY_ADD:
+        Blit8888Rows_SSE2(info, &p, SDL_COPY_ADD);
+        break;
+    case SDL_COPY_MOD:
+        Blit8888Rows_SSE2(info, &p, SDL_COPY_MOD);
+        break;
+    default:
+        Blit8888Rows_SSE2(info, &p, 0);
+        break;
+    }
+}
+
+#endif /* HAVE_SSE2_BLITTERS */
+
+#if HAVE_AVX2_BLITTERS
+
+/* The ends of rows are done with masked loads and stores where the pixels
+   are 32 bits.  The scalar code used for the other tails isn't built for
+   AVX, and entering it with the upper halves of the ymm registers dirty
+   costs a state transition on many CPUs, more than a small sprite takes
+   to draw, so those are preceded by _mm256_zeroupper(). */
+
+/* Lanes below n set, for the last partial group of eight pixels */
+SDL_TARGETING_AVX2 static SDL_INLINE __m256i
+TailMask_AVX2(int n)
+{
+    return _mm256_cmpgt_epi32(_mm256_set1_epi32(n), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+}
+
+SDL_TARGETING_AVX2 static SDL_INLINE __m256i
+MulDiv255_AVX2(__m256i a, __m256i b)
+{
+    __m256i t = _mm256_add_epi16(_mm256_mullo_epi16(a, b), _mm256_set1_epi16(1));
+    return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+}
+
+SDL_TARGETING_AVX2 static SDL_INLINE __m256i
+Alpha_AVX2(__m256i x)
+{
+    return _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(x, 0xFF), 0xFF);
+}
+
+SDL_TARGETING_AVX2 SDL_FORCE_INLINE void
+Blit8888Rows_AVX2(SDL_BlitInfo *info, const Blit8888Params *p, const int op, const int argb)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m128i src_rotr = _mm_cvtsi32_si128(p->src_rot);
+    const __m128i src_rotl = _mm_cvtsi32_si128(32 - p->src_rot);
+    const __m256i src_keep = _mm256_set1_epi32(p->src_swap ? 0xFF00FF00 : 0xFFFFFFFF);
+    const __m256i src_lo = _mm256_set1_epi32(p->src_swap ? 0x000000FF : 0);
+    const __m256i src_hi = _mm256_set1_epi32(p->src_swap ? 0x00FF0000 : 0);
+    const __m128i dst_rotr = _mm_cvtsi32_si128(p->dst_rot);
+    const __m128i dst_rotl = _mm_cvtsi32_si128(32 - p->dst_rot);
+    const __m256i dst_keep = _mm256_set1_epi32(p->dst_swap ? 0xFF00FF00 : 0xFFFFFFFF);
+    const __m256i dst_lo = _mm256_set1_epi32(p->dst_swap ? 0x000000FF : 0);
+    const __m256i dst_hi = _mm256_set1_epi32(p->dst_swap ? 0x00FF0000 : 0);
+    const __m256i src_alpha = _mm256_set1_epi32(p->src_alpha);
+    const __m256i dst_mask = _mm256_set1_epi32(p->dst_mask);
+    const __m256i ckey_mask = _mm256_set1_epi32(p->ckey_mask);
+    const __m256i ckey = _mm256_set1_epi32(p->ckey);
+    const __m256i modulate = _mm256_unpacklo_epi8(_mm256_set1_epi32(p->modulate), zero);
+    const __m256i rgb_mask = _mm256_set1_epi32(0x00FFFFFF);
+    const __m256i alpha_mask = _mm256_set1_epi32(0xFF000000);
+    const __m256i rgb_mask16 = _mm256_set_epi16(0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1);
+    const __m256i alpha_one16 = _mm256_set_epi16(255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0);
+    const __m256i max16 = _mm256_set1_epi16(255);
+    const __m256i ones = _mm256_set1_epi32(-1);
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        for ( ; n > 0; n -= 8, src += 8, dst += 8) {
+            __m256i s, d, keep, mask, s_lo, s_hi, d_lo, d_hi, r;
+
+            if (n >= 8) {
+                mask = ones;
+                s = _mm256_loadu_si256((const __m256i *)src);
+                d = _mm256_loadu_si256((const __m256i *)dst);
+            } else {
+                mask = TailMask_AVX2(n);
+                s = _mm256_maskload_epi32((const int *)src, mask);
+                d = _mm256_maskload_epi32((const int *)dst, mask);
+            }
+            keep = _mm256_cmpeq_epi32(_mm256_and_si256(s, ckey_mask), ckey);
+
+            /* Convert both to ARGB8888 */
+            if (!argb) {
+                s = _mm256_or_si256(_mm256_srl_epi32(s, src_rotr), _mm256_sll_epi32(s, src_rotl));
+                s = _mm256_or_si256(_mm256_and_si256(s, src_keep),
+                                    _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(s, 16), src_lo),
+                                                    _mm256_and_si256(_mm256_slli_epi32(s, 16), src_hi)));
+                r = _mm256_or_si256(_mm256_srl_epi32(d, dst_rotr), _mm256_sll_epi32(d, dst_rotl));
+                r = _mm256_or_si256(_mm256_and_si256(r, dst_keep),
+                                    _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(r, 16), dst_lo),
+                                                    _mm256_and_si256(_mm256_slli_epi32(r, 16), dst_hi)));
+            } else {
+                r = d;
+            }
+            s = _mm256_or_si256(s, src_alpha);
+
+            s_lo = MulDiv255_AVX2(_mm256_unpacklo_epi8(s, zero), modulate);
+            s_hi = MulDiv255_AVX2(_mm256_unpackhi_epi8(s, zero), modulate);
+            if (op == SDL_COPY_BLEND || op == SDL_COPY_ADD) {
+                s_lo = MulDiv255_AVX2(s_lo, _mm256_or_si256(_mm256_and_si256(Alpha_AVX2(s_lo), rgb_mask16), alpha_one16));
+                s_hi = MulDiv255_AVX2(s_hi, _mm256_or_si256(_mm256_and_si256(Alpha_AVX2(s_hi), rgb_mask16), alpha_one16));
+            }
+            if (op == SDL_COPY_BLEND) {
+                d_lo = _mm256_unpacklo_epi8(r, zero);
+                d_hi = _mm256_unpackhi_epi8(r, zero);
+                d_lo = _mm256_add_epi16(s_lo, MulDiv255_AVX2(d_lo, _mm256_sub_epi16(max16, Alpha_AVX2(s_lo))));
+                d_hi = _mm256_add_epi16(s_hi, MulDiv255_AVX2(d_hi, _mm256_sub_epi16(max16, Alpha_AVX2(s_hi))));
+                r = _mm256_packus_epi16(d_lo, d_hi);
+            } else if (op == SDL_COPY_ADD) {
+                r = _mm256_or_si256(_mm256_and_si256(_mm256_adds_epu8(_mm256_packus_epi16(s_lo, s_hi), r), rgb_mask),
+                                    _mm256_and_si256(r, alpha_mask));
+            } else if (op == SDL_COPY_MOD) {
+                d_lo = MulDiv255_AVX2(s_lo, _mm256_unpacklo_epi8(r, zero));
+                d_hi = MulDiv255_AVX2(s_hi, _mm256_unpackhi_epi8(r, zero));
+                r = _mm256_or_si256(_mm256_and_si256(_mm256_packus_epi16(d_lo, d_hi), rgb_mask),
+                                    _mm256_and_si256(r, alpha_mask));
+            } else {
+                r = _mm256_packus_epi16(s_lo, s_hi);
+            }
+            r = _mm256_and_si256(r, dst_mask);
+
+            /* Back to the destination layout, skipping colorkeyed pixels */
+            if (!argb) {
+                r = _mm256_or_si256(_mm256_and_si256(r, dst_keep),
+                                    _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(r, 16), dst_lo),
+                                                    _mm256_and_si256(_mm256_slli_epi32(r, 16), dst_hi)));
+                r = _mm256_or_si256(_mm256_sll_epi32(r, dst_rotr), _mm256_srl_epi32(r, dst_rotl));
+            }
+            r = _mm256_blendv_epi8(r, d, keep);
+            if (n >= 8) {
+                _mm256_storeu_si256((__m256i *)dst, r);
+            } else {
+                _mm256_maskstore_epi32((int *)dst, mask, r);
+            }
+        }
+
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+SDL_TARGETING_AVX2 static void
+Blit8888_AVX2(SDL_BlitInfo *info)
+{
+    Blit8888Params p;
+
+    SetupBlit8888(info, &p);
+    if (!p.src_rot && !p.src_swap && !p.dst_rot && !p.dst_swap) {
+        /* Both are already in ARGB8888 order, the common case for sprites */
+        switch (p.op) {
+        case SDL_COPY_BLEND:
+            Blit8888Rows_AVX2(info, &p, SDL_COPY_BLEND, 1);
+            break;
+        case SDL_COPY_ADD:
+            Blit8888Rows_AVX2(info, &p, SDL_COPY_ADD, 1);
+            break;
+        case SDL_COPY_MOD:
+            Blit8888Rows_AVX2(info, &p, SDL_COPY_MOD, 1);
+            break;
+        default:
+            Blit8888Rows_AVX2(info, &p, 0, 1);
+            break;
+        }
+        return;
+    }
+    switch (p.op) {
+    case SDL_COPY_BLEND:
+        Blit8888Rows_AVX2(info, &p, SDL_COPY_BLEND, 0);
+        break;
+    case SDL_COPY_ADD:
+        Blit8888Rows_AVX2(info, &p, SDL_COPY_ADD, 0);
+        break;
+    case SDL_COPY_MOD:
+        Blit8888Rows_AVX2(info, &p, SDL_COPY_MOD, 0);
+        break;
+    default:
+        Blit8888Rows_AVX2(info, &p, 0, 0);
+        break;
+    }
+}
+
+#endif /* HAVE_AVX2_BLITTERS */
+
+/* Straight conversions between the 8888, 24-bit and 565 formats, for
+   SDL_ConvertPixels() and SDL_ConvertSurface().  The results match
+   BlitNtoN(): a missing source alpha becomes opaque, an unused
+   destination channel becomes 0 and 565 channels are expanded the way
+   SDL_expand_byte does.
+
+   Channels that move by the same number of bits are handled together, a
+   swizzle between two 8888 layouts takes at most three shifts.
+ */
+
+typedef struct
+{
+    int src_bpp, dst_bpp;
+    int src_shift[4], dst_shift[4]; /* R, G, B and A, -1 if missing */
+    int groups;
+    Uint32 group_mask[4];       /* source bits that move together */
+    int group_shift[4];         /* left when positive, right when negative */
+    Uint32 alpha;               /* opaque alpha missing from the source */
+    int byte_map[4];            /* the source byte of each destination byte */
+} ConvertParams;
+
+#define CONVERT_ZERO    -1
+#define CONVERT_OPAQUE  -2
+
+static void
+SetupConvert(const SDL_BlitInfo *info, ConvertParams *p)
+{
+    const SDL_PixelFormat *sf = info->src_fmt;
+    const SDL_PixelFormat *df = info->dst_fmt;
+    const Uint8 dst_loss[4] = { df->Rloss, df->Gloss, df->Bloss, df->Aloss };
+    int c, g;
+
+    p->src_bpp = sf->BytesPerPixel;
+    p->dst_bpp = df->BytesPerPixel;
+    p->src_shift[0] = sf->Rshift;
+    p->src_shift[1] = sf->Gshift;
+    p->src_shift[2] = sf->Bshift;
+    p->src_shift[3] = sf->Amask ? sf->Ashift : -1;
+    p->dst_shift[0] = df->Rshift;
+    p->dst_shift[1] = df->Gshift;
+    p->dst_shift[2] = df->Bshift;
+    p->dst_shift[3] = df->Amask ? df->Ashift : -1;
+    p->alpha = (df->Amask && !sf->Amask) ? df->Amask : 0;
+
+    /* Only used when the source has 8 bits per channel */
+    p->groups = 0;
+    for (c = 0; c < 4; ++c) {
+        Uint32 mask;
+        int shift;
+
+        if (p->src_shift[c] < 0 || p->dst_shift[c] < 0) {
+            continue;
+        }
+        mask = ((0xFF << dst_loss[c]) & 0xFF) << p->src_shift[c];
+        shift = p->dst_shift[c] - (p->src_shift[c] + dst_loss[c]);
+        for (g = 0; g < p->groups; ++g) {
+            if (p->group_shift[g] == shift) {
+                break;
+            }
+        }
+        if (g == p->groups) {
+            p->group_mask[g] = 0;
+            p->group_shift[g] = shift;
+            ++p->groups;
+        }
+        p->group_mask[g] |= mask;
+    }
+
+    /* Only used for little endian 8888 and 24-bit pixels */
+    for (c = 0; c < 4; ++c) {
+        p->byte_map[c] = CONVERT_ZERO;
+    }
+    for (c = 0; c < 4; ++c) {
+        if (p->dst_shift[c] >= 0 && p->dst_shift[c] / 8 < 4) {
+            if (p->src_shift[c] >= 0) {
+                p->byte_map[p->dst_shift[c] / 8] = p->src_shift[c] / 8;
+            } else {
+                p->byte_map[p->dst_shift[c] / 8] = CONVERT_OPAQUE;
+            }
+        }
+    }
+}
+
+static SDL_INLINE Uint32
+ConvertGroups(Uint32 pixel, const ConvertParams *p)
+{
+    Uint32 result = p->alpha;
+    int g;
+
+    for (g = 0; g < p->groups; ++g) {
+        if (p->group_shift[g] >= 0) {
+            result |= (pixel & p->group_mask[g]) << p->group_shift[g];
+        } else {
+            result |= (pixel & p->group_mask[g]) >> -p->group_shift[g];
+        }
+    }
+    return result;
+}
+
+/* Convert pixels one at a time, for the ends of rows */
+static void
+ConvertPixels(const Uint8 *src, Uint8 *dst, int n, const ConvertParams *p)
+{
+    Uint32 pixel;
+
+    if (p->src_bpp == 2) {
+        const int rshift = p->src_shift[0], bshift = p->src_shift[2];
+
+        while (n--) {
+            Uint32 r, g, b;
+
+            pixel = *(const Uint16 *)src;
+            r = (((pixel >> rshift) & 0x1F) * 1053) >> 7;
+            g = (((pixel >> 5) & 0x3F) * 4145) >> 10;
+            b = (((pixel >> bshift) & 0x1F) * 1053) >> 7;
+            *(Uint32 *)dst = (r << p->dst_shift[0]) | (g << p->dst_shift[1]) |
+                             (b << p->dst_shift[2]) | p->alpha;
+            src += 2;
+            dst += 4;
+        }
+        return;
+    }
+
+    while (n--) {
+        if (p->src_bpp == 3) {
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+            pixel = src[0] | (src[1] << 8) | (src[2] << 16);
+#else
+            pixel = (src[0] << 16) | (src[1] << 8) | src[2];
+#endif
+        } else {
+            pixel = *(const Uint32 *)src;
+        }
+        pixel = ConvertGroups(pixel, p);
+        if (p->dst_bpp == 3) {
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+            dst[0] = (Uint8)pixel;
+            dst[1] = (Uint8)(pixel >> 8);
+            dst[2] = (Uint8)(pixel >> 16);
+#else
+            dst[0] = (Uint8)(pixel >> 16);
+            dst[1] = (Uint8)(pixel >> 8);
+            dst[2] = (Uint8)pixel;
+#endif
+        } else if (p->dst_bpp == 2) {
+            *(Uint16 *)dst = (Uint16)pixel;
+        } else {
+            *(Uint32 *)dst = pixel;
+        }
+        src += p->src_bpp;
+        dst += p->dst_bpp;
+    }
+}
+
+static void
+ConvertNtoN(SDL_BlitInfo *info)
+{
+    ConvertParams p;
+
+    SetupConvert(info, &p);
+    while (info->dst_h--) {
+        ConvertPixels(info->src, info->dst, info->dst_w, &p);
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if HAVE_SSE2_BLITTERS
+
+SDL_FORCE_INLINE __m128i
+ConvertGroups_SSE2(__m128i s, const __m128i *mask, const __m128i *left,
+                   const __m128i *right, __m128i alpha, int groups)
+{
+    __m128i r = alpha;
+    int g;
+
+    for (g = 0; g < groups; ++g) {
+        __m128i t = _mm_and_si128(s, mask[g]);
+        r = _mm_or_si128(r, _mm_sll_epi32(_mm_srl_epi32(t, right[g]), left[g]));
+    }
+    return r;
+}
+
+/* The group shifts as shift counts, since SSE2 has no variable shifts */
+static void
+SetupGroups_SSE2(const ConvertParams *p, __m128i *mask, __m128i *left, __m128i *right)
+{
+    int g;
+
+    for (g = 0; g < p->groups; ++g) {
+        const int shift = p->group_shift[g];
+
+        mask[g] = _mm_set1_epi32(p->group_mask[g]);
+        left[g] = _mm_cvtsi32_si128(shift > 0 ? shift : 0);
+        right[g] = _mm_cvtsi32_si128(shift < 0 ? -shift : 0);
+    }
+}
+
+static void
+Convert4to4_SSE2(SDL_BlitInfo *info)
+{
+    ConvertParams p;
+    __m128i mask[4], left[4], right[4], alpha;
+
+    SetupConvert(info, &p);
+    SetupGroups_SSE2(&p, mask, left, right);
+    alpha = _mm_set1_epi32(p.alpha);
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        for ( ; n >= 4; n -= 4, src += 4, dst += 4) {
+            __m128i s = _mm_loadu_si128((const __m128i *)src);
+            _mm_storeu_si128((__m128i *)dst,
+                             ConvertGroups_SSE2(s, mask, left, right, alpha, p.groups));
+        }
+        ConvertPixels((const Uint8 *)src, (Uint8 *)dst, n, &p);
+
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void
+Convert4to565_SSE2(SDL_BlitInfo *info)
+{
+    ConvertParams p;
+    __m128i mask[4], left[4], right[4];
+    const __m128i zero = _mm_setzero_si128();
+
+    SetupConvert(info, &p);
+    SetupGroups_SSE2(&p, mask, left, right);
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint16 *dst = (Uint16 *)info->dst;
+        int n = info->dst_w;
+
+        for ( ; n >= 8; n -= 8, src += 8, dst += 8) {
+            __m128i lo = _mm_loadu_si128((const __m128i *)src);
+            __m128i hi = _mm_loadu_si128((const __m128i *)(src + 4));
+            lo = ConvertGroups_SSE2(lo, mask, left, right, zero, p.groups);
+            hi = ConvertGroups_SSE2(hi, mask, left, right, zero, p.groups);
+            /* Sign extend so the signed saturation keeps all 16 bits */
+            lo = _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16);
+            hi = _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16);
+            _mm_storeu_si128((__m128i *)dst, _mm_packs_epi32(lo, hi));
+        }
+        ConvertPixels((const Uint8 *)src, (Uint8 *)dst, n, &p);
+
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void
+Convert565to4_SSE2(SDL_BlitInfo *info)
+{
+    ConvertParams p;
+    __m128i rshift, bshift, rdst, gdst, bdst, alpha;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i mask5 = _mm_set1_epi16(0x1F);
+    const __m128i mask6 = _mm_set1_epi16(0x3F);
+    /* (v << 4) * 0x839D >> 16 and (v << 3) * 0x8187 >> 16 are
+       v * 255 / 31 and v * 255 / 63, rounded down */
+    const __m128i expand5 = _mm_set1_epi16((short)0x839D);
+    const __m128i expand6 = _mm_set1_epi16((short)0x8187);
+
+    SetupConvert(info, &p);
+    rshift = _mm_cvtsi32_si128(p.src_shift[0]);
+    bshift = _mm_cvtsi32_si128(p.src_shift[2]);
+    rdst = _mm_cvtsi32_si128(p.dst_shift[0]);
+    gdst = _mm_cvtsi32_si128(p.dst_shift[1]);
+    bdst = _mm_cvtsi32_si128(p.dst_shift[2]);
+    alpha = _mm_set1_epi32(p.alpha);
+
+    while (info->dst_h--) {
+        const Uint16 *src = (const Uint16 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        for ( ; n >= 8; n -= 8, src += 8, dst += 8) {
+            __m128i s = _mm_loadu_si128((const __m128i *)src);
+            __m128i r = _mm_and_si128(_mm_srl_epi16(s, rshift), mask5);
+            __m128i g = _mm_and_si128(_mm_srli_epi16(s, 5), mask6);
+            __m128i b = _mm_and_si128(_mm_srl_epi16(s, bshift), mask5);
+            __m128i lo, hi;
+
+            r = _mm_mulhi_epu16(_mm_slli_epi16(r, 4), expand5);
+            g = _mm_mulhi_epu16(_mm_slli_epi16(g, 3), expand6);
+            b = _mm_mulhi_epu16(_mm_slli_epi16(b, 4), expand5);
+            lo = _mm_or_si128(_mm_or_si128(_mm_sll_epi32(_mm_unpacklo_epi16(r, zero), rdst),
+                                           _mm_sll_epi32(_mm_unpacklo_epi16(g, zero), gdst)),
+                              _mm_or_si128(_mm_sll_epi32(_mm_unpacklo_epi16(b, zero), bdst), alpha));
+            hi = _mm_or_si128(_mm_or_si128(_mm_sll_epi32(_mm_unpackhi_epi16(r, zero), rdst),
+                                           _mm_sll_epi32(_mm_unpackhi_epi16(g, zero), gdst)),
+                              _mm_or_si128(_mm_sll_epi32(_mm_unpackhi_epi16(b, zero), bdst), alpha));
+            _mm_storeu_si128((__m128i *)dst, lo);
+            _mm_storeu_si128((__m128i *)(dst + 4), hi);
+        }
+        ConvertPixels((const Uint8 *)src, (Uint8 *)dst, n, &p);
+
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#endif /* HAVE_SSE2_BLITTERS */
+
+#if HAVE_AVX2_BLITTERS
+
+/* A byte shuffle for four pixels, within each 128-bit lane */
+SDL_TARGETING_AVX2 static __m256i
+SetupShuffle_AVX2(const ConvertParams *p)
+{
+    Uint8 shuffle[16];
+    int i, j;
+
+    SDL_memset(shuffle, 0x80, sizeof(shuffle));
+    for (i = 0; i < 4; ++i) {
+        for (j = 0; j < p->dst_bpp; ++j) {
+            if (p->byte_map[j] >= 0) {
+                shuffle[i * p->dst_bpp + j] = (Uint8)(i * p->src_bpp + p->byte_map[j]);
+            }
+        }
+    }
+    return _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)shuffle));
+}
+
+SDL_TARGETING_AVX2 static void
+Convert4to4_AVX2(SDL_BlitInfo *info)
+{
+    ConvertParams p;
+    __m256i shuffle, alpha;
+
+    SetupConvert(info, &p);
+    shuffle = SetupShuffle_AVX2(&p);
+    alpha = _mm256_set1_epi32(p.alpha);
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        for ( ; n >= 8; n -= 8, src += 8, dst += 8) {
+            __m256i s = _mm256_loadu_si256((const __m256i *)src);
+            s = _mm256_or_si256(_mm256_shuffle_epi8(s, shuffle), alpha);
+            _mm256_storeu_si256((__m256i *)dst, s);
+        }
+        if (n) {
+            const __m256i mask = TailMask_AVX2(n);
+            __m256i s = _mm256_maskload_epi32((const int *)src, mask);
+            s = _mm256_or_si256(_mm256_shuffle_epi8(s, shuffle), alpha);
+            _mm256_maskstore_epi32((int *)dst, mask, s);
+        }
+
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+SDL_TARGETING_AVX2 static void
+Convert3to4_AVX2(SDL_BlitInfo *info)
+{
+    ConvertParams p;
+    __m256i shuffle, alpha;
+    const __m256i spread = _mm256_setr_epi32(0, 1, 2, 0, 3, 4, 5, 0);
+
+    SetupConvert(info, &p);
+    shuffle = SetupShuffle_AVX2(&p);
+    alpha = _mm256_set1_epi32(p.alpha);
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        /* Eight pixels at a time, but the load is 32 bytes */
+        for ( ; n >= 11; n -= 8, src += 24, dst += 8) {
+            __m256i s = _mm256_loadu_si256((const __m256i *)src);
+            s = _mm256_permutevar8x32_epi32(s, spread);
+            s = _mm256_or_si256(_mm256_shuffle_epi8(s, shuffle), alpha);
+            _mm256_storeu_si256((__m256i *)dst, s);
+        }
+        if (n) {
+            _mm256_zeroupper();
+            ConvertPixels(src, (Uint8 *)dst, n, &p);
+        }
+
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+SDL_TARGETING_AVX2 static void
+Convert4to3_AVX2(SDL_BlitInfo *info)
+{
+    ConvertParams p;
+    __m256i shuffle;
+    const __m256i gather = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+
+    SetupConvert(info, &p);
+    shuffle = SetupShuffle_AVX2(&p);
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint8 *dst = info->dst;
+        int n = info->dst_w;
+
+        for ( ; n >= 8; n -= 8, src += 8, dst += 24) {
+            __m256i s = _mm256_loadu_si256((const __m256i *)src);
+            s = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(s, shuffle), gather);
+            _mm_storeu_si128((__m128i *)dst, _mm256_castsi256_si128(s));
+            _mm_storel_epi64((__m128i *)(dst + 16), _mm256_extracti128_si256(s, 1));
+        }
+        if (n) {
+            _mm256_zeroupper();
+            ConvertPixels((const Uint8 *)src, dst, n, &p);
+        }
+
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#endif /* HAVE_AVX2_BLITTERS */
+
+/* *INDENT-OFF* */
+
+#define SIMD_BLIT_FLAGS \
+    (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | \
+     SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_COLORKEY)
+
+#define SIMD_BLIT_ENTRIES(src, cpu, func) \
+    { src, SDL_PIXELFORMAT_RGB888, SIMD_BLIT_FLAGS, cpu, func }, \
+    { src, SDL_PIXELFORMAT_BGR888, SIMD_BLIT_FLAGS, cpu, func }, \
+    { src, SDL_PIXELFORMAT_ARGB8888, SIMD_BLIT_FLAGS, cpu, func }, \
+    { src, SDL_PIXELFORMAT_RGBA8888, SIMD_BLIT_FLAGS, cpu, func }, \
+    { src, SDL_PIXELFORMAT_ABGR8888, SIMD_BLIT_FLAGS, cpu, func }, \
+    { src, SDL_PIXELFORMAT_BGRA8888, SIMD_BLIT_FLAGS, cpu, func },
+
+#define SIMD_BLIT_TABLE(cpu, func) \
+    SIMD_BLIT_ENTRIES(SDL_PIXELFORMAT_RGB888, cpu, func) \
+    SIMD_BLIT_ENTRIES(SDL_PIXELFORMAT_BGR888, cpu, func) \
+    SIMD_BLIT_ENTRIES(SDL_PIXELFORMAT_ARGB8888, cpu, func) \
+    SIMD_BLIT_ENTRIES(SDL_PIXELFORMAT_RGBA8888, cpu, func) \
+    SIMD_BLIT_ENTRIES(SDL_PIXELFORMAT_ABGR8888, cpu, func) \
+    SIMD_BLIT_ENTRIES(SDL_PIXELFORMAT_BGRA8888, cpu, func)
+
+SDL_BlitFuncEntry SDL_SIMDBlitFuncTable[] = {
+#if HAVE_AVX2_BLITTERS
+    SIMD_BLIT_TABLE(SDL_CPU_AVX2, Blit8888_AVX2)
+#endif
+#if HAVE_SSE2_BLITTERS
+    SIMD_BLIT_TABLE(SDL_CPU_SSE2, Blit8888_SSE2)
+#endif
+    { 0, 0, 0, 0, NULL }
+};
+
+#define CONVERT_ENTRY(src, dst, cpu, func) \
+    { src, dst, 0, cpu, func },
+
+#define CONVERT_TO_8888(src, cpu, func) \
+    CONVERT_ENTRY(src, SDL_PIXELFORMAT_RGB888, cpu, func) \
+    CONVERT_ENTRY(src, SDL_PIXELFORMAT_BGR888, cpu, func) \
+    CONVERT_ENTRY(src, SDL_PIXELFORMAT_RGBX8888, cpu, func) \
+    CONVERT_ENTRY(src, SDL_PIXELFORMAT_BGRX8888, cpu, func) \
+    CONVERT_ENTRY(src, SDL_PIXELFORMAT_ARGB8888, cpu, func) \
+    CONVERT_ENTRY(src, SDL_PIXELFORMAT_RGBA8888, cpu, func) \
+    CONVERT_ENTRY(src, SDL_PIXELFORMAT_ABGR8888, cpu, func) \
+    CONVERT_ENTRY(src, SDL_PIXELFORMAT_BGRA8888, cpu, func)
+
+#define CONVERT_FROM_8888(dst, cpu, func) \
+    CONVERT_ENTRY(SDL_PIXELFORMAT_RGB888, dst, cpu, func) \
+    CONVERT_ENTRY(SDL_PIXELFORMAT_BGR888, dst, cpu, func) \
+    CONVERT_ENTRY(SDL_PIXELFORMAT_RGBX8888, dst, cpu, func) \
+    CONVERT_ENTRY(SDL_PIXELFORMAT_BGRX8888, dst, cpu, func) \
+    CONVERT_ENTRY(SDL_PIXELFORMAT_ARGB8888, dst, cpu, func) \
+    CONVERT_ENTRY(SDL_PIXELFORMAT_RGBA8888, dst, cpu, func) \
+    CONVERT_ENTRY(SDL_PIXELFORMAT_ABGR8888, dst, cpu, func) \
+    CONVERT_ENTRY(SDL_PIXELFORMAT_BGRA8888, dst, cpu, func)
+
+#define CONVERT_8888_TO_8888(cpu, func) \
+    CONVERT_TO_8888(SDL_PIXELFORMAT_RGB888, cpu, func) \
+    CONVERT_TO_8888(SDL_PIXELFORMAT_BGR888, cpu, func) \
+    CONVERT_TO_8888(SDL_PIXELFORMAT_RGBX8888, cpu, func) \
+    CONVERT_TO_8888(SDL_PIXELFORMAT_BGRX8888, cpu, func) \
+    CONVERT_TO_8888(SDL_PIXELFORMAT_ARGB8888, cpu, func) \
+    CONVERT_TO_8888(SDL_PIXELFORMAT_RGBA8888, cpu, func) \
+    CONVERT_TO_8888(SDL_PIXELFORMAT_ABGR8888, cpu, func) \
+    CONVERT_TO_8888(SDL_PIXELFORMAT_BGRA8888, cpu, func)
+
+SDL_BlitFuncEntry SDL_SIMDConvertFuncTable[] = {
+#if HAVE_AVX2_BLITTERS
+    CONVERT_8888_TO_8888(SDL_CPU_AVX2, Convert4to4_AVX2)
+    CONVERT_TO_8888(SDL_PIXELFORMAT_RGB24, SDL_CPU_AVX2, Convert3to4_AVX2)
+    CONVERT_TO_8888(SDL_PIXELFORMAT_BGR24, SDL_CPU_AVX2, Convert3to4_AVX2)
+    CONVERT_FROM_8888(SDL_PIXELFORMAT_RGB24, SDL_CPU_AVX2, Convert4to3_AVX2)
+    CONVERT_FROM_8888(SDL_PIXELFORMAT_BGR24, SDL_CPU_AVX2, Convert4to3_AVX2)
+#endif
+#if HAVE_SSE2_BLITTERS
+    CONVERT_8888_TO_8888(SDL_CPU_SSE2, Convert4to4_SSE2)
+    CONVERT_TO_8888(SDL_PIXELFORMAT_RGB565, SDL_CPU_SSE2, Convert565to4_SSE2)
+    CONVERT_TO_8888(SDL_PIXELFORMAT_BGR565, SDL_CPU_SSE2, Convert565to4_SSE2)
+    CONVERT_FROM_8888(SDL_PIXELFORMAT_RGB565, SDL_CPU_SSE2, Convert4to565_SSE2)
+    CONVERT_FROM_8888(SDL_PIXELFORMAT_BGR565, SDL_CPU_SSE2, Convert4to565_SSE2)
+#endif
+    /* The generic 24-bit blitters unpack every channel, this doesn't */
+    CONVERT_TO_8888(SDL_PIXELFORMAT_RGB24, SDL_CPU_ANY, ConvertNtoN)
+    CONVERT_TO_8888(SDL_PIXELFORMAT_BGR24, SDL_CPU_ANY, ConvertNtoN)
+    CONVERT_FROM_8888(SDL_PIXELFORMAT_RGB24, SDL_CPU_ANY, ConvertNtoN)
+    CONVERT_FROM_8888(SDL_PIXELFORMAT_BGR24, SDL_CPU_ANY, ConvertNtoN)
+    { 0, 0, 0, 0, NULL }
+};
+
+/* *INDENT-ON* */
+
+/* vi: set ts=4 sw=4 expandtab: */
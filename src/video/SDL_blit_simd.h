@@ -0,0 +1,58 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2014 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+/* Which vector instruction sets the blitters can be built with */
+#if SDL_ASSEMBLY_ROUTINES
+#if defined(__SSE2__)
+#define HAVE_SSE2_BLITTERS 1
+#endif
+#if defined(__AVX2__) || \
+    (defined(_MSC_VER) && (_MSC_VER >= 1700) && (defined(_M_IX86) || defined(_M_X64))) || \
+    ((defined(__i386__) || defined(__x86_64__)) && \
+     ((defined(__clang__) && (__clang_major__ >= 4)) || \
+      (!defined(__clang__) && defined(__GNUC__) && ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)))))
+#define HAVE_AVX2_BLITTERS 1
+#endif
+#endif /* SDL_ASSEMBLY_ROUTINES */
+
+#if HAVE_AVX2_BLITTERS
+#include <immintrin.h>
+#if defined(__AVX2__) || defined(_MSC_VER)
+#define SDL_TARGETING_AVX2
+#else
+#define SDL_TARGETING_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+/* *INDENT-OFF* */
+
+/* Vectorized blitters between the 32-bit 8888 formats, consulted before
+   the other blitters when the copy flags need per-channel arithmetic. */
+extern SDL_BlitFuncEntry SDL_SIMDBlitFuncTable[];
+
+/* Straight conversions between the 8888, 24-bit and 565 formats, used
+   when there are no copy flags at all. */
+extern SDL_BlitFuncEntry SDL_SIMDConvertFuncTable[];
+
+/* *INDENT-ON* */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -22,113 +22,126 @@
 
 #include "SDL_video.h"
 #include "SDL_blit.h"
+#include "SDL_blit_simd.h"
+#include "SDL_RLEaccel_c.h"
 
 
-#ifdef __SSE__
-/* *INDENT-OFF* */
-
-#ifdef _MSC_VER
-#define SSE_BEGIN \
-    __m128 c128; \
-    c128.m128_u32[0] = color; \
-    c128.m128_u32[1] = color; \
-    c128.m128_u32[2] = color; \
-    c128.m128_u32[3] = color;
-#else
-#define SSE_BEGIN \
-    __m128 c128; \
-    DECLARE_ALIGNED(Uint32, cccc[4], 16); \
-    cccc[0] = color; \
-    cccc[1] = color; \
-    cccc[2] = color; \
-    cccc[3] = color; \
-    c128 = *(__m128 *)cccc;
-#endif
+/* The vector fills write a byte pattern that repeats every 48 bytes, or
+   every 96 for AVX2, which any pixel size from 1 to 4 bytes divides.  The
+   pattern buffer holds two periods, so it can be read from any phase. */
+#define SDL_FILLRECT_PATTERN_SIZE   192
 
-#define SSE_WORK \
-    for (i = n / 64; i--;) { \
-        _mm_stream_ps((float *)(p+0), c128); \
-        _mm_stream_ps((float *)(p+16), c128); \
-        _mm_stream_ps((float *)(p+32), c128); \
-        _mm_stream_ps((float *)(p+48), c128); \
-        p += 64; \
-    }
+/* Rows narrower than this are filled by the plain C versions */
+#define SDL_FILLRECT_VECTOR_BYTES   64
 
-#define SSE_END
-
-#define DEFINE_SSE_FILLRECT(bpp, type) \
-static void \
-SDL_FillRect##bpp##SSE(Uint8 *pixels, int pitch, Uint32 color, int w, int h) \
-{ \
-    int i, n; \
-    Uint8 *p = NULL; \
- \
-    SSE_BEGIN; \
- \
-    while (h--) { \
-        n = w * bpp; \
-        p = pixels; \
- \
-        if (n > 63) { \
-            int adjust = 16 - ((uintptr_t)p & 15); \
-            if (adjust < 16) { \
-                n -= adjust; \
-                adjust /= bpp; \
-                while (adjust--) { \
-                    *((type *)p) = (type)color; \
-                    p += bpp; \
-                } \
-            } \
-            SSE_WORK; \
-        } \
-        if (n & 63) { \
-            int remainder = (n & 63); \
-            remainder /= bpp; \
-            while (remainder--) { \
-                *((type *)p) = (type)color; \
-                p += bpp; \
-            } \
-        } \
-        pixels += pitch; \
-    } \
- \
-    SSE_END; \
-}
+/* Fills at least this large use non-temporal stores, they would only push
+   everything else out of the cache */
+#define SDL_FILLRECT_STREAM_BYTES   (1024 * 1024)
 
+typedef void (*SDL_FillRectFunc) (Uint8 *pixels, int pitch, const Uint8 *pattern,
+                                  int bytes, int h, SDL_bool stream);
+
+#ifdef __SSE__
 static void
-SDL_FillRect1SSE(Uint8 *pixels, int pitch, Uint32 color, int w, int h)
+SDL_FillRectSSE(Uint8 *pixels, int pitch, const Uint8 *pattern, int bytes,
+                int h, SDL_bool stream)
 {
-    int i, n;
-
-    SSE_BEGIN;
     while (h--) {
         Uint8 *p = pixels;
-        n = w;
-
-        if (n > 63) {
-            int adjust = 16 - ((uintptr_t)p & 15);
-            if (adjust) {
-                n -= adjust;
-                SDL_memset(p, color, adjust);
-                p += adjust;
+        int n = bytes;
+        int head = (int) (-(uintptr_t) p & 15);
+        const Uint8 *phase = pattern + head;
+        __m128 c0 = _mm_loadu_ps((const float *) phase);
+        __m128 c1 = _mm_loadu_ps((const float *) (phase + 16));
+        __m128 c2 = _mm_loadu_ps((const float *) (phase + 32));
+
+        SDL_memcpy(p, pattern, head);
+        p += head;
+        n -= head;
+        if (stream) {
+            for (; n >= 48; n -= 48, p += 48) {
+                _mm_stream_ps((float *) p, c0);
+                _mm_stream_ps((float *) (p + 16), c1);
+                _mm_stream_ps((float *) (p + 32), c2);
+            }
+        } else {
+            for (; n >= 48; n -= 48, p += 48) {
+                _mm_store_ps((float *) p, c0);
+                _mm_store_ps((float *) (p + 16), c1);
+                _mm_store_ps((float *) (p + 32), c2);
             }
-            SSE_WORK;
-        }
-        if (n & 63) {
-            int remainder = (n & 63);
-            SDL_memset(p, color, remainder);
         }
+        SDL_memcpy(p, phase, n);
         pixels += pitch;
     }
+    if (stream) {
+        _mm_sfence();
+    }
+}
+#endif /* __SSE__ */
 
-    SSE_END;
+#if HAVE_AVX2_BLITTERS
+/* Large fills go to SDL_FillRectSSE() instead, streaming from the AVX2
+   version measured slower, even with 128-bit stores */
+SDL_TARGETING_AVX2 static void
+SDL_FillRectAVX2(Uint8 *pixels, int pitch, const Uint8 *pattern, int bytes,
+                 int h, SDL_bool stream)
+{
+    while (h--) {
+        Uint8 *p = pixels;
+        int n = bytes;
+        int head = (int) (-(uintptr_t) p & 31);
+        const Uint8 *phase = pattern + head;
+        __m256i c0 = _mm256_loadu_si256((const __m256i *) phase);
+        __m256i c1 = _mm256_loadu_si256((const __m256i *) (phase + 32));
+        __m256i c2 = _mm256_loadu_si256((const __m256i *) (phase + 64));
+
+        SDL_memcpy(p, pattern, head);
+        p += head;
+        n -= head;
+        for (; n >= 96; n -= 96, p += 96) {
+            _mm256_store_si256((__m256i *) p, c0);
+            _mm256_store_si256((__m256i *) (p + 32), c1);
+            _mm256_store_si256((__m256i *) (p + 64), c2);
+        }
+        if (n >= 32) {
+            _mm256_store_si256((__m256i *) p, c0);
+            p += 32;
+            n -= 32;
+            if (n >= 32) {
+                _mm256_store_si256((__m256i *) p, c1);
+                p += 32;
+                n -= 32;
+                SDL_memcpy(p, phase + 64, n);
+            } else {
+                SDL_memcpy(p, phase + 32, n);
+            }
+        } else {
+            SDL_memcpy(p, phase, n);
+        }
+        pixels += pitch;
+    }
 }
-/* DEFINE_SSE_FILLRECT(1, Uint8) */
-DEFINE_SSE_FILLRECT(2, Uint16)
-DEFINE_SSE_FILLRECT(4, Uint32)
+#endif /* HAVE_AVX2_BLITTERS */
 
-/* *INDENT-ON* */
-#endif /* __SSE__ */
+static SDL_FillRectFunc
+SDL_GetFillRectFunc(SDL_bool stream)
+{
+    const Uint32 features = SDL_GetBlitCPUFeatures();
+
+#if HAVE_AVX2_BLITTERS
+    if ((features & SDL_CPU_AVX2) && !stream) {
+        return SDL_FillRectAVX2;
+    }
+#endif
+#ifdef __SSE__
+    if (features & SDL_CPU_SSE) {
+        return SDL_FillRectSSE;
+    }
+#endif
+    (void) features;
+    return NULL;
+}
 
 static void
 SDL_FillRect1(Uint8 * pixels, int pitch, Uint32 color, int w, int h)
@@ -196,9 +209,15 @@ SDL_FillRect2(Uint8 * pixels, int pitch, Uint32 color, int w, int h)
 static void
 SDL_FillRect3(Uint8 * pixels, int pitch, Uint32 color, int w, int h)
 {
-    Uint8 r = (Uint8) ((color >> 16) & 0xFF);
-    Uint8 g = (Uint8) ((color >> 8) & 0xFF);
-    Uint8 b = (Uint8) (color & 0xFF);
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+    Uint8 b1 = (Uint8) (color & 0xFF);
+    Uint8 b2 = (Uint8) ((color >> 8) & 0xFF);
+    Uint8 b3 = (Uint8) ((color >> 16) & 0xFF);
+#else
+    Uint8 b1 = (Uint8) ((color >> 16) & 0xFF);
+    Uint8 b2 = (Uint8) ((color >> 8) & 0xFF);
+    Uint8 b3 = (Uint8) (color & 0xFF);
+#endif
     int n;
     Uint8 *p = NULL;
 
@@ -207,9 +226,9 @@ SDL_FillRect3(Uint8 * pixels, int pitch, Uint32 color, int w, int h)
         p = pixels;
 
         while (n--) {
-            *p++ = r;
-            *p++ = g;
-            *p++ = b;
+            *p++ = b1;
+            *p++ = b2;
+            *p++ = b3;
         }
         pixels += pitch;
     }
@@ -224,14 +243,20 @@ SDL_FillRect4(Uint8 * pixels, int pitch, Uint32 color, int w, int h)
     }
 }
 
-/* 
- * This function performs a fast fill of the given rectangle with 'color'
- */
-int
-SDL_FillRect(SDL_Surface * dst, const SDL_Rect * rect, Uint32 color)
+typedef struct
 {
-    SDL_Rect clipped;
-    Uint8 *pixels;
+    int bpp;
+    Uint32 color;               /* repeated to fill 32 bits */
+    SDL_FillRectFunc func;      /* NULL if there's no vector version */
+    SDL_FillRectFunc stream_func;
+    Uint8 pattern[SDL_FILLRECT_PATTERN_SIZE];
+} SDL_FillInfo;
+
+static int
+SDL_SetupFill(SDL_Surface * dst, Uint32 color, SDL_FillInfo * info)
+{
+    Uint8 bytes[4];
+    int i;
 
     if (!dst) {
         return SDL_SetError("Passed NULL destination surface");
@@ -242,6 +267,103 @@ SDL_FillRect(SDL_Surface * dst, const SDL_Rect * rect, Uint32 color)
         return SDL_SetError("SDL_FillRect(): Unsupported surface format");
     }
 
+    /* Perform software fill */
+    if (!dst->pixels) {
+        return SDL_SetError("SDL_FillRect(): You must lock the surface");
+    }
+
+    info->bpp = dst->format->BytesPerPixel;
+    switch (info->bpp) {
+    case 1:
+        color &= 0xFF;
+        color |= (color << 8);
+        color |= (color << 16);
+        break;
+    case 2:
+        color &= 0xFFFF;
+        color |= (color << 16);
+        break;
+    }
+    info->color = color;
+
+    info->func = SDL_GetFillRectFunc(SDL_FALSE);
+    info->stream_func = SDL_GetFillRectFunc(SDL_TRUE);
+    if (!info->stream_func) {
+        /* AVX2 without SSE, large fills just don't stream */
+        info->stream_func = info->func;
+    }
+    if (info->func) {
+        /* The pixel as it's laid out in memory */
+        if (info->bpp == 3) {
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+            bytes[0] = (Uint8) color;
+            bytes[1] = (Uint8) (color >> 8);
+            bytes[2] = (Uint8) (color >> 16);
+#else
+            bytes[0] = (Uint8) (color >> 16);
+            bytes[1] = (Uint8) (color >> 8);
+            bytes[2] = (Uint8) color;
+#endif
+        } else {
+            SDL_memcpy(bytes, &color, sizeof(color));
+        }
+        for (i = 0; i < SDL_FILLRECT_PATTERN_SIZE; ++i) {
+            info->pattern[i] = bytes[i % info->bpp];
+        }
+    }
+    return 0;
+}
+
+static void
+SDL_FillClippedRect(SDL_Surface * dst, const SDL_Rect * rect,
+                    const SDL_FillInfo * info)
+{
+    Uint8 *pixels = (Uint8 *) dst->pixels + rect->y * dst->pitch +
+                                            rect->x * info->bpp;
+    const int bytes = rect->w * info->bpp;
+
+    /* An RLE encoded surface keeps its pixels, the rows are encoded again
+       the next time it's blitted */
+    SDL_RLEInvalidateRows(dst, rect->y, rect->h);
+
+    if (info->func && bytes >= SDL_FILLRECT_VECTOR_BYTES) {
+        if ((size_t) bytes * rect->h >= SDL_FILLRECT_STREAM_BYTES) {
+            info->stream_func(pixels, dst->pitch, info->pattern, bytes, rect->h, SDL_TRUE);
+        } else {
+            info->func(pixels, dst->pitch, info->pattern, bytes, rect->h, SDL_FALSE);
+        }
+        return;
+    }
+
+    switch (info->bpp) {
+    case 1:
+        SDL_FillRect1(pixels, dst->pitch, info->color, rect->w, rect->h);
+        break;
+    case 2:
+        SDL_FillRect2(pixels, dst->pitch, info->color, rect->w, rect->h);
+        break;
+    case 3:
+        SDL_FillRect3(pixels, dst->pitch, info->color, rect->w, rect->h);
+        break;
+    case 4:
+        SDL_FillRect4(pixels, dst->pitch, info->color, rect->w, rect->h);
+        break;
+    }
+}
+
+/* 
+ * This function performs a fast fill of the given rectangle with 'color'
+ */
+int
+SDL_FillRect(SDL_Surface * dst, const SDL_Rect * rect, Uint32 color)
+{
+    SDL_FillInfo info;
+    SDL_Rect clipped;
+
+    if (SDL_SetupFill(dst, color, &info) < 0) {
+        return -1;
+    }
+
     /* If 'rect' == NULL, then fill the whole surface */
     if (rect) {
         /* Perform clipping */
@@ -257,81 +379,165 @@ SDL_FillRect(SDL_Surface * dst, const SDL_Rect * rect, Uint32 color)
         }
     }
 
-    /* Perform software fill */
-    if (!dst->pixels) {
-        return SDL_SetError("SDL_FillRect(): You must lock the surface");
-    }
+    SDL_FillClippedRect(dst, rect, &info);
 
-    pixels = (Uint8 *) dst->pixels + rect->y * dst->pitch +
-                                     rect->x * dst->format->BytesPerPixel;
+    /* We're done! */
+    return 0;
+}
 
-    switch (dst->format->BytesPerPixel) {
-    case 1:
-        {
-            color |= (color << 8);
-            color |= (color << 16);
-#ifdef __SSE__
-            if (SDL_HasSSE()) {
-                SDL_FillRect1SSE(pixels, dst->pitch, color, rect->w, rect->h);
-                break;
-            }
-#endif
-            SDL_FillRect1(pixels, dst->pitch, color, rect->w, rect->h);
-            break;
+static int
+SDL_CompareRectTops(const void *a, const void *b)
+{
+    return ((const SDL_Rect *) a)->y - ((const SDL_Rect *) b)->y;
+}
+
+static int
+SDL_CompareRectLefts(const void *a, const void *b)
+{
+    return ((const SDL_Rect *) a)->x - ((const SDL_Rect *) b)->x;
+}
+
+static int
+SDL_CompareInts(const void *a, const void *b)
+{
+    return *(const int *) a - *(const int *) b;
+}
+
+/* Fill the union of a set of clipped rectangles with as few spans as
+   possible.  The rectangles are cut into bands at each top and bottom
+   edge, the ranges covered within each band are merged, and bands with
+   the same ranges as the band above them are merged with it. */
+static void
+SDL_FillRectUnion(SDL_Surface * dst, SDL_Rect * rects, int count,
+                  const SDL_FillInfo * info, void *scratch)
+{
+    SDL_Rect *spans = (SDL_Rect *) scratch;
+    SDL_Rect *pending = spans + count;
+    int *active = (int *) (pending + count);
+    int *edges = active + count;
+    int i, j, next, band, num_edges, num_active, num_spans, num_pending;
+
+    SDL_qsort(rects, count, sizeof(*rects), SDL_CompareRectTops);
+    for (i = 0; i < count; ++i) {
+        edges[2 * i] = rects[i].y;
+        edges[2 * i + 1] = rects[i].y + rects[i].h;
+    }
+    SDL_qsort(edges, 2 * count, sizeof(*edges), SDL_CompareInts);
+    for (i = 1, num_edges = 1; i < 2 * count; ++i) {
+        if (edges[i] != edges[num_edges - 1]) {
+            edges[num_edges++] = edges[i];
         }
+    }
 
-    case 2:
-        {
-            color |= (color << 16);
-#ifdef __SSE__
-            if (SDL_HasSSE()) {
-                SDL_FillRect2SSE(pixels, dst->pitch, color, rect->w, rect->h);
-                break;
+    next = 0;
+    num_active = 0;
+    num_pending = 0;
+    for (band = 0; band + 1 < num_edges; ++band) {
+        const int top = edges[band];
+        const int bottom = edges[band + 1];
+
+        /* Update the rectangles crossing this band */
+        for (i = 0, j = 0; i < num_active; ++i) {
+            const SDL_Rect *r = &rects[active[i]];
+            if (r->y + r->h > top) {
+                active[j++] = active[i];
             }
-#endif
-            SDL_FillRect2(pixels, dst->pitch, color, rect->w, rect->h);
-            break;
+        }
+        num_active = j;
+        while (next < count && rects[next].y == top) {
+            active[num_active++] = next++;
         }
 
-    case 3:
-        /* 24-bit RGB is a slow path, at least for now. */
-        {
-            SDL_FillRect3(pixels, dst->pitch, color, rect->w, rect->h);
-            break;
+        /* Merge their overlapping and touching ranges */
+        for (i = 0; i < num_active; ++i) {
+            spans[i] = rects[active[i]];
+        }
+        SDL_qsort(spans, num_active, sizeof(*spans), SDL_CompareRectLefts);
+        for (i = 0, num_spans = 0; i < num_active; ++i) {
+            const int right = spans[i].x + spans[i].w;
+            SDL_Rect *last = num_spans > 0 ? &spans[num_spans - 1] : NULL;
+            if (last && spans[i].x <= last->x + last->w) {
+                if (right > last->x + last->w) {
+                    last->w = right - last->x;
+                }
+            } else {
+                spans[num_spans].x = spans[i].x;
+                spans[num_spans].w = spans[i].w;
+                spans[num_spans].y = top;
+                spans[num_spans].h = bottom - top;
+                ++num_spans;
+            }
         }
 
-    case 4:
-        {
-#ifdef __SSE__
-            if (SDL_HasSSE()) {
-                SDL_FillRect4SSE(pixels, dst->pitch, color, rect->w, rect->h);
-                break;
+        /* Grow the spans above, or fill them and start over */
+        if (num_spans == num_pending && num_pending > 0 &&
+            pending[0].y + pending[0].h == top) {
+            for (i = 0; i < num_spans; ++i) {
+                if (spans[i].x != pending[i].x || spans[i].w != pending[i].w) {
+                    break;
+                }
+            }
+            if (i == num_spans) {
+                for (i = 0; i < num_pending; ++i) {
+                    pending[i].h += bottom - top;
+                }
+                continue;
             }
-#endif
-            SDL_FillRect4(pixels, dst->pitch, color, rect->w, rect->h);
-            break;
         }
+        for (i = 0; i < num_pending; ++i) {
+            SDL_FillClippedRect(dst, &pending[i], info);
+        }
+        SDL_memcpy(pending, spans, num_spans * sizeof(*spans));
+        num_pending = num_spans;
+    }
+    for (i = 0; i < num_pending; ++i) {
+        SDL_FillClippedRect(dst, &pending[i], info);
     }
-
-    /* We're done! */
-    return 0;
 }
 
 int
 SDL_FillRects(SDL_Surface * dst, const SDL_Rect * rects, int count,
               Uint32 color)
 {
-    int i;
-    int status = 0;
+    SDL_FillInfo info;
+    SDL_Rect *clipped;
+    void *scratch;
+    int i, num_clipped;
 
     if (!rects) {
         return SDL_SetError("SDL_FillRects() passed NULL rects");
     }
+    if (SDL_SetupFill(dst, color, &info) < 0) {
+        return -1;
+    }
 
-    for (i = 0; i < count; ++i) {
-        status += SDL_FillRect(dst, &rects[i], color);
+    /* The clipped rects, then scratch space for SDL_FillRectUnion() */
+    clipped = NULL;
+    if (count > 1) {
+        clipped = (SDL_Rect *) SDL_malloc(count * (3 * sizeof(SDL_Rect) + 3 * sizeof(int)));
     }
-    return status;
+    if (!clipped) {
+        /* Fill them one at a time, overlapping parts more than once */
+        for (i = 0; i < count; ++i) {
+            SDL_Rect rect;
+            if (SDL_IntersectRect(&rects[i], &dst->clip_rect, &rect)) {
+                SDL_FillClippedRect(dst, &rect, &info);
+            }
+        }
+        return 0;
+    }
+
+    for (i = 0, num_clipped = 0; i < count; ++i) {
+        if (SDL_IntersectRect(&rects[i], &dst->clip_rect, &clipped[num_clipped])) {
+            ++num_clipped;
+        }
+    }
+    scratch = clipped + count;
+    if (num_clipped > 0) {
+        SDL_FillRectUnion(dst, clipped, num_clipped, &info, scratch);
+    }
+    SDL_free(clipped);
+    return 0;
 }
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -23,6 +23,7 @@
 /* General (mostly internal) pixel/color manipulation routines for SDL */
 
 #include "SDL_endian.h"
+#include "SDL_mutex.h"
 #include "SDL_video.h"
 #include "SDL_sysvideo.h"
 #include "SDL_blit.h"
@@ -483,19 +484,52 @@ SDL_MasksToPixelFormatEnum(int bpp, Uint32 Rmask, Uint32 Gmask, Uint32 Bmask,
 }
 
 static SDL_PixelFormat *formats;
+static SDL_RWLock *formats_lock;
 
-SDL_PixelFormat *
-SDL_AllocFormat(Uint32 pixel_format)
+/* Formats are allocated from any thread, with or without SDL_Init(), so
+   the lock protecting the cache is created on first use. */
+static SDL_RWLock *
+SDL_GetFormatsLock(void)
+{
+    SDL_RWLock *lock = (SDL_RWLock *)SDL_AtomicGetPtr((void **)&formats_lock);
+    if (!lock) {
+        lock = SDL_CreateRWLock();
+        if (lock && !SDL_AtomicCASPtr((void **)&formats_lock, NULL, lock)) {
+            SDL_DestroyRWLock(lock);
+            lock = (SDL_RWLock *)SDL_AtomicGetPtr((void **)&formats_lock);
+        }
+    }
+    return lock;
+}
+
+/* Look it up in our list of previously allocated formats */
+static SDL_PixelFormat *
+SDL_FindCachedFormat(Uint32 pixel_format)
 {
     SDL_PixelFormat *format;
 
-    /* Look it up in our list of previously allocated formats */
     for (format = formats; format; format = format->next) {
         if (pixel_format == format->format) {
-            ++format->refcount;
+            /* Other readers may be taking references at the same time */
+            SDL_AtomicIncRef((SDL_atomic_t *)&format->refcount);
             return format;
         }
     }
+    return NULL;
+}
+
+SDL_PixelFormat *
+SDL_AllocFormat(Uint32 pixel_format)
+{
+    SDL_RWLock *lock = SDL_GetFormatsLock();
+    SDL_PixelFormat *format;
+
+    SDL_LockRWLockForReading(lock);
+    format = SDL_FindCachedFormat(pixel_format);
+    SDL_UnlockRWLock(lock);
+    if (format) {
+        return format;
+    }
 
     /* Allocate an empty pixel format structure, and initialize it */
     format = SDL_malloc(sizeof(*format));
@@ -510,9 +544,21 @@ SDL_AllocFormat(Uint32 pixel_format)
     }
 
     if (!SDL_ISPIXELFORMAT_INDEXED(pixel_format)) {
-        /* Cache the RGB formats */
-        format->next = formats;
-        formats = format;
+        SDL_PixelFormat *cached;
+
+        /* Cache the RGB formats, unless another thread just beat us to it */
+        SDL_LockRWLockForWriting(lock);
+        cached = SDL_FindCachedFormat(pixel_format);
+        if (!cached) {
+            format->next = formats;
+            formats = format;
+        }
+        SDL_UnlockRWLock(lock);
+
+        if (cached) {
+            SDL_free(format);
+            format = cached;
+        }
     }
     return format;
 }
@@ -585,13 +631,19 @@ SDL_InitFormat(SDL_PixelFormat * format, Uint32 pixel_format)
 void
 SDL_FreeFormat(SDL_PixelFormat *format)
 {
+    SDL_RWLock *lock;
     SDL_PixelFormat *prev;
 
     if (!format) {
         SDL_InvalidParamError("format");
         return;
     }
+
+    /* Holding the write lock keeps readers from reviving it meanwhile */
+    lock = SDL_GetFormatsLock();
+    SDL_LockRWLockForWriting(lock);
     if (--format->refcount > 0) {
+        SDL_UnlockRWLock(lock);
         return;
     }
 
@@ -606,6 +658,7 @@ SDL_FreeFormat(SDL_PixelFormat *format)
             }
         }
     }
+    SDL_UnlockRWLock(lock);
 
     if (format->palette) {
         SDL_FreePalette(format->palette);
@@ -970,12 +1023,10 @@ SDL_AllocBlitMap(void)
     return (map);
 }
 
-void
-SDL_InvalidateMap(SDL_BlitMap * map)
+/* Drop the current mapping, but keep the cached ones */
+static void
+SDL_ReleaseMapping(SDL_BlitMap * map)
 {
-    if (!map) {
-        return;
-    }
     if (map->dst) {
         /* Release our reference to the surface - see the note below */
         if (--map->dst->refcount <= 0) {
@@ -989,6 +1040,152 @@ SDL_InvalidateMap(SDL_BlitMap * map)
     map->info.table = NULL;
 }
 
+static void
+SDL_FreeMappingCache(SDL_BlitMapCache * entry)
+{
+    if (entry->dst_palette) {
+        SDL_FreePalette(entry->dst_palette);
+    }
+    SDL_FreeFormat(entry->dst_fmt);
+    SDL_free(entry->table);
+}
+
+/* Move the current mapping into the cache, as the most recently used */
+static void
+SDL_StashMapping(SDL_BlitMap * map)
+{
+    SDL_BlitMapCache *entry;
+    SDL_PixelFormat *dstfmt;
+    SDL_RWLock *lock;
+
+    /* RLE data is encoded for its destination, so it isn't worth keeping */
+    if (!map->dst || !map->data || (map->info.flags & SDL_COPY_RLE_MASK)) {
+        SDL_ReleaseMapping(map);
+        return;
+    }
+
+    if (map->num_cached == SDL_BLITMAP_CACHE_SIZE) {
+        SDL_FreeMappingCache(&map->cache[--map->num_cached]);
+    }
+    SDL_memmove(&map->cache[1], &map->cache[0],
+                map->num_cached * sizeof(map->cache[0]));
+    ++map->num_cached;
+
+    /* Hold the format and palette, so their addresses can't be reused */
+    dstfmt = map->dst->format;
+    lock = SDL_GetFormatsLock();
+    SDL_LockRWLockForReading(lock);
+    SDL_AtomicIncRef((SDL_atomic_t *)&dstfmt->refcount);
+    SDL_UnlockRWLock(lock);
+
+    entry = &map->cache[0];
+    entry->dst_fmt = dstfmt;
+    entry->dst_palette = dstfmt->palette;
+    if (entry->dst_palette) {
+        ++entry->dst_palette->refcount;
+    }
+    entry->dst_palette_version = map->dst_palette_version;
+    entry->src_palette_version = map->src_palette_version;
+    entry->flags = map->info.flags;
+    entry->r = map->info.r;
+    entry->g = map->info.g;
+    entry->b = map->info.b;
+    entry->a = map->info.a;
+    entry->identity = map->identity;
+    entry->blit = map->blit;
+    entry->func = (SDL_BlitFunc) map->data;
+    entry->table = map->info.table;
+    map->info.table = NULL;
+
+    SDL_ReleaseMapping(map);
+}
+
+/* Make a cached mapping to dst current again, if there is one */
+static SDL_bool
+SDL_RestoreMapping(SDL_Surface * src, SDL_Surface * dst)
+{
+    SDL_BlitMap *map = src->map;
+    SDL_PixelFormat *srcfmt = src->format;
+    SDL_PixelFormat *dstfmt = dst->format;
+    SDL_BlitMapCache entry;
+    int i;
+
+    for (i = 0; i < map->num_cached; ++i) {
+        const SDL_BlitMapCache *cached = &map->cache[i];
+        if (cached->dst_fmt != dstfmt ||
+            cached->dst_palette != dstfmt->palette ||
+            cached->flags != map->info.flags) {
+            continue;
+        }
+        if (dstfmt->palette &&
+            cached->dst_palette_version != dstfmt->palette->version) {
+            continue;
+        }
+        if (srcfmt->palette &&
+            cached->src_palette_version != srcfmt->palette->version) {
+            continue;
+        }
+        /* Palette to RGB tables have the color modulation baked in */
+        if (SDL_ISPIXELFORMAT_INDEXED(srcfmt->format) &&
+            (cached->r != map->info.r || cached->g != map->info.g ||
+             cached->b != map->info.b || cached->a != map->info.a)) {
+            continue;
+        }
+        break;
+    }
+    if (i == map->num_cached) {
+        return SDL_FALSE;
+    }
+
+    entry = map->cache[i];
+    --map->num_cached;
+    SDL_memmove(&map->cache[i], &map->cache[i + 1],
+                (map->num_cached - i) * sizeof(map->cache[0]));
+
+    map->dst = dst;
+    ++dst->refcount;
+    map->identity = entry.identity;
+    map->info.table = entry.table;
+    map->dst_palette_version = entry.dst_palette_version;
+    map->src_palette_version = entry.src_palette_version;
+    map->blit = entry.blit;
+    map->data = entry.func;
+    map->info.src_fmt = srcfmt;
+    map->info.src_pitch = src->pitch;
+    map->info.dst_fmt = dstfmt;
+    map->info.dst_pitch = dst->pitch;
+
+    /* The mapping keeps dst alive now, not the format and palette */
+    entry.table = NULL;
+    SDL_FreeMappingCache(&entry);
+    return SDL_TRUE;
+}
+
+void
+SDL_InvalidateMap(SDL_BlitMap * map)
+{
+    if (!map) {
+        return;
+    }
+    SDL_ReleaseMapping(map);
+    while (map->num_cached > 0) {
+        SDL_FreeMappingCache(&map->cache[--map->num_cached]);
+    }
+}
+
+/* Change copy flags that only select a different blit function, such as
+   SDL_COPY_NEAREST. The current mapping stays cached for the old flags,
+   so switching back and forth doesn't recalculate the blit each time.
+ */
+void
+SDL_SwitchMapFlags(SDL_BlitMap * map, int flags)
+{
+    if (map->info.flags != flags) {
+        SDL_StashMapping(map);
+        map->info.flags = flags;
+    }
+}
+
 int
 SDL_MapSurface(SDL_Surface * src, SDL_Surface * dst)
 {
@@ -996,12 +1193,15 @@ SDL_MapSurface(SDL_Surface * src, SDL_Surface * dst)
     SDL_PixelFormat *dstfmt;
     SDL_BlitMap *map;
 
-    /* Clear out any previous mapping */
+    /* Set aside the previous mapping, we may switch back to it */
     map = src->map;
     if ((src->flags & SDL_RLEACCEL) == SDL_RLEACCEL) {
-        SDL_UnRLESurface(src, 1);
+        SDL_UnRLESurface(src);
+    }
+    SDL_StashMapping(map);
+    if (SDL_RestoreMapping(src, dst)) {
+        return 0;
     }
-    SDL_InvalidateMap(map);
 
     /* Figure out what kind of mapping we're doing */
     map->identity = 0;
@@ -1080,6 +1280,7 @@ SDL_FreeBlitMap(SDL_BlitMap * map)
 {
     if (map) {
         SDL_InvalidateMap(map);
+        SDL_FreeSurface(map->scratch);
         SDL_free(map);
     }
 }
@@ -30,6 +30,7 @@ extern int SDL_InitFormat(SDL_PixelFormat * format, Uint32 pixel_format);
 /* Blit mapping functions */
 extern SDL_BlitMap *SDL_AllocBlitMap(void);
 extern void SDL_InvalidateMap(SDL_BlitMap * map);
+extern void SDL_SwitchMapFlags(SDL_BlitMap * map, int flags);
 extern int SDL_MapSurface(SDL_Surface * src, SDL_Surface * dst);
 extern void SDL_FreeBlitMap(SDL_BlitMap * map);
 
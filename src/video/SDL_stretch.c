@@ -28,6 +28,8 @@
 
 #include "SDL_video.h"
 #include "SDL_blit.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_blit_simd.h"
 
 /* This isn't ready for general consumption yet - it should be folded
    into the general blitting mechanism.
@@ -350,4 +352,314 @@ SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
     return (0);
 }
 
+/* The filtered stretch works on each axis separately: each destination
+   row is a weighted sum of source rows, and each destination pixel a
+   weighted sum of pixels in that row.  The weights are fixed point and
+   add up to exactly STRETCH_ONE for every destination pixel.
+ */
+#define STRETCH_BITS    14
+#define STRETCH_ONE     (1 << STRETCH_BITS)
+#define STRETCH_HALF    (1 << (STRETCH_BITS - 1))
+
+typedef struct
+{
+    int taps;           /* weights stored per destination pixel */
+    int *first;         /* first source pixel of each destination pixel */
+    int *count;         /* number of source pixels used by each one */
+    Uint16 *weights;    /* 'taps' weights for each destination pixel */
+} SDL_StretchFilter;
+
+static int
+SDL_StretchFilterTaps(int src_len, int dst_len)
+{
+    if (dst_len >= src_len) {
+        return 2;
+    }
+    return (src_len / dst_len) + 2;
+}
+
+/* Bilinear when enlarging, the average over the covered area when
+   shrinking.  The storage comes from the caller. */
+static void
+SDL_InitStretchFilter(SDL_StretchFilter * filter, int src_len, int dst_len)
+{
+    int i, j;
+
+    for (i = 0; i < dst_len; ++i) {
+        Uint16 *weights = &filter->weights[i * filter->taps];
+
+        if (dst_len >= src_len) {
+            /* Sample at the pixel center, in 16.16 source coordinates */
+            Sint64 pos = ((Sint64)(2 * i + 1) * src_len * 0x10000) / (2 * dst_len) - 0x8000;
+            int x, frac, weight;
+
+            if (pos < 0) {
+                pos = 0;
+            }
+            x = (int)(pos >> 16);
+            frac = (int)(pos & 0xFFFF);
+            if (x >= src_len - 1) {
+                x = src_len - 1;
+                frac = 0;
+            }
+            weight = (frac * STRETCH_ONE + 0x8000) >> 16;
+
+            filter->first[i] = x;
+            if (weight == 0) {
+                filter->count[i] = 1;
+                weights[0] = STRETCH_ONE;
+            } else {
+                filter->count[i] = 2;
+                weights[0] = (Uint16)(STRETCH_ONE - weight);
+                weights[1] = (Uint16)weight;
+            }
+        } else {
+            /* Scaled by dst_len, source pixel j covers [j*dst_len, (j+1)*dst_len)
+               and destination pixel i covers [i*src_len, (i+1)*src_len) */
+            const Sint64 left = (Sint64)i * src_len;
+            const Sint64 right = left + src_len;
+            const int first = (int)(left / dst_len);
+            const int last = (int)((right - 1) / dst_len);
+            int prev = 0;
+
+            filter->first[i] = first;
+            filter->count[i] = last - first + 1;
+            for (j = first; j <= last; ++j) {
+                /* Round the running total rather than each weight, so the
+                   weights can't go negative and still add up exactly */
+                const Sint64 covered = SDL_min(right, (Sint64)(j + 1) * dst_len) - left;
+                const int total = (int)((covered * STRETCH_ONE + src_len / 2) / src_len);
+
+                weights[j - first] = (Uint16)(total - prev);
+                prev = total;
+            }
+        }
+    }
+}
+
+/* Combine 'count' source rows into one row of 'len' bytes */
+static void
+SDL_StretchRowsLinear(const Uint8 * src, int pitch, int len, int count,
+                      const Uint16 * weights, Uint8 * dst)
+{
+    int i = 0, k;
+
+#if HAVE_SSE2_BLITTERS
+    if (SDL_GetBlitCPUFeatures() & SDL_CPU_SSE2) {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i half = _mm_set1_epi32(STRETCH_HALF);
+
+        for ( ; i + 16 <= len; i += 16) {
+            __m128i acc0 = zero, acc1 = zero, acc2 = zero, acc3 = zero;
+
+            for (k = 0; k < count; k += 2) {
+                const __m128i a = _mm_loadu_si128((const __m128i *)(src + k * pitch + i));
+                const __m128i b = (k + 1 < count) ? _mm_loadu_si128((const __m128i *)(src + (k + 1) * pitch + i)) : zero;
+                const __m128i w = _mm_set1_epi32(weights[k] | ((k + 1 < count) ? (weights[k + 1] << 16) : 0));
+                const __m128i a_lo = _mm_unpacklo_epi8(a, zero), a_hi = _mm_unpackhi_epi8(a, zero);
+                const __m128i b_lo = _mm_unpacklo_epi8(b, zero), b_hi = _mm_unpackhi_epi8(b, zero);
+
+                acc0 = _mm_add_epi32(acc0, _mm_madd_epi16(_mm_unpacklo_epi16(a_lo, b_lo), w));
+                acc1 = _mm_add_epi32(acc1, _mm_madd_epi16(_mm_unpackhi_epi16(a_lo, b_lo), w));
+                acc2 = _mm_add_epi32(acc2, _mm_madd_epi16(_mm_unpacklo_epi16(a_hi, b_hi), w));
+                acc3 = _mm_add_epi32(acc3, _mm_madd_epi16(_mm_unpackhi_epi16(a_hi, b_hi), w));
+            }
+            acc0 = _mm_srai_epi32(_mm_add_epi32(acc0, half), STRETCH_BITS);
+            acc1 = _mm_srai_epi32(_mm_add_epi32(acc1, half), STRETCH_BITS);
+            acc2 = _mm_srai_epi32(_mm_add_epi32(acc2, half), STRETCH_BITS);
+            acc3 = _mm_srai_epi32(_mm_add_epi32(acc3, half), STRETCH_BITS);
+            _mm_storeu_si128((__m128i *)(dst + i),
+                             _mm_packus_epi16(_mm_packs_epi32(acc0, acc1),
+                                              _mm_packs_epi32(acc2, acc3)));
+        }
+    }
+#endif
+    for ( ; i < len; ++i) {
+        Uint32 acc = 0;
+
+        for (k = 0; k < count; ++k) {
+            acc += src[k * pitch + i] * weights[k];
+        }
+        dst[i] = (Uint8)((acc + STRETCH_HALF) >> STRETCH_BITS);
+    }
+}
+
+/* Filter one row of 32-bit pixels horizontally */
+static void
+SDL_StretchRowLinear(const Uint32 * src, const SDL_StretchFilter * filter,
+                     Uint32 * dst, int dst_w)
+{
+    int i = 0, k;
+
+#if HAVE_SSE2_BLITTERS
+    if (SDL_GetBlitCPUFeatures() & SDL_CPU_SSE2) {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i half = _mm_set1_epi32(STRETCH_HALF);
+
+        for ( ; i < dst_w; ++i) {
+            const Uint32 *pixels = src + filter->first[i];
+            const Uint16 *weights = &filter->weights[i * filter->taps];
+            const int count = filter->count[i];
+            __m128i acc = zero;
+
+            for (k = 0; k + 1 < count; k += 2) {
+                /* Interleave the channels of the two pixels to pair them with their weights */
+                __m128i p = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(pixels + k)), zero);
+                p = _mm_unpacklo_epi16(p, _mm_srli_si128(p, 8));
+                acc = _mm_add_epi32(acc, _mm_madd_epi16(p, _mm_set1_epi32(weights[k] | (weights[k + 1] << 16))));
+            }
+            if (k < count) {
+                __m128i p = _mm_unpacklo_epi8(_mm_cvtsi32_si128(pixels[k]), zero);
+                p = _mm_unpacklo_epi16(p, zero);
+                acc = _mm_add_epi32(acc, _mm_madd_epi16(p, _mm_set1_epi32(weights[k])));
+            }
+            acc = _mm_srai_epi32(_mm_add_epi32(acc, half), STRETCH_BITS);
+            acc = _mm_packs_epi32(acc, acc);
+            dst[i] = (Uint32)_mm_cvtsi128_si32(_mm_packus_epi16(acc, acc));
+        }
+    }
+#endif
+    for ( ; i < dst_w; ++i) {
+        const Uint8 *pixels = (const Uint8 *)(src + filter->first[i]);
+        const Uint16 *weights = &filter->weights[i * filter->taps];
+        const int count = filter->count[i];
+        Uint8 *pixel = (Uint8 *)&dst[i];
+        int c;
+
+        for (c = 0; c < 4; ++c) {
+            Uint32 acc = 0;
+
+            for (k = 0; k < count; ++k) {
+                acc += pixels[k * 4 + c] * weights[k];
+            }
+            pixel[c] = (Uint8)((acc + STRETCH_HALF) >> STRETCH_BITS);
+        }
+    }
+}
+
+/* Perform a filtered stretch blit between two 8888 surfaces of the same format */
+int
+SDL_SoftStretchLinear(SDL_Surface * src, const SDL_Rect * srcrect,
+                      SDL_Surface * dst, const SDL_Rect * dstrect)
+{
+    int src_locked;
+    int dst_locked;
+    int taps_x, taps_y;
+    int y;
+    size_t size;
+    Uint8 *buffer;
+    Uint32 *row;
+    SDL_StretchFilter filter_x, filter_y;
+    SDL_Rect full_src;
+    SDL_Rect full_dst;
+
+    if (src->format->format != dst->format->format) {
+        return SDL_SetError("Only works with same format surfaces");
+    }
+    if (SDL_PIXELLAYOUT(src->format->format) != SDL_PACKEDLAYOUT_8888) {
+        return SDL_SetError("Only works with 8 bits per channel 32-bit surfaces");
+    }
+
+    /* Verify the blit rectangles */
+    if (srcrect) {
+        if ((srcrect->x < 0) || (srcrect->y < 0) ||
+            ((srcrect->x + srcrect->w) > src->w) ||
+            ((srcrect->y + srcrect->h) > src->h)) {
+            return SDL_SetError("Invalid source blit rectangle");
+        }
+    } else {
+        full_src.x = 0;
+        full_src.y = 0;
+        full_src.w = src->w;
+        full_src.h = src->h;
+        srcrect = &full_src;
+    }
+    if (dstrect) {
+        if ((dstrect->x < 0) || (dstrect->y < 0) ||
+            ((dstrect->x + dstrect->w) > dst->w) ||
+            ((dstrect->y + dstrect->h) > dst->h)) {
+            return SDL_SetError("Invalid destination blit rectangle");
+        }
+    } else {
+        full_dst.x = 0;
+        full_dst.y = 0;
+        full_dst.w = dst->w;
+        full_dst.h = dst->h;
+        dstrect = &full_dst;
+    }
+    if (srcrect->w <= 0 || srcrect->h <= 0 || dstrect->w <= 0 || dstrect->h <= 0) {
+        return 0;
+    }
+
+    /* Set up the filters and a row for the vertical pass */
+    taps_x = SDL_StretchFilterTaps(srcrect->w, dstrect->w);
+    taps_y = SDL_StretchFilterTaps(srcrect->h, dstrect->h);
+    size = (size_t)dstrect->w * (2 * sizeof(int) + taps_x * sizeof(Uint16)) +
+           (size_t)dstrect->h * (2 * sizeof(int) + taps_y * sizeof(Uint16)) +
+           (size_t)srcrect->w * sizeof(Uint32);
+    buffer = (Uint8 *)SDL_malloc(size);
+    if (!buffer) {
+        return SDL_OutOfMemory();
+    }
+    row = (Uint32 *)buffer;
+    filter_x.first = (int *)(row + srcrect->w);
+    filter_x.count = filter_x.first + dstrect->w;
+    filter_y.first = filter_x.count + dstrect->w;
+    filter_y.count = filter_y.first + dstrect->h;
+    filter_x.weights = (Uint16 *)(filter_y.count + dstrect->h);
+    filter_y.weights = filter_x.weights + dstrect->w * taps_x;
+    filter_x.taps = taps_x;
+    filter_y.taps = taps_y;
+    SDL_InitStretchFilter(&filter_x, srcrect->w, dstrect->w);
+    SDL_InitStretchFilter(&filter_y, srcrect->h, dstrect->h);
+
+    /* Lock the destination if it's in hardware */
+    dst_locked = 0;
+    if (SDL_MUSTLOCK(dst)) {
+        if (SDL_LockSurface(dst) < 0) {
+            SDL_free(buffer);
+            return SDL_SetError("Unable to lock destination surface");
+        }
+        dst_locked = 1;
+    }
+    /* Lock the source if it's in hardware */
+    src_locked = 0;
+    if (SDL_MUSTLOCK(src)) {
+        if (SDL_LockSurface(src) < 0) {
+            if (dst_locked) {
+                SDL_UnlockSurface(dst);
+            }
+            SDL_free(buffer);
+            return SDL_SetError("Unable to lock source surface");
+        }
+        src_locked = 1;
+    }
+
+    for (y = 0; y < dstrect->h; ++y) {
+        const Uint8 *srcp = (const Uint8 *)src->pixels +
+            (srcrect->y + filter_y.first[y]) * src->pitch + srcrect->x * 4;
+        Uint32 *dstp = (Uint32 *)((Uint8 *)dst->pixels +
+            (dstrect->y + y) * dst->pitch + dstrect->x * 4);
+
+        if (filter_y.count[y] == 1) {
+            SDL_StretchRowLinear((const Uint32 *)srcp, &filter_x, dstp, dstrect->w);
+        } else {
+            SDL_StretchRowsLinear(srcp, src->pitch, srcrect->w * 4,
+                                  filter_y.count[y], &filter_y.weights[y * taps_y],
+                                  (Uint8 *)row);
+            SDL_StretchRowLinear(row, &filter_x, dstp, dstrect->w);
+        }
+    }
+
+    /* We need to unlock the surfaces if they're locked */
+    if (dst_locked) {
+        SDL_UnlockSurface(dst);
+    }
+    if (src_locked) {
+        SDL_UnlockSurface(src);
+    }
+    SDL_free(buffer);
+    return 0;
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
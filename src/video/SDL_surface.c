@@ -25,6 +25,7 @@
 #include "SDL_blit.h"
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
+#include "SDL_yuv_c.h"
 
 /* Public routines */
 /*
@@ -453,6 +454,55 @@ SDL_GetSurfaceBlendMode(SDL_Surface * surface, SDL_BlendMode *blendMode)
     return 0;
 }
 
+int
+SDL_SetSurfaceScaleMode(SDL_Surface * surface, SDL_ScaleMode scaleMode)
+{
+    int flags, status;
+
+    if (!surface) {
+        return -1;
+    }
+
+    status = 0;
+    flags = surface->map->info.flags;
+    switch (scaleMode) {
+    case SDL_SCALEMODE_NEAREST:
+        surface->map->info.flags &= ~SDL_COPY_LINEAR;
+        break;
+    case SDL_SCALEMODE_LINEAR:
+        surface->map->info.flags |= SDL_COPY_LINEAR;
+        break;
+    default:
+        status = SDL_Unsupported();
+        break;
+    }
+
+    if (surface->map->info.flags != flags) {
+        SDL_InvalidateMap(surface->map);
+    }
+
+    return status;
+}
+
+int
+SDL_GetSurfaceScaleMode(SDL_Surface * surface, SDL_ScaleMode *scaleMode)
+{
+    if (!surface) {
+        return -1;
+    }
+
+    if (!scaleMode) {
+        return 0;
+    }
+
+    if (surface->map->info.flags & SDL_COPY_LINEAR) {
+        *scaleMode = SDL_SCALEMODE_LINEAR;
+    } else {
+        *scaleMode = SDL_SCALEMODE_NEAREST;
+    }
+    return 0;
+}
+
 SDL_bool
 SDL_SetClipRect(SDL_Surface * surface, const SDL_Rect * rect)
 {
@@ -602,8 +652,7 @@ SDL_UpperBlit(SDL_Surface * src, const SDL_Rect * srcrect,
 
     /* Switch back to a fast blit if we were previously stretching */
     if (src->map->info.flags & SDL_COPY_NEAREST) {
-        src->map->info.flags &= ~SDL_COPY_NEAREST;
-        SDL_InvalidateMap(src->map);
+        SDL_SwitchMapFlags(src->map, src->map->info.flags & ~SDL_COPY_NEAREST);
     }
 
     if (w > 0 && h > 0) {
@@ -782,16 +831,71 @@ SDL_LowerBlitScaled(SDL_Surface * src, SDL_Rect * srcrect,
         SDL_COPY_COLORKEY
     );
 
-    if (!(src->map->info.flags & SDL_COPY_NEAREST)) {
-        src->map->info.flags |= SDL_COPY_NEAREST;
-        SDL_InvalidateMap(src->map);
+    /* Filtering would blur the color key, so those are never filtered.
+       The filter works on bytes, so only 8 bits per channel are filtered. */
+    if ( (src->map->info.flags & SDL_COPY_LINEAR) &&
+         !(src->map->info.flags & SDL_COPY_COLORKEY) &&
+         SDL_PIXELLAYOUT(src->format->format) == SDL_PACKEDLAYOUT_8888 ) {
+        SDL_Surface *tmp = src->map->scratch;
+        SDL_Rect tmprect;
+        Uint32 flags;
+
+        if ( !(src->map->info.flags & complex_copy_flags) &&
+             src->format->format == dst->format->format ) {
+            return SDL_SoftStretchLinear( src, srcrect, dst, dstrect );
+        }
+
+        /* Filter into a scratch surface kept with the blit map, and blit
+           that the way src would be */
+        if (!tmp || tmp->w < dstrect->w || tmp->h < dstrect->h) {
+            int w = dstrect->w;
+            int h = dstrect->h;
+
+            if (tmp) {
+                w = SDL_max(w, tmp->w);
+                h = SDL_max(h, tmp->h);
+                SDL_FreeSurface(tmp);
+                src->map->scratch = NULL;
+            }
+            tmp = SDL_CreateRGBSurface(0, w, h, 32,
+                                       src->format->Rmask, src->format->Gmask,
+                                       src->format->Bmask, src->format->Amask);
+            if (!tmp) {
+                return -1;
+            }
+            src->map->scratch = tmp;
+        }
+
+        tmprect.x = 0;
+        tmprect.y = 0;
+        tmprect.w = dstrect->w;
+        tmprect.h = dstrect->h;
+        if (SDL_SoftStretchLinear( src, srcrect, tmp, &tmprect ) < 0) {
+            return -1;
+        }
+
+        flags = (src->map->info.flags & complex_copy_flags);
+        if (tmp->map->info.flags != flags) {
+            /* The blit function depends on the flags */
+            SDL_InvalidateMap(tmp->map);
+            tmp->map->info.flags = flags;
+        }
+        tmp->map->info.r = src->map->info.r;
+        tmp->map->info.g = src->map->info.g;
+        tmp->map->info.b = src->map->info.b;
+        tmp->map->info.a = src->map->info.a;
+        return SDL_LowerBlit( tmp, &tmprect, dst, dstrect );
     }
 
     if ( !(src->map->info.flags & complex_copy_flags) &&
          src->format->format == dst->format->format &&
          !SDL_ISPIXELFORMAT_INDEXED(src->format->format) ) {
+        /* This doesn't use the blit map, so leave its flags alone */
         return SDL_SoftStretch( src, srcrect, dst, dstrect );
     } else {
+        if (!(src->map->info.flags & SDL_COPY_NEAREST)) {
+            SDL_SwitchMapFlags(src->map, src->map->info.flags | SDL_COPY_NEAREST);
+        }
         return SDL_LowerBlit( src, srcrect, dst, dstrect );
     }
 }
@@ -802,13 +906,8 @@ SDL_LowerBlitScaled(SDL_Surface * src, SDL_Rect * srcrect,
 int
 SDL_LockSurface(SDL_Surface * surface)
 {
-    if (!surface->locked) {
-        /* Perform the lock */
-        if (surface->flags & SDL_RLEACCEL) {
-            SDL_UnRLESurface(surface, 1);
-            surface->flags |= SDL_RLEACCEL;     /* save accel'd state */
-        }
-    }
+    /* RLE accelerated surfaces keep their pixels, so there is nothing to
+       do until the surface is unlocked again */
 
     /* Increment the surface lock count, for recursive locks */
     ++surface->locked;
@@ -828,11 +927,9 @@ SDL_UnlockSurface(SDL_Surface * surface)
         return;
     }
 
-    /* Update RLE encoded surface with new data */
-    if ((surface->flags & SDL_RLEACCEL) == SDL_RLEACCEL) {
-        surface->flags &= ~SDL_RLEACCEL;        /* stop lying */
-        SDL_RLESurface(surface);
-    }
+    /* Any of the pixels may have changed, the RLE encoding is updated
+       the next time the surface is blitted */
+    SDL_RLEInvalidateRows(surface, 0, surface->h);
 }
 
 /*
@@ -1091,6 +1188,14 @@ int SDL_ConvertPixels(int width, int height,
         return 0;
     }
 
+    if (SDL_ISPIXELFORMAT_FOURCC(src_format) && SDL_ISPIXELFORMAT_FOURCC(dst_format)) {
+        return SDL_SetError("Can't convert between different YUV formats");
+    } else if (SDL_ISPIXELFORMAT_FOURCC(src_format)) {
+        return SDL_ConvertPixels_YUV_to_RGB(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
+    } else if (SDL_ISPIXELFORMAT_FOURCC(dst_format)) {
+        return SDL_ConvertPixels_RGB_to_YUV(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
+    }
+
     if (!SDL_CreateSurfaceOnStack(width, height, src_format, nonconst_src,
                                   src_pitch,
                                   &src_surface, &src_fmt, &src_blitmap)) {
@@ -1128,7 +1233,7 @@ SDL_FreeSurface(SDL_Surface * surface)
         SDL_UnlockSurface(surface);
     }
     if (surface->flags & SDL_RLEACCEL) {
-        SDL_UnRLESurface(surface, 0);
+        SDL_UnRLESurface(surface);
     }
     if (surface->format) {
         SDL_SetSurfacePalette(surface, NULL);
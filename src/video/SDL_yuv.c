@@ -0,0 +1,846 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2014 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#include "SDL_video.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_blit.h"
+#include "SDL_blit_simd.h"
+#include "SDL_yuv_c.h"
+
+/* Conversions between the YUV formats and the 32-bit RGB formats.
+
+   All of the math is fixed point, and the vector versions compute exactly
+   what the C versions do, so the results don't depend on the CPU.  Other
+   RGB formats go through ARGB8888 and the regular blitters.
+ */
+
+static SDL_YUV_CONVERSION_MODE SDL_YUV_ConversionMode = SDL_YUV_CONVERSION_BT601;
+
+/* Content taller than this is considered HD for SDL_YUV_CONVERSION_AUTOMATIC */
+#define SDL_YUV_SD_THRESHOLD    576
+
+void
+SDL_SetYUVConversionMode(SDL_YUV_CONVERSION_MODE mode)
+{
+    SDL_YUV_ConversionMode = mode;
+}
+
+SDL_YUV_CONVERSION_MODE
+SDL_GetYUVConversionMode(void)
+{
+    return SDL_YUV_ConversionMode;
+}
+
+SDL_YUV_CONVERSION_MODE
+SDL_GetYUVConversionModeForResolution(int width, int height)
+{
+    SDL_YUV_CONVERSION_MODE mode = SDL_GetYUVConversionMode();
+    if (mode == SDL_YUV_CONVERSION_AUTOMATIC) {
+        if (height <= SDL_YUV_SD_THRESHOLD) {
+            mode = SDL_YUV_CONVERSION_BT601;
+        } else {
+            mode = SDL_YUV_CONVERSION_BT709;
+        }
+    }
+    return mode;
+}
+
+/* YUV to RGB, Q13 coefficients:
+     R = y_scale * (Y - y_offset)                       + v_r * (V - 128)
+     G = y_scale * (Y - y_offset) + u_g * (U - 128)     + v_g * (V - 128)
+     B = y_scale * (Y - y_offset) + u_b * (U - 128)
+ */
+typedef struct
+{
+    Sint16 y_offset;
+    Sint16 y_scale, v_r, u_g, v_g, u_b;
+} YUVToRGBMatrix;
+
+/* RGB to YUV, Q15 coefficients, each row summing to the range of Y or 0:
+     Y = y_r * R + y_g * G + y_b * B + y_offset
+     U = u_r * R + u_g * G + u_b * B + 128
+     V = v_r * R + v_g * G + v_b * B + 128
+ */
+typedef struct
+{
+    Sint16 y_offset;
+    Sint16 y_r, y_g, y_b;
+    Sint16 u_r, u_g, u_b;
+    Sint16 v_r, v_g, v_b;
+} RGBToYUVMatrix;
+
+/* Indexed by SDL_YUV_CONVERSION_MODE */
+static const YUVToRGBMatrix SDL_YUVToRGBMatrices[] = {
+    {  0, 8192, 11485, -2819, -5850, 14516 },   /* JPEG, BT.601 full range */
+    { 16, 9539, 13075, -3209, -6660, 16525 },   /* BT.601 */
+    { 16, 9539, 14686, -1747, -4366, 17305 }    /* BT.709 */
+};
+
+static const RGBToYUVMatrix SDL_RGBToYUVMatrices[] = {
+    {  0, 9798, 19234, 3736, -5529, -10855, 16384, 16384, -13720, -2664 },
+    { 16, 8414, 16520, 3208, -4857,  -9535, 14392, 14392, -12051, -2341 },
+    { 16, 5983, 20127, 2032, -3298, -11094, 14392, 14392, -13072, -1320 }
+};
+
+#define YUV_PLANAR      0   /* separate Y, U and V planes */
+#define YUV_SEMIPLANAR  1   /* a Y plane and an interleaved U and V plane */
+#define YUV_PACKED      2   /* Y, U and V interleaved in 4:2:2 macropixels */
+
+/* Where the samples of a YUV image are */
+typedef struct
+{
+    int layout;
+    int chroma_rows;            /* rows sharing each row of U and V samples */
+    Uint8 *y_plane, *u_plane, *v_plane;
+    int y_pitch, uv_pitch;
+    int y_pos, u_pos, v_pos;    /* byte offset of each sample in its group */
+    int y_step, uv_step;        /* bytes from one sample to the next */
+} YUVPlanes;
+
+static int
+GetYUVPlanes(int width, int height, Uint32 format, const void *pixels,
+             int pitch, YUVPlanes *planes)
+{
+    Uint8 *first = (Uint8 *) pixels + pitch * height;
+
+    SDL_zerop(planes);
+    planes->y_plane = (Uint8 *) pixels;
+    planes->y_pitch = pitch;
+
+    switch (format) {
+    case SDL_PIXELFORMAT_YV12:
+    case SDL_PIXELFORMAT_IYUV:
+        planes->layout = YUV_PLANAR;
+        planes->chroma_rows = 2;
+        planes->uv_pitch = (pitch + 1) / 2;
+        planes->u_plane = first;
+        planes->v_plane = first + planes->uv_pitch * ((height + 1) / 2);
+        if (format == SDL_PIXELFORMAT_YV12) {
+            planes->v_plane = first;
+            planes->u_plane = first + planes->uv_pitch * ((height + 1) / 2);
+        }
+        planes->y_step = 1;
+        planes->uv_step = 1;
+        break;
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+        planes->layout = YUV_SEMIPLANAR;
+        planes->chroma_rows = 2;
+        planes->uv_pitch = pitch;
+        planes->u_plane = planes->v_plane = first;
+        planes->u_pos = (format == SDL_PIXELFORMAT_NV12) ? 0 : 1;
+        planes->v_pos = 1 - planes->u_pos;
+        planes->y_step = 1;
+        planes->uv_step = 2;
+        break;
+    case SDL_PIXELFORMAT_YUY2:
+    case SDL_PIXELFORMAT_UYVY:
+    case SDL_PIXELFORMAT_YVYU:
+        planes->layout = YUV_PACKED;
+        planes->chroma_rows = 1;
+        planes->uv_pitch = pitch;
+        planes->u_plane = planes->v_plane = planes->y_plane;
+        if (format == SDL_PIXELFORMAT_YUY2) {
+            planes->y_pos = 0;
+            planes->u_pos = 1;
+            planes->v_pos = 3;
+        } else if (format == SDL_PIXELFORMAT_UYVY) {
+            planes->u_pos = 0;
+            planes->y_pos = 1;
+            planes->v_pos = 2;
+        } else {
+            planes->y_pos = 0;
+            planes->v_pos = 1;
+            planes->u_pos = 3;
+        }
+        planes->y_step = 2;
+        planes->uv_step = 4;
+        break;
+    default:
+        return SDL_SetError("Unsupported YUV format");
+    }
+    return 0;
+}
+
+/* Find the channels of a 32-bit format with 8-bit red, green and blue */
+static SDL_bool
+GetRGBShifts(Uint32 format, int *r_shift, int *g_shift, int *b_shift,
+             Uint32 *alpha)
+{
+    int bpp;
+    Uint32 Rmask, Gmask, Bmask, Amask;
+
+    if (!SDL_PixelFormatEnumToMasks(format, &bpp, &Rmask, &Gmask, &Bmask, &Amask) ||
+        bpp != 32) {
+        return SDL_FALSE;
+    }
+    for (*r_shift = 0; *r_shift < 32 && Rmask != (0xFFu << *r_shift); *r_shift += 8);
+    for (*g_shift = 0; *g_shift < 32 && Gmask != (0xFFu << *g_shift); *g_shift += 8);
+    for (*b_shift = 0; *b_shift < 32 && Bmask != (0xFFu << *b_shift); *b_shift += 8);
+    if (*r_shift == 32 || *g_shift == 32 || *b_shift == 32) {
+        return SDL_FALSE;
+    }
+    *alpha = Amask;
+    return SDL_TRUE;
+}
+
+typedef struct
+{
+    const YUVToRGBMatrix *m;
+    int r_shift, g_shift, b_shift;
+    Uint32 alpha;               /* ORed into every pixel */
+} YUVToRGBParams;
+
+typedef struct
+{
+    const RGBToYUVMatrix *m;
+    int r_shift, g_shift, b_shift;
+} RGBToYUVParams;
+
+typedef void (*YUVToRGBRowFunc)(const YUVPlanes *planes, int row, Uint32 *dst,
+                                int width, const YUVToRGBParams *p);
+
+/* Converts one or two rows of pixels, the chroma samples are shared by
+   both of them.  src1 is src0 and y1 is NULL when there is only one. */
+typedef void (*RGBToYUVRowsFunc)(const Uint32 *src0, const Uint32 *src1,
+                                 Uint8 *y0, Uint8 *y1, Uint8 *u, Uint8 *v,
+                                 int width, const RGBToYUVParams *p);
+
+static void
+GetYUVRow(const YUVPlanes *planes, int row,
+          const Uint8 **y, const Uint8 **u, const Uint8 **v)
+{
+    const int chroma_row = row / planes->chroma_rows;
+
+    *y = planes->y_plane + row * planes->y_pitch + planes->y_pos;
+    *u = planes->u_plane + chroma_row * planes->uv_pitch + planes->u_pos;
+    *v = planes->v_plane + chroma_row * planes->uv_pitch + planes->v_pos;
+}
+
+/* Samples are multiplied by 64 so that a Q13 coefficient and a 16-bit
+   high multiply leave 8 times the result, which is what the vector
+   versions compute as well. */
+static SDL_INLINE Uint32
+YUVToRGBPixel(int Y, int U, int V, const YUVToRGBParams *p)
+{
+    const YUVToRGBMatrix *m = p->m;
+    int r, g, b;
+
+    Y = ((Y - m->y_offset) * 64 * m->y_scale) >> 16;
+    U = (U - 128) * 64;
+    V = (V - 128) * 64;
+    r = (Y + ((V * m->v_r) >> 16) + 4) >> 3;
+    g = (Y + ((U * m->u_g) >> 16) + ((V * m->v_g) >> 16) + 4) >> 3;
+    b = (Y + ((U * m->u_b) >> 16) + 4) >> 3;
+    r = (r < 0) ? 0 : (r > 255) ? 255 : r;
+    g = (g < 0) ? 0 : (g > 255) ? 255 : g;
+    b = (b < 0) ? 0 : (b > 255) ? 255 : b;
+    return ((Uint32) r << p->r_shift) | ((Uint32) g << p->g_shift) |
+           ((Uint32) b << p->b_shift) | p->alpha;
+}
+
+static void
+YUVToRGBPixels(const YUVPlanes *planes, const Uint8 *y, const Uint8 *u,
+               const Uint8 *v, Uint32 *dst, int x, int width,
+               const YUVToRGBParams *p)
+{
+    const int y_step = planes->y_step;
+    const int uv_step = planes->uv_step;
+
+    for (; x < width; ++x) {
+        const int c = (x / 2) * uv_step;
+        dst[x] = YUVToRGBPixel(y[x * y_step], u[c], v[c], p);
+    }
+}
+
+static void
+YUVToRGBRow_C(const YUVPlanes *planes, int row, Uint32 *dst, int width,
+              const YUVToRGBParams *p)
+{
+    const Uint8 *y, *u, *v;
+
+    GetYUVRow(planes, row, &y, &u, &v);
+    YUVToRGBPixels(planes, y, u, v, dst, 0, width, p);
+}
+
+#define RGB_CHANNEL(pixel, shift)   (((pixel) >> (shift)) & 0xFF)
+
+/* Y in Q15 with rounding */
+static SDL_INLINE Uint8
+RGBToY(Uint32 pixel, const RGBToYUVParams *p)
+{
+    const RGBToYUVMatrix *m = p->m;
+    const int Y = (m->y_r * RGB_CHANNEL(pixel, p->r_shift) +
+                   m->y_g * RGB_CHANNEL(pixel, p->g_shift) +
+                   m->y_b * RGB_CHANNEL(pixel, p->b_shift) +
+                   (m->y_offset << 15) + (1 << 14)) >> 15;
+    return (Uint8) ((Y > 255) ? 255 : Y);
+}
+
+/* U and V from the sums of a block of four pixels, so in Q17 */
+static void
+RGBToYUVPixels(const Uint32 *src0, const Uint32 *src1, Uint8 *y0, Uint8 *y1,
+               Uint8 *u, Uint8 *v, int x, int width, const RGBToYUVParams *p)
+{
+    const RGBToYUVMatrix *m = p->m;
+    const int round = (128 << 17) + (1 << 16);
+
+    for (; x < width; x += 2) {
+        const int x1 = (x + 1 < width) ? x + 1 : x;
+        const Uint32 pixels[4] = { src0[x], src0[x1], src1[x], src1[x1] };
+        int R = 0, G = 0, B = 0, U, V, i;
+
+        y0[x] = RGBToY(pixels[0], p);
+        y0[x1] = RGBToY(pixels[1], p);
+        if (y1) {
+            y1[x] = RGBToY(pixels[2], p);
+            y1[x1] = RGBToY(pixels[3], p);
+        }
+        for (i = 0; i < 4; ++i) {
+            R += RGB_CHANNEL(pixels[i], p->r_shift);
+            G += RGB_CHANNEL(pixels[i], p->g_shift);
+            B += RGB_CHANNEL(pixels[i], p->b_shift);
+        }
+        U = (m->u_r * R + m->u_g * G + m->u_b * B + round) >> 17;
+        V = (m->v_r * R + m->v_g * G + m->v_b * B + round) >> 17;
+        u[x / 2] = (Uint8) ((U < 0) ? 0 : (U > 255) ? 255 : U);
+        v[x / 2] = (Uint8) ((V < 0) ? 0 : (V > 255) ? 255 : V);
+    }
+}
+
+static void
+RGBToYUVRows_C(const Uint32 *src0, const Uint32 *src1, Uint8 *y0, Uint8 *y1,
+               Uint8 *u, Uint8 *v, int width, const RGBToYUVParams *p)
+{
+    RGBToYUVPixels(src0, src1, y0, y1, u, v, 0, width, p);
+}
+
+#if HAVE_SSE2_BLITTERS
+
+static void
+YUVToRGBRow_SSE2(const YUVPlanes *planes, int row, Uint32 *dst, int width,
+                 const YUVToRGBParams *p)
+{
+    const YUVToRGBMatrix *m = p->m;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i y_offset = _mm_set1_epi16(m->y_offset);
+    const __m128i bias = _mm_set1_epi16(128);
+    const __m128i y_scale = _mm_set1_epi16(m->y_scale);
+    const __m128i v_r = _mm_set1_epi16(m->v_r);
+    const __m128i u_g = _mm_set1_epi16(m->u_g);
+    const __m128i v_g = _mm_set1_epi16(m->v_g);
+    const __m128i u_b = _mm_set1_epi16(m->u_b);
+    const __m128i round = _mm_set1_epi16(4);
+    const __m128i max = _mm_set1_epi16(255);
+    const __m128i byte_mask = _mm_set1_epi16(0xFF);
+    const __m128i word_mask = _mm_set1_epi32(0xFFFF);
+    const __m128i r_shift = _mm_cvtsi32_si128(p->r_shift);
+    const __m128i g_shift = _mm_cvtsi32_si128(p->g_shift);
+    const __m128i b_shift = _mm_cvtsi32_si128(p->b_shift);
+    const __m128i alpha = _mm_set1_epi32(p->alpha);
+    /* Sample positions in 16-bit words, and in 32-bit pairs of chroma */
+    const __m128i y_shift = _mm_cvtsi32_si128(planes->y_pos * 8);
+    const __m128i c_shift = _mm_cvtsi32_si128(8 - planes->y_pos * 8);
+    const __m128i u_shift = _mm_cvtsi32_si128(planes->layout == YUV_PACKED ? (planes->u_pos / 2) * 16 : planes->u_pos * 8);
+    const __m128i v_shift = _mm_cvtsi32_si128(planes->layout == YUV_PACKED ? (planes->v_pos / 2) * 16 : planes->v_pos * 8);
+    const Uint8 *y, *u, *v, *uv, *yuv;
+    __m128i Y, U, V, R, G, B, w, c;
+    int x;
+
+    GetYUVRow(planes, row, &y, &u, &v);
+    uv = u - planes->u_pos;
+    yuv = y - planes->y_pos;
+
+    for (x = 0; x + 8 <= width; x += 8) {
+        switch (planes->layout) {
+        case YUV_PLANAR:
+            Y = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *) (y + x)), zero);
+            U = _mm_cvtsi32_si128(*(const int *) (u + x / 2));
+            V = _mm_cvtsi32_si128(*(const int *) (v + x / 2));
+            U = _mm_unpacklo_epi16(_mm_unpacklo_epi8(U, zero), zero);
+            V = _mm_unpacklo_epi16(_mm_unpacklo_epi8(V, zero), zero);
+            break;
+        case YUV_SEMIPLANAR:
+            Y = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *) (y + x)), zero);
+            w = _mm_loadl_epi64((const __m128i *) (uv + x));
+            U = _mm_unpacklo_epi16(_mm_and_si128(_mm_srl_epi16(w, u_shift), byte_mask), zero);
+            V = _mm_unpacklo_epi16(_mm_and_si128(_mm_srl_epi16(w, v_shift), byte_mask), zero);
+            break;
+        default:
+            w = _mm_loadu_si128((const __m128i *) (yuv + x * 2));
+            Y = _mm_and_si128(_mm_srl_epi16(w, y_shift), byte_mask);
+            c = _mm_and_si128(_mm_srl_epi16(w, c_shift), byte_mask);
+            U = _mm_and_si128(_mm_srl_epi32(c, u_shift), word_mask);
+            V = _mm_and_si128(_mm_srl_epi32(c, v_shift), word_mask);
+            break;
+        }
+        /* Each chroma sample covers two pixels */
+        U = _mm_or_si128(U, _mm_slli_epi32(U, 16));
+        V = _mm_or_si128(V, _mm_slli_epi32(V, 16));
+
+        Y = _mm_mulhi_epi16(_mm_slli_epi16(_mm_sub_epi16(Y, y_offset), 6), y_scale);
+        U = _mm_slli_epi16(_mm_sub_epi16(U, bias), 6);
+        V = _mm_slli_epi16(_mm_sub_epi16(V, bias), 6);
+        R = _mm_add_epi16(Y, _mm_mulhi_epi16(V, v_r));
+        G = _mm_add_epi16(Y, _mm_add_epi16(_mm_mulhi_epi16(U, u_g), _mm_mulhi_epi16(V, v_g)));
+        B = _mm_add_epi16(Y, _mm_mulhi_epi16(U, u_b));
+        R = _mm_min_epi16(_mm_max_epi16(_mm_srai_epi16(_mm_add_epi16(R, round), 3), zero), max);
+        G = _mm_min_epi16(_mm_max_epi16(_mm_srai_epi16(_mm_add_epi16(G, round), 3), zero), max);
+        B = _mm_min_epi16(_mm_max_epi16(_mm_srai_epi16(_mm_add_epi16(B, round), 3), zero), max);
+
+        _mm_storeu_si128((__m128i *) (dst + x), _mm_or_si128(
+            _mm_or_si128(_mm_sll_epi32(_mm_unpacklo_epi16(R, zero), r_shift),
+                         _mm_sll_epi32(_mm_unpacklo_epi16(G, zero), g_shift)),
+            _mm_or_si128(_mm_sll_epi32(_mm_unpacklo_epi16(B, zero), b_shift), alpha)));
+        _mm_storeu_si128((__m128i *) (dst + x + 4), _mm_or_si128(
+            _mm_or_si128(_mm_sll_epi32(_mm_unpackhi_epi16(R, zero), r_shift),
+                         _mm_sll_epi32(_mm_unpackhi_epi16(G, zero), g_shift)),
+            _mm_or_si128(_mm_sll_epi32(_mm_unpackhi_epi16(B, zero), b_shift), alpha)));
+    }
+    YUVToRGBPixels(planes, y, u, v, dst, x, width, p);
+}
+
+/* One 8-bit channel of 8 pixels, in 16-bit lanes */
+static SDL_INLINE __m128i
+RGBChannel_SSE2(const Uint32 *src, __m128i shift)
+{
+    const __m128i mask = _mm_set1_epi32(0xFF);
+    __m128i lo = _mm_and_si128(_mm_srl_epi32(_mm_loadu_si128((const __m128i *) src), shift), mask);
+    __m128i hi = _mm_and_si128(_mm_srl_epi32(_mm_loadu_si128((const __m128i *) (src + 4)), shift), mask);
+    return _mm_packs_epi32(lo, hi);
+}
+
+static SDL_INLINE __m128i
+RGBToY_SSE2(__m128i R, __m128i G, __m128i B, __m128i rg, __m128i b0,
+            __m128i round)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i lo = _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(R, G), rg),
+                               _mm_madd_epi16(_mm_unpacklo_epi16(B, zero), b0));
+    __m128i hi = _mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(R, G), rg),
+                               _mm_madd_epi16(_mm_unpackhi_epi16(B, zero), b0));
+    lo = _mm_srai_epi32(_mm_add_epi32(lo, round), 15);
+    hi = _mm_srai_epi32(_mm_add_epi32(hi, round), 15);
+    lo = _mm_packs_epi32(lo, hi);
+    return _mm_packus_epi16(lo, lo);
+}
+
+static void
+RGBToYUVRows_SSE2(const Uint32 *src0, const Uint32 *src1, Uint8 *y0, Uint8 *y1,
+                  Uint8 *u, Uint8 *v, int width, const RGBToYUVParams *p)
+{
+    const RGBToYUVMatrix *m = p->m;
+    const __m128i r_shift = _mm_cvtsi32_si128(p->r_shift);
+    const __m128i g_shift = _mm_cvtsi32_si128(p->g_shift);
+    const __m128i b_shift = _mm_cvtsi32_si128(p->b_shift);
+    const __m128i y_rg = _mm_set1_epi32((int) (((Uint32) (Uint16) m->y_g << 16) | (Uint16) m->y_r));
+    const __m128i y_b0 = _mm_set1_epi32((Uint16) m->y_b);
+    const __m128i y_round = _mm_set1_epi32((m->y_offset << 15) + (1 << 14));
+    const __m128i u_r = _mm_set1_epi16(m->u_r), u_g = _mm_set1_epi16(m->u_g), u_b = _mm_set1_epi16(m->u_b);
+    const __m128i v_r = _mm_set1_epi16(m->v_r), v_g = _mm_set1_epi16(m->v_g), v_b = _mm_set1_epi16(m->v_b);
+    const __m128i uv_round = _mm_set1_epi32((128 << 17) + (1 << 16));
+    __m128i R0, G0, B0, R1, G1, B1, U, V;
+    int x;
+
+    for (x = 0; x + 8 <= width; x += 8) {
+        R0 = RGBChannel_SSE2(src0 + x, r_shift);
+        G0 = RGBChannel_SSE2(src0 + x, g_shift);
+        B0 = RGBChannel_SSE2(src0 + x, b_shift);
+        R1 = RGBChannel_SSE2(src1 + x, r_shift);
+        G1 = RGBChannel_SSE2(src1 + x, g_shift);
+        B1 = RGBChannel_SSE2(src1 + x, b_shift);
+
+        _mm_storel_epi64((__m128i *) (y0 + x), RGBToY_SSE2(R0, G0, B0, y_rg, y_b0, y_round));
+        if (y1) {
+            _mm_storel_epi64((__m128i *) (y1 + x), RGBToY_SSE2(R1, G1, B1, y_rg, y_b0, y_round));
+        }
+
+        /* madd sums horizontal pairs, the rows are added first */
+        R0 = _mm_add_epi16(R0, R1);
+        G0 = _mm_add_epi16(G0, G1);
+        B0 = _mm_add_epi16(B0, B1);
+        U = _mm_add_epi32(_mm_add_epi32(_mm_madd_epi16(R0, u_r), _mm_madd_epi16(G0, u_g)),
+                          _mm_add_epi32(_mm_madd_epi16(B0, u_b), uv_round));
+        V = _mm_add_epi32(_mm_add_epi32(_mm_madd_epi16(R0, v_r), _mm_madd_epi16(G0, v_g)),
+                          _mm_add_epi32(_mm_madd_epi16(B0, v_b), uv_round));
+        U = _mm_packs_epi32(_mm_srai_epi32(U, 17), _mm_srai_epi32(V, 17));
+        U = _mm_packus_epi16(U, U);
+        *(int *) (u + x / 2) = _mm_cvtsi128_si32(U);
+        *(int *) (v + x / 2) = _mm_cvtsi128_si32(_mm_srli_si128(U, 4));
+    }
+    RGBToYUVPixels(src0, src1, y0, y1, u, v, x, width, p);
+}
+
+#endif /* HAVE_SSE2_BLITTERS */
+
+#if HAVE_AVX2_BLITTERS
+
+SDL_TARGETING_AVX2 static void
+YUVToRGBRow_AVX2(const YUVPlanes *planes, int row, Uint32 *dst, int width,
+                 const YUVToRGBParams *p)
+{
+    const YUVToRGBMatrix *m = p->m;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i y_offset = _mm256_set1_epi16(m->y_offset);
+    const __m256i bias = _mm256_set1_epi16(128);
+    const __m256i y_scale = _mm256_set1_epi16(m->y_scale);
+    const __m256i v_r = _mm256_set1_epi16(m->v_r);
+    const __m256i u_g = _mm256_set1_epi16(m->u_g);
+    const __m256i v_g = _mm256_set1_epi16(m->v_g);
+    const __m256i u_b = _mm256_set1_epi16(m->u_b);
+    const __m256i round = _mm256_set1_epi16(4);
+    const __m256i max = _mm256_set1_epi16(255);
+    const __m256i byte_mask = _mm256_set1_epi16(0xFF);
+    const __m256i word_mask = _mm256_set1_epi32(0xFFFF);
+    const __m128i r_shift = _mm_cvtsi32_si128(p->r_shift);
+    const __m128i g_shift = _mm_cvtsi32_si128(p->g_shift);
+    const __m128i b_shift = _mm_cvtsi32_si128(p->b_shift);
+    const __m256i alpha = _mm256_set1_epi32(p->alpha);
+    const __m128i y_shift = _mm_cvtsi32_si128(planes->y_pos * 8);
+    const __m128i c_shift = _mm_cvtsi32_si128(8 - planes->y_pos * 8);
+    const __m128i u_shift = _mm_cvtsi32_si128(planes->layout == YUV_PACKED ? (planes->u_pos / 2) * 16 : planes->u_pos * 8);
+    const __m128i v_shift = _mm_cvtsi32_si128(planes->layout == YUV_PACKED ? (planes->v_pos / 2) * 16 : planes->v_pos * 8);
+    const Uint8 *y, *u, *v, *uv, *yuv;
+    __m256i Y, U, V, R, G, B, w, c;
+    __m128i w128;
+    int x;
+
+    GetYUVRow(planes, row, &y, &u, &v);
+    uv = u - planes->u_pos;
+    yuv = y - planes->y_pos;
+
+    for (x = 0; x + 16 <= width; x += 16) {
+        switch (planes->layout) {
+        case YUV_PLANAR:
+            Y = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *) (y + x)));
+            U = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *) (u + x / 2)));
+            V = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *) (v + x / 2)));
+            break;
+        case YUV_SEMIPLANAR:
+            Y = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *) (y + x)));
+            w128 = _mm_loadu_si128((const __m128i *) (uv + x));
+            U = _mm256_cvtepu16_epi32(_mm_and_si128(_mm_srl_epi16(w128, u_shift), _mm256_castsi256_si128(byte_mask)));
+            V = _mm256_cvtepu16_epi32(_mm_and_si128(_mm_srl_epi16(w128, v_shift), _mm256_castsi256_si128(byte_mask)));
+            break;
+        default:
+            w = _mm256_loadu_si256((const __m256i *) (yuv + x * 2));
+            Y = _mm256_and_si256(_mm256_srl_epi16(w, y_shift), byte_mask);
+            c = _mm256_and_si256(_mm256_srl_epi16(w, c_shift), byte_mask);
+            U = _mm256_and_si256(_mm256_srl_epi32(c, u_shift), word_mask);
+            V = _mm256_and_si256(_mm256_srl_epi32(c, v_shift), word_mask);
+            break;
+        }
+        U = _mm256_or_si256(U, _mm256_slli_epi32(U, 16));
+        V = _mm256_or_si256(V, _mm256_slli_epi32(V, 16));
+
+        Y = _mm256_mulhi_epi16(_mm256_slli_epi16(_mm256_sub_epi16(Y, y_offset), 6), y_scale);
+        U = _mm256_slli_epi16(_mm256_sub_epi16(U, bias), 6);
+        V = _mm256_slli_epi16(_mm256_sub_epi16(V, bias), 6);
+        R = _mm256_add_epi16(Y, _mm256_mulhi_epi16(V, v_r));
+        G = _mm256_add_epi16(Y, _mm256_add_epi16(_mm256_mulhi_epi16(U, u_g), _mm256_mulhi_epi16(V, v_g)));
+        B = _mm256_add_epi16(Y, _mm256_mulhi_epi16(U, u_b));
+        R = _mm256_min_epi16(_mm256_max_epi16(_mm256_srai_epi16(_mm256_add_epi16(R, round), 3), zero), max);
+        G = _mm256_min_epi16(_mm256_max_epi16(_mm256_srai_epi16(_mm256_add_epi16(G, round), 3), zero), max);
+        B = _mm256_min_epi16(_mm256_max_epi16(_mm256_srai_epi16(_mm256_add_epi16(B, round), 3), zero), max);
+
+        _mm256_storeu_si256((__m256i *) (dst + x), _mm256_or_si256(
+            _mm256_or_si256(_mm256_sll_epi32(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(R)), r_shift),
+                            _mm256_sll_epi32(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(G)), g_shift)),
+            _mm256_or_si256(_mm256_sll_epi32(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(B)), b_shift), alpha)));
+        _mm256_storeu_si256((__m256i *) (dst + x + 8), _mm256_or_si256(
+            _mm256_or_si256(_mm256_sll_epi32(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(R, 1)), r_shift),
+                            _mm256_sll_epi32(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(G, 1)), g_shift)),
+            _mm256_or_si256(_mm256_sll_epi32(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(B, 1)), b_shift), alpha)));
+    }
+    YUVToRGBPixels(planes, y, u, v, dst, x, width, p);
+}
+
+/* One 8-bit channel of 16 pixels, in 16-bit lanes */
+SDL_TARGETING_AVX2 static SDL_INLINE __m256i
+RGBChannel_AVX2(const Uint32 *src, __m128i shift)
+{
+    const __m256i mask = _mm256_set1_epi32(0xFF);
+    __m256i lo = _mm256_and_si256(_mm256_srl_epi32(_mm256_loadu_si256((const __m256i *) src), shift), mask);
+    __m256i hi = _mm256_and_si256(_mm256_srl_epi32(_mm256_loadu_si256((const __m256i *) (src + 8)), shift), mask);
+    return _mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), 0xD8);
+}
+
+/* The unpacks and packs stay within 128-bit lanes, so the order is kept */
+SDL_TARGETING_AVX2 static SDL_INLINE __m128i
+RGBToY_AVX2(__m256i R, __m256i G, __m256i B, __m256i rg, __m256i b0,
+            __m256i round)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i lo = _mm256_add_epi32(_mm256_madd_epi16(_mm256_unpacklo_epi16(R, G), rg),
+                                  _mm256_madd_epi16(_mm256_unpacklo_epi16(B, zero), b0));
+    __m256i hi = _mm256_add_epi32(_mm256_madd_epi16(_mm256_unpackhi_epi16(R, G), rg),
+                                  _mm256_madd_epi16(_mm256_unpackhi_epi16(B, zero), b0));
+    lo = _mm256_srai_epi32(_mm256_add_epi32(lo, round), 15);
+    hi = _mm256_srai_epi32(_mm256_add_epi32(hi, round), 15);
+    lo = _mm256_packs_epi32(lo, hi);
+    lo = _mm256_packus_epi16(lo, lo);
+    return _mm256_castsi256_si128(_mm256_permute4x64_epi64(lo, 0x08));
+}
+
+SDL_TARGETING_AVX2 static void
+RGBToYUVRows_AVX2(const Uint32 *src0, const Uint32 *src1, Uint8 *y0, Uint8 *y1,
+                  Uint8 *u, Uint8 *v, int width, const RGBToYUVParams *p)
+{
+    const RGBToYUVMatrix *m = p->m;
+    const __m128i r_shift = _mm_cvtsi32_si128(p->r_shift);
+    const __m128i g_shift = _mm_cvtsi32_si128(p->g_shift);
+    const __m128i b_shift = _mm_cvtsi32_si128(p->b_shift);
+    const __m256i y_rg = _mm256_set1_epi32((int) (((Uint32) (Uint16) m->y_g << 16) | (Uint16) m->y_r));
+    const __m256i y_b0 = _mm256_set1_epi32((Uint16) m->y_b);
+    const __m256i y_round = _mm256_set1_epi32((m->y_offset << 15) + (1 << 14));
+    const __m256i u_r = _mm256_set1_epi16(m->u_r), u_g = _mm256_set1_epi16(m->u_g), u_b = _mm256_set1_epi16(m->u_b);
+    const __m256i v_r = _mm256_set1_epi16(m->v_r), v_g = _mm256_set1_epi16(m->v_g), v_b = _mm256_set1_epi16(m->v_b);
+    const __m256i uv_round = _mm256_set1_epi32((128 << 17) + (1 << 16));
+    const __m256i uv_order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    __m256i R0, G0, B0, R1, G1, B1, U, V;
+    __m128i UV;
+    int x;
+
+    for (x = 0; x + 16 <= width; x += 16) {
+        R0 = RGBChannel_AVX2(src0 + x, r_shift);
+        G0 = RGBChannel_AVX2(src0 + x, g_shift);
+        B0 = RGBChannel_AVX2(src0 + x, b_shift);
+        R1 = RGBChannel_AVX2(src1 + x, r_shift);
+        G1 = RGBChannel_AVX2(src1 + x, g_shift);
+        B1 = RGBChannel_AVX2(src1 + x, b_shift);
+
+        _mm_storeu_si128((__m128i *) (y0 + x), RGBToY_AVX2(R0, G0, B0, y_rg, y_b0, y_round));
+        if (y1) {
+            _mm_storeu_si128((__m128i *) (y1 + x), RGBToY_AVX2(R1, G1, B1, y_rg, y_b0, y_round));
+        }
+
+        R0 = _mm256_add_epi16(R0, R1);
+        G0 = _mm256_add_epi16(G0, G1);
+        B0 = _mm256_add_epi16(B0, B1);
+        U = _mm256_add_epi32(_mm256_add_epi32(_mm256_madd_epi16(R0, u_r), _mm256_madd_epi16(G0, u_g)),
+                             _mm256_add_epi32(_mm256_madd_epi16(B0, u_b), uv_round));
+        V = _mm256_add_epi32(_mm256_add_epi32(_mm256_madd_epi16(R0, v_r), _mm256_madd_epi16(G0, v_g)),
+                             _mm256_add_epi32(_mm256_madd_epi16(B0, v_b), uv_round));
+        U = _mm256_packs_epi32(_mm256_srai_epi32(U, 17), _mm256_srai_epi32(V, 17));
+        U = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(U, U), uv_order);
+        UV = _mm256_castsi256_si128(U);
+        _mm_storel_epi64((__m128i *) (u + x / 2), UV);
+        _mm_storel_epi64((__m128i *) (v + x / 2), _mm_srli_si128(UV, 8));
+    }
+    RGBToYUVPixels(src0, src1, y0, y1, u, v, x, width, p);
+}
+
+#endif /* HAVE_AVX2_BLITTERS */
+
+static YUVToRGBRowFunc
+GetYUVToRGBRowFunc(void)
+{
+    const Uint32 features = SDL_GetBlitCPUFeatures();
+
+#if HAVE_AVX2_BLITTERS
+    if (features & SDL_CPU_AVX2) {
+        return YUVToRGBRow_AVX2;
+    }
+#endif
+#if HAVE_SSE2_BLITTERS
+    if (features & SDL_CPU_SSE2) {
+        return YUVToRGBRow_SSE2;
+    }
+#endif
+    (void) features;
+    return YUVToRGBRow_C;
+}
+
+static RGBToYUVRowsFunc
+GetRGBToYUVRowsFunc(void)
+{
+    const Uint32 features = SDL_GetBlitCPUFeatures();
+
+#if HAVE_AVX2_BLITTERS
+    if (features & SDL_CPU_AVX2) {
+        return RGBToYUVRows_AVX2;
+    }
+#endif
+#if HAVE_SSE2_BLITTERS
+    if (features & SDL_CPU_SSE2) {
+        return RGBToYUVRows_SSE2;
+    }
+#endif
+    (void) features;
+    return RGBToYUVRows_C;
+}
+
+static int
+GetConversionMatrixIndex(int width, int height)
+{
+    switch (SDL_GetYUVConversionModeForResolution(width, height)) {
+    case SDL_YUV_CONVERSION_JPEG:
+        return 0;
+    case SDL_YUV_CONVERSION_BT709:
+        return 2;
+    default:
+        return 1;
+    }
+}
+
+int
+SDL_ConvertPixels_YUV_to_RGB(int width, int height,
+                             Uint32 src_format, const void *src, int src_pitch,
+                             Uint32 dst_format, void *dst, int dst_pitch)
+{
+    YUVPlanes planes;
+    YUVToRGBParams params;
+    YUVToRGBRowFunc convert;
+    int row;
+
+    if (GetYUVPlanes(width, height, src_format, src, src_pitch, &planes) < 0) {
+        return -1;
+    }
+
+    if (!GetRGBShifts(dst_format, &params.r_shift, &params.g_shift,
+                      &params.b_shift, &params.alpha)) {
+        /* Convert to ARGB8888 first, then to the format that was asked for */
+        const int tmp_pitch = width * 4;
+        void *tmp = SDL_malloc((size_t) tmp_pitch * height);
+        int retval;
+
+        if (!tmp) {
+            return SDL_OutOfMemory();
+        }
+        retval = SDL_ConvertPixels_YUV_to_RGB(width, height, src_format, src, src_pitch,
+                                              SDL_PIXELFORMAT_ARGB8888, tmp, tmp_pitch);
+        if (retval == 0) {
+            retval = SDL_ConvertPixels(width, height, SDL_PIXELFORMAT_ARGB8888, tmp, tmp_pitch,
+                                       dst_format, dst, dst_pitch);
+        }
+        SDL_free(tmp);
+        return retval;
+    }
+
+    params.m = &SDL_YUVToRGBMatrices[GetConversionMatrixIndex(width, height)];
+    convert = GetYUVToRGBRowFunc();
+    for (row = 0; row < height; ++row) {
+        convert(&planes, row, (Uint32 *) ((Uint8 *) dst + row * dst_pitch), width, &params);
+    }
+    return 0;
+}
+
+int
+SDL_ConvertPixels_RGB_to_YUV(int width, int height,
+                             Uint32 src_format, const void *src, int src_pitch,
+                             Uint32 dst_format, void *dst, int dst_pitch)
+{
+    YUVPlanes planes;
+    RGBToYUVParams params;
+    RGBToYUVRowsFunc convert;
+    Uint32 alpha;
+    const int chroma_width = (width + 1) / 2;
+    Uint8 *scratch, *y0, *y1, *u, *v, *out;
+    int row, i;
+
+    if (GetYUVPlanes(width, height, dst_format, dst, dst_pitch, &planes) < 0) {
+        return -1;
+    }
+
+    if (!GetRGBShifts(src_format, &params.r_shift, &params.g_shift,
+                      &params.b_shift, &alpha)) {
+        /* Convert to ARGB8888 first */
+        const int tmp_pitch = width * 4;
+        void *tmp = SDL_malloc((size_t) tmp_pitch * height);
+        int retval;
+
+        if (!tmp) {
+            return SDL_OutOfMemory();
+        }
+        retval = SDL_ConvertPixels(width, height, src_format, src, src_pitch,
+                                   SDL_PIXELFORMAT_ARGB8888, tmp, tmp_pitch);
+        if (retval == 0) {
+            retval = SDL_ConvertPixels_RGB_to_YUV(width, height, SDL_PIXELFORMAT_ARGB8888, tmp, tmp_pitch,
+                                                  dst_format, dst, dst_pitch);
+        }
+        SDL_free(tmp);
+        return retval;
+    }
+
+    /* The interleaved layouts are put together from planar rows */
+    scratch = NULL;
+    if (planes.layout != YUV_PLANAR) {
+        scratch = (Uint8 *) SDL_malloc(2 * chroma_width * 2);
+        if (!scratch) {
+            return SDL_OutOfMemory();
+        }
+    }
+
+    params.m = &SDL_RGBToYUVMatrices[GetConversionMatrixIndex(width, height)];
+    convert = GetRGBToYUVRowsFunc();
+    for (row = 0; row < height; row += planes.chroma_rows) {
+        const Uint32 *src0 = (const Uint32 *) ((const Uint8 *) src + row * src_pitch);
+        const Uint32 *src1 = src0;
+        const int chroma_row = row / planes.chroma_rows;
+
+        if (planes.chroma_rows == 2 && row + 1 < height) {
+            src1 = (const Uint32 *) ((const Uint8 *) src0 + src_pitch);
+        }
+
+        switch (planes.layout) {
+        case YUV_PLANAR:
+            y0 = planes.y_plane + row * planes.y_pitch;
+            y1 = (src1 != src0) ? y0 + planes.y_pitch : NULL;
+            u = planes.u_plane + chroma_row * planes.uv_pitch;
+            v = planes.v_plane + chroma_row * planes.uv_pitch;
+            convert(src0, src1, y0, y1, u, v, width, &params);
+            break;
+        case YUV_SEMIPLANAR:
+            y0 = planes.y_plane + row * planes.y_pitch;
+            y1 = (src1 != src0) ? y0 + planes.y_pitch : NULL;
+            u = scratch;
+            v = scratch + chroma_width;
+            convert(src0, src1, y0, y1, u, v, width, &params);
+            out = planes.u_plane + chroma_row * planes.uv_pitch;
+            for (i = 0; i < chroma_width; ++i) {
+                out[i * 2 + planes.u_pos] = u[i];
+                out[i * 2 + planes.v_pos] = v[i];
+            }
+            break;
+        default:
+            y0 = scratch;
+            u = scratch + chroma_width * 2;
+            v = u + chroma_width;
+            convert(src0, src0, y0, NULL, u, v, width, &params);
+            if (width & 1) {
+                y0[width] = y0[width - 1];
+            }
+            out = planes.y_plane + row * planes.y_pitch;
+            for (i = 0; i < chroma_width; ++i) {
+                out[i * 4 + planes.y_pos] = y0[i * 2];
+                out[i * 4 + planes.y_pos + 2] = y0[i * 2 + 1];
+                out[i * 4 + planes.u_pos] = u[i];
+                out[i * 4 + planes.v_pos] = v[i];
+            }
+            break;
+        }
+    }
+    SDL_free(scratch);
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
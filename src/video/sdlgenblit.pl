@@ -58,6 +58,22 @@ my %format_type = (
     "BGRA8888" => "Uint32",
 );
 
+# SDL_DEFINE_PIXELFORMAT() of each format, used to build the lookup hash
+my %format_value = (
+    "RGB888" => 0x16161804,
+    "BGR888" => 0x16561804,
+    "ARGB8888" => 0x16362004,
+    "RGBA8888" => 0x16462004,
+    "ABGR8888" => 0x16762004,
+    "BGRA8888" => 0x16862004,
+);
+
+# The modulation and blend variants, each one gets its own function so
+# that nothing is tested per pixel.  The modulate index is made of the
+# SDL_COPY_MODULATE_COLOR and SDL_COPY_MODULATE_ALPHA bits.
+my @modulate_names = ( "", "_ModulateColor", "_ModulateAlpha", "_Modulate" );
+my @blend_names = ( "", "_Blend", "_Add", "_Mod" );
+
 my %get_rgba_string_ignore_alpha = (
     "RGB888" => "_R = (Uint8)(_pixel >> 16); _G = (Uint8)(_pixel >> 8); _B = (Uint8)_pixel;",
     "BGR888" => "_B = (Uint8)(_pixel >> 16); _G = (Uint8)(_pixel >> 8); _R = (Uint8)_pixel;",
@@ -135,10 +151,26 @@ __EOF__
 sub output_copydefs
 {
     print FILE <<__EOF__;
-extern SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[];
+/* Returns the generated blitter for exactly these copy flags, or NULL */
+extern SDL_BlitFunc SDL_GetGeneratedBlitFunc(Uint32 src_format, Uint32 dst_format, int flags);
 __EOF__
 }
 
+# Alpha modulation has no effect when the alpha channel is thrown away,
+# and the mod blend never looks at the source alpha.
+sub effective_modulate
+{
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+
+    my $dst_has_alpha = ($dst =~ /A/) ? 1 : 0;
+    if ( (!$dst_has_alpha && !$blend) || $blend == 3 ) {
+        $modulate &= ~2;
+    }
+    return $modulate;
+}
+
 sub output_copyfuncname
 {
     my $prefix = shift;
@@ -151,12 +183,8 @@ sub output_copyfuncname
     my $suffix = shift;
 
     print FILE "$prefix SDL_Blit_${src}_${dst}";
-    if ( $modulate ) {
-        print FILE "_Modulate";
-    }
-    if ( $blend ) {
-        print FILE "_Blend";
-    }
+    print FILE $modulate_names[$modulate];
+    print FILE $blend_names[$blend];
     if ( $scale ) {
         print FILE "_Scale";
     }
@@ -227,7 +255,7 @@ __EOF__
     my $ignore_dst_alpha = !$dst_has_alpha && !$blend;
 
     if ( $blend ) {
-        get_rgba("src", $src, $ignore_dst_alpha);
+        get_rgba("src", $src, $blend == 3);
         get_rgba("dst", $dst, !$dst_has_alpha);
         $s = "src";
         $d = "dst";
@@ -235,58 +263,50 @@ __EOF__
         get_rgba("", $src, $ignore_dst_alpha);
     }
 
-    if ( $modulate ) {
+    if ( $modulate & 1 ) {
         print FILE <<__EOF__;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                ${s}R = (${s}R * modulateR) / 255;
-                ${s}G = (${s}G * modulateG) / 255;
-                ${s}B = (${s}B * modulateB) / 255;
-            }
+            ${s}R = (${s}R * modulateR) / 255;
+            ${s}G = (${s}G * modulateG) / 255;
+            ${s}B = (${s}B * modulateB) / 255;
 __EOF__
-        if (not $ignore_dst_alpha) {
-            print FILE <<__EOF__;
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                ${s}A = (${s}A * modulateA) / 255;
-            }
+    }
+    if ( ($modulate & 2) && !$ignore_dst_alpha ) {
+        print FILE <<__EOF__;
+            ${s}A = (${s}A * modulateA) / 255;
 __EOF__
-        }
     }
-    if ( $blend ) {
+    if ( $blend == 1 || $blend == 2 ) {
         print FILE <<__EOF__;
-            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
-                /* This goes away if we ever use premultiplied alpha */
-                if (${s}A < 255) {
-                    ${s}R = (${s}R * ${s}A) / 255;
-                    ${s}G = (${s}G * ${s}A) / 255;
-                    ${s}B = (${s}B * ${s}A) / 255;
-                }
+            /* This goes away if we ever use premultiplied alpha */
+            if (${s}A < 255) {
+                ${s}R = (${s}R * ${s}A) / 255;
+                ${s}G = (${s}G * ${s}A) / 255;
+                ${s}B = (${s}B * ${s}A) / 255;
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
-            case SDL_COPY_BLEND:
-                ${d}R = ${s}R + ((255 - ${s}A) * ${d}R) / 255;
-                ${d}G = ${s}G + ((255 - ${s}A) * ${d}G) / 255;
-                ${d}B = ${s}B + ((255 - ${s}A) * ${d}B) / 255;
 __EOF__
-
+    }
+    if ( $blend == 1 ) {
+        print FILE <<__EOF__;
+            ${d}R = ${s}R + ((255 - ${s}A) * ${d}R) / 255;
+            ${d}G = ${s}G + ((255 - ${s}A) * ${d}G) / 255;
+            ${d}B = ${s}B + ((255 - ${s}A) * ${d}B) / 255;
+__EOF__
         if ( $dst_has_alpha ) {
             print FILE <<__EOF__;
-                ${d}A = ${s}A + ((255 - ${s}A) * ${d}A) / 255;
+            ${d}A = ${s}A + ((255 - ${s}A) * ${d}A) / 255;
 __EOF__
         }
-
+    } elsif ( $blend == 2 ) {
         print FILE <<__EOF__;
-                break;
-            case SDL_COPY_ADD:
-                ${d}R = ${s}R + ${d}R; if (${d}R > 255) ${d}R = 255;
-                ${d}G = ${s}G + ${d}G; if (${d}G > 255) ${d}G = 255;
-                ${d}B = ${s}B + ${d}B; if (${d}B > 255) ${d}B = 255;
-                break;
-            case SDL_COPY_MOD:
-                ${d}R = (${s}R * ${d}R) / 255;
-                ${d}G = (${s}G * ${d}G) / 255;
-                ${d}B = (${s}B * ${d}B) / 255;
-                break;
-            }
+            ${d}R = ${s}R + ${d}R; if (${d}R > 255) ${d}R = 255;
+            ${d}G = ${s}G + ${d}G; if (${d}G > 255) ${d}G = 255;
+            ${d}B = ${s}B + ${d}B; if (${d}B > 255) ${d}B = 255;
+__EOF__
+    } elsif ( $blend == 3 ) {
+        print FILE <<__EOF__;
+            ${d}R = (${s}R * ${d}R) / 255;
+            ${d}G = (${s}G * ${d}G) / 255;
+            ${d}B = (${s}B * ${d}B) / 255;
 __EOF__
     }
     if ( $blend ) {
@@ -311,29 +331,32 @@ sub output_copyfunc
     print FILE <<__EOF__;
 {
 __EOF__
-    if ( $modulate || $blend ) {
-        print FILE <<__EOF__;
-    const int flags = info->flags;
-__EOF__
-    }
-    if ( $modulate ) {
+    if ( $modulate & 1 ) {
         print FILE <<__EOF__;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
 __EOF__
-        if (!$ignore_dst_alpha) {
-            print FILE <<__EOF__;
+    }
+    if ( ($modulate & 2) && !$ignore_dst_alpha ) {
+        print FILE <<__EOF__;
     const Uint32 modulateA = info->a;
 __EOF__
-        }
     }
     if ( $blend ) {
-        print FILE <<__EOF__;
+        if ( $blend == 3 ) {
+            print FILE <<__EOF__;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB;
+    Uint32 dstpixel;
+__EOF__
+        } else {
+            print FILE <<__EOF__;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
 __EOF__
+        }
         if ($dst_has_alpha) {
             print FILE <<__EOF__;
     Uint32 dstR, dstG, dstB, dstA;
@@ -440,61 +463,128 @@ sub output_copyinc
 __EOF__
 }
 
+# The index of a blitter within the functions for a format pair
+sub copyfunc_index
+{
+    my $modulate = shift;
+    my $blend = shift;
+    my $scale = shift;
+
+    return $modulate | ($blend << 2) | ($scale << 4);
+}
+
+sub pair_hash
+{
+    use integer;
+    my $src = shift;
+    my $dst = shift;
+    my $multiplier = shift;
+
+    my $key = (($format_value{$src} * 31) ^ $format_value{$dst}) & 0xFFFFFFFF;
+    return (($key * $multiplier) & 0xFFFFFFFF) >> 27;
+}
+
+# Find a multiplier that gives every format pair its own hash slot
+sub find_pair_hash
+{
+    for (my $multiplier = 0x9E3779B1; ; $multiplier += 2) {
+        my %used;
+        my $collision = 0;
+        foreach my $src (@src_formats) {
+            foreach my $dst (@dst_formats) {
+                my $hash = pair_hash($src, $dst, $multiplier);
+                if ( exists $used{$hash} ) {
+                    $collision = 1;
+                }
+                $used{$hash} = 1;
+            }
+        }
+        if ( !$collision ) {
+            return $multiplier;
+        }
+    }
+}
+
 sub output_copyfunctable
 {
+    my $multiplier = find_pair_hash();
+    my @slots = (-1) x 32;
+    my $pair = 0;
+
     print FILE <<__EOF__;
-SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
+typedef struct
+{
+    Uint32 src_format;
+    Uint32 dst_format;
+    SDL_BlitFunc func[32];
+} SDL_GeneratedBlitPair;
+
+static const SDL_GeneratedBlitPair SDL_GeneratedBlitPairs[] = {
 __EOF__
     for (my $i = 0; $i <= $#src_formats; ++$i) {
         my $src = $src_formats[$i];
         for (my $j = 0; $j <= $#dst_formats; ++$j) {
             my $dst = $dst_formats[$j];
-            for (my $modulate = 0; $modulate <= 1; ++$modulate) {
-                for (my $blend = 0; $blend <= 1; ++$blend) {
+            my @funcs = ("NULL") x 32;
+            for (my $modulate = 0; $modulate <= 3; ++$modulate) {
+                for (my $blend = 0; $blend <= 3; ++$blend) {
                     for (my $scale = 0; $scale <= 1; ++$scale) {
                         if ( $modulate || $blend || $scale ) {
-                            print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
-                            my $flags = "";
-                            my $flag = "";
-                            if ( $modulate ) {
-                                $flag = "SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA";
-                                if ( $flags eq "" ) {
-                                    $flags = $flag;
-                                } else {
-                                    $flags = "$flags | $flag";
-                                }
-                            }
-                            if ( $blend ) {
-                                $flag = "SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD";
-                                if ( $flags eq "" ) {
-                                    $flags = $flag;
-                                } else {
-                                    $flags = "$flags | $flag";
-                                }
-                            }
-                            if ( $scale ) {
-                                $flag = "SDL_COPY_NEAREST";
-                                if ( $flags eq "" ) {
-                                    $flags = $flag;
-                                } else {
-                                    $flags = "$flags | $flag";
-                                }
-                            }
-                            if ( $flags eq "" ) {
-                                $flags = "0";
-                            }
-                            print FILE "($flags), SDL_CPU_ANY,";
-                            output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n");
+                            my $effective = effective_modulate($dst, $modulate, $blend);
+                            $funcs[copyfunc_index($modulate, $blend, $scale)] =
+                                "SDL_Blit_${src}_${dst}" . $modulate_names[$effective] .
+                                $blend_names[$blend] . ($scale ? "_Scale" : "");
                         }
                     }
                 }
             }
+            print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, {\n";
+            for (my $k = 0; $k < 32; ++$k) {
+                print FILE "        $funcs[$k],\n";
+            }
+            print FILE "    } },\n";
+            $slots[pair_hash($src, $dst, $multiplier)] = $pair++;
         }
     }
     print FILE <<__EOF__;
-    { 0, 0, 0, 0, NULL }
 };
 
+/* The format pair in each hash slot, or -1 */
+static const Sint8 SDL_GeneratedBlitSlots[32] = {
+__EOF__
+    print FILE "    " . join(", ", @slots) . "\n";
+    printf FILE <<__EOF__, $multiplier;
+};
+
+SDL_BlitFunc
+SDL_GetGeneratedBlitFunc(Uint32 src_format, Uint32 dst_format, int flags)
+{
+    /* The blend mode flags are one-hot, anything else has no blitter */
+    static const Sint8 blend_index[8] = { 0, 1, 2, -1, 3, -1, -1, -1 };
+    const Uint32 key = (src_format * 31u) ^ dst_format;
+    const int slot = SDL_GeneratedBlitSlots[(Uint32)(key * 0x%08Xu) >> 27];
+    const SDL_GeneratedBlitPair *pair;
+    int blend;
+
+    if (slot < 0) {
+        return NULL;
+    }
+    pair = &SDL_GeneratedBlitPairs[slot];
+    if (pair->src_format != src_format || pair->dst_format != dst_format) {
+        return NULL;
+    }
+    if (flags & SDL_COPY_COLORKEY) {
+        return NULL;
+    }
+    blend = blend_index[(flags >> 4) & 0x7];
+    if (blend < 0) {
+        return NULL;
+    }
+    return pair->func[(flags & (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA)) |
+                      (blend << 2) |
+                      ((flags & SDL_COPY_NEAREST) ? 0x10 : 0)];
+}
+
 __EOF__
 }
 
@@ -502,12 +592,18 @@ sub output_copyfunc_c
 {
     my $src = shift;
     my $dst = shift;
+    my %done;
 
-    for (my $modulate = 0; $modulate <= 1; ++$modulate) {
-        for (my $blend = 0; $blend <= 1; ++$blend) {
+    for (my $modulate = 0; $modulate <= 3; ++$modulate) {
+        for (my $blend = 0; $blend <= 3; ++$blend) {
             for (my $scale = 0; $scale <= 1; ++$scale) {
                 if ( $modulate || $blend || $scale ) {
-                    output_copyfunc($src, $dst, $modulate, $blend, $scale);
+                    my $effective = effective_modulate($dst, $modulate, $blend);
+                    my $index = copyfunc_index($effective, $blend, $scale);
+                    if ( !$done{$index} ) {
+                        output_copyfunc($src, $dst, $effective, $blend, $scale);
+                        $done{$index} = 1;
+                    }
                 }
             }
         }
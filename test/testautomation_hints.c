@@ -145,6 +145,104 @@ hints_setHint(void *arg)
   return TEST_COMPLETED;
 }
 
+/* What a hint callback saw, filled in by _hintCallback() */
+typedef struct {
+  int count;
+  char oldValue[16];
+  char newValue[16];
+  char currentValue[16];
+  SDL_bool removeSelf;
+} _HintCallbackData;
+
+static void
+_copyHintValue(char *dst, const char *value)
+{
+  SDL_strlcpy(dst, value ? value : "null", 16);
+}
+
+static void SDLCALL
+_hintCallback(void *userdata, const char *name, const char *oldValue, const char *newValue)
+{
+  _HintCallbackData *data = (_HintCallbackData *)userdata;
+
+  data->count++;
+  _copyHintValue(data->oldValue, oldValue);
+  _copyHintValue(data->newValue, newValue);
+  /* Looking the hint up from the callback must not deadlock */
+  _copyHintValue(data->currentValue, SDL_GetHint(name));
+  if (data->removeSelf) {
+    SDL_DelHintCallback(name, _hintCallback, userdata);
+  }
+}
+
+/**
+ * @brief Call to SDL_AddHintCallback and SDL_DelHintCallback
+ */
+int
+hints_callbacks(void *arg)
+{
+  const char *name = "SDL_TEST_HINT_CALLBACKS";
+  _HintCallbackData watcher, remover;
+
+  SDL_zero(watcher);
+  SDL_zero(remover);
+
+  SDL_SetHint(name, "a");
+  SDL_AddHintCallback(name, _hintCallback, &watcher);
+  SDLTest_AssertPass("Call to SDL_AddHintCallback()");
+  SDLTest_AssertCheck(
+    watcher.count == 1 && SDL_strcmp(watcher.newValue, "a") == 0,
+    "Verify callback was called with the current value; got: count=%i newValue='%s'",
+    watcher.count, watcher.newValue);
+
+  SDL_SetHint(name, "b");
+  SDLTest_AssertPass("Call to SDL_SetHint(%s, b)", name);
+  SDLTest_AssertCheck(
+    watcher.count == 2 && SDL_strcmp(watcher.oldValue, "a") == 0 && SDL_strcmp(watcher.newValue, "b") == 0,
+    "Verify callback was called with old value 'a' and new value 'b'; got: count=%i oldValue='%s' newValue='%s'",
+    watcher.count, watcher.oldValue, watcher.newValue);
+  SDLTest_AssertCheck(
+    SDL_strcmp(watcher.currentValue, "a") == 0,
+    "Verify the hint still had its old value during the callback; got: '%s'",
+    watcher.currentValue);
+
+  /* Setting the same value again doesn't call anything */
+  SDL_SetHint(name, "b");
+  SDLTest_AssertCheck(
+    watcher.count == 2,
+    "Verify callback was not called for an unchanged value; got: count=%i",
+    watcher.count);
+
+  /* A callback removing itself while it runs */
+  SDL_AddHintCallback(name, _hintCallback, &remover);
+  remover.count = 0;
+  remover.removeSelf = SDL_TRUE;
+  SDL_SetHint(name, "c");
+  SDL_SetHint(name, "d");
+  SDLTest_AssertPass("Call to SDL_SetHint() with a callback removing itself");
+  SDLTest_AssertCheck(
+    remover.count == 1 && SDL_strcmp(remover.newValue, "c") == 0,
+    "Verify self-removing callback was only called once; got: count=%i newValue='%s'",
+    remover.count, remover.newValue);
+  SDLTest_AssertCheck(
+    watcher.count == 4 && SDL_strcmp(watcher.newValue, "d") == 0,
+    "Verify other callback was still called; got: count=%i newValue='%s'",
+    watcher.count, watcher.newValue);
+  SDLTest_AssertCheck(
+    SDL_strcmp(SDL_GetHint(name), "d") == 0,
+    "Verify the new value was stored; got: '%s'",
+    SDL_GetHint(name));
+
+  SDL_DelHintCallback(name, _hintCallback, &watcher);
+  SDL_SetHint(name, "e");
+  SDLTest_AssertCheck(
+    watcher.count == 4,
+    "Verify removed callback was not called; got: count=%i",
+    watcher.count);
+
+  return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Hints test cases */
@@ -154,9 +252,12 @@ static const SDLTest_TestCaseReference hintsTest1 =
 static const SDLTest_TestCaseReference hintsTest2 =
         { (SDLTest_TestCaseFp)hints_setHint, "hints_setHint", "Call to SDL_SetHint", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference hintsTest3 =
+        { (SDLTest_TestCaseFp)hints_callbacks, "hints_callbacks", "Call to SDL_AddHintCallback and SDL_DelHintCallback", TEST_ENABLED };
+
 /* Sequence of Hints test cases */
 static const SDLTest_TestCaseReference *hintsTests[] =  {
-    &hintsTest1, &hintsTest2, NULL
+    &hintsTest1, &hintsTest2, &hintsTest3, NULL
 };
 
 /* Hints test suite (global) */
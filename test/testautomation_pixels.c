@@ -500,6 +500,106 @@ pixels_calcGammaRamp(void *arg)
   return TEST_COMPLETED;
 }
 
+/* Largest difference allowed per channel after a trip through YUV */
+#define YUV_TEST_TOLERANCE 3
+
+/**
+ * @brief Converts RGB to each YUV format and back with each conversion
+ * mode, and checks the Y, U and V values of black and white.
+ *
+ * @sa http://wiki.libsdl.org/moin.fcg/SDL_ConvertPixels
+ */
+int
+pixels_convertYUV(void *arg)
+{
+  const Uint32 yuvFormats[] = {
+    SDL_PIXELFORMAT_YV12, SDL_PIXELFORMAT_IYUV, SDL_PIXELFORMAT_NV12, SDL_PIXELFORMAT_NV21,
+    SDL_PIXELFORMAT_YUY2, SDL_PIXELFORMAT_UYVY, SDL_PIXELFORMAT_YVYU
+  };
+  const SDL_YUV_CONVERSION_MODE modes[] = {
+    SDL_YUV_CONVERSION_JPEG, SDL_YUV_CONVERSION_BT601, SDL_YUV_CONVERSION_BT709
+  };
+  const char *features[] = { NULL, "0" };
+  const SDL_YUV_CONVERSION_MODE savedMode = SDL_GetYUVConversionMode();
+  const char *saved = SDL_GetHint(SDL_HINT_BLIT_CPU_FEATURES);
+  char *original = saved ? SDL_strdup(saved) : NULL;
+  const int w = 16, h = 8;
+  Uint32 rgb[16 * 8], back[16 * 8];
+  Uint8 yuv[16 * 8 * 2];
+  SDL_YUV_CONVERSION_MODE mode;
+  int f, m, c, i, x, y, ret, worst;
+
+  /* Set and get */
+  SDL_SetYUVConversionMode(SDL_YUV_CONVERSION_AUTOMATIC);
+  mode = SDL_GetYUVConversionMode();
+  SDLTest_AssertCheck(mode == SDL_YUV_CONVERSION_AUTOMATIC, "Verify SDL_GetYUVConversionMode(), expected: %i, got: %i", SDL_YUV_CONVERSION_AUTOMATIC, mode);
+  mode = SDL_GetYUVConversionModeForResolution(640, 480);
+  SDLTest_AssertCheck(mode == SDL_YUV_CONVERSION_BT601, "Verify automatic mode for 640x480, expected: %i, got: %i", SDL_YUV_CONVERSION_BT601, mode);
+  mode = SDL_GetYUVConversionModeForResolution(1920, 1080);
+  SDLTest_AssertCheck(mode == SDL_YUV_CONVERSION_BT709, "Verify automatic mode for 1920x1080, expected: %i, got: %i", SDL_YUV_CONVERSION_BT709, mode);
+
+  /* One color per 2x2 block, so no chroma is lost to subsampling */
+  for (y = 0; y < h; y++) {
+    for (x = 0; x < w; x++) {
+      const int block = (y / 2) * (w / 2) + (x / 2);
+      rgb[y * w + x] = 0xff000000 | ((block * 53 % 256) << 16) | ((block * 97 % 256) << 8) | (255 - block * 29 % 256);
+    }
+  }
+
+  for (c = 0; c < SDL_arraysize(features); c++) {
+    /* An empty value is the same as no override */
+    SDL_SetHintWithPriority(SDL_HINT_BLIT_CPU_FEATURES, features[c] ? features[c] : "", SDL_HINT_OVERRIDE);
+
+    for (m = 0; m < SDL_arraysize(modes); m++) {
+      SDL_SetYUVConversionMode(modes[m]);
+      for (f = 0; f < SDL_arraysize(yuvFormats); f++) {
+        const char *name = SDL_GetPixelFormatName(yuvFormats[f]);
+        const int packed = (yuvFormats[f] == SDL_PIXELFORMAT_YUY2 || yuvFormats[f] == SDL_PIXELFORMAT_UYVY || yuvFormats[f] == SDL_PIXELFORMAT_YVYU);
+        const int pitch = packed ? w * 2 : w;
+
+        ret = SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_ARGB8888, rgb, w * 4, yuvFormats[f], yuv, pitch);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_ConvertPixels(ARGB8888 to %s), expected: 0, got: %i", name, ret);
+        ret = SDL_ConvertPixels(w, h, yuvFormats[f], yuv, pitch, SDL_PIXELFORMAT_ARGB8888, back, w * 4);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_ConvertPixels(%s to ARGB8888), expected: 0, got: %i", name, ret);
+
+        worst = 0;
+        for (i = 0; i < w * h; i++) {
+          int shift;
+          for (shift = 0; shift < 32; shift += 8) {
+            const int diff = SDL_abs((int) ((rgb[i] >> shift) & 0xff) - (int) ((back[i] >> shift) & 0xff));
+            worst = SDL_max(worst, diff);
+          }
+        }
+        SDLTest_AssertCheck(worst <= YUV_TEST_TOLERANCE, "Verify %s round trip in mode %i with SDL_BLIT_CPU_FEATURES=%s, expected: <=%i, got: %i", name, modes[m], features[c] ? features[c] : "(unset)", YUV_TEST_TOLERANCE, worst);
+      }
+    }
+  }
+
+  /* Black and white land on the ends of the range */
+  for (m = 0; m < 2; m++) {
+    const Uint32 bw[2] = { 0xff000000, 0xffffffff };
+    const int low = (m == 0) ? 0 : 16;
+    const int high = (m == 0) ? 255 : 235;
+    Uint8 plane[2 * 2 + 2];
+
+    SDL_SetYUVConversionMode(modes[m]);
+    ret = SDL_ConvertPixels(2, 1, SDL_PIXELFORMAT_ARGB8888, bw, 8, SDL_PIXELFORMAT_YUY2, plane, 4);
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_ConvertPixels(ARGB8888 to YUY2), expected: 0, got: %i", ret);
+    SDLTest_AssertCheck(plane[0] == low && plane[2] == high, "Verify Y of black and white in mode %i, expected: %i and %i, got: %i and %i", modes[m], low, high, plane[0], plane[2]);
+    SDLTest_AssertCheck(plane[1] == 128 && plane[3] == 128, "Verify U and V of gray in mode %i, expected: 128, got: %i and %i", modes[m], plane[1], plane[3]);
+  }
+
+  /* YUV to YUV isn't supported */
+  ret = SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_YV12, yuv, w, SDL_PIXELFORMAT_NV12, back, w);
+  SDLTest_AssertCheck(ret == -1, "Verify result from SDL_ConvertPixels(YV12 to NV12), expected: -1, got: %i", ret);
+
+  SDL_SetYUVConversionMode(savedMode);
+  SDL_SetHintWithPriority(SDL_HINT_BLIT_CPU_FEATURES, original ? original : "", SDL_HINT_OVERRIDE);
+  SDL_free(original);
+
+  return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Pixels test cases */
@@ -515,9 +615,12 @@ static const SDLTest_TestCaseReference pixelsTest3 =
 static const SDLTest_TestCaseReference pixelsTest4 =
         { (SDLTest_TestCaseFp)pixels_getPixelFormatName, "pixels_getPixelFormatName", "Call to SDL_GetPixelFormatName", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference pixelsTest5 =
+        { (SDLTest_TestCaseFp)pixels_convertYUV, "pixels_convertYUV", "Call to SDL_ConvertPixels with YUV formats", TEST_ENABLED };
+
 /* Sequence of Pixels test cases */
 static const SDLTest_TestCaseReference *pixelsTests[] =  {
-    &pixelsTest1, &pixelsTest2, &pixelsTest3, &pixelsTest4, NULL
+    &pixelsTest1, &pixelsTest2, &pixelsTest3, &pixelsTest4, &pixelsTest5, NULL
 };
 
 /* Pixels test suite (global) */
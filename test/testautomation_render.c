@@ -36,6 +36,8 @@ static SDL_Texture *_loadTestFace(void);
 static int _hasBlendModes(void);
 static int _hasDrawColor(void);
 static int _isSupported(int code);
+static SDL_Renderer *_createSurfaceRenderer(SDL_Surface **surface, const char *batching);
+static Uint32 _readPixel(SDL_Renderer *target, int x, int y);
 
 /**
  * Create software renderer for tests
@@ -570,6 +572,1340 @@ render_testBlitAlpha (void *arg)
    return TEST_COMPLETED;
 }
 
+/**
+ * @brief Tests that SDL_RenderFlush draws the batched commands.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderFlush
+ * http://wiki.libsdl.org/moin.cgi/SDL_CreateSoftwareRenderer
+ */
+int
+render_testRenderFlush (void *arg)
+{
+   int ret;
+   SDL_Rect rect;
+   SDL_Surface *target;
+   SDL_Renderer *swrenderer;
+   Uint32 pixel;
+
+   /* Batched software renderer, so the surface lags behind the calls */
+   swrenderer = _createSurfaceRenderer(&target, "1");
+   if (swrenderer == NULL) {
+      return TEST_ABORTED;
+   }
+
+   ret = SDL_SetRenderDrawColor(swrenderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_SetRenderDrawColor, expected: 0, got: %i", ret);
+   ret = SDL_RenderClear(swrenderer);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderClear, expected: 0, got: %i", ret);
+   ret = SDL_SetRenderDrawColor(swrenderer, 255, 0, 0, SDL_ALPHA_OPAQUE);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_SetRenderDrawColor, expected: 0, got: %i", ret);
+   rect.x = 10;
+   rect.y = 10;
+   rect.w = 20;
+   rect.h = 20;
+   ret = SDL_RenderFillRect(swrenderer, &rect);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderFillRect, expected: 0, got: %i", ret);
+
+   /* Flush and look at the surface itself */
+   ret = SDL_RenderFlush(swrenderer);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderFlush, expected: 0, got: %i", ret);
+   pixel = *(Uint32 *)((Uint8 *)target->pixels + 15 * target->pitch + 15 * 4);
+   SDLTest_AssertCheck(pixel == 0xffff0000, "Validate filled pixel on the surface, expected: 0xffff0000, got: 0x%.8x", pixel);
+   pixel = *(Uint32 *)((Uint8 *)target->pixels + 5 * target->pitch + 5 * 4);
+   SDLTest_AssertCheck(pixel == 0xff000000, "Validate cleared pixel on the surface, expected: 0xff000000, got: 0x%.8x", pixel);
+
+   /* Nothing left to draw */
+   ret = SDL_RenderFlush(swrenderer);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderFlush with nothing queued, expected: 0, got: %i", ret);
+
+   /* Invalid renderer */
+   ret = SDL_RenderFlush(NULL);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderFlush(NULL), expected: -1, got: %i", ret);
+
+   SDL_DestroyRenderer(swrenderer);
+   SDL_FreeSurface(target);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that SDL_RenderCopyBatch draws like the single copy calls.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderCopyBatch
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderCopyEx
+ */
+int
+render_testRenderCopyBatch (void *arg)
+{
+   const SDL_Rect srcrects[] = {
+      {  0,  0, 42, 42 }, {  0,  0, 42, 42 }, { 10,  5, 20, 30 }, { 0, 0, 42, 42 }, { 0, 0, 42, 42 }, { 0, 0, 42, 42 }
+   };
+   const SDL_Rect dstrects[] = {
+      {  0,  0, 42, 42 }, { 40,  5, 30, 20 }, { 10, 30, 40, 20 }, { 50, 34, 26, 26 }, { 60, -8, 30, 30 }, { -100, -100, 10, 10 }
+   };
+   const SDL_Color colors[] = {
+      { 255, 255, 255, 255 }, { 255, 128, 0, 255 }, { 64, 255, 64, 128 }, { 255, 255, 255, 255 }, { 0, 0, 255, 200 }, { 255, 255, 255, 255 }
+   };
+   const double angles[] = { 0.0, 0.0, 90.0, 30.0, 0.0, 0.0 };
+   const SDL_RendererFlip flips[] = {
+      SDL_FLIP_NONE, SDL_FLIP_NONE, SDL_FLIP_HORIZONTAL, SDL_FLIP_NONE, SDL_FLIP_VERTICAL, SDL_FLIP_NONE
+   };
+   const int count = SDL_arraysize(dstrects);
+   SDL_Rect many[200];
+   Uint32 *reference, *batched;
+   SDL_Surface *face, *target;
+   SDL_Renderer *swrenderer;
+   SDL_Texture *tface;
+   int ret, i, differ, drawn;
+   const size_t size = TESTRENDER_SCREEN_W * TESTRENDER_SCREEN_H * 4;
+
+   swrenderer = _createSurfaceRenderer(&target, "1");
+   if (swrenderer == NULL) {
+      return TEST_ABORTED;
+   }
+   face = SDLTest_ImageFace();
+   SDLTest_AssertCheck(face != NULL, "Verify SDLTest_ImageFace() result");
+   tface = face ? SDL_CreateTextureFromSurface(swrenderer, face) : NULL;
+   SDLTest_AssertCheck(tface != NULL, "Verify SDL_CreateTextureFromSurface() result");
+   SDL_FreeSurface(face);
+   reference = (Uint32 *)SDL_malloc(size);
+   batched = (Uint32 *)SDL_malloc(size);
+   if (tface == NULL || reference == NULL || batched == NULL) {
+      SDL_free(reference);
+      SDL_free(batched);
+      SDL_DestroyRenderer(swrenderer);
+      SDL_FreeSurface(target);
+      return TEST_ABORTED;
+   }
+
+   /* One call per copy */
+   SDL_SetRenderDrawColor(swrenderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+   SDL_RenderClear(swrenderer);
+   for (i = 0; i < count; i++) {
+      SDL_SetTextureColorMod(tface, colors[i].r, colors[i].g, colors[i].b);
+      SDL_SetTextureAlphaMod(tface, colors[i].a);
+      ret = SDL_RenderCopyEx(swrenderer, tface, &srcrects[i], &dstrects[i], angles[i], NULL, flips[i]);
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopyEx, expected: 0, got: %i", ret);
+   }
+   ret = SDL_RenderReadPixels(swrenderer, NULL, RENDER_COMPARE_FORMAT, reference, TESTRENDER_SCREEN_W * 4);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels, expected: 0, got: %i", ret);
+   for (i = 0, drawn = 0; i < TESTRENDER_SCREEN_W * TESTRENDER_SCREEN_H; i++) {
+      drawn += (reference[i] != 0xff000000);
+   }
+   SDLTest_AssertCheck(drawn > 0, "Validate single copies drew something, got: %i pixels", drawn);
+
+   /* All of them at once */
+   SDL_SetTextureColorMod(tface, 255, 255, 255);
+   SDL_SetTextureAlphaMod(tface, 255);
+   SDL_RenderClear(swrenderer);
+   ret = SDL_RenderCopyBatch(swrenderer, tface, srcrects, dstrects, colors, angles, flips, count);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopyBatch, expected: 0, got: %i", ret);
+   ret = SDL_RenderReadPixels(swrenderer, NULL, RENDER_COMPARE_FORMAT, batched, TESTRENDER_SCREEN_W * 4);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels, expected: 0, got: %i", ret);
+   for (i = 0, differ = 0; i < TESTRENDER_SCREEN_W * TESTRENDER_SCREEN_H; i++) {
+      differ += (reference[i] != batched[i]);
+   }
+   SDLTest_AssertCheck(differ == 0, "Validate batched copies match single copies, expected: 0 pixels differ, got: %i", differ);
+
+   /* More copies than are prepared at a time, without the optional arrays */
+   for (i = 0; i < SDL_arraysize(many); i++) {
+      many[i].x = (i * 7) % TESTRENDER_SCREEN_W - 4;
+      many[i].y = (i * 13) % TESTRENDER_SCREEN_H - 4;
+      many[i].w = 8 + i % 5;
+      many[i].h = 8 + i % 3;
+   }
+   SDL_RenderClear(swrenderer);
+   for (i = 0; i < SDL_arraysize(many); i++) {
+      SDL_RenderCopy(swrenderer, tface, NULL, &many[i]);
+   }
+   SDL_RenderReadPixels(swrenderer, NULL, RENDER_COMPARE_FORMAT, reference, TESTRENDER_SCREEN_W * 4);
+   SDL_RenderClear(swrenderer);
+   ret = SDL_RenderCopyBatch(swrenderer, tface, NULL, many, NULL, NULL, NULL, SDL_arraysize(many));
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopyBatch, expected: 0, got: %i", ret);
+   SDL_RenderReadPixels(swrenderer, NULL, RENDER_COMPARE_FORMAT, batched, TESTRENDER_SCREEN_W * 4);
+   for (i = 0, differ = 0; i < TESTRENDER_SCREEN_W * TESTRENDER_SCREEN_H; i++) {
+      differ += (reference[i] != batched[i]);
+   }
+   SDLTest_AssertCheck(differ == 0, "Validate large batch matches single copies, expected: 0 pixels differ, got: %i", differ);
+
+   /* Nothing to draw, and invalid parameters */
+   ret = SDL_RenderCopyBatch(swrenderer, tface, NULL, dstrects, NULL, NULL, NULL, 0);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopyBatch with no copies, expected: 0, got: %i", ret);
+   ret = SDL_RenderCopyBatch(swrenderer, tface, NULL, NULL, NULL, NULL, NULL, count);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderCopyBatch with NULL dstrects, expected: -1, got: %i", ret);
+   ret = SDL_RenderCopyBatch(swrenderer, NULL, NULL, dstrects, NULL, NULL, NULL, count);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderCopyBatch with NULL texture, expected: -1, got: %i", ret);
+   ret = SDL_RenderCopyBatch(NULL, tface, NULL, dstrects, NULL, NULL, NULL, count);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderCopyBatch with NULL renderer, expected: -1, got: %i", ret);
+
+   SDL_free(reference);
+   SDL_free(batched);
+   SDL_DestroyTexture(tface);
+   SDL_DestroyRenderer(swrenderer);
+   SDL_FreeSurface(target);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests SDL_RenderGeometry argument checking and what it draws.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderGeometry
+ */
+int
+render_testRenderGeometry (void *arg)
+{
+   const int quad[] = { 0, 1, 2, 0, 2, 3 };
+   const int badIndices[] = { 0, 1, 4 };
+   const int negativeIndices[] = { 0, -1, 2 };
+   const Uint32 texels[] = { 0xffff0000, 0xff00ff00, 0xff0000ff, 0xffffffff };
+   SDL_Vertex vertices[6];
+   SDL_Vertex unrolled[6];
+   Uint32 *indexed, *listed;
+   SDL_Surface *target;
+   SDL_Renderer *swrenderer;
+   SDL_Texture *texture;
+   Uint32 pixel;
+   int ret, i, differ;
+   int r, g, b;
+   const size_t size = TESTRENDER_SCREEN_W * TESTRENDER_SCREEN_H * 4;
+
+   swrenderer = _createSurfaceRenderer(&target, "0");
+   if (swrenderer == NULL) {
+      return TEST_ABORTED;
+   }
+
+   /* A quad from (10,10) to (50,40) */
+   SDL_zero(vertices);
+   vertices[0].position.x = 10.0f; vertices[0].position.y = 10.0f;
+   vertices[1].position.x = 50.0f; vertices[1].position.y = 10.0f;
+   vertices[2].position.x = 50.0f; vertices[2].position.y = 40.0f;
+   vertices[3].position.x = 10.0f; vertices[3].position.y = 40.0f;
+   vertices[0].tex_coord.x = 0.0f; vertices[0].tex_coord.y = 0.0f;
+   vertices[1].tex_coord.x = 1.0f; vertices[1].tex_coord.y = 0.0f;
+   vertices[2].tex_coord.x = 1.0f; vertices[2].tex_coord.y = 1.0f;
+   vertices[3].tex_coord.x = 0.0f; vertices[3].tex_coord.y = 1.0f;
+   for (i = 0; i < 4; i++) {
+      vertices[i].color.r = 255;
+      vertices[i].color.a = 255;
+   }
+   for (i = 0; i < SDL_arraysize(quad); i++) {
+      unrolled[i] = vertices[quad[i]];
+   }
+
+   /* Invalid parameters */
+   ret = SDL_RenderGeometry(swrenderer, NULL, NULL, 4, quad, 6);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderGeometry with NULL vertices, expected: -1, got: %i", ret);
+   ret = SDL_RenderGeometry(swrenderer, NULL, vertices, 4, NULL, 0);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderGeometry with 4 vertices, expected: -1, got: %i", ret);
+   ret = SDL_RenderGeometry(swrenderer, NULL, vertices, 4, quad, 5);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderGeometry with 5 indices, expected: -1, got: %i", ret);
+   ret = SDL_RenderGeometry(swrenderer, NULL, vertices, 4, badIndices, 3);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderGeometry with index 4 of 4 vertices, expected: -1, got: %i", ret);
+   ret = SDL_RenderGeometry(swrenderer, NULL, vertices, 4, negativeIndices, 3);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderGeometry with index -1, expected: -1, got: %i", ret);
+   ret = SDL_RenderGeometry(NULL, NULL, vertices, 3, NULL, 0);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderGeometry with NULL renderer, expected: -1, got: %i", ret);
+   ret = SDL_RenderGeometry(swrenderer, NULL, vertices, 0, NULL, 0);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGeometry with no vertices, expected: 0, got: %i", ret);
+
+   /* The window renderer may not do triangles at all */
+   if (renderer != NULL) {
+      ret = SDL_RenderGeometry(renderer, NULL, vertices, 4, quad, 6);
+      SDLTest_AssertCheck(ret == 0 || SDL_strcmp(SDL_GetError(), "That operation is not supported") == 0,
+                          "Validate SDL_RenderGeometry either draws or is unsupported, got: %i (%s)", ret, ret == 0 ? "" : SDL_GetError());
+   }
+
+   indexed = (Uint32 *)SDL_malloc(size);
+   listed = (Uint32 *)SDL_malloc(size);
+   if (indexed == NULL || listed == NULL) {
+      SDL_free(indexed);
+      SDL_free(listed);
+      SDL_DestroyRenderer(swrenderer);
+      SDL_FreeSurface(target);
+      return TEST_ABORTED;
+   }
+
+   /* Solid color quad, indexed and as a list */
+   SDL_SetRenderDrawColor(swrenderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+   SDL_SetRenderDrawBlendMode(swrenderer, SDL_BLENDMODE_NONE);
+   SDL_RenderClear(swrenderer);
+   ret = SDL_RenderGeometry(swrenderer, NULL, vertices, 4, quad, SDL_arraysize(quad));
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGeometry, expected: 0, got: %i", ret);
+   pixel = _readPixel(swrenderer, 30, 25);
+   SDLTest_AssertCheck(pixel == 0xffff0000, "Validate pixel inside the quad, expected: 0xffff0000, got: 0x%.8x", pixel);
+   pixel = _readPixel(swrenderer, 11, 39);
+   SDLTest_AssertCheck(pixel == 0xffff0000, "Validate pixel inside a corner of the quad, expected: 0xffff0000, got: 0x%.8x", pixel);
+   pixel = _readPixel(swrenderer, 5, 5);
+   SDLTest_AssertCheck(pixel == 0xff000000, "Validate pixel outside the quad, expected: 0xff000000, got: 0x%.8x", pixel);
+   pixel = _readPixel(swrenderer, 55, 25);
+   SDLTest_AssertCheck(pixel == 0xff000000, "Validate pixel outside the quad, expected: 0xff000000, got: 0x%.8x", pixel);
+   SDL_RenderReadPixels(swrenderer, NULL, RENDER_COMPARE_FORMAT, indexed, TESTRENDER_SCREEN_W * 4);
+
+   SDL_RenderClear(swrenderer);
+   ret = SDL_RenderGeometry(swrenderer, NULL, unrolled, SDL_arraysize(unrolled), NULL, 0);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGeometry, expected: 0, got: %i", ret);
+   SDL_RenderReadPixels(swrenderer, NULL, RENDER_COMPARE_FORMAT, listed, TESTRENDER_SCREEN_W * 4);
+   for (i = 0, differ = 0; i < TESTRENDER_SCREEN_W * TESTRENDER_SCREEN_H; i++) {
+      differ += (indexed[i] != listed[i]);
+   }
+   SDLTest_AssertCheck(differ == 0, "Validate indexed and listed vertices draw the same, expected: 0 pixels differ, got: %i", differ);
+
+   /* Colors are interpolated, the middle of the triangle mixes all three */
+   SDL_RenderClear(swrenderer);
+   vertices[0].position.x = 10.0f; vertices[0].position.y = 10.0f;
+   vertices[1].position.x = 70.0f; vertices[1].position.y = 10.0f;
+   vertices[2].position.x = 40.0f; vertices[2].position.y = 55.0f;
+   vertices[1].color.r = 0; vertices[1].color.g = 255;
+   vertices[2].color.r = 0; vertices[2].color.b = 255;
+   ret = SDL_RenderGeometry(swrenderer, NULL, vertices, 3, NULL, 0);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGeometry, expected: 0, got: %i", ret);
+   pixel = _readPixel(swrenderer, 40, 25);
+   r = (pixel >> 16) & 0xff;
+   g = (pixel >> 8) & 0xff;
+   b = pixel & 0xff;
+   SDLTest_AssertCheck(SDL_abs(r - 85) <= 12 && SDL_abs(g - 85) <= 12 && SDL_abs(b - 85) <= 12,
+                       "Validate interpolated color at the centroid, expected: about 85,85,85, got: %i,%i,%i", r, g, b);
+
+   /* Textured quad, one texel per quarter */
+   texture = SDL_CreateTexture(swrenderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 2, 2);
+   SDLTest_AssertCheck(texture != NULL, "Verify result from SDL_CreateTexture is not NULL");
+   if (texture != NULL) {
+      static const struct { int x, y; int texel; } samples[] = {
+         { 15, 15, 0 }, { 45, 15, 1 }, { 15, 35, 2 }, { 45, 35, 3 }
+      };
+
+      SDL_UpdateTexture(texture, NULL, texels, 2 * 4);
+      SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+      vertices[1].position.x = 50.0f; vertices[1].position.y = 10.0f;
+      vertices[2].position.x = 50.0f; vertices[2].position.y = 40.0f;
+      for (i = 0; i < 4; i++) {
+         vertices[i].color.r = vertices[i].color.g = vertices[i].color.b = vertices[i].color.a = 255;
+      }
+      SDL_RenderClear(swrenderer);
+      ret = SDL_RenderGeometry(swrenderer, texture, vertices, 4, quad, SDL_arraysize(quad));
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGeometry with a texture, expected: 0, got: %i", ret);
+      for (i = 0; i < SDL_arraysize(samples); i++) {
+         pixel = _readPixel(swrenderer, samples[i].x, samples[i].y);
+         SDLTest_AssertCheck(pixel == texels[samples[i].texel], "Validate textured pixel at %i,%i, expected: 0x%.8x, got: 0x%.8x",
+                             samples[i].x, samples[i].y, texels[samples[i].texel], pixel);
+      }
+
+      /* The vertex color modulates the texels */
+      for (i = 0; i < 4; i++) {
+         vertices[i].color.g = vertices[i].color.b = 0;
+      }
+      ret = SDL_RenderGeometry(swrenderer, texture, vertices, 4, quad, SDL_arraysize(quad));
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGeometry with a texture, expected: 0, got: %i", ret);
+      pixel = _readPixel(swrenderer, 45, 35);
+      SDLTest_AssertCheck(pixel == 0xffff0000, "Validate modulated white texel, expected: 0xffff0000, got: 0x%.8x", pixel);
+      pixel = _readPixel(swrenderer, 45, 15);
+      SDLTest_AssertCheck(pixel == 0xff000000, "Validate modulated green texel, expected: 0xff000000, got: 0x%.8x", pixel);
+
+      SDL_DestroyTexture(texture);
+   }
+
+   SDL_free(indexed);
+   SDL_free(listed);
+   SDL_DestroyRenderer(swrenderer);
+   SDL_FreeSurface(target);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Draws the same primitives and copies with the int calls or their
+ * float variants. Helper function.
+ */
+static void
+_drawFloatScene(SDL_Renderer *target, SDL_Texture *texture, int useFloat)
+{
+   const SDL_Point points[] = { { 2, 2 }, { 4, 3 }, { 6, 2 }, { 38, 28 } };
+   const SDL_Point lines[] = { { 1, 25 }, { 20, 5 }, { 39, 25 }, { 1, 25 } };
+   const SDL_Rect rects[] = { { 3, 12, 10, 6 }, { 25, 2, 12, 9 } };
+   const SDL_Rect copy = { 14, 14, 12, 12 };
+   const SDL_Rect copyEx = { 26, 14, 10, 14 };
+   SDL_FPoint fpoints[SDL_arraysize(points)];
+   SDL_FPoint flines[SDL_arraysize(lines)];
+   SDL_FRect frects[SDL_arraysize(rects)];
+   SDL_FRect fcopy, fcopyEx;
+   int i;
+
+   if (!useFloat) {
+      SDL_RenderDrawPoint(target, 1, 1);
+      SDL_RenderDrawPoints(target, points, SDL_arraysize(points));
+      SDL_RenderDrawLine(target, 0, 29, 39, 0);
+      SDL_RenderDrawLines(target, lines, SDL_arraysize(lines));
+      SDL_RenderDrawRect(target, &rects[0]);
+      SDL_RenderDrawRects(target, rects, SDL_arraysize(rects));
+      SDL_RenderFillRect(target, &rects[1]);
+      SDL_RenderFillRects(target, rects, 1);
+      SDL_RenderCopy(target, texture, NULL, &copy);
+      SDL_RenderCopyEx(target, texture, NULL, &copyEx, 90.0, NULL, SDL_FLIP_VERTICAL);
+      return;
+   }
+
+   for (i = 0; i < SDL_arraysize(points); i++) {
+      fpoints[i].x = (float)points[i].x;
+      fpoints[i].y = (float)points[i].y;
+   }
+   for (i = 0; i < SDL_arraysize(lines); i++) {
+      flines[i].x = (float)lines[i].x;
+      flines[i].y = (float)lines[i].y;
+   }
+   for (i = 0; i < SDL_arraysize(rects); i++) {
+      frects[i].x = (float)rects[i].x;
+      frects[i].y = (float)rects[i].y;
+      frects[i].w = (float)rects[i].w;
+      frects[i].h = (float)rects[i].h;
+   }
+   fcopy.x = (float)copy.x;
+   fcopy.y = (float)copy.y;
+   fcopy.w = (float)copy.w;
+   fcopy.h = (float)copy.h;
+   fcopyEx.x = (float)copyEx.x;
+   fcopyEx.y = (float)copyEx.y;
+   fcopyEx.w = (float)copyEx.w;
+   fcopyEx.h = (float)copyEx.h;
+
+   SDL_RenderDrawPointF(target, 1.0f, 1.0f);
+   SDL_RenderDrawPointsF(target, fpoints, SDL_arraysize(fpoints));
+   SDL_RenderDrawLineF(target, 0.0f, 29.0f, 39.0f, 0.0f);
+   SDL_RenderDrawLinesF(target, flines, SDL_arraysize(flines));
+   SDL_RenderDrawRectF(target, &frects[0]);
+   SDL_RenderDrawRectsF(target, frects, SDL_arraysize(frects));
+   SDL_RenderFillRectF(target, &frects[1]);
+   SDL_RenderFillRectsF(target, frects, 1);
+   SDL_RenderCopyF(target, texture, NULL, &fcopy);
+   SDL_RenderCopyExF(target, texture, NULL, &fcopyEx, 90.0, NULL, SDL_FLIP_VERTICAL);
+}
+
+/**
+ * @brief Tests that the float variants of the drawing calls match the int
+ * ones at whole coordinates, with and without scaling.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderDrawPointF
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderDrawLinesF
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderFillRectsF
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderCopyExF
+ */
+int
+render_testFloatVariants (void *arg)
+{
+   Uint32 *reference, *floats;
+   SDL_Surface *face, *target;
+   SDL_Renderer *swrenderer;
+   SDL_Texture *tface;
+   SDL_FRect frect;
+   Uint32 pixel;
+   int ret, i, scale, differ, drawn;
+   const size_t size = TESTRENDER_SCREEN_W * TESTRENDER_SCREEN_H * 4;
+
+   swrenderer = _createSurfaceRenderer(&target, "0");
+   if (swrenderer == NULL) {
+      return TEST_ABORTED;
+   }
+   face = SDLTest_ImageFace();
+   SDLTest_AssertCheck(face != NULL, "Verify SDLTest_ImageFace() result");
+   tface = face ? SDL_CreateTextureFromSurface(swrenderer, face) : NULL;
+   SDLTest_AssertCheck(tface != NULL, "Verify SDL_CreateTextureFromSurface() result");
+   SDL_FreeSurface(face);
+   reference = (Uint32 *)SDL_malloc(size);
+   floats = (Uint32 *)SDL_malloc(size);
+   if (tface == NULL || reference == NULL || floats == NULL) {
+      SDL_free(reference);
+      SDL_free(floats);
+      SDL_DestroyRenderer(swrenderer);
+      SDL_FreeSurface(target);
+      return TEST_ABORTED;
+   }
+
+   for (scale = 1; scale <= 2; scale++) {
+      ret = SDL_RenderSetScale(swrenderer, (float)scale, (float)scale);
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderSetScale, expected: 0, got: %i", ret);
+
+      SDL_SetRenderDrawColor(swrenderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+      SDL_RenderClear(swrenderer);
+      SDL_SetRenderDrawColor(swrenderer, 255, 255, 0, SDL_ALPHA_OPAQUE);
+      _drawFloatScene(swrenderer, tface, 0);
+      SDL_RenderReadPixels(swrenderer, NULL, RENDER_COMPARE_FORMAT, reference, TESTRENDER_SCREEN_W * 4);
+
+      SDL_SetRenderDrawColor(swrenderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+      SDL_RenderClear(swrenderer);
+      SDL_SetRenderDrawColor(swrenderer, 255, 255, 0, SDL_ALPHA_OPAQUE);
+      _drawFloatScene(swrenderer, tface, 1);
+      SDL_RenderReadPixels(swrenderer, NULL, RENDER_COMPARE_FORMAT, floats, TESTRENDER_SCREEN_W * 4);
+
+      for (i = 0, differ = 0, drawn = 0; i < TESTRENDER_SCREEN_W * TESTRENDER_SCREEN_H; i++) {
+         differ += (reference[i] != floats[i]);
+         drawn += (reference[i] != 0xff000000);
+      }
+      SDLTest_AssertCheck(drawn > 0, "Validate the scene drew something at scale %i, got: %i pixels", scale, drawn);
+      SDLTest_AssertCheck(differ == 0, "Validate float variants match at scale %i, expected: 0 pixels differ, got: %i", scale, differ);
+   }
+   SDL_RenderSetScale(swrenderer, 1.0f, 1.0f);
+
+   /* Fractional coordinates still draw */
+   SDL_SetRenderDrawColor(swrenderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+   SDL_RenderClear(swrenderer);
+   SDL_SetRenderDrawColor(swrenderer, 255, 255, 0, SDL_ALPHA_OPAQUE);
+   frect.x = 10.25f;
+   frect.y = 10.5f;
+   frect.w = 9.5f;
+   frect.h = 9.75f;
+   ret = SDL_RenderFillRectF(swrenderer, &frect);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderFillRectF, expected: 0, got: %i", ret);
+   pixel = _readPixel(swrenderer, 15, 15);
+   SDLTest_AssertCheck(pixel == 0xffffff00, "Validate pixel inside a fractional rectangle, expected: 0xffffff00, got: 0x%.8x", pixel);
+
+   /* Invalid parameters */
+   ret = SDL_RenderDrawPointsF(swrenderer, NULL, 1);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderDrawPointsF with NULL points, expected: -1, got: %i", ret);
+   ret = SDL_RenderDrawLinesF(swrenderer, NULL, 2);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderDrawLinesF with NULL points, expected: -1, got: %i", ret);
+   ret = SDL_RenderFillRectsF(swrenderer, NULL, 1);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderFillRectsF with NULL rects, expected: -1, got: %i", ret);
+   ret = SDL_RenderCopyF(swrenderer, NULL, NULL, &frect);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderCopyF with NULL texture, expected: -1, got: %i", ret);
+   ret = SDL_RenderDrawPointF(NULL, 1.0f, 1.0f);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderDrawPointF with NULL renderer, expected: -1, got: %i", ret);
+
+   SDL_free(reference);
+   SDL_free(floats);
+   SDL_DestroyTexture(tface);
+   SDL_DestroyRenderer(swrenderer);
+   SDL_FreeSurface(target);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Checks that a rectangle has the expected position and size. Helper function.
+ */
+static void
+_checkRect(const SDL_Rect *rect, int x, int y, int w, int h, const char *what)
+{
+   SDLTest_AssertCheck(rect->x == x && rect->y == y && rect->w == w && rect->h == h,
+                       "Validate %s, expected: %i,%i %ix%i, got: %i,%i %ix%i",
+                       what, x, y, w, h, rect->x, rect->y, rect->w, rect->h);
+}
+
+/**
+ * @brief Tests the areas reported by SDL_RenderGetDamageRects.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderGetDamageRects
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderPresent
+ */
+int
+render_testDamageRects (void *arg)
+{
+   const SDL_Rect first = { 10, 10, 5, 5 };
+   const SDL_Rect second = { 60, 40, 4, 4 };
+   SDL_Rect clip;
+   SDL_Rect rects[4];
+   SDL_Surface *target;
+   SDL_Renderer *swrenderer;
+   int ret;
+
+   swrenderer = _createSurfaceRenderer(&target, "1");
+   if (swrenderer == NULL) {
+      return TEST_ABORTED;
+   }
+
+   /* Nothing drawn yet */
+   ret = SDL_RenderGetDamageRects(swrenderer, NULL, 0);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGetDamageRects before drawing, expected: 0, got: %i", ret);
+
+   /* Areas far apart are kept apart */
+   SDL_SetRenderDrawColor(swrenderer, 255, 255, 255, SDL_ALPHA_OPAQUE);
+   SDL_RenderFillRect(swrenderer, &first);
+   ret = SDL_RenderGetDamageRects(swrenderer, rects, SDL_arraysize(rects));
+   SDLTest_AssertCheck(ret == 1, "Validate result from SDL_RenderGetDamageRects, expected: 1, got: %i", ret);
+   _checkRect(&rects[0], 10, 10, 5, 5, "damage of one rectangle");
+
+   SDL_RenderFillRect(swrenderer, &second);
+   ret = SDL_RenderGetDamageRects(swrenderer, NULL, 0);
+   SDLTest_AssertCheck(ret == 2, "Validate count from SDL_RenderGetDamageRects, expected: 2, got: %i", ret);
+   ret = SDL_RenderGetDamageRects(swrenderer, rects, SDL_arraysize(rects));
+   SDLTest_AssertCheck(ret == 2, "Validate result from SDL_RenderGetDamageRects, expected: 2, got: %i", ret);
+   if (ret == 2) {
+      const int swap = (rects[0].x != first.x);
+      _checkRect(&rects[swap], 10, 10, 5, 5, "damage of the first rectangle");
+      _checkRect(&rects[!swap], 60, 40, 4, 4, "damage of the second rectangle");
+   }
+
+   /* Without room for both, the last rectangle is the union */
+   ret = SDL_RenderGetDamageRects(swrenderer, rects, 1);
+   SDLTest_AssertCheck(ret == 1, "Validate result from SDL_RenderGetDamageRects with room for one, expected: 1, got: %i", ret);
+   _checkRect(&rects[0], 10, 10, 54, 34, "damage with room for one rectangle");
+
+   /* Presenting starts over */
+   SDL_RenderPresent(swrenderer);
+   ret = SDL_RenderGetDamageRects(swrenderer, NULL, 0);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGetDamageRects after present, expected: 0, got: %i", ret);
+
+   /* Drawing is clipped */
+   clip.x = 0;
+   clip.y = 0;
+   clip.w = 12;
+   clip.h = 12;
+   SDL_RenderSetClipRect(swrenderer, &clip);
+   SDL_RenderFillRect(swrenderer, &first);
+   SDL_RenderSetClipRect(swrenderer, NULL);
+   ret = SDL_RenderGetDamageRects(swrenderer, rects, SDL_arraysize(rects));
+   SDLTest_AssertCheck(ret == 1, "Validate result from SDL_RenderGetDamageRects, expected: 1, got: %i", ret);
+   _checkRect(&rects[0], 10, 10, 2, 2, "damage of a clipped rectangle");
+
+   /* Clearing damages the whole output */
+   SDL_RenderClear(swrenderer);
+   ret = SDL_RenderGetDamageRects(swrenderer, rects, SDL_arraysize(rects));
+   SDLTest_AssertCheck(ret == 1, "Validate result from SDL_RenderGetDamageRects after clear, expected: 1, got: %i", ret);
+   _checkRect(&rects[0], 0, 0, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, "damage after clear");
+
+   /* Invalid parameters */
+   ret = SDL_RenderGetDamageRects(swrenderer, rects, 0);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderGetDamageRects with no room, expected: -1, got: %i", ret);
+   ret = SDL_RenderGetDamageRects(NULL, rects, SDL_arraysize(rects));
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderGetDamageRects with NULL renderer, expected: -1, got: %i", ret);
+
+   SDL_DestroyRenderer(swrenderer);
+   SDL_FreeSurface(target);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Creates a surface of one opaque color. Helper function.
+ */
+static SDL_Surface *
+_createColorSurface(int w, int h, Uint32 color)
+{
+   SDL_Surface *surface;
+
+   surface = SDL_CreateRGBSurface(0, w, h, 32,
+                                  RENDER_COMPARE_RMASK, RENDER_COMPARE_GMASK, RENDER_COMPARE_BMASK, RENDER_COMPARE_AMASK);
+   if (surface != NULL) {
+      SDL_FillRect(surface, NULL, color);
+   }
+   return surface;
+}
+
+/**
+ * @brief Tests packing images into a texture atlas and drawing them.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_CreateTextureAtlas
+ * http://wiki.libsdl.org/moin.cgi/SDL_AddAtlasImage
+ * http://wiki.libsdl.org/moin.cgi/SDL_QueryAtlasImage
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderCopyAtlas
+ * http://wiki.libsdl.org/moin.cgi/SDL_DestroyTextureAtlas
+ */
+int
+render_testTextureAtlas (void *arg)
+{
+   const Uint32 colors[] = { 0xffff0000, 0xff00ff00, 0xff0000ff };
+   SDL_TextureAtlas *atlas;
+   SDL_Surface *target, *image;
+   SDL_Renderer *swrenderer;
+   SDL_Texture *pages[3], *page;
+   SDL_Rect rects[3], rect, src, dst;
+   Uint32 pixel;
+   int handles[3], big, handle, newPage, mismatches;
+   int ret, i, j;
+
+   swrenderer = _createSurfaceRenderer(&target, "0");
+   if (swrenderer == NULL) {
+      return TEST_ABORTED;
+   }
+
+   /* Invalid parameters */
+   atlas = SDL_CreateTextureAtlas(NULL, 0, 64, 64);
+   SDLTest_AssertCheck(atlas == NULL, "Validate result from SDL_CreateTextureAtlas with NULL renderer, expected: NULL, got: %p", (void *)atlas);
+   atlas = SDL_CreateTextureAtlas(swrenderer, 0, -1, 64);
+   SDLTest_AssertCheck(atlas == NULL, "Validate result from SDL_CreateTextureAtlas with negative width, expected: NULL, got: %p", (void *)atlas);
+   atlas = SDL_CreateTextureAtlas(swrenderer, SDL_PIXELFORMAT_YV12, 64, 64);
+   SDLTest_AssertCheck(atlas == NULL, "Validate result from SDL_CreateTextureAtlas with a YUV format, expected: NULL, got: %p", (void *)atlas);
+   SDL_DestroyTextureAtlas(NULL);
+   SDLTest_AssertPass("Call to SDL_DestroyTextureAtlas(NULL)");
+
+   atlas = SDL_CreateTextureAtlas(swrenderer, 0, 64, 64);
+   SDLTest_AssertCheck(atlas != NULL, "Verify result from SDL_CreateTextureAtlas is not NULL");
+   if (atlas == NULL) {
+      SDL_DestroyRenderer(swrenderer);
+      SDL_FreeSurface(target);
+      return TEST_ABORTED;
+   }
+
+   /* Small images share a page without overlapping */
+   for (i = 0; i < SDL_arraysize(colors); i++) {
+      image = _createColorSurface(10 + i, 12, colors[i]);
+      handles[i] = SDL_AddAtlasImage(atlas, image);
+      SDL_FreeSurface(image);
+      SDLTest_AssertCheck(handles[i] == i, "Validate result from SDL_AddAtlasImage, expected: %i, got: %i", i, handles[i]);
+      ret = SDL_QueryAtlasImage(atlas, handles[i], &pages[i], &rects[i]);
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDL_QueryAtlasImage, expected: 0, got: %i", ret);
+      SDLTest_AssertCheck(rects[i].w == 10 + i && rects[i].h == 12, "Validate size of atlas image %i, expected: %ix12, got: %ix%i", i, 10 + i, rects[i].w, rects[i].h);
+   }
+   for (i = 0; i < SDL_arraysize(colors); i++) {
+      SDLTest_AssertCheck(pages[i] == pages[0], "Validate atlas image %i is on the first page", i);
+      for (j = i + 1; j < SDL_arraysize(colors); j++) {
+         SDLTest_AssertCheck(!SDL_HasIntersection(&rects[i], &rects[j]), "Validate atlas images %i and %i don't overlap", i, j);
+      }
+   }
+
+   /* An image larger than a page gets one of its own */
+   image = _createColorSurface(100, 20, 0xffffffff);
+   big = SDL_AddAtlasImage(atlas, image);
+   SDL_FreeSurface(image);
+   SDLTest_AssertCheck(big == 3, "Validate result from SDL_AddAtlasImage for a big image, expected: 3, got: %i", big);
+   ret = SDL_QueryAtlasImage(atlas, big, &page, &rect);
+   SDLTest_AssertCheck(ret == 0 && page != pages[0] && rect.w == 100 && rect.h == 20,
+                       "Validate big atlas image has its own page, got: %i, %ix%i", ret, rect.w, rect.h);
+
+   /* Filling up the page starts another one */
+   newPage = 0;
+   for (i = 0; i < 16 && !newPage; i++) {
+      image = _createColorSurface(20, 20, 0xff808080);
+      handle = SDL_AddAtlasImage(atlas, image);
+      SDL_FreeSurface(image);
+      SDLTest_AssertCheck(handle >= 0, "Validate result from SDL_AddAtlasImage, expected: >= 0, got: %i", handle);
+      SDL_QueryAtlasImage(atlas, handle, &page, NULL);
+      newPage = (page != pages[0]);
+   }
+   SDLTest_AssertCheck(newPage, "Validate a full atlas page starts another one");
+
+   /* Drawing whole images and parts of them */
+   SDL_SetRenderDrawColor(swrenderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+   SDL_RenderClear(swrenderer);
+   for (i = 0; i < SDL_arraysize(colors); i++) {
+      dst.x = i * 20;
+      dst.y = 0;
+      dst.w = rects[i].w;
+      dst.h = rects[i].h;
+      ret = SDL_RenderCopyAtlas(swrenderer, atlas, handles[i], NULL, &dst);
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopyAtlas, expected: 0, got: %i", ret);
+   }
+   for (i = 0; i < SDL_arraysize(colors); i++) {
+      pixel = _readPixel(swrenderer, i * 20 + 5, 6);
+      SDLTest_AssertCheck(pixel == colors[i], "Validate atlas image %i drawn, expected: 0x%.8x, got: 0x%.8x", i, colors[i], pixel);
+   }
+
+   /* A source rectangle reaching out of the image is clipped to it */
+   src.x = 5;
+   src.y = 6;
+   src.w = 40;
+   src.h = 40;
+   dst.x = 10;
+   dst.y = 30;
+   dst.w = 40;
+   dst.h = 20;
+   ret = SDL_RenderCopyAtlas(swrenderer, atlas, handles[1], &src, &dst);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopyAtlas with a source rectangle, expected: 0, got: %i", ret);
+   mismatches = 0;
+   for (j = dst.y; j < dst.y + dst.h; j += 4) {
+      for (i = dst.x; i < dst.x + dst.w; i += 4) {
+         mismatches += (_readPixel(swrenderer, i, j) != colors[1]);
+      }
+   }
+   SDLTest_AssertCheck(mismatches == 0, "Validate clipped atlas image has no pixels of its neighbors, expected: 0 mismatches, got: %i", mismatches);
+
+   /* Invalid images */
+   ret = SDL_QueryAtlasImage(atlas, -1, &page, &rect);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_QueryAtlasImage with image -1, expected: -1, got: %i", ret);
+   ret = SDL_QueryAtlasImage(atlas, 1000, NULL, NULL);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_QueryAtlasImage with image 1000, expected: -1, got: %i", ret);
+   ret = SDL_RenderCopyAtlas(swrenderer, atlas, 1000, NULL, NULL);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderCopyAtlas with image 1000, expected: -1, got: %i", ret);
+   ret = SDL_AddAtlasImage(atlas, NULL);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_AddAtlasImage with NULL surface, expected: -1, got: %i", ret);
+   if (renderer != NULL) {
+      ret = SDL_RenderCopyAtlas(renderer, atlas, handles[0], NULL, NULL);
+      SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderCopyAtlas with another renderer, expected: -1, got: %i", ret);
+   }
+
+   SDL_DestroyTextureAtlas(atlas);
+   SDLTest_AssertPass("Call to SDL_DestroyTextureAtlas()");
+   SDL_DestroyRenderer(swrenderer);
+   SDL_FreeSurface(target);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests textures that draw straight from the pixels of a surface.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_CreateTextureWrappingSurface
+ */
+int
+render_testTextureWrappingSurface (void *arg)
+{
+   SDL_Surface *target, *surface, *indexed;
+   SDL_Renderer *swrenderer;
+   SDL_Texture *texture;
+   SDL_BlendMode blendMode;
+   Uint32 format, pixel;
+   int access, w, h;
+   Uint8 r, g, b, a;
+   int ret;
+
+   swrenderer = _createSurfaceRenderer(&target, "1");
+   if (swrenderer == NULL) {
+      return TEST_ABORTED;
+   }
+
+   /* Invalid parameters */
+   texture = SDL_CreateTextureWrappingSurface(swrenderer, NULL);
+   SDLTest_AssertCheck(texture == NULL, "Validate result from SDL_CreateTextureWrappingSurface with NULL surface, expected: NULL, got: %p", (void *)texture);
+   indexed = SDL_CreateRGBSurface(0, 16, 16, 8, 0, 0, 0, 0);
+   SDLTest_AssertCheck(indexed != NULL, "Verify result from SDL_CreateRGBSurface is not NULL");
+   texture = SDL_CreateTextureWrappingSurface(swrenderer, indexed);
+   SDLTest_AssertCheck(texture == NULL, "Validate result from SDL_CreateTextureWrappingSurface with an 8-bit surface, expected: NULL, got: %p", (void *)texture);
+   SDL_FreeSurface(indexed);
+
+   surface = _createColorSurface(16, 16, 0xffff0000);
+   SDLTest_AssertCheck(surface != NULL, "Verify result from SDL_CreateRGBSurface is not NULL");
+   if (surface == NULL) {
+      SDL_DestroyRenderer(swrenderer);
+      SDL_FreeSurface(target);
+      return TEST_ABORTED;
+   }
+
+   /* A surface that needs locking can't share its pixels, blitting it
+      does the RLE encoding */
+   SDL_SetSurfaceRLE(surface, 1);
+   SDL_BlitSurface(surface, NULL, target, NULL);
+   SDLTest_AssertCheck(SDL_MUSTLOCK(surface), "Verify the RLE surface needs locking");
+   texture = SDL_CreateTextureWrappingSurface(swrenderer, surface);
+   SDLTest_AssertCheck(texture == NULL, "Validate result from SDL_CreateTextureWrappingSurface with an RLE surface, expected: NULL, got: %p", (void *)texture);
+   SDL_SetSurfaceRLE(surface, 0);
+   SDL_BlitSurface(surface, NULL, target, NULL);
+   SDLTest_AssertCheck(!SDL_MUSTLOCK(surface), "Verify the surface doesn't need locking after decoding");
+
+   /* The surface settings carry over */
+   SDL_SetSurfaceColorMod(surface, 255, 128, 64);
+   SDL_SetSurfaceAlphaMod(surface, 200);
+   SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_ADD);
+   texture = SDL_CreateTextureWrappingSurface(swrenderer, surface);
+   SDLTest_AssertCheck(texture != NULL, "Verify result from SDL_CreateTextureWrappingSurface is not NULL");
+   if (texture == NULL) {
+      SDL_FreeSurface(surface);
+      SDL_DestroyRenderer(swrenderer);
+      SDL_FreeSurface(target);
+      return TEST_ABORTED;
+   }
+   ret = SDL_QueryTexture(texture, &format, &access, &w, &h);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_QueryTexture, expected: 0, got: %i", ret);
+   SDLTest_AssertCheck(format == surface->format->format && access == SDL_TEXTUREACCESS_STREAMING && w == 16 && h == 16,
+                       "Validate texture attributes, expected: %s streaming 16x16, got: %s %i %ix%i",
+                       SDL_GetPixelFormatName(surface->format->format), SDL_GetPixelFormatName(format), access, w, h);
+   SDL_GetTextureColorMod(texture, &r, &g, &b);
+   SDL_GetTextureAlphaMod(texture, &a);
+   SDL_GetTextureBlendMode(texture, &blendMode);
+   SDLTest_AssertCheck(r == 255 && g == 128 && b == 64 && a == 200 && blendMode == SDL_BLENDMODE_ADD,
+                       "Validate texture modulation, expected: 255,128,64,200 and blend mode %i, got: %i,%i,%i,%i and %i",
+                       SDL_BLENDMODE_ADD, r, g, b, a, blendMode);
+   SDL_SetTextureColorMod(texture, 255, 255, 255);
+   SDL_SetTextureAlphaMod(texture, 255);
+   SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+
+   /* Drawing uses the current pixels of the surface */
+   SDL_SetRenderDrawColor(swrenderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+   SDL_RenderClear(swrenderer);
+   ret = SDL_RenderCopy(swrenderer, texture, NULL, NULL);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopy, expected: 0, got: %i", ret);
+   pixel = _readPixel(swrenderer, 40, 30);
+   SDLTest_AssertCheck(pixel == 0xffff0000, "Validate pixel from the surface, expected: 0xffff0000, got: 0x%.8x", pixel);
+
+   SDL_RenderFlush(swrenderer);
+   SDL_FillRect(surface, NULL, 0xff0000ff);
+   ret = SDL_RenderCopy(swrenderer, texture, NULL, NULL);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopy, expected: 0, got: %i", ret);
+   pixel = _readPixel(swrenderer, 40, 30);
+   SDLTest_AssertCheck(pixel == 0xff0000ff, "Validate pixel from the changed surface, expected: 0xff0000ff, got: 0x%.8x", pixel);
+
+   /* The texture keeps the surface alive */
+   SDL_FreeSurface(surface);
+   SDL_RenderClear(swrenderer);
+   ret = SDL_RenderCopy(swrenderer, texture, NULL, NULL);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopy after freeing the surface, expected: 0, got: %i", ret);
+   pixel = _readPixel(swrenderer, 40, 30);
+   SDLTest_AssertCheck(pixel == 0xff0000ff, "Validate pixel after freeing the surface, expected: 0xff0000ff, got: 0x%.8x", pixel);
+
+   SDL_DestroyTexture(texture);
+   SDL_DestroyRenderer(swrenderer);
+   SDL_FreeSurface(target);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Fills a rectangle of locked ARGB8888 pixels. Helper function.
+ */
+static void
+_fillLocked(void *pixels, int pitch, const SDL_Rect *rect, Uint32 color)
+{
+   int x, y;
+
+   for (y = rect->y; y < rect->y + rect->h; y++) {
+      Uint32 *row = (Uint32 *)((Uint8 *)pixels + y * pitch);
+      for (x = rect->x; x < rect->x + rect->w; x++) {
+         row[x] = color;
+      }
+   }
+}
+
+/**
+ * @brief Tests locking several areas of a texture, and multi-buffered
+ * streaming textures.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_LockTextureRects
+ * http://wiki.libsdl.org/moin.cgi/SDL_SetTextureBuffers
+ */
+int
+render_testTextureRectsAndBuffers (void *arg)
+{
+   const SDL_Rect rects[] = { { 2, 2, 4, 4 }, { 20, 20, 6, 6 } };
+   const SDL_Rect outside = { 20, 20, 20, 20 };
+   const SDL_Rect negative = { -1, 0, 4, 4 };
+   const SDL_Rect corner = { 0, 0, 8, 8 };
+   const SDL_Rect left = { 0, 0, 32, 32 };
+   const SDL_Rect right = { 40, 0, 32, 32 };
+   SDL_Rect local[SDL_arraysize(rects)];
+   SDL_Surface *target, *surface;
+   SDL_Renderer *swrenderer;
+   SDL_Texture *texture, *other;
+   Uint32 pixel;
+   void *pixels;
+   int pitch, ret, i;
+
+   swrenderer = _createSurfaceRenderer(&target, "1");
+   if (swrenderer == NULL) {
+      return TEST_ABORTED;
+   }
+   texture = SDL_CreateTexture(swrenderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, 32, 32);
+   SDLTest_AssertCheck(texture != NULL, "Verify result from SDL_CreateTexture is not NULL");
+   if (texture == NULL) {
+      SDL_DestroyRenderer(swrenderer);
+      SDL_FreeSurface(target);
+      return TEST_ABORTED;
+   }
+   SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+   SDL_SetRenderDrawColor(swrenderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+   SDL_RenderClear(swrenderer);
+
+   /* Invalid areas */
+   ret = SDL_LockTextureRects(texture, NULL, 1, &pixels, &pitch);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_LockTextureRects with NULL rects, expected: -1, got: %i", ret);
+   ret = SDL_LockTextureRects(texture, rects, 0, &pixels, &pitch);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_LockTextureRects with no rects, expected: -1, got: %i", ret);
+   ret = SDL_LockTextureRects(texture, &outside, 1, &pixels, &pitch);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_LockTextureRects past the texture, expected: -1, got: %i", ret);
+   ret = SDL_LockTextureRects(texture, &negative, 1, &pixels, &pitch);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_LockTextureRects with a negative x, expected: -1, got: %i", ret);
+   ret = SDL_LockTexture(texture, &outside, &pixels, &pitch);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_LockTexture past the texture, expected: -1, got: %i", ret);
+
+   /* Only the locked areas change */
+   ret = SDL_LockTexture(texture, NULL, &pixels, &pitch);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_LockTexture, expected: 0, got: %i", ret);
+   if (ret == 0) {
+      _fillLocked(pixels, pitch, &left, 0xffff0000);
+      SDL_UnlockTexture(texture);
+   }
+   ret = SDL_LockTextureRects(texture, rects, SDL_arraysize(rects), &pixels, &pitch);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_LockTextureRects, expected: 0, got: %i", ret);
+   if (ret == 0) {
+      /* The pixels start at the top left of the bounding box */
+      for (i = 0; i < SDL_arraysize(rects); i++) {
+         local[i] = rects[i];
+         local[i].x -= rects[0].x;
+         local[i].y -= rects[0].y;
+         _fillLocked(pixels, pitch, &local[i], 0xff00ff00);
+      }
+      SDL_UnlockTexture(texture);
+   }
+   SDL_RenderCopy(swrenderer, texture, NULL, &left);
+   pixel = _readPixel(swrenderer, 3, 3);
+   SDLTest_AssertCheck(pixel == 0xff00ff00, "Validate pixel in the first locked area, expected: 0xff00ff00, got: 0x%.8x", pixel);
+   pixel = _readPixel(swrenderer, 25, 25);
+   SDLTest_AssertCheck(pixel == 0xff00ff00, "Validate pixel in the second locked area, expected: 0xff00ff00, got: 0x%.8x", pixel);
+   pixel = _readPixel(swrenderer, 10, 10);
+   SDLTest_AssertCheck(pixel == 0xffff0000, "Validate pixel between the locked areas, expected: 0xffff0000, got: 0x%.8x", pixel);
+
+   /* Buffer counts */
+   other = SDL_CreateTexture(swrenderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 32, 32);
+   ret = SDL_SetTextureBuffers(other, 2);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_SetTextureBuffers on a static texture, expected: -1, got: %i", ret);
+   SDL_DestroyTexture(other);
+   ret = SDL_SetTextureBuffers(texture, 0);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_SetTextureBuffers(0), expected: -1, got: %i", ret);
+   ret = SDL_SetTextureBuffers(texture, 4);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_SetTextureBuffers(4), expected: -1, got: %i", ret);
+   surface = _createColorSurface(16, 16, 0xffffffff);
+   other = surface ? SDL_CreateTextureWrappingSurface(swrenderer, surface) : NULL;
+   if (other != NULL) {
+      ret = SDL_SetTextureBuffers(other, 2);
+      SDLTest_AssertCheck(ret == -1, "Validate result from SDL_SetTextureBuffers on a texture wrapping a surface, expected: -1, got: %i", ret);
+      SDL_DestroyTexture(other);
+   }
+   SDL_FreeSurface(surface);
+
+   /* With any number of buffers, queued drawing keeps the pixels it was queued with */
+   for (i = 3; i >= 1; i--) {
+      ret = SDL_SetTextureBuffers(texture, i);
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDL_SetTextureBuffers(%i), expected: 0, got: %i", i, ret);
+
+      SDL_RenderClear(swrenderer);
+      ret = SDL_LockTexture(texture, NULL, &pixels, &pitch);
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDL_LockTexture, expected: 0, got: %i", ret);
+      if (ret == 0) {
+         _fillLocked(pixels, pitch, &left, 0xff0000ff);
+         SDL_UnlockTexture(texture);
+      }
+      SDL_RenderCopy(swrenderer, texture, NULL, &left);
+      ret = SDL_LockTextureRects(texture, &corner, 1, &pixels, &pitch);
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDL_LockTextureRects, expected: 0, got: %i", ret);
+      if (ret == 0) {
+         _fillLocked(pixels, pitch, &corner, 0xffffffff);
+         SDL_UnlockTexture(texture);
+      }
+      SDL_RenderCopy(swrenderer, texture, NULL, &right);
+
+      pixel = _readPixel(swrenderer, 4, 4);
+      SDLTest_AssertCheck(pixel == 0xff0000ff, "Validate first copy with %i buffers, expected: 0xff0000ff, got: 0x%.8x", i, pixel);
+      pixel = _readPixel(swrenderer, right.x + 4, 4);
+      SDLTest_AssertCheck(pixel == 0xffffffff, "Validate locked area of second copy with %i buffers, expected: 0xffffffff, got: 0x%.8x", i, pixel);
+      pixel = _readPixel(swrenderer, right.x + 20, 20);
+      SDLTest_AssertCheck(pixel == 0xff0000ff, "Validate rest of second copy with %i buffers, expected: 0xff0000ff, got: 0x%.8x", i, pixel);
+   }
+
+   SDL_DestroyTexture(texture);
+   SDL_DestroyRenderer(swrenderer);
+   SDL_FreeSurface(target);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Draws primitives and copies crossing the tiles of a 200x150 target.
+ * Helper function.
+ */
+static void
+_drawThreadsScene(SDL_Renderer *target, SDL_Texture *face, SDL_Texture *stream)
+{
+   const SDL_Rect fills[] = { { 10, 10, 150, 40 }, { 60, 50, 80, 90 } };
+   const SDL_Rect blended = { 30, 30, 140, 100 };
+   const SDL_Rect outline = { 5, 5, 190, 140 };
+   const SDL_Rect copy = { 50, 52, 32, 32 };
+   const SDL_Rect scaled = { 100, 40, 90, 100 };
+   const SDL_Rect rotated = { 40, 15, 60, 40 };
+   /* Unscaled copies of a texture without RLE are split between tiles */
+   const SDL_Rect streamed[] = { { 56, 56, 16, 16 }, { 120, 60, 16, 16 }, { 0, 100, 64, 50 } };
+   SDL_Point points[20];
+   SDL_Vertex vertices[3];
+   int i;
+
+   SDL_SetRenderDrawBlendMode(target, SDL_BLENDMODE_NONE);
+   SDL_SetRenderDrawColor(target, 30, 60, 90, 255);
+   SDL_RenderClear(target);
+   SDL_SetRenderDrawColor(target, 200, 40, 40, 255);
+   SDL_RenderFillRects(target, fills, SDL_arraysize(fills));
+   SDL_SetRenderDrawBlendMode(target, SDL_BLENDMODE_BLEND);
+   SDL_SetRenderDrawColor(target, 40, 200, 40, 128);
+   SDL_RenderFillRect(target, &blended);
+
+   SDL_SetRenderDrawColor(target, 255, 255, 255, 255);
+   SDL_RenderDrawLine(target, 0, 0, 199, 149);
+   SDL_RenderDrawLine(target, 199, 0, 0, 149);
+   SDL_RenderDrawRect(target, &outline);
+   for (i = 0; i < SDL_arraysize(points); i++) {
+      points[i].x = 3 + i * 10;
+      points[i].y = 140 - i * 7;
+   }
+   SDL_RenderDrawPoints(target, points, SDL_arraysize(points));
+
+   SDL_RenderCopy(target, face, NULL, &copy);
+   SDL_RenderCopy(target, face, NULL, &scaled);
+   SDL_RenderCopyEx(target, face, NULL, &rotated, 30.0, NULL, SDL_FLIP_HORIZONTAL);
+   SDL_SetTextureBlendMode(face, SDL_BLENDMODE_ADD);
+   SDL_RenderCopy(target, face, NULL, &streamed[2]);
+   SDL_SetTextureBlendMode(face, SDL_BLENDMODE_BLEND);
+   for (i = 0; i < SDL_arraysize(streamed); i++) {
+      SDL_RenderCopy(target, stream, NULL, &streamed[i]);
+   }
+
+   for (i = 0; i < SDL_arraysize(vertices); i++) {
+      vertices[i].color.r = (Uint8)(i == 0 ? 255 : 0);
+      vertices[i].color.g = (Uint8)(i == 1 ? 255 : 0);
+      vertices[i].color.b = (Uint8)(i == 2 ? 255 : 0);
+      vertices[i].color.a = 255;
+      vertices[i].tex_coord.x = 0.0f;
+      vertices[i].tex_coord.y = 0.0f;
+   }
+   vertices[0].position.x = 20.0f;
+   vertices[0].position.y = 140.0f;
+   vertices[1].position.x = 100.0f;
+   vertices[1].position.y = 60.0f;
+   vertices[2].position.x = 180.0f;
+   vertices[2].position.y = 130.0f;
+   SDL_RenderGeometry(target, NULL, vertices, SDL_arraysize(vertices), NULL, 0);
+}
+
+/**
+ * @brief Tests that the software renderer draws the same with and without
+ * worker threads, also after the texture drawn changes buffers.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_CreateSoftwareRenderer
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderReadPixels
+ */
+int
+render_testSoftwareThreads (void *arg)
+{
+   const char *threads[] = { "4", "1" };
+   const SDL_Rect all = { 0, 0, 16, 16 };
+   const SDL_Rect middle = { 4, 4, 8, 8 };
+   const int w = 200, h = 150;
+   Uint32 *drawn[2];
+   SDL_Surface *target, *face;
+   SDL_Renderer *swrenderer;
+   SDL_Texture *tface, *stream;
+   const char *hint;
+   char *original, *batching;
+   void *pixels;
+   int ret, pitch, frame, i, differ;
+
+   target = SDL_CreateRGBSurface(0, w, h, 32,
+                                 RENDER_COMPARE_RMASK, RENDER_COMPARE_GMASK, RENDER_COMPARE_BMASK, RENDER_COMPARE_AMASK);
+   SDLTest_AssertCheck(target != NULL, "Verify result from SDL_CreateRGBSurface is not NULL");
+   if (target == NULL) {
+      return TEST_ABORTED;
+   }
+
+   /* A batched frame is drawn in one go, so the tiles get all of it */
+   hint = SDL_GetHint(SDL_HINT_RENDER_BATCHING);
+   batching = hint ? SDL_strdup(hint) : NULL;
+   SDL_SetHint(SDL_HINT_RENDER_BATCHING, "1");
+   swrenderer = SDL_CreateSoftwareRenderer(target);
+   SDL_SetHint(SDL_HINT_RENDER_BATCHING, batching ? batching : "0");
+   SDL_free(batching);
+   SDLTest_AssertCheck(swrenderer != NULL, "Verify result from SDL_CreateSoftwareRenderer is not NULL");
+   if (swrenderer == NULL) {
+      SDL_FreeSurface(target);
+      return TEST_ABORTED;
+   }
+
+   face = SDLTest_ImageFace();
+   tface = face ? SDL_CreateTextureFromSurface(swrenderer, face) : NULL;
+   SDL_FreeSurface(face);
+   stream = SDL_CreateTexture(swrenderer, RENDER_COMPARE_FORMAT, SDL_TEXTUREACCESS_STREAMING, all.w, all.h);
+   drawn[0] = (Uint32 *)SDL_malloc(w * h * 4);
+   drawn[1] = (Uint32 *)SDL_malloc(w * h * 4);
+   SDLTest_AssertCheck(tface != NULL && stream != NULL && drawn[0] != NULL && drawn[1] != NULL, "Verify textures and pixel buffers are not NULL");
+   if (tface == NULL || stream == NULL || drawn[0] == NULL || drawn[1] == NULL) {
+      SDL_free(drawn[0]);
+      SDL_free(drawn[1]);
+      SDL_DestroyRenderer(swrenderer);
+      SDL_FreeSurface(target);
+      return TEST_ABORTED;
+   }
+   ret = SDL_SetTextureBuffers(stream, 2);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_SetTextureBuffers(2), expected: 0, got: %i", ret);
+
+   /* The hint is looked at whenever the queue is drawn */
+   hint = SDL_GetHint(SDL_HINT_RENDER_SOFTWARE_THREADS);
+   original = hint ? SDL_strdup(hint) : NULL;
+   for (frame = 0; frame < 2; frame++) {
+      /* Each frame draws the other buffer of the streaming texture */
+      ret = SDL_LockTexture(stream, NULL, &pixels, &pitch);
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDL_LockTexture, expected: 0, got: %i", ret);
+      if (ret == 0) {
+         _fillLocked(pixels, pitch, &all, frame ? 0xff20c0ff : 0xffffc020);
+         _fillLocked(pixels, pitch, &middle, frame ? 0x80ff0000 : 0x800000ff);
+         SDL_UnlockTexture(stream);
+      }
+
+      for (i = 0; i < SDL_arraysize(threads); i++) {
+         SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, threads[i]);
+         _drawThreadsScene(swrenderer, tface, stream);
+         ret = SDL_RenderReadPixels(swrenderer, NULL, RENDER_COMPARE_FORMAT, drawn[i], w * 4);
+         SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels with %s threads, expected: 0, got: %i", threads[i], ret);
+      }
+      for (i = 0, differ = 0; i < w * h; i++) {
+         differ += (drawn[0][i] != drawn[1][i]);
+      }
+      SDLTest_AssertCheck(differ == 0, "Validate frame %i drawn with 4 threads and 1, expected: 0 differences, got: %i", frame, differ);
+   }
+   SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, original ? original : "1");
+   SDL_free(original);
+
+   SDL_free(drawn[0]);
+   SDL_free(drawn[1]);
+   SDL_DestroyTexture(stream);
+   SDL_DestroyTexture(tface);
+   SDL_DestroyRenderer(swrenderer);
+   SDL_FreeSurface(target);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that flipped copies and copies rotated by right angles match
+ * plain copies of a texture flipped or rotated beforehand, on 32-bit and
+ * 8-bit targets.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderCopyEx
+ */
+int
+render_testCopyExRightAngles (void *arg)
+{
+   /* Rotations are clockwise, 'turn' counts quarter turns */
+   static const struct {
+      double angle;
+      SDL_RendererFlip flip;
+      int turn;
+   } cases[] = {
+      { 0.0, SDL_FLIP_NONE, 0 },
+      { 0.0, SDL_FLIP_HORIZONTAL, 0 },
+      { 0.0, SDL_FLIP_VERTICAL, 0 },
+      { 90.0, SDL_FLIP_NONE, 1 },
+      { 180.0, SDL_FLIP_NONE, 2 },
+      { 270.0, SDL_FLIP_NONE, 3 },
+      { 90.0, SDL_FLIP_HORIZONTAL, 1 }
+   };
+   static const int depths[] = { 32, 8 };
+   const int w = 16, h = 12;
+   const SDL_Rect rect = { 30, 20, 16, 12 };
+   SDL_Color colors[256];
+   SDL_Surface *image, *turned, *target;
+   SDL_Renderer *swrenderer;
+   SDL_Texture *texture, *reference;
+   SDL_Rect turnedRect, part = { 0, 0, 0, 0 };
+   Uint8 *drawn;
+   int i, j, k, x, y, sx, sy, ret, differ;
+
+   /* A 3-3-2 palette for the 8-bit target, the image only uses its colors */
+   for (i = 0; i < 256; i++) {
+      colors[i].r = (Uint8)((i >> 5) * 255 / 7);
+      colors[i].g = (Uint8)(((i >> 2) & 7) * 255 / 7);
+      colors[i].b = (Uint8)((i & 3) * 255 / 3);
+      colors[i].a = 255;
+   }
+   image = SDL_CreateRGBSurface(0, w, h, 32,
+                                RENDER_COMPARE_RMASK, RENDER_COMPARE_GMASK, RENDER_COMPARE_BMASK, RENDER_COMPARE_AMASK);
+   turned = SDL_CreateRGBSurface(0, w, w, 32,
+                                 RENDER_COMPARE_RMASK, RENDER_COMPARE_GMASK, RENDER_COMPARE_BMASK, RENDER_COMPARE_AMASK);
+   SDLTest_AssertCheck(image != NULL && turned != NULL, "Verify result from SDL_CreateRGBSurface is not NULL");
+   if (image == NULL || turned == NULL) {
+      SDL_FreeSurface(image);
+      SDL_FreeSurface(turned);
+      return TEST_ABORTED;
+   }
+   for (y = 0; y < h; y++) {
+      for (x = 0; x < w; x++) {
+         const SDL_Color *color = &colors[(y * w + x * 37) & 0xff];
+         ((Uint32 *)((Uint8 *)image->pixels + y * image->pitch))[x] = SDL_MapRGB(image->format, color->r, color->g, color->b);
+      }
+   }
+
+   for (i = 0; i < SDL_arraysize(depths); i++) {
+      if (depths[i] == 8) {
+         target = SDL_CreateRGBSurface(0, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, 8, 0, 0, 0, 0);
+         if (target != NULL) {
+            SDL_SetPaletteColors(target->format->palette, colors, 0, 256);
+         }
+      } else {
+         target = SDL_CreateRGBSurface(0, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, 32,
+                                       RENDER_COMPARE_RMASK, RENDER_COMPARE_GMASK, RENDER_COMPARE_BMASK, RENDER_COMPARE_AMASK);
+      }
+      swrenderer = target ? SDL_CreateSoftwareRenderer(target) : NULL;
+      texture = swrenderer ? SDL_CreateTextureFromSurface(swrenderer, image) : NULL;
+      drawn = target ? (Uint8 *)SDL_malloc(target->pitch * target->h) : NULL;
+      SDLTest_AssertCheck(texture != NULL && drawn != NULL, "Verify %i-bit target, renderer and texture are not NULL", depths[i]);
+      if (texture == NULL || drawn == NULL) {
+         SDL_free(drawn);
+         if (swrenderer) {
+            SDL_DestroyRenderer(swrenderer);
+         }
+         SDL_FreeSurface(target);
+         continue;
+      }
+      SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+
+      for (j = 0; j < SDL_arraysize(cases); j++) {
+         const int turn = cases[j].turn;
+         const int tw = (turn & 1) ? h : w;
+         const int th = (turn & 1) ? w : h;
+
+         /* Rotations keep the center, which is on a pixel corner */
+         turnedRect.x = rect.x + (rect.w - tw) / 2;
+         turnedRect.y = rect.y + (rect.h - th) / 2;
+         turnedRect.w = tw;
+         turnedRect.h = th;
+
+         /* Flipped first, then turned, as SDL_RenderCopyEx() does */
+         for (y = 0; y < th; y++) {
+            for (x = 0; x < tw; x++) {
+               switch (turn) {
+               case 1: sx = y; sy = h - 1 - x; break;
+               case 2: sx = w - 1 - x; sy = h - 1 - y; break;
+               case 3: sx = w - 1 - y; sy = x; break;
+               default: sx = x; sy = y; break;
+               }
+               if (cases[j].flip & SDL_FLIP_HORIZONTAL) {
+                  sx = w - 1 - sx;
+               }
+               if (cases[j].flip & SDL_FLIP_VERTICAL) {
+                  sy = h - 1 - sy;
+               }
+               ((Uint32 *)((Uint8 *)turned->pixels + y * turned->pitch))[x] =
+                  ((Uint32 *)((Uint8 *)image->pixels + sy * image->pitch))[sx];
+            }
+         }
+         SDL_SetRenderDrawColor(swrenderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+         SDL_RenderClear(swrenderer);
+         ret = SDL_RenderCopyEx(swrenderer, texture, NULL, &rect, cases[j].angle, NULL, cases[j].flip);
+         SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopyEx, expected: 0, got: %i", ret);
+         SDL_RenderFlush(swrenderer);
+         SDL_memcpy(drawn, target->pixels, target->pitch * target->h);
+
+         SDL_RenderClear(swrenderer);
+         reference = SDL_CreateTextureFromSurface(swrenderer, turned);
+         if (reference != NULL) {
+            part.w = tw;
+            part.h = th;
+            SDL_SetTextureBlendMode(reference, SDL_BLENDMODE_NONE);
+            SDL_RenderCopy(swrenderer, reference, &part, &turnedRect);
+            SDL_RenderFlush(swrenderer);
+            SDL_DestroyTexture(reference);
+         }
+
+         for (k = 0, differ = 0; k < target->pitch * target->h; k++) {
+            differ += (drawn[k] != ((Uint8 *)target->pixels)[k]);
+         }
+         SDLTest_AssertCheck(reference != NULL && differ == 0, "Validate %g degrees with flip %i on a %i-bit target matches SDL_RenderCopy, expected: 0 differences, got: %i",
+                             cases[j].angle, (int)cases[j].flip, depths[i], differ);
+      }
+
+      SDL_free(drawn);
+      SDL_DestroyTexture(texture);
+      SDL_DestroyRenderer(swrenderer);
+      SDL_FreeSurface(target);
+   }
+   SDL_FreeSurface(image);
+   SDL_FreeSurface(turned);
+
+   return TEST_COMPLETED;
+}
+
 /* Helper functions */
 
 /**
@@ -978,6 +2314,69 @@ _hasTexAlpha(void)
    return 1;
 }
 
+/**
+ * @brief Creates a software renderer drawing on a new surface the size of
+ * the test screen. Helper function.
+ *
+ * @param surface Filled in with the surface drawn on.
+ * @param batching Value of SDL_HINT_RENDER_BATCHING for the renderer.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_CreateSoftwareRenderer
+ */
+static SDL_Renderer *
+_createSurfaceRenderer(SDL_Surface **surface, const char *batching)
+{
+   SDL_Renderer *swrenderer;
+   const char *hint;
+   char *original;
+
+   *surface = SDL_CreateRGBSurface(0, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, 32,
+                                   RENDER_COMPARE_RMASK, RENDER_COMPARE_GMASK, RENDER_COMPARE_BMASK, RENDER_COMPARE_AMASK);
+   SDLTest_AssertCheck(*surface != NULL, "Verify result from SDL_CreateRGBSurface is not NULL");
+   if (*surface == NULL) {
+      return NULL;
+   }
+
+   /* The hint is only looked at when the renderer is created. Hints can't
+      be unset, "0" is what an unset hint means for software renderers. */
+   hint = SDL_GetHint(SDL_HINT_RENDER_BATCHING);
+   original = hint ? SDL_strdup(hint) : NULL;
+   SDL_SetHint(SDL_HINT_RENDER_BATCHING, batching);
+   swrenderer = SDL_CreateSoftwareRenderer(*surface);
+   SDL_SetHint(SDL_HINT_RENDER_BATCHING, original ? original : "0");
+   SDL_free(original);
+
+   SDLTest_AssertCheck(swrenderer != NULL, "Verify result from SDL_CreateSoftwareRenderer is not NULL");
+   if (swrenderer == NULL) {
+      SDL_FreeSurface(*surface);
+      *surface = NULL;
+   }
+   return swrenderer;
+}
+
+/**
+ * @brief Reads one pixel of a renderer in the compare format. Helper function.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderReadPixels
+ */
+static Uint32
+_readPixel(SDL_Renderer *target, int x, int y)
+{
+   SDL_Rect rect;
+   Uint32 pixel = 0;
+
+   rect.x = x;
+   rect.y = y;
+   rect.w = 1;
+   rect.h = 1;
+   if (SDL_RenderReadPixels(target, &rect, RENDER_COMPARE_FORMAT, &pixel, 4) < 0) {
+      SDLTest_LogError("SDL_RenderReadPixels() failed with error: %s", SDL_GetError());
+   }
+   return pixel;
+}
+
 /**
  * @brief Compares screen pixels with image pixels. Helper function.
  *
@@ -1085,9 +2484,30 @@ static const SDLTest_TestCaseReference renderTest6 =
 static const SDLTest_TestCaseReference renderTest7 =
         {  (SDLTest_TestCaseFp)render_testBlitBlend, "render_testBlitBlend", "Tests blitting with blending", TEST_DISABLED };
 
+static const SDLTest_TestCaseReference renderTest8 =
+        { (SDLTest_TestCaseFp)render_testRenderFlush, "render_testRenderFlush", "Tests flushing batched drawing", TEST_ENABLED };
+static const SDLTest_TestCaseReference renderTest9 =
+        { (SDLTest_TestCaseFp)render_testRenderCopyBatch, "render_testRenderCopyBatch", "Tests drawing many copies in one call", TEST_ENABLED };
+static const SDLTest_TestCaseReference renderTest10 =
+        { (SDLTest_TestCaseFp)render_testRenderGeometry, "render_testRenderGeometry", "Tests drawing triangle lists", TEST_ENABLED };
+static const SDLTest_TestCaseReference renderTest11 =
+        { (SDLTest_TestCaseFp)render_testFloatVariants, "render_testFloatVariants", "Tests the float variants of the drawing calls", TEST_ENABLED };
+static const SDLTest_TestCaseReference renderTest12 =
+        { (SDLTest_TestCaseFp)render_testDamageRects, "render_testDamageRects", "Tests the areas reported as drawn on", TEST_ENABLED };
+static const SDLTest_TestCaseReference renderTest13 =
+        { (SDLTest_TestCaseFp)render_testTextureAtlas, "render_testTextureAtlas", "Tests packing images into texture atlases", TEST_ENABLED };
+static const SDLTest_TestCaseReference renderTest14 =
+        { (SDLTest_TestCaseFp)render_testTextureWrappingSurface, "render_testTextureWrappingSurface", "Tests textures using the pixels of a surface", TEST_ENABLED };
+static const SDLTest_TestCaseReference renderTest15 =
+        { (SDLTest_TestCaseFp)render_testTextureRectsAndBuffers, "render_testTextureRectsAndBuffers", "Tests locking several areas and multi-buffered textures", TEST_ENABLED };
+static const SDLTest_TestCaseReference renderTest16 =
+        { (SDLTest_TestCaseFp)render_testSoftwareThreads, "render_testSoftwareThreads", "Tests drawing with the software renderer's worker threads", TEST_ENABLED };
+static const SDLTest_TestCaseReference renderTest17 =
+        { (SDLTest_TestCaseFp)render_testCopyExRightAngles, "render_testCopyExRightAngles", "Tests flips and right angle rotations against plain copies", TEST_ENABLED };
+
 /* Sequence of Render test cases */
 static const SDLTest_TestCaseReference *renderTests[] =  {
-    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, NULL
+    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, &renderTest8, &renderTest9, &renderTest10, &renderTest11, &renderTest12, &renderTest13, &renderTest14, &renderTest15, &renderTest16, &renderTest17, NULL
 };
 
 /* Render test suite (global) */
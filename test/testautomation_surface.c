@@ -588,6 +588,1207 @@ surface_testBlitBlendLoop(void *arg) {
 
 }
 
+/**
+ * @brief Tests setting and getting the scale mode, and filtered scaled blits.
+ */
+int
+surface_testScaleMode(void *arg)
+{
+   SDL_Surface *src, *dst, *small;
+   SDL_ScaleMode scaleMode;
+   Uint32 *pixels;
+   Uint32 flat;
+   int ret, i, errors, mid = 0;
+
+   src = SDL_CreateRGBSurface(0, 9, 9, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+   dst = SDL_CreateRGBSurface(0, 7, 5, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+   SDLTest_AssertCheck(src != NULL && dst != NULL, "Verify surfaces are not NULL");
+   if (src == NULL || dst == NULL) {
+      SDL_FreeSurface(src);
+      SDL_FreeSurface(dst);
+      return TEST_ABORTED;
+   }
+
+   /* Set and get */
+   ret = SDL_GetSurfaceScaleMode(src, &scaleMode);
+   SDLTest_AssertCheck(ret == 0, "Verify result from SDL_GetSurfaceScaleMode(), expected: 0, got: %i", ret);
+   SDLTest_AssertCheck(scaleMode == SDL_SCALEMODE_NEAREST, "Verify default scale mode, expected: %i, got: %i", SDL_SCALEMODE_NEAREST, scaleMode);
+   ret = SDL_SetSurfaceScaleMode(src, SDL_SCALEMODE_LINEAR);
+   SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SetSurfaceScaleMode(LINEAR), expected: 0, got: %i", ret);
+   ret = SDL_GetSurfaceScaleMode(src, &scaleMode);
+   SDLTest_AssertCheck(ret == 0 && scaleMode == SDL_SCALEMODE_LINEAR, "Verify scale mode, expected: %i, got: %i", SDL_SCALEMODE_LINEAR, scaleMode);
+   ret = SDL_SetSurfaceScaleMode(src, (SDL_ScaleMode) 42);
+   SDLTest_AssertCheck(ret == -1, "Verify result from SDL_SetSurfaceScaleMode(42), expected: -1, got: %i", ret);
+   ret = SDL_SetSurfaceScaleMode(NULL, SDL_SCALEMODE_LINEAR);
+   SDLTest_AssertCheck(ret == -1, "Verify result from SDL_SetSurfaceScaleMode(NULL), expected: -1, got: %i", ret);
+   ret = SDL_GetSurfaceScaleMode(NULL, &scaleMode);
+   SDLTest_AssertCheck(ret == -1, "Verify result from SDL_GetSurfaceScaleMode(NULL), expected: -1, got: %i", ret);
+
+   /* A flat color stays flat when shrunk and when enlarged */
+   flat = 0xff3c78b4;
+   SDL_FillRect(src, NULL, flat);
+   ret = SDL_BlitScaled(src, NULL, dst, NULL);
+   SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitScaled() 9x9 to 7x5, expected: 0, got: %i", ret);
+   for (i = 0, errors = 0, pixels = (Uint32 *)dst->pixels; i < dst->w * dst->h; i++) {
+      errors += (pixels[i] != flat);
+   }
+   SDLTest_AssertCheck(errors == 0, "Verify shrunk flat color, expected: 0 errors, got: %i", errors);
+
+   small = SDL_CreateRGBSurface(0, 2, 1, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+   SDLTest_AssertCheck(small != NULL, "Verify surface is not NULL");
+   if (small != NULL) {
+      SDL_Rect row = { 0, 0, 7, 1 };
+
+      /* Enlarging a step from black to white fills in grays, in order */
+      SDL_SetSurfaceScaleMode(small, SDL_SCALEMODE_LINEAR);
+      ((Uint32 *)small->pixels)[0] = 0xff000000;
+      ((Uint32 *)small->pixels)[1] = 0xffffffff;
+      ret = SDL_BlitScaled(small, NULL, dst, &row);
+      SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitScaled() 2x1 to 7x1, expected: 0, got: %i", ret);
+      pixels = (Uint32 *)dst->pixels;
+      for (i = 0, errors = 0; i < row.w; i++) {
+         const Uint32 gray = pixels[i] & 0xff;
+
+         if (gray != 0 && gray != 0xff) {
+            mid++;
+         }
+         if (i > 0 && gray < (pixels[i - 1] & 0xff)) {
+            errors++;
+         }
+      }
+      SDLTest_AssertCheck(errors == 0, "Verify enlarged step only gets lighter, expected: 0 errors, got: %i", errors);
+      SDLTest_AssertCheck(mid > 0, "Verify enlarged step has grays, expected: >0, got: %i", mid);
+
+      /* Filtering isn't done through a color key, nothing new appears */
+      SDL_SetColorKey(small, SDL_TRUE, 0xff000000);
+      SDL_FillRect(dst, NULL, 0xff0000ff);
+      ret = SDL_BlitScaled(small, NULL, dst, &row);
+      SDLTest_AssertCheck(ret == 0, "Verify result from color keyed SDL_BlitScaled(), expected: 0, got: %i", ret);
+      for (i = 0, errors = 0; i < row.w; i++) {
+         errors += (pixels[i] != 0xff0000ff && pixels[i] != 0xffffffff);
+      }
+      SDLTest_AssertCheck(errors == 0, "Verify color keyed blit is unfiltered, expected: 0 errors, got: %i", errors);
+
+      SDL_FreeSurface(small);
+   }
+
+   /* Shrinking a lot averages everything, a single black row barely shows */
+   for (i = 250; i <= 300; i += 50) {
+      SDL_Rect one = { 0, 0, 1, 1 };
+      Uint32 pixel;
+      int channel;
+
+      small = SDL_CreateRGBSurface(0, 1, i, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+      SDLTest_AssertCheck(small != NULL, "Verify 1x%i surface is not NULL", i);
+      if (small == NULL) {
+         continue;
+      }
+      SDL_SetSurfaceScaleMode(small, SDL_SCALEMODE_LINEAR);
+      SDL_FillRect(small, NULL, 0xffffffff);
+      ((Uint32 *)small->pixels)[i / 2] = 0xff000000;
+      ret = SDL_BlitScaled(small, NULL, dst, &one);
+      SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitScaled() 1x%i to 1x1, expected: 0, got: %i", i, ret);
+      pixel = ((Uint32 *)dst->pixels)[0];
+      for (channel = 0, errors = 0; channel < 24; channel += 8) {
+         const int value = (int)((pixel >> channel) & 0xff);
+         errors += (value < 0xfd || value > 0xff);
+      }
+      errors += ((pixel >> 24) != 0xff);
+      SDLTest_AssertCheck(errors == 0, "Verify 1x%i shrunk to 1x1, expected: 0xfffefefe, got: 0x%.8x", i, pixel);
+      SDL_FreeSurface(small);
+   }
+
+   /* SDL_SoftStretchLinear() takes only 8 bits per channel 32-bit surfaces */
+   ret = SDL_SoftStretchLinear(src, NULL, dst, NULL);
+   SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SoftStretchLinear() with ARGB8888, expected: 0, got: %i", ret);
+   SDL_FreeSurface(src);
+   SDL_FreeSurface(dst);
+   src = SDL_CreateRGBSurface(0, 9, 9, 16, 0xf800, 0x07e0, 0x001f, 0);
+   dst = SDL_CreateRGBSurface(0, 7, 5, 16, 0xf800, 0x07e0, 0x001f, 0);
+   SDLTest_AssertCheck(src != NULL && dst != NULL, "Verify 16-bit surfaces are not NULL");
+   if (src != NULL && dst != NULL) {
+      ret = SDL_SoftStretchLinear(src, NULL, dst, NULL);
+      SDLTest_AssertCheck(ret == -1, "Verify result from SDL_SoftStretchLinear() with RGB565, expected: -1, got: %i", ret);
+   }
+   SDL_FreeSurface(src);
+   SDL_FreeSurface(dst);
+
+   return TEST_COMPLETED;
+}
+
+/* Counts the pixels of 'rect' in 'surface' that don't hold 'color' */
+static int
+_countFillErrors(SDL_Surface *surface, const SDL_Rect *rect, Uint32 color)
+{
+   int x, y, errors = 0;
+   const int bpp = surface->format->BytesPerPixel;
+
+   for (y = rect->y; y < rect->y + rect->h; y++) {
+      const Uint8 *row = (const Uint8 *)surface->pixels + y * surface->pitch;
+      for (x = rect->x; x < rect->x + rect->w; x++) {
+         Uint32 pixel = 0;
+         SDL_memcpy(&pixel, row + x * bpp, bpp);
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+         pixel >>= (4 - bpp) * 8;
+#endif
+         if (pixel != color) {
+            errors++;
+         }
+      }
+   }
+   return errors;
+}
+
+/**
+ * @brief Tests SDL_FillRect with large and small rectangles under each
+ * SDL_BLIT_CPU_FEATURES mask the CPU can run.
+ */
+int
+surface_testFillRectFeatures(void *arg)
+{
+   /* SSE = 0x04, SSE2 = 0x08, AVX2 = 0x40, as in src/video/SDL_blit.h */
+   static const struct {
+      const char *value;
+      SDL_bool sse;
+      SDL_bool avx2;
+   } masks[] = {
+      { "0", SDL_FALSE, SDL_FALSE },
+      { "4", SDL_TRUE, SDL_FALSE },
+      { "12", SDL_TRUE, SDL_FALSE },
+      { "64", SDL_FALSE, SDL_TRUE },
+      { "72", SDL_FALSE, SDL_TRUE },
+      { "76", SDL_TRUE, SDL_TRUE }
+   };
+   static const int depths[] = { 8, 16, 24, 32 };
+   const char *saved = SDL_GetHint(SDL_HINT_BLIT_CPU_FEATURES);
+   char *original = saved ? SDL_strdup(saved) : NULL;
+   SDL_Rect whole, inner;
+   int i, j, ret, errors;
+
+   /* Big enough for the non-temporal stores at every depth */
+   whole.x = 0;
+   whole.y = 0;
+   whole.w = 1100;
+   whole.h = 1000;
+   inner.x = 3;
+   inner.y = 5;
+   inner.w = 1001;
+   inner.h = 7;
+
+   for (i = 0; i < SDL_arraysize(masks); i++) {
+      if ((masks[i].sse && !SDL_HasSSE()) || (masks[i].avx2 && !SDL_HasAVX2())) {
+         SDLTest_Log("Skipping SDL_BLIT_CPU_FEATURES=%s, not supported by this CPU", masks[i].value);
+         continue;
+      }
+      SDL_SetHintWithPriority(SDL_HINT_BLIT_CPU_FEATURES, masks[i].value, SDL_HINT_OVERRIDE);
+
+      for (j = 0; j < SDL_arraysize(depths); j++) {
+         const int bpp = depths[j] / 8;
+         const Uint32 outer = 0x00a1b2c3 & (0xffffffff >> ((4 - bpp) * 8));
+         const Uint32 color = 0x00123456 & (0xffffffff >> ((4 - bpp) * 8));
+         SDL_Surface *surface = SDL_CreateRGBSurface(0, whole.w, whole.h, depths[j], 0, 0, 0, 0);
+         SDLTest_AssertCheck(surface != NULL, "Verify %d bpp surface is not NULL", depths[j]);
+         if (surface == NULL) {
+            continue;
+         }
+
+         ret = SDL_FillRect(surface, NULL, outer);
+         SDLTest_AssertCheck(ret == 0, "Verify result from SDL_FillRect(NULL), expected: 0, got: %i", ret);
+         errors = _countFillErrors(surface, &whole, outer);
+         SDLTest_AssertCheck(errors == 0, "Verify large fill with SDL_BLIT_CPU_FEATURES=%s at %d bpp, expected: 0 errors, got: %i", masks[i].value, depths[j], errors);
+
+         ret = SDL_FillRect(surface, &inner, color);
+         SDLTest_AssertCheck(ret == 0, "Verify result from SDL_FillRect(inner), expected: 0, got: %i", ret);
+         errors = _countFillErrors(surface, &inner, color);
+         SDLTest_AssertCheck(errors == 0, "Verify inner fill with SDL_BLIT_CPU_FEATURES=%s at %d bpp, expected: 0 errors, got: %i", masks[i].value, depths[j], errors);
+         errors = _countFillErrors(surface, &whole, outer) - inner.w * inner.h;
+         SDLTest_AssertCheck(errors == 0, "Verify inner fill stays inside with SDL_BLIT_CPU_FEATURES=%s at %d bpp, expected: 0 errors, got: %i", masks[i].value, depths[j], errors);
+
+         SDL_FreeSurface(surface);
+      }
+   }
+
+   /* An empty value is the same as no override */
+   SDL_SetHintWithPriority(SDL_HINT_BLIT_CPU_FEATURES, original ? original : "", SDL_HINT_OVERRIDE);
+   SDL_free(original);
+
+   return TEST_COMPLETED;
+}
+
+/* Draws keyed (zero), opaque and, at 32 bpp, translucent runs into 'rect' */
+static void
+_drawRLEPattern(SDL_Surface *surface, const SDL_Rect *rect, int seed)
+{
+   int x, y;
+
+   for (y = rect->y; y < rect->y + rect->h; y++) {
+      Uint8 *row = (Uint8 *)surface->pixels + y * surface->pitch;
+      for (x = rect->x; x < rect->x + rect->w; x++) {
+         const SDL_bool keyed = (((x / 5) + y + seed) % 3 == 0);
+         if (surface->format->BytesPerPixel == 1) {
+            row[x] = keyed ? 0 : (Uint8)(1 + (x * 7 + y * 3 + seed) % 254);
+         } else {
+            const Uint32 alpha = (x % 4 == 1) ? (Uint32)(0x80 + y) : 0xff;
+            ((Uint32 *)row)[x] = keyed ? 0 : ((alpha << 24) |
+                                              (((x * 9 + seed) & 0xff) << 16) |
+                                              (((y * 13) & 0xff) << 8) |
+                                              (((x + y) * 5) & 0xff));
+         }
+      }
+   }
+}
+
+/* Creates a 50x30 source, colorkeyed on zero unless 'blend' is set */
+static SDL_Surface *
+_createRLESource(int bpp, SDL_bool blend)
+{
+   SDL_Surface *surface;
+   SDL_Rect all = { 0, 0, 50, 30 };
+   SDL_Color colors[256];
+   int i;
+
+   if (bpp == 8) {
+      surface = SDL_CreateRGBSurface(0, all.w, all.h, 8, 0, 0, 0, 0);
+      if (surface != NULL) {
+         for (i = 0; i < 256; i++) {
+            colors[i].r = (Uint8)i;
+            colors[i].g = (Uint8)(255 - i);
+            colors[i].b = (Uint8)(i * 7);
+            colors[i].a = 255;
+         }
+         SDL_SetPaletteColors(surface->format->palette, colors, 0, 256);
+      }
+   } else {
+      surface = SDL_CreateRGBSurface(0, all.w, all.h, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+   }
+   if (surface == NULL) {
+      return NULL;
+   }
+   _drawRLEPattern(surface, &all, 0);
+   if (blend) {
+      SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_BLEND);
+   } else {
+      SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);
+      SDL_SetColorKey(surface, SDL_TRUE, 0);
+   }
+   return surface;
+}
+
+/* Blits 'rle' and 'plain' whole and clipped onto a cleared 'actual' and
+   'expected', and checks that they give the same pixels, give or take
+   'allowable_error' */
+static void
+_checkRLEBlit(SDL_Surface *rle, SDL_Surface *plain, SDL_Surface *actual, SDL_Surface *expected, int allowable_error, const char *step)
+{
+   /* The second one hangs off the top right corner, clear of the first */
+   static const SDL_Rect places[] = { { 2, 4, 0, 0 }, { 60, -11, 0, 0 } };
+   SDL_Rect rect;
+   int i, ret;
+
+   SDL_FillRect(expected, NULL, SDL_MapRGB(expected->format, 0x20, 0x90, 0x50));
+   SDL_FillRect(actual, NULL, SDL_MapRGB(actual->format, 0x20, 0x90, 0x50));
+   for (i = 0; i < SDL_arraysize(places); i++) {
+      /* Blitting clips the destination rectangle in place */
+      rect = places[i];
+      SDL_BlitSurface(plain, NULL, expected, &rect);
+      rect = places[i];
+      SDL_BlitSurface(rle, NULL, actual, &rect);
+   }
+   if (actual->format->BitsPerPixel == 32) {
+      SDLTest_AssertCheck((rle->flags & SDL_RLEACCEL) != 0, "Verify %i-bit source is RLE encoded %s", plain->format->BitsPerPixel, step);
+   }
+   ret = SDLTest_CompareSurfaces(actual, expected, allowable_error);
+   SDLTest_AssertCheck(ret == 0, "Verify %i-bit RLE blit to %i-bit target %s, expected: 0 differences, got: %i", plain->format->BitsPerPixel, actual->format->BitsPerPixel, step, ret);
+}
+
+/**
+ * @brief Tests that RLE surfaces blit like plain ones into 32, 16 and
+ * 24-bit targets, also after being changed through a lock, SDL_FillRect()
+ * and a blit onto them.
+ */
+int
+surface_testRLE(void *arg)
+{
+   static const struct {
+      int bpp;
+      SDL_bool blend;
+   } sources[] = {
+      { 32, SDL_FALSE },
+      { 32, SDL_TRUE },
+      { 8, SDL_FALSE }
+   };
+   static const struct {
+      int bpp;
+      Uint32 Rmask, Gmask, Bmask;
+   } targets[] = {
+      { 32, 0x00ff0000, 0x0000ff00, 0x000000ff },
+      { 16, 0xf800, 0x07e0, 0x001f },
+      { 24, 0xff0000, 0x00ff00, 0x0000ff }
+   };
+   SDL_Surface *rle, *plain, *actual, *expected, *patch;
+   SDL_Rect rows = { 0, 5, 50, 8 };
+   SDL_Rect band = { 3, 17, 40, 6 };
+   SDL_Rect hole = { 30, 2, 9, 20 };
+   SDL_Rect spot = { 12, 24, 6, 4 };
+   Uint32 Amask;
+   int i, j, allowable_error;
+
+   patch = SDL_CreateRGBSurface(0, 6, 6, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+   SDLTest_AssertCheck(patch != NULL, "Verify patch surface is not NULL");
+   if (patch == NULL) {
+      return TEST_ABORTED;
+   }
+   SDL_FillRect(patch, NULL, 0xffc0b0a0);
+   SDL_SetSurfaceBlendMode(patch, SDL_BLENDMODE_NONE);
+
+   for (i = 0; i < SDL_arraysize(sources); i++) {
+      /* The RLE alpha blenders have always shifted by 8 where the other
+         blitters divide by 255, so blended colors may be two steps off */
+      allowable_error = sources[i].blend ? 3 * 2 * 2 : 0;
+
+      for (j = 0; j < SDL_arraysize(targets); j++) {
+         /* Colorkeyed 32-bit sources are only encoded for their own format */
+         Amask = (targets[j].bpp == 32 && sources[i].bpp == 32) ? 0xff000000 : 0;
+         rle = _createRLESource(sources[i].bpp, sources[i].blend);
+         plain = _createRLESource(sources[i].bpp, sources[i].blend);
+         actual = SDL_CreateRGBSurface(0, 100, 40, targets[j].bpp, targets[j].Rmask, targets[j].Gmask, targets[j].Bmask, Amask);
+         expected = SDL_CreateRGBSurface(0, 100, 40, targets[j].bpp, targets[j].Rmask, targets[j].Gmask, targets[j].Bmask, Amask);
+         SDLTest_AssertCheck(rle != NULL && plain != NULL && actual != NULL && expected != NULL, "Verify %i-bit sources and %i-bit targets are not NULL", sources[i].bpp, targets[j].bpp);
+         if (rle == NULL || plain == NULL || actual == NULL || expected == NULL) {
+            SDL_FreeSurface(rle);
+            SDL_FreeSurface(plain);
+            SDL_FreeSurface(actual);
+            SDL_FreeSurface(expected);
+            continue;
+         }
+         SDL_SetSurfaceRLE(rle, 1);
+         _checkRLEBlit(rle, plain, actual, expected, allowable_error, "when first encoded");
+
+         /* The same target keeps the encoding, so changes are spliced in */
+         SDL_LockSurface(rle);
+         _drawRLEPattern(rle, &rows, 1);
+         SDL_UnlockSurface(rle);
+         _drawRLEPattern(plain, &rows, 1);
+         _checkRLEBlit(rle, plain, actual, expected, allowable_error, "after lock and unlock");
+
+         SDL_FillRect(rle, &band, SDL_MapRGBA(rle->format, 0x40, 0x50, 0x60, 0xff));
+         SDL_FillRect(plain, &band, SDL_MapRGBA(plain->format, 0x40, 0x50, 0x60, 0xff));
+         SDL_FillRect(rle, &hole, 0);
+         SDL_FillRect(plain, &hole, 0);
+         _checkRLEBlit(rle, plain, actual, expected, allowable_error, "after partial fills");
+
+         SDL_BlitSurface(patch, NULL, rle, &spot);
+         SDL_BlitSurface(patch, NULL, plain, &spot);
+         _checkRLEBlit(rle, plain, actual, expected, allowable_error, "after a blit onto it");
+
+         SDL_FreeSurface(rle);
+         SDL_FreeSurface(plain);
+         SDL_FreeSurface(actual);
+         SDL_FreeSurface(expected);
+      }
+   }
+   SDL_FreeSurface(patch);
+
+   return TEST_COMPLETED;
+}
+
+/* Reads the pixel at 'x', 'y' of a 16, 24 or 32-bit surface */
+static Uint32
+_getSurfacePixel(SDL_Surface *surface, int x, int y)
+{
+   const int bpp = surface->format->BytesPerPixel;
+   Uint32 pixel = 0;
+
+   SDL_memcpy(&pixel, (Uint8 *)surface->pixels + y * surface->pitch + x * bpp, bpp);
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+   pixel >>= (4 - bpp) * 8;
+#endif
+   return pixel;
+}
+
+/**
+ * @brief Tests the straight conversions between the 8888, 24-bit and 565
+ * formats against SDL_GetRGBA() and SDL_MapRGBA(), with and without the
+ * vector blitters. 565 sources go through all 65536 values.
+ */
+int
+surface_testConvertFormats(void *arg)
+{
+   static const Uint32 formats[] = {
+      SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888,
+      SDL_PIXELFORMAT_RGBX8888, SDL_PIXELFORMAT_BGRX8888,
+      SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGBA8888,
+      SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGRA8888,
+      SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_BGR24,
+      SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_BGR565
+   };
+   /* Scalar, SSE2 only and whatever the CPU has */
+   static const char *features[] = { "0", "8", "" };
+   const char *saved = SDL_GetHint(SDL_HINT_BLIT_CPU_FEATURES);
+   char *original = saved ? SDL_strdup(saved) : NULL;
+   SDL_Surface *src, *dst;
+   Uint32 Rmask, Gmask, Bmask, Amask, pixel;
+   Uint8 r, g, b, a, er, eg, eb, ea;
+   int i, j, k, x, y, bpp, w, h, ret, errors;
+
+   for (i = 0; i < SDL_arraysize(features); i++) {
+      if (SDL_strcmp(features[i], "8") == 0 && !SDL_HasSSE2()) {
+         SDLTest_Log("Skipping SDL_BLIT_CPU_FEATURES=%s, not supported by this CPU", features[i]);
+         continue;
+      }
+      SDL_SetHintWithPriority(SDL_HINT_BLIT_CPU_FEATURES, features[i], SDL_HINT_OVERRIDE);
+
+      for (j = 0; j < SDL_arraysize(formats); j++) {
+         for (k = 0; k < SDL_arraysize(formats); k++) {
+            /* The table converts to and from the 8888 formats */
+            if (j == k || (SDL_BYTESPERPIXEL(formats[j]) != 4 && SDL_BYTESPERPIXEL(formats[k]) != 4)) {
+               continue;
+            }
+
+            /* An odd width leaves tails for the vector loops */
+            w = (SDL_BYTESPERPIXEL(formats[j]) == 2) ? 256 : 61;
+            h = (SDL_BYTESPERPIXEL(formats[j]) == 2) ? 256 : 37;
+            SDL_PixelFormatEnumToMasks(formats[j], &bpp, &Rmask, &Gmask, &Bmask, &Amask);
+            src = SDL_CreateRGBSurface(0, w, h, bpp, Rmask, Gmask, Bmask, Amask);
+            SDL_PixelFormatEnumToMasks(formats[k], &bpp, &Rmask, &Gmask, &Bmask, &Amask);
+            dst = SDL_CreateRGBSurface(0, w, h, bpp, Rmask, Gmask, Bmask, Amask);
+            SDLTest_AssertCheck(src != NULL && dst != NULL, "Verify %s and %s surfaces are not NULL", SDL_GetPixelFormatName(formats[j]), SDL_GetPixelFormatName(formats[k]));
+            if (src == NULL || dst == NULL) {
+               SDL_FreeSurface(src);
+               SDL_FreeSurface(dst);
+               continue;
+            }
+
+            for (y = 0; y < h; y++) {
+               Uint8 *row = (Uint8 *)src->pixels + y * src->pitch;
+               for (x = 0; x < src->w * src->format->BytesPerPixel; x++) {
+                  row[x] = (Uint8)(((y * src->pitch + x) * 2654435761u) >> 24);
+               }
+               if (src->format->BytesPerPixel == 2) {
+                  for (x = 0; x < w; x++) {
+                     ((Uint16 *)row)[x] = (Uint16)(y * w + x);
+                  }
+               }
+            }
+            SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+            ret = SDL_BlitSurface(src, NULL, dst, NULL);
+
+            errors = 0;
+            for (y = 0; y < h; y++) {
+               for (x = 0; x < w; x++) {
+                  SDL_GetRGBA(_getSurfacePixel(src, x, y), src->format, &r, &g, &b, &a);
+                  pixel = SDL_MapRGBA(dst->format, r, g, b, a);
+                  SDL_GetRGBA(pixel, dst->format, &er, &eg, &eb, &ea);
+                  SDL_GetRGBA(_getSurfacePixel(dst, x, y), dst->format, &r, &g, &b, &a);
+                  if (r != er || g != eg || b != eb || a != ea) {
+                     errors++;
+                  }
+               }
+            }
+            SDLTest_AssertCheck(ret == 0 && errors == 0, "Verify %s to %s with SDL_BLIT_CPU_FEATURES=\"%s\", expected: 0 errors, got: %i (result %i)",
+                                SDL_GetPixelFormatName(formats[j]), SDL_GetPixelFormatName(formats[k]), features[i], errors, ret);
+
+            SDL_FreeSurface(src);
+            SDL_FreeSurface(dst);
+         }
+      }
+   }
+
+   /* An empty value is the same as no override */
+   SDL_SetHintWithPriority(SDL_HINT_BLIT_CPU_FEATURES, original ? original : "", SDL_HINT_OVERRIDE);
+   SDL_free(original);
+
+   return TEST_COMPLETED;
+}
+
+/* Fills every byte of a surface with a pattern, 'seed' makes it differ */
+static void
+_fillBytePattern(SDL_Surface *surface, int seed)
+{
+   int x, y;
+
+   for (y = 0; y < surface->h; y++) {
+      Uint8 *row = (Uint8 *)surface->pixels + y * surface->pitch;
+      for (x = 0; x < surface->pitch; x++) {
+         row[x] = (Uint8)((x * 7 + y * 13 + ((x * y) >> 3) + seed) & 0xff);
+      }
+   }
+}
+
+/**
+ * @brief Tests that blits big enough to be split into bands give the same
+ * result with one and with several blit threads.
+ */
+int
+surface_testBlitThreads(void *arg)
+{
+   static const struct {
+      Uint32 src_format;
+      Uint32 dst_format;
+      SDL_BlendMode blendMode;
+      SDL_bool colorkey;
+      SDL_bool modulate;
+   } cases[] = {
+      { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_BLEND, SDL_FALSE, SDL_FALSE },
+      { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565, SDL_BLENDMODE_BLEND, SDL_FALSE, SDL_TRUE },
+      { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, SDL_BLENDMODE_NONE, SDL_TRUE, SDL_TRUE },
+      { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR24, SDL_BLENDMODE_NONE, SDL_FALSE, SDL_FALSE },
+      { SDL_PIXELFORMAT_INDEX8, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_NONE, SDL_TRUE, SDL_FALSE }
+   };
+   /* Over 256K pixels, so four threads get a band each */
+   const SDL_Rect srcrect = { 7, 5, 580, 470 };
+   const SDL_Rect place = { 11, 9, 0, 0 };
+   const char *saved = SDL_GetHint(SDL_HINT_BLIT_THREADS);
+   char *original = saved ? SDL_strdup(saved) : NULL;
+   SDL_Surface *src, *single, *threaded;
+   SDL_Rect dstrect;
+   SDL_Color colors[256];
+   Uint32 Rmask, Gmask, Bmask, Amask;
+   int i, y, bpp, ret1, ret4, differ;
+
+   for (i = 0; i < 256; i++) {
+      colors[i].r = (Uint8)(i * 5);
+      colors[i].g = (Uint8)(i * 3 + 40);
+      colors[i].b = (Uint8)(255 - i);
+      colors[i].a = 255;
+   }
+
+   for (i = 0; i < SDL_arraysize(cases); i++) {
+      SDL_PixelFormatEnumToMasks(cases[i].src_format, &bpp, &Rmask, &Gmask, &Bmask, &Amask);
+      src = SDL_CreateRGBSurface(0, 600, 500, bpp, Rmask, Gmask, Bmask, Amask);
+      SDL_PixelFormatEnumToMasks(cases[i].dst_format, &bpp, &Rmask, &Gmask, &Bmask, &Amask);
+      single = SDL_CreateRGBSurface(0, 620, 520, bpp, Rmask, Gmask, Bmask, Amask);
+      threaded = SDL_CreateRGBSurface(0, 620, 520, bpp, Rmask, Gmask, Bmask, Amask);
+      SDLTest_AssertCheck(src != NULL && single != NULL && threaded != NULL, "Verify result from SDL_CreateRGBSurface is not NULL");
+      if (src == NULL || single == NULL || threaded == NULL) {
+         SDL_FreeSurface(src);
+         SDL_FreeSurface(single);
+         SDL_FreeSurface(threaded);
+         continue;
+      }
+
+      _fillBytePattern(src, 0);
+      _fillBytePattern(single, 100);
+      _fillBytePattern(threaded, 100);
+      if (src->format->palette) {
+         SDL_SetPaletteColors(src->format->palette, colors, 0, 256);
+      }
+      SDL_SetSurfaceBlendMode(src, cases[i].blendMode);
+      if (cases[i].colorkey) {
+         SDL_SetColorKey(src, SDL_TRUE, src->format->palette ? 17 : _getSurfacePixel(src, 7, 5));
+      }
+      if (cases[i].modulate) {
+         SDL_SetSurfaceColorMod(src, 0xc0, 0xff, 0x80);
+         SDL_SetSurfaceAlphaMod(src, 0xa0);
+      }
+
+      SDL_SetHint(SDL_HINT_BLIT_THREADS, "1");
+      dstrect = place;
+      ret1 = SDL_BlitSurface(src, (SDL_Rect *)&srcrect, single, &dstrect);
+      SDL_SetHint(SDL_HINT_BLIT_THREADS, "4");
+      dstrect = place;
+      ret4 = SDL_BlitSurface(src, (SDL_Rect *)&srcrect, threaded, &dstrect);
+
+      differ = 0;
+      for (y = 0; y < single->h; y++) {
+         differ += (SDL_memcmp((Uint8 *)single->pixels + y * single->pitch,
+                               (Uint8 *)threaded->pixels + y * threaded->pitch,
+                               single->w * single->format->BytesPerPixel) != 0);
+      }
+      SDLTest_AssertCheck(ret1 == 0 && ret4 == 0 && differ == 0, "Verify %s to %s with 4 blit threads matches 1 thread, expected: 0 differing rows, got: %i (results %i, %i)",
+                          SDL_GetPixelFormatName(cases[i].src_format), SDL_GetPixelFormatName(cases[i].dst_format), differ, ret1, ret4);
+
+      SDL_FreeSurface(src);
+      SDL_FreeSurface(single);
+      SDL_FreeSurface(threaded);
+   }
+
+   SDL_SetHint(SDL_HINT_BLIT_THREADS, original ? original : "1");
+   SDL_free(original);
+
+   return TEST_COMPLETED;
+}
+
+/* Blend modes and modulation of surface_testSIMDBlits() */
+static const struct {
+   SDL_BlendMode blendMode;
+   SDL_bool modulate;
+   SDL_bool colorkey;
+   int allowable_error;
+   const char *name;
+} _simdBlitModes[] = {
+   { SDL_BLENDMODE_NONE, SDL_TRUE, SDL_FALSE, 0, "modulated copy" },
+   /* The scalar per-pixel alpha blitters approximate the division by 255 */
+   { SDL_BLENDMODE_BLEND, SDL_FALSE, SDL_FALSE, 3, "blend" },
+   { SDL_BLENDMODE_BLEND, SDL_TRUE, SDL_FALSE, 0, "modulated blend" },
+   { SDL_BLENDMODE_ADD, SDL_FALSE, SDL_FALSE, 0, "add" },
+   { SDL_BLENDMODE_MOD, SDL_TRUE, SDL_FALSE, 0, "modulated mod" },
+   { SDL_BLENDMODE_NONE, SDL_FALSE, SDL_TRUE, 0, "colorkey" },
+   { SDL_BLENDMODE_BLEND, SDL_FALSE, SDL_TRUE, 0, "colorkey blend" }
+};
+
+/* Blits a pattern in 'src_format' onto one in 'dst_format' with fresh
+   surfaces, so the blitter is picked for the current CPU features */
+static SDL_Surface *
+_blitSIMDPattern(Uint32 src_format, Uint32 dst_format, int mode)
+{
+   const SDL_Rect place = { 2, 1, 0, 0 };
+   SDL_Surface *src, *dst;
+   SDL_Rect dstrect = place;
+   Uint32 Rmask, Gmask, Bmask, Amask, key;
+   int bpp, x, y, ret;
+
+   SDL_PixelFormatEnumToMasks(src_format, &bpp, &Rmask, &Gmask, &Bmask, &Amask);
+   src = SDL_CreateRGBSurface(0, 37, 9, bpp, Rmask, Gmask, Bmask, Amask);
+   SDL_PixelFormatEnumToMasks(dst_format, &bpp, &Rmask, &Gmask, &Bmask, &Amask);
+   dst = SDL_CreateRGBSurface(0, 41, 11, bpp, Rmask, Gmask, Bmask, Amask);
+   if (src == NULL || dst == NULL) {
+      SDL_FreeSurface(src);
+      SDL_FreeSurface(dst);
+      return NULL;
+   }
+   _fillBytePattern(src, 0);
+   _fillBytePattern(dst, 100);
+
+   SDL_SetSurfaceBlendMode(src, _simdBlitModes[mode].blendMode);
+   if (_simdBlitModes[mode].modulate) {
+      SDL_SetSurfaceColorMod(src, 0xc0, 0xff, 0x80);
+      SDL_SetSurfaceAlphaMod(src, 0xa0);
+   }
+   if (_simdBlitModes[mode].colorkey) {
+      /* Every fifth pixel matches the key */
+      key = _getSurfacePixel(src, 3, 2);
+      for (y = 0; y < src->h; y++) {
+         for (x = y % 5; x < src->w; x += 5) {
+            ((Uint32 *)((Uint8 *)src->pixels + y * src->pitch))[x] = key;
+         }
+      }
+      SDL_SetColorKey(src, SDL_TRUE, key);
+   }
+
+   ret = SDL_BlitSurface(src, NULL, dst, &dstrect);
+   SDL_FreeSurface(src);
+   if (ret != 0) {
+      SDL_FreeSurface(dst);
+      return NULL;
+   }
+   return dst;
+}
+
+/**
+ * @brief Tests the vectorized 8888 blitters against the scalar ones for
+ * every format pair, blend mode, modulation and colorkey. Widths aren't a
+ * multiple of the vector width, so the row tails are covered too.
+ */
+int
+surface_testSIMDBlits(void *arg)
+{
+   static const Uint32 formats[] = {
+      SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888,
+      SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGBA8888,
+      SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGRA8888
+   };
+   const char *saved = SDL_GetHint(SDL_HINT_BLIT_CPU_FEATURES);
+   char *original = saved ? SDL_strdup(saved) : NULL;
+   SDL_Surface *scalar, *sse2, *best;
+   Uint8 r, g, b, a, er, eg, eb, ea;
+   int i, j, mode, x, y, allowable_error, errors, differ;
+
+   if (!SDL_HasSSE2()) {
+      SDLTest_Log("Skipping the vector blitters, not supported by this CPU");
+      SDL_free(original);
+      return TEST_SKIPPED;
+   }
+
+   for (i = 0; i < SDL_arraysize(formats); i++) {
+      for (j = 0; j < SDL_arraysize(formats); j++) {
+         for (mode = 0; mode < SDL_arraysize(_simdBlitModes); mode++) {
+            SDL_SetHintWithPriority(SDL_HINT_BLIT_CPU_FEATURES, "0", SDL_HINT_OVERRIDE);
+            scalar = _blitSIMDPattern(formats[i], formats[j], mode);
+            SDL_SetHintWithPriority(SDL_HINT_BLIT_CPU_FEATURES, "8", SDL_HINT_OVERRIDE);
+            sse2 = _blitSIMDPattern(formats[i], formats[j], mode);
+            SDL_SetHintWithPriority(SDL_HINT_BLIT_CPU_FEATURES, "", SDL_HINT_OVERRIDE);
+            best = _blitSIMDPattern(formats[i], formats[j], mode);
+            SDLTest_AssertCheck(scalar != NULL && sse2 != NULL && best != NULL, "Verify %s blits of %s to %s succeeded",
+                                _simdBlitModes[mode].name, SDL_GetPixelFormatName(formats[i]), SDL_GetPixelFormatName(formats[j]));
+            if (scalar == NULL || sse2 == NULL || best == NULL) {
+               SDL_FreeSurface(scalar);
+               SDL_FreeSurface(sse2);
+               SDL_FreeSurface(best);
+               continue;
+            }
+
+            allowable_error = _simdBlitModes[mode].allowable_error;
+            errors = 0;
+            differ = 0;
+            for (y = 0; y < scalar->h; y++) {
+               for (x = 0; x < scalar->w; x++) {
+                  SDL_GetRGBA(_getSurfacePixel(scalar, x, y), scalar->format, &er, &eg, &eb, &ea);
+                  SDL_GetRGBA(_getSurfacePixel(sse2, x, y), sse2->format, &r, &g, &b, &a);
+                  if (SDL_abs(r - er) > allowable_error || SDL_abs(g - eg) > allowable_error ||
+                      SDL_abs(b - eb) > allowable_error || SDL_abs(a - ea) > allowable_error) {
+                     errors++;
+                  }
+                  differ += (_getSurfacePixel(sse2, x, y) != _getSurfacePixel(best, x, y));
+               }
+            }
+            SDLTest_AssertCheck(errors == 0, "Verify %s of %s to %s with SSE2 matches scalar blitters, expected: 0 errors, got: %i",
+                                _simdBlitModes[mode].name, SDL_GetPixelFormatName(formats[i]), SDL_GetPixelFormatName(formats[j]), errors);
+            SDLTest_AssertCheck(differ == 0, "Verify %s of %s to %s with all CPU features matches SSE2, expected: 0 differences, got: %i",
+                                _simdBlitModes[mode].name, SDL_GetPixelFormatName(formats[i]), SDL_GetPixelFormatName(formats[j]), differ);
+
+            SDL_FreeSurface(scalar);
+            SDL_FreeSurface(sse2);
+            SDL_FreeSurface(best);
+         }
+      }
+   }
+
+   SDL_SetHintWithPriority(SDL_HINT_BLIT_CPU_FEATURES, original ? original : "", SDL_HINT_OVERRIDE);
+   SDL_free(original);
+
+   return TEST_COMPLETED;
+}
+
+/* What SDL_Blit_Slow() makes of one pixel, for surface_testGeneratedBlits() */
+static Uint32
+_slowBlitPixel(Uint32 srcpixel, SDL_PixelFormat *src_fmt, Uint32 dstpixel, SDL_PixelFormat *dst_fmt,
+               SDL_BlendMode blendMode, const SDL_Color *modulate_color, const SDL_Color *modulate_alpha)
+{
+   Uint8 r, g, b, a;
+   Uint32 srcR, srcG, srcB, srcA, dstR, dstG, dstB, dstA;
+
+   SDL_GetRGBA(srcpixel, src_fmt, &r, &g, &b, &a);
+   srcR = r; srcG = g; srcB = b; srcA = a;
+   SDL_GetRGBA(dstpixel, dst_fmt, &r, &g, &b, &a);
+   dstR = r; dstG = g; dstB = b; dstA = a;
+
+   if (modulate_color) {
+      srcR = (srcR * modulate_color->r) / 255;
+      srcG = (srcG * modulate_color->g) / 255;
+      srcB = (srcB * modulate_color->b) / 255;
+   }
+   if (modulate_alpha) {
+      srcA = (srcA * modulate_alpha->a) / 255;
+   }
+   if ((blendMode == SDL_BLENDMODE_BLEND || blendMode == SDL_BLENDMODE_ADD) && srcA < 255) {
+      srcR = (srcR * srcA) / 255;
+      srcG = (srcG * srcA) / 255;
+      srcB = (srcB * srcA) / 255;
+   }
+   switch (blendMode) {
+   case SDL_BLENDMODE_NONE:
+      dstR = srcR; dstG = srcG; dstB = srcB; dstA = srcA;
+      break;
+   case SDL_BLENDMODE_BLEND:
+      dstR = srcR + ((255 - srcA) * dstR) / 255;
+      dstG = srcG + ((255 - srcA) * dstG) / 255;
+      dstB = srcB + ((255 - srcA) * dstB) / 255;
+      dstA = srcA + ((255 - srcA) * dstA) / 255;
+      break;
+   case SDL_BLENDMODE_ADD:
+      dstR = SDL_min(srcR + dstR, 255);
+      dstG = SDL_min(srcG + dstG, 255);
+      dstB = SDL_min(srcB + dstB, 255);
+      break;
+   case SDL_BLENDMODE_MOD:
+      dstR = (srcR * dstR) / 255;
+      dstG = (srcG * dstG) / 255;
+      dstB = (srcB * dstB) / 255;
+      break;
+   }
+   return SDL_MapRGBA(dst_fmt, (Uint8)dstR, (Uint8)dstG, (Uint8)dstB, (Uint8)dstA);
+}
+
+/**
+ * @brief Tests the generated blitters of every format pair, copy flag and
+ * scaling against the per-pixel arithmetic of SDL_Blit_Slow().
+ */
+int
+surface_testGeneratedBlits(void *arg)
+{
+   static const Uint32 src_formats[] = {
+      SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888,
+      SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGBA8888,
+      SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGRA8888
+   };
+   static const Uint32 dst_formats[] = {
+      SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888
+   };
+   static const SDL_BlendMode blendModes[] = {
+      SDL_BLENDMODE_NONE, SDL_BLENDMODE_BLEND, SDL_BLENDMODE_ADD, SDL_BLENDMODE_MOD
+   };
+   const SDL_Color modulate = { 0xc0, 0xff, 0x80, 0xa0 };
+   const char *saved = SDL_GetHint(SDL_HINT_BLIT_CPU_FEATURES);
+   char *original = saved ? SDL_strdup(saved) : NULL;
+   SDL_Surface *src, *before, *after;
+   SDL_Rect dstrect;
+   Uint32 Rmask, Gmask, Bmask, Amask, expected;
+   Uint8 r, g, b, a, er, eg, eb, ea;
+   int i, j, k, modulation, scaled, bpp, x, y, incx, incy, ret, errors;
+
+   /* Without the vector blitters everything here but the alpha blending
+      skipped below goes through the generated ones */
+   SDL_SetHintWithPriority(SDL_HINT_BLIT_CPU_FEATURES, "0", SDL_HINT_OVERRIDE);
+
+   for (i = 0; i < SDL_arraysize(src_formats); i++) {
+      for (j = 0; j < SDL_arraysize(dst_formats); j++) {
+         for (k = 0; k < SDL_arraysize(blendModes); k++) {
+            for (modulation = 0; modulation < 4; modulation++) {
+               for (scaled = 0; scaled < 2; scaled++) {
+                  if (blendModes[k] == SDL_BLENDMODE_BLEND && !scaled &&
+                      (modulation == 0 || (modulation == 2 && !SDL_ISPIXELFORMAT_ALPHA(src_formats[i])))) {
+                     /* Per-pixel and per-surface alpha blending have their own blitters */
+                     continue;
+                  }
+
+                  SDL_PixelFormatEnumToMasks(src_formats[i], &bpp, &Rmask, &Gmask, &Bmask, &Amask);
+                  src = SDL_CreateRGBSurface(0, 13, 7, bpp, Rmask, Gmask, Bmask, Amask);
+                  SDL_PixelFormatEnumToMasks(dst_formats[j], &bpp, &Rmask, &Gmask, &Bmask, &Amask);
+                  before = SDL_CreateRGBSurface(0, 35, 21, bpp, Rmask, Gmask, Bmask, Amask);
+                  after = SDL_CreateRGBSurface(0, 35, 21, bpp, Rmask, Gmask, Bmask, Amask);
+                  if (src == NULL || before == NULL || after == NULL) {
+                     SDLTest_AssertCheck(SDL_FALSE, "Verify result from SDL_CreateRGBSurface is not NULL");
+                     SDL_FreeSurface(src);
+                     SDL_FreeSurface(before);
+                     SDL_FreeSurface(after);
+                     continue;
+                  }
+                  _fillBytePattern(src, 0);
+                  _fillBytePattern(before, 100);
+                  _fillBytePattern(after, 100);
+
+                  SDL_SetSurfaceBlendMode(src, blendModes[k]);
+                  if (modulation & 1) {
+                     SDL_SetSurfaceColorMod(src, modulate.r, modulate.g, modulate.b);
+                  }
+                  if (modulation & 2) {
+                     SDL_SetSurfaceAlphaMod(src, modulate.a);
+                  }
+                  dstrect.x = 3;
+                  dstrect.y = 2;
+                  dstrect.w = scaled ? 29 : src->w;
+                  dstrect.h = scaled ? 17 : src->h;
+                  ret = SDL_BlitScaled(src, NULL, after, &dstrect);
+
+                  /* SDL_Blit_Slow() steps through the source in 16.16 */
+                  incx = (src->w << 16) / dstrect.w;
+                  incy = (src->h << 16) / dstrect.h;
+                  errors = 0;
+                  for (y = 0; y < dstrect.h; y++) {
+                     for (x = 0; x < dstrect.w; x++) {
+                        expected = _slowBlitPixel(_getSurfacePixel(src, (x * incx) >> 16, (y * incy) >> 16), src->format,
+                                                  _getSurfacePixel(before, dstrect.x + x, dstrect.y + y), before->format,
+                                                  blendModes[k],
+                                                  (modulation & 1) ? &modulate : NULL,
+                                                  (modulation & 2) ? &modulate : NULL);
+                        SDL_GetRGBA(expected, after->format, &er, &eg, &eb, &ea);
+                        SDL_GetRGBA(_getSurfacePixel(after, dstrect.x + x, dstrect.y + y), after->format, &r, &g, &b, &a);
+                        if (r != er || g != eg || b != eb || a != ea) {
+                           errors++;
+                        }
+                     }
+                  }
+                  SDLTest_AssertCheck(ret == 0 && errors == 0, "Verify %s to %s with blend mode %i, modulation %i%s, expected: 0 errors, got: %i (result %i)",
+                                      SDL_GetPixelFormatName(src_formats[i]), SDL_GetPixelFormatName(dst_formats[j]),
+                                      (int)blendModes[k], modulation, scaled ? ", scaled" : "", errors, ret);
+
+                  SDL_FreeSurface(src);
+                  SDL_FreeSurface(before);
+                  SDL_FreeSurface(after);
+               }
+            }
+         }
+      }
+   }
+
+   SDL_SetHintWithPriority(SDL_HINT_BLIT_CPU_FEATURES, original ? original : "", SDL_HINT_OVERRIDE);
+   SDL_free(original);
+
+   return TEST_COMPLETED;
+}
+
+/* Destinations of surface_testBlitMapCache(), more than the cached mappings */
+static SDL_Surface *
+_createCacheTarget(int index)
+{
+   static const Uint32 formats[] = {
+      SDL_PIXELFORMAT_INDEX8, SDL_PIXELFORMAT_INDEX8, SDL_PIXELFORMAT_RGB565,
+      SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888
+   };
+   SDL_Surface *surface;
+   Uint32 Rmask, Gmask, Bmask, Amask;
+   SDL_Color colors[256];
+   int bpp, i;
+
+   SDL_PixelFormatEnumToMasks(formats[index], &bpp, &Rmask, &Gmask, &Bmask, &Amask);
+   surface = SDL_CreateRGBSurface(0, 24, 16, bpp, Rmask, Gmask, Bmask, Amask);
+   if (surface && surface->format->palette) {
+      for (i = 0; i < 256; i++) {
+         colors[i].r = (Uint8)(i * (index + 3));
+         colors[i].g = (Uint8)(255 - i);
+         colors[i].b = (Uint8)(i * 7 + index * 40);
+         colors[i].a = 255;
+      }
+      SDL_SetPaletteColors(surface->format->palette, colors, 0, 256);
+   }
+   return surface;
+}
+
+/* An 8-bit or blended 32-bit source for surface_testBlitMapCache() */
+static SDL_Surface *
+_createCacheSource(int bpp)
+{
+   SDL_Surface *surface;
+   SDL_Color colors[256];
+   int i;
+
+   if (bpp == 8) {
+      surface = SDL_CreateRGBSurface(0, 20, 12, 8, 0, 0, 0, 0);
+      if (surface) {
+         for (i = 0; i < 256; i++) {
+            colors[i].r = (Uint8)(i * 5);
+            colors[i].g = (Uint8)(i * 3 + 40);
+            colors[i].b = (Uint8)(255 - i);
+            colors[i].a = 255;
+         }
+         SDL_SetPaletteColors(surface->format->palette, colors, 0, 256);
+      }
+   } else {
+      surface = SDL_CreateRGBSurface(0, 20, 12, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+      if (surface) {
+         SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_BLEND);
+      }
+   }
+   if (surface) {
+      _fillBytePattern(surface, 0);
+   }
+   return surface;
+}
+
+/**
+ * @brief Tests that a source blitted to more destinations than the blit map
+ * caches gives the same results as one drawn to a single destination, also
+ * after palettes or copy flags change and a destination is replaced.
+ */
+int
+surface_testBlitMapCache(void *arg)
+{
+   static const int depths[] = { 8, 32 };
+   const SDL_Rect place = { 3, 2, 0, 0 };
+   SDL_Surface *src, *targets[6], *twins[6], *twinTargets[6];
+   SDL_Rect dstrect;
+   SDL_Color color;
+   int i, j, round, y, ret1, ret2, differ;
+
+   for (i = 0; i < SDL_arraysize(depths); i++) {
+      src = _createCacheSource(depths[i]);
+      for (j = 0; j < SDL_arraysize(targets); j++) {
+         targets[j] = _createCacheTarget(j);
+         twinTargets[j] = _createCacheTarget(j);
+         twins[j] = _createCacheSource(depths[i]);
+      }
+
+      for (round = 0; round < 4; round++) {
+         if (round == 1) {
+            /* Palettes change under cached mappings */
+            color.r = 0x12; color.g = 0x34; color.b = 0x56; color.a = 255;
+            for (j = 0; j < SDL_arraysize(targets); j++) {
+               if (targets[j] && targets[j]->format->palette) {
+                  SDL_SetPaletteColors(targets[j]->format->palette, &color, 40, 1);
+                  SDL_SetPaletteColors(twinTargets[j]->format->palette, &color, 40, 1);
+               }
+               if (src && src->format->palette && twins[j]) {
+                  SDL_SetPaletteColors(twins[j]->format->palette, &color, 7, 1);
+               }
+            }
+            if (src && src->format->palette) {
+               SDL_SetPaletteColors(src->format->palette, &color, 7, 1);
+            }
+         } else if (round == 2) {
+            /* The copy flags change, modulation can't be blitted to 8-bit */
+            if (src && src->format->palette) {
+               SDL_SetColorKey(src, SDL_TRUE, 17);
+            } else {
+               SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+            }
+            for (j = 0; j < SDL_arraysize(twins); j++) {
+               if (twins[j] && twins[j]->format->palette) {
+                  SDL_SetColorKey(twins[j], SDL_TRUE, 17);
+               } else {
+                  SDL_SetSurfaceBlendMode(twins[j], SDL_BLENDMODE_NONE);
+               }
+            }
+         } else if (round == 3) {
+            /* A new destination, maybe where a freed one was */
+            SDL_FreeSurface(targets[4]);
+            targets[4] = _createCacheTarget(5);
+            SDL_FreeSurface(twinTargets[4]);
+            twinTargets[4] = _createCacheTarget(5);
+         }
+
+         for (j = 0; j < SDL_arraysize(targets); j++) {
+            if (src == NULL || targets[j] == NULL || twins[j] == NULL || twinTargets[j] == NULL) {
+               SDLTest_AssertCheck(SDL_FALSE, "Verify surfaces were created");
+               continue;
+            }
+            _fillBytePattern(targets[j], 100);
+            _fillBytePattern(twinTargets[j], 100);
+            dstrect = place;
+            ret1 = SDL_BlitSurface(src, NULL, targets[j], &dstrect);
+            dstrect = place;
+            ret2 = SDL_BlitSurface(twins[j], NULL, twinTargets[j], &dstrect);
+
+            differ = 0;
+            for (y = 0; y < targets[j]->h; y++) {
+               differ += (SDL_memcmp((Uint8 *)targets[j]->pixels + y * targets[j]->pitch,
+                                     (Uint8 *)twinTargets[j]->pixels + y * twinTargets[j]->pitch,
+                                     targets[j]->w * targets[j]->format->BytesPerPixel) != 0);
+            }
+            SDLTest_AssertCheck(ret1 == 0 && ret2 == 0 && differ == 0, "Verify %i-bit source to %s in round %i matches a source only blitted there, expected: 0 differing rows, got: %i (results %i, %i)",
+                                depths[i], SDL_GetPixelFormatName(targets[j]->format->format), round, differ, ret1, ret2);
+         }
+      }
+
+      SDL_FreeSurface(src);
+      for (j = 0; j < SDL_arraysize(targets); j++) {
+         SDL_FreeSurface(targets[j]);
+         SDL_FreeSurface(twinTargets[j]);
+         SDL_FreeSurface(twins[j]);
+      }
+   }
+
+   return TEST_COMPLETED;
+}
+
+/* Sources of surface_testNearestToggle(), and the format they're blitted to */
+static SDL_Surface *
+_createNearestSource(int kind, Uint32 *dst_format)
+{
+   SDL_Surface *surface;
+
+   switch (kind) {
+   case 0:
+      /* Blended and modulated, scaled through the blit map */
+      surface = SDL_CreateRGBSurface(0, 20, 12, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+      SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_BLEND);
+      SDL_SetSurfaceColorMod(surface, 0xc0, 0xff, 0x80);
+      *dst_format = SDL_PIXELFORMAT_ARGB8888;
+      break;
+   case 1:
+      /* A plain copy, scaled by SDL_SoftStretch() */
+      surface = SDL_CreateRGBSurface(0, 20, 12, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+      SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);
+      *dst_format = SDL_PIXELFORMAT_ARGB8888;
+      break;
+   case 2:
+      /* 24-bit, scaled by the slow blitter */
+      surface = SDL_CreateRGBSurface(0, 20, 12, 24, 0x00ff0000, 0x0000ff00, 0x000000ff, 0);
+      *dst_format = SDL_PIXELFORMAT_ARGB8888;
+      break;
+   case 3:
+      /* RLE encoded, which the scaled blits can't use */
+      surface = SDL_CreateRGBSurface(0, 20, 12, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0);
+      *dst_format = SDL_PIXELFORMAT_RGB888;
+      break;
+   default:
+      /* A format conversion */
+      surface = SDL_CreateRGBSurface(0, 20, 12, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+      SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);
+      *dst_format = SDL_PIXELFORMAT_RGB565;
+      break;
+   }
+   if (surface == NULL) {
+      return NULL;
+   }
+   _fillBytePattern(surface, 0);
+   if (kind == 3) {
+      SDL_SetColorKey(surface, SDL_TRUE, _getSurfacePixel(surface, 3, 2));
+      SDL_SetSurfaceRLE(surface, 1);
+   }
+   return surface;
+}
+
+/**
+ * @brief Tests that a source switching between unscaled and scaled blits
+ * gives the same results as fresh sources doing each blit once.
+ */
+int
+surface_testNearestToggle(void *arg)
+{
+   /* A zero size is an unscaled blit */
+   static const struct {
+      int w, h;
+   } steps[] = {
+      { 0, 0 }, { 31, 19 }, { 0, 0 }, { 9, 5 }, { 0, 0 }, { 40, 24 }, { 31, 19 }, { 0, 0 }
+   };
+   SDL_Surface *src, *twin, *dst, *expected;
+   SDL_Rect dstrect;
+   Uint32 dst_format, Rmask, Gmask, Bmask, Amask;
+   int kind, i, y, bpp, ret1, ret2, differ;
+
+   for (kind = 0; kind < 5; kind++) {
+      src = _createNearestSource(kind, &dst_format);
+      SDL_PixelFormatEnumToMasks(dst_format, &bpp, &Rmask, &Gmask, &Bmask, &Amask);
+      dst = SDL_CreateRGBSurface(0, 48, 32, bpp, Rmask, Gmask, Bmask, Amask);
+      expected = SDL_CreateRGBSurface(0, 48, 32, bpp, Rmask, Gmask, Bmask, Amask);
+      SDLTest_AssertCheck(src != NULL && dst != NULL && expected != NULL, "Verify result from SDL_CreateRGBSurface is not NULL");
+      if (src == NULL || dst == NULL || expected == NULL) {
+         SDL_FreeSurface(src);
+         SDL_FreeSurface(dst);
+         SDL_FreeSurface(expected);
+         continue;
+      }
+
+      for (i = 0; i < SDL_arraysize(steps); i++) {
+         twin = _createNearestSource(kind, &dst_format);
+         if (twin == NULL) {
+            continue;
+         }
+         if (i >= 4) {
+            /* The surface changes half way through */
+            SDL_SetSurfaceAlphaMod(src, 0x80);
+            SDL_SetSurfaceAlphaMod(twin, 0x80);
+         }
+         _fillBytePattern(dst, 100);
+         _fillBytePattern(expected, 100);
+         dstrect.x = 3;
+         dstrect.y = 2;
+         dstrect.w = steps[i].w;
+         dstrect.h = steps[i].h;
+         if (steps[i].w) {
+            ret1 = SDL_BlitScaled(src, NULL, dst, &dstrect);
+            dstrect.x = 3;
+            dstrect.y = 2;
+            dstrect.w = steps[i].w;
+            dstrect.h = steps[i].h;
+            ret2 = SDL_BlitScaled(twin, NULL, expected, &dstrect);
+         } else {
+            ret1 = SDL_BlitSurface(src, NULL, dst, &dstrect);
+            dstrect.x = 3;
+            dstrect.y = 2;
+            ret2 = SDL_BlitSurface(twin, NULL, expected, &dstrect);
+         }
+         SDL_FreeSurface(twin);
+
+         differ = 0;
+         for (y = 0; y < dst->h; y++) {
+            differ += (SDL_memcmp((Uint8 *)dst->pixels + y * dst->pitch,
+                                  (Uint8 *)expected->pixels + y * expected->pitch,
+                                  dst->w * dst->format->BytesPerPixel) != 0);
+         }
+         SDLTest_AssertCheck(ret1 == 0 && ret2 == 0 && differ == 0, "Verify source %i step %i (%s) matches a fresh source, expected: 0 differing rows, got: %i (results %i, %i)",
+                             kind, i, steps[i].w ? "scaled" : "unscaled", differ, ret1, ret2);
+      }
+
+      SDL_FreeSurface(src);
+      SDL_FreeSurface(dst);
+      SDL_FreeSurface(expected);
+   }
+
+   return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Surface test cases */
@@ -630,11 +1831,39 @@ static const SDLTest_TestCaseReference surfaceTest11 =
 static const SDLTest_TestCaseReference surfaceTest12 =
         { (SDLTest_TestCaseFp)surface_testBlitBlendMod, "surface_testBlitBlendMod", "Tests blitting routines with mod blending mode.", TEST_ENABLED};
 
+static const SDLTest_TestCaseReference surfaceTest13 =
+        { (SDLTest_TestCaseFp)surface_testFillRectFeatures, "surface_testFillRectFeatures", "Tests large and small fills under each CPU feature mask.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest14 =
+        { (SDLTest_TestCaseFp)surface_testScaleMode, "surface_testScaleMode", "Tests surface scale modes and filtered scaled blits.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest15 =
+        { (SDLTest_TestCaseFp)surface_testRLE, "surface_testRLE", "Tests RLE blits against plain blits, also after changing the surface.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest16 =
+        { (SDLTest_TestCaseFp)surface_testConvertFormats, "surface_testConvertFormats", "Tests straight conversions between 8888, 24-bit and 565 formats.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest17 =
+        { (SDLTest_TestCaseFp)surface_testBlitThreads, "surface_testBlitThreads", "Tests large blits give the same result with one and several blit threads.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest18 =
+        { (SDLTest_TestCaseFp)surface_testSIMDBlits, "surface_testSIMDBlits", "Tests the vectorized 8888 blitters against the scalar ones.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest19 =
+        { (SDLTest_TestCaseFp)surface_testGeneratedBlits, "surface_testGeneratedBlits", "Tests the generated blitters against the generic one.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest20 =
+        { (SDLTest_TestCaseFp)surface_testBlitMapCache, "surface_testBlitMapCache", "Tests blits switching between more destinations than the blit map caches.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest21 =
+        { (SDLTest_TestCaseFp)surface_testNearestToggle, "surface_testNearestToggle", "Tests a source switching between unscaled and scaled blits.", TEST_ENABLED};
+
 /* Sequence of Surface test cases */
 static const SDLTest_TestCaseReference *surfaceTests[] =  {
     &surfaceTest1, &surfaceTest2, &surfaceTest3, &surfaceTest4, &surfaceTest5,
     &surfaceTest6, &surfaceTest7, &surfaceTest8, &surfaceTest9, &surfaceTest10,
-    &surfaceTest11, &surfaceTest12, NULL
+    &surfaceTest11, &surfaceTest12, &surfaceTest13, &surfaceTest14,
+    &surfaceTest15, &surfaceTest16, &surfaceTest17, &surfaceTest18, &surfaceTest19, &surfaceTest20, &surfaceTest21, NULL
 };
 
 /* Surface test suite (global) */
@@ -0,0 +1,641 @@
+/**
+ * Thread and lock test suite
+ */
+
+#include <stdio.h>
+
+#include "SDL.h"
+#include "SDL_test.h"
+
+/* Threads started by each test */
+#define THREAD_TEST_THREADS     4
+
+/* Times each thread goes around its loop */
+#define THREAD_TEST_ITERATIONS  10000
+
+/* State shared between a test and the threads it starts */
+typedef struct
+{
+    SDL_mutex *mutex;
+    SDL_cond *cond;
+    SDL_RWLock *rwlock;
+    SDL_SeqLock seqlock;
+    SDL_SpinLock spinlock;
+    int counter;
+    int result;
+    int first;                  /* Written together with second */
+    int second;
+    SDL_atomic_t done;          /* Set when the writers have finished */
+    SDL_atomic_t errors;        /* Torn reads seen by the readers */
+    SDL_TLSID tls[2];
+    SDL_atomic_t destroyed;     /* Thread-local values destroyed */
+} _ThreadTestData;
+
+/* Test case functions */
+
+/* Adds to the counter under the mutex */
+static int SDLCALL
+_mutexIncrementThread(void *arg)
+{
+    _ThreadTestData *data = (_ThreadTestData *) arg;
+    int i;
+
+    for (i = 0; i < THREAD_TEST_ITERATIONS; i++) {
+        SDL_LockMutex(data->mutex);
+        data->counter++;
+        SDL_UnlockMutex(data->mutex);
+    }
+    return 0;
+}
+
+/* Tries to take the mutex, which the test thread is holding */
+static int SDLCALL
+_mutexTryLockThread(void *arg)
+{
+    _ThreadTestData *data = (_ThreadTestData *) arg;
+
+    data->result = SDL_TryLockMutex(data->mutex);
+    return 0;
+}
+
+/* Sets the counter and wakes the test thread */
+static int SDLCALL
+_mutexSignalThread(void *arg)
+{
+    _ThreadTestData *data = (_ThreadTestData *) arg;
+
+    SDL_LockMutex(data->mutex);
+    data->counter = 1;
+    SDL_CondSignal(data->cond);
+    SDL_UnlockMutex(data->mutex);
+    return 0;
+}
+
+/**
+ * @brief Tests locking a non-recursive mutex from several threads, and
+ * waiting on a condition variable with it.
+ */
+int
+thread_testNonRecursiveMutex(void *arg)
+{
+    _ThreadTestData data;
+    SDL_Thread *threads[THREAD_TEST_THREADS];
+    int i, ret;
+
+    SDL_zero(data);
+    data.mutex = SDL_CreateNonRecursiveMutex();
+    SDLTest_AssertPass("Call to SDL_CreateNonRecursiveMutex()");
+    SDLTest_AssertCheck(data.mutex != NULL, "Verify mutex is not NULL");
+    if (data.mutex == NULL) {
+        return TEST_ABORTED;
+    }
+
+    /* Only one thread can hold it */
+    ret = SDL_TryLockMutex(data.mutex);
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_TryLockMutex(), expected: 0, got: %i", ret);
+    threads[0] = SDL_CreateThread(_mutexTryLockThread, "TryLock", &data);
+    SDLTest_AssertCheck(threads[0] != NULL, "Verify thread is not NULL");
+    SDL_WaitThread(threads[0], NULL);
+    SDLTest_AssertCheck(data.result == SDL_MUTEX_TIMEDOUT, "Verify SDL_TryLockMutex() from another thread, expected: %i, got: %i", SDL_MUTEX_TIMEDOUT, data.result);
+    ret = SDL_UnlockMutex(data.mutex);
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_UnlockMutex(), expected: 0, got: %i", ret);
+
+    /* No increments are lost */
+    for (i = 0; i < THREAD_TEST_THREADS; i++) {
+        threads[i] = SDL_CreateThread(_mutexIncrementThread, "Increment", &data);
+        SDLTest_AssertCheck(threads[i] != NULL, "Verify thread %i is not NULL", i);
+    }
+    for (i = 0; i < THREAD_TEST_THREADS; i++) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+    SDLTest_AssertCheck(data.counter == THREAD_TEST_THREADS * THREAD_TEST_ITERATIONS, "Verify counter, expected: %i, got: %i", THREAD_TEST_THREADS * THREAD_TEST_ITERATIONS, data.counter);
+
+    /* Condition variables work with it */
+    data.cond = SDL_CreateCond();
+    SDLTest_AssertCheck(data.cond != NULL, "Verify condition variable is not NULL");
+    if (data.cond != NULL) {
+        SDL_LockMutex(data.mutex);
+        ret = SDL_CondWaitTimeout(data.cond, data.mutex, 10);
+        SDLTest_AssertCheck(ret == SDL_MUTEX_TIMEDOUT, "Verify result from SDL_CondWaitTimeout(), expected: %i, got: %i", SDL_MUTEX_TIMEDOUT, ret);
+
+        data.counter = 0;
+        threads[0] = SDL_CreateThread(_mutexSignalThread, "Signal", &data);
+        SDLTest_AssertCheck(threads[0] != NULL, "Verify thread is not NULL");
+        while (data.counter == 0) {
+            SDL_CondWait(data.cond, data.mutex);
+        }
+        SDL_UnlockMutex(data.mutex);
+        SDL_WaitThread(threads[0], NULL);
+        SDLTest_AssertPass("Woken by SDL_CondSignal()");
+        SDL_DestroyCond(data.cond);
+    }
+
+    SDL_DestroyMutex(data.mutex);
+    SDLTest_AssertPass("Call to SDL_DestroyMutex()");
+
+    return TEST_COMPLETED;
+}
+
+/* Tries to take the reader-writer lock for reading and for writing */
+static int SDLCALL
+_rwlockTryLockThread(void *arg)
+{
+    _ThreadTestData *data = (_ThreadTestData *) arg;
+
+    data->result = SDL_TryLockRWLockForReading(data->rwlock);
+    if (data->result == 0) {
+        SDL_UnlockRWLock(data->rwlock);
+    }
+    data->counter = SDL_TryLockRWLockForWriting(data->rwlock);
+    if (data->counter == 0) {
+        SDL_UnlockRWLock(data->rwlock);
+    }
+    return 0;
+}
+
+/* Changes both values under the write lock */
+static int SDLCALL
+_rwlockWriterThread(void *arg)
+{
+    _ThreadTestData *data = (_ThreadTestData *) arg;
+    int i;
+
+    for (i = 0; i < THREAD_TEST_ITERATIONS; i++) {
+        SDL_LockRWLockForWriting(data->rwlock);
+        data->first++;
+        data->second++;
+        SDL_UnlockRWLock(data->rwlock);
+    }
+    return 0;
+}
+
+/* Checks under the read lock that both values are the same */
+static int SDLCALL
+_rwlockReaderThread(void *arg)
+{
+    _ThreadTestData *data = (_ThreadTestData *) arg;
+
+    while (!SDL_AtomicGet(&data->done)) {
+        SDL_LockRWLockForReading(data->rwlock);
+        if (data->first != data->second) {
+            SDL_AtomicIncRef(&data->errors);
+        }
+        SDL_UnlockRWLock(data->rwlock);
+    }
+    return 0;
+}
+
+/**
+ * @brief Tests that readers share a reader-writer lock and writers don't,
+ * and that readers never see a write half done.
+ */
+int
+thread_testRWLock(void *arg)
+{
+    _ThreadTestData data;
+    SDL_Thread *threads[THREAD_TEST_THREADS];
+    int i, ret;
+
+    SDL_zero(data);
+    data.rwlock = SDL_CreateRWLock();
+    SDLTest_AssertPass("Call to SDL_CreateRWLock()");
+    SDLTest_AssertCheck(data.rwlock != NULL, "Verify rwlock is not NULL");
+    if (data.rwlock == NULL) {
+        return TEST_ABORTED;
+    }
+
+    /* Held for reading, another reader gets in but a writer doesn't */
+    ret = SDL_LockRWLockForReading(data.rwlock);
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_LockRWLockForReading(), expected: 0, got: %i", ret);
+    threads[0] = SDL_CreateThread(_rwlockTryLockThread, "TryLock", &data);
+    SDLTest_AssertCheck(threads[0] != NULL, "Verify thread is not NULL");
+    SDL_WaitThread(threads[0], NULL);
+    SDLTest_AssertCheck(data.result == 0, "Verify SDL_TryLockRWLockForReading() while read locked, expected: 0, got: %i", data.result);
+    SDLTest_AssertCheck(data.counter == SDL_MUTEX_TIMEDOUT, "Verify SDL_TryLockRWLockForWriting() while read locked, expected: %i, got: %i", SDL_MUTEX_TIMEDOUT, data.counter);
+    ret = SDL_UnlockRWLock(data.rwlock);
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_UnlockRWLock(), expected: 0, got: %i", ret);
+
+    /* Held for writing, nobody else gets in */
+    ret = SDL_LockRWLockForWriting(data.rwlock);
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_LockRWLockForWriting(), expected: 0, got: %i", ret);
+    threads[0] = SDL_CreateThread(_rwlockTryLockThread, "TryLock", &data);
+    SDLTest_AssertCheck(threads[0] != NULL, "Verify thread is not NULL");
+    SDL_WaitThread(threads[0], NULL);
+    SDLTest_AssertCheck(data.result == SDL_MUTEX_TIMEDOUT, "Verify SDL_TryLockRWLockForReading() while write locked, expected: %i, got: %i", SDL_MUTEX_TIMEDOUT, data.result);
+    SDLTest_AssertCheck(data.counter == SDL_MUTEX_TIMEDOUT, "Verify SDL_TryLockRWLockForWriting() while write locked, expected: %i, got: %i", SDL_MUTEX_TIMEDOUT, data.counter);
+    ret = SDL_UnlockRWLock(data.rwlock);
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_UnlockRWLock(), expected: 0, got: %i", ret);
+
+    /* Half the threads write, half read */
+    for (i = 0; i < THREAD_TEST_THREADS; i++) {
+        threads[i] = SDL_CreateThread((i & 1) ? _rwlockReaderThread : _rwlockWriterThread, "RWLock", &data);
+        SDLTest_AssertCheck(threads[i] != NULL, "Verify thread %i is not NULL", i);
+    }
+    for (i = 0; i < THREAD_TEST_THREADS; i += 2) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+    SDL_AtomicSet(&data.done, 1);
+    for (i = 1; i < THREAD_TEST_THREADS; i += 2) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+    SDLTest_AssertCheck(data.first == (THREAD_TEST_THREADS / 2) * THREAD_TEST_ITERATIONS, "Verify writes, expected: %i, got: %i", (THREAD_TEST_THREADS / 2) * THREAD_TEST_ITERATIONS, data.first);
+    ret = SDL_AtomicGet(&data.errors);
+    SDLTest_AssertCheck(ret == 0, "Verify readers saw no partial writes, expected: 0, got: %i", ret);
+
+    SDL_DestroyRWLock(data.rwlock);
+    SDLTest_AssertPass("Call to SDL_DestroyRWLock()");
+
+    return TEST_COMPLETED;
+}
+
+/* Changes both values inside a write section */
+static int SDLCALL
+_seqlockWriterThread(void *arg)
+{
+    _ThreadTestData *data = (_ThreadTestData *) arg;
+    int i;
+
+    for (i = 0; i < THREAD_TEST_ITERATIONS; i++) {
+        SDL_SeqLockWriteBegin(&data->seqlock);
+        data->first++;
+        data->second++;
+        SDL_SeqLockWriteEnd(&data->seqlock);
+    }
+    return 0;
+}
+
+/* Checks that every copy that isn't retried has both values the same */
+static int SDLCALL
+_seqlockReaderThread(void *arg)
+{
+    _ThreadTestData *data = (_ThreadTestData *) arg;
+    volatile int *first = &data->first;
+    volatile int *second = &data->second;
+    int a, b;
+    Uint32 seq;
+
+    while (!SDL_AtomicGet(&data->done)) {
+        do {
+            seq = SDL_SeqLockReadBegin(&data->seqlock);
+            a = *first;
+            b = *second;
+        } while (SDL_SeqLockReadRetry(&data->seqlock, seq));
+        if (a != b) {
+            SDL_AtomicIncRef(&data->errors);
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Tests that sequence lock readers retry across writes, and never
+ * keep a copy made while a write was going on.
+ */
+int
+thread_testSeqLock(void *arg)
+{
+    _ThreadTestData data;
+    SDL_Thread *threads[THREAD_TEST_THREADS];
+    SDL_bool retry;
+    Uint32 seq;
+    int i, ret;
+
+    SDL_zero(data);
+
+    /* A read with no write in between doesn't retry */
+    seq = SDL_SeqLockReadBegin(&data.seqlock);
+    retry = SDL_SeqLockReadRetry(&data.seqlock, seq);
+    SDLTest_AssertCheck(retry == SDL_FALSE, "Verify SDL_SeqLockReadRetry() without a write, expected: %i, got: %i", SDL_FALSE, retry);
+
+    /* A read across a write does */
+    seq = SDL_SeqLockReadBegin(&data.seqlock);
+    SDL_SeqLockWriteBegin(&data.seqlock);
+    SDL_SeqLockWriteEnd(&data.seqlock);
+    retry = SDL_SeqLockReadRetry(&data.seqlock, seq);
+    SDLTest_AssertCheck(retry == SDL_TRUE, "Verify SDL_SeqLockReadRetry() across a write, expected: %i, got: %i", SDL_TRUE, retry);
+
+    /* Half the threads write, half read */
+    for (i = 0; i < THREAD_TEST_THREADS; i++) {
+        threads[i] = SDL_CreateThread((i & 1) ? _seqlockReaderThread : _seqlockWriterThread, "SeqLock", &data);
+        SDLTest_AssertCheck(threads[i] != NULL, "Verify thread %i is not NULL", i);
+    }
+    for (i = 0; i < THREAD_TEST_THREADS; i += 2) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+    SDL_AtomicSet(&data.done, 1);
+    for (i = 1; i < THREAD_TEST_THREADS; i += 2) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+    SDLTest_AssertCheck(data.first == (THREAD_TEST_THREADS / 2) * THREAD_TEST_ITERATIONS, "Verify writes, expected: %i, got: %i", (THREAD_TEST_THREADS / 2) * THREAD_TEST_ITERATIONS, data.first);
+    ret = SDL_AtomicGet(&data.errors);
+    SDLTest_AssertCheck(ret == 0, "Verify readers kept no partial writes, expected: 0, got: %i", ret);
+
+    return TEST_COMPLETED;
+}
+
+/* Uses a good part of the stack it was given and reports how it went */
+static int SDLCALL
+_attributesThread(void *arg)
+{
+    _ThreadTestData *data = (_ThreadTestData *) arg;
+    volatile Uint8 buffer[64 * 1024];
+    int i, sum = 0;
+
+    for (i = 0; i < (int) sizeof(buffer); i++) {
+        buffer[i] = (Uint8) i;
+    }
+    for (i = 0; i < (int) sizeof(buffer); i++) {
+        sum += buffer[i];
+    }
+    data->counter++;
+    return sum;
+}
+
+/* Restricts itself to the first CPU, and then to no CPU at all */
+static int SDLCALL
+_affinityThread(void *arg)
+{
+    _ThreadTestData *data = (_ThreadTestData *) arg;
+
+    data->result = SDL_SetThreadAffinity(1);
+    SDL_ClearError();
+    data->counter = SDL_SetThreadAffinity(0);
+    data->first = (int) SDL_strlen(SDL_GetError());
+    return 0;
+}
+
+/**
+ * @brief Tests that threads start and finish with each kind of attribute.
+ */
+int
+thread_testCreateWithAttributes(void *arg)
+{
+    _ThreadTestData data;
+    SDL_ThreadAttributes attributes;
+    SDL_Thread *thread;
+    int i, status, expected = 0;
+
+    for (i = 0; i < 64 * 1024; i++) {
+        expected += (Uint8) i;
+    }
+
+    SDL_zero(data);
+    for (i = 0; i < 5; i++) {
+        const char *description = "";
+
+        SDL_zero(attributes);
+        switch (i) {
+        case 0:
+            description = "NULL attributes";
+            break;
+        case 1:
+            description = "zeroed attributes";
+            break;
+        case 2:
+            description = "a 1 MB stack";
+            attributes.stacksize = 1024 * 1024;
+            break;
+        case 3:
+            description = "affinity to the first CPU";
+            attributes.affinity = 1;
+            break;
+        case 4:
+            description = "low priority";
+            attributes.setpriority = SDL_TRUE;
+            attributes.priority = SDL_THREAD_PRIORITY_LOW;
+            break;
+        }
+
+        thread = SDL_CreateThreadWithAttributes(_attributesThread, "Attributes", &data, (i == 0) ? NULL : &attributes);
+        SDLTest_AssertPass("Call to SDL_CreateThreadWithAttributes() with %s", description);
+        SDLTest_AssertCheck(thread != NULL, "Verify thread with %s is not NULL", description);
+        if (thread == NULL) {
+            continue;
+        }
+        status = 0;
+        SDL_WaitThread(thread, &status);
+        SDLTest_AssertCheck(status == expected, "Verify status of thread with %s, expected: %i, got: %i", description, expected, status);
+    }
+    SDLTest_AssertCheck(data.counter == 5, "Verify all threads ran, expected: 5, got: %i", data.counter);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests SDL_SetThreadAffinity with a valid and an empty mask.
+ */
+int
+thread_testSetThreadAffinity(void *arg)
+{
+    _ThreadTestData data;
+    SDL_Thread *thread;
+
+    SDL_zero(data);
+    thread = SDL_CreateThread(_affinityThread, "Affinity", &data);
+    SDLTest_AssertCheck(thread != NULL, "Verify thread is not NULL");
+    if (thread == NULL) {
+        return TEST_ABORTED;
+    }
+    SDL_WaitThread(thread, NULL);
+
+    /* Platforms without thread affinity refuse every mask */
+    SDLTest_AssertCheck(data.result == 0 || data.result == -1, "Verify SDL_SetThreadAffinity(1), expected: 0 or -1, got: %i", data.result);
+    SDLTest_AssertCheck(data.counter == -1, "Verify SDL_SetThreadAffinity(0), expected: -1, got: %i", data.counter);
+    SDLTest_AssertCheck(data.first > 0, "Verify SDL_SetThreadAffinity(0) set an error message");
+
+    return TEST_COMPLETED;
+}
+
+/* Counts the thread-local values destroyed when their thread exits */
+static void SDLCALL
+_tlsDestructor(void *value)
+{
+    _ThreadTestData *data = (_ThreadTestData *) value;
+
+    SDL_AtomicIncRef(&data->destroyed);
+}
+
+/* Checks its own thread-local values and error message while the other
+   threads set theirs */
+static int SDLCALL
+_tlsThread(void *arg)
+{
+    _ThreadTestData *data = (_ThreadTestData *) arg;
+    int values[2];
+    char message[64];
+    int i;
+
+    if (SDL_TLSGet(data->tls[0]) != NULL || SDL_TLSGet(data->tls[1]) != NULL) {
+        SDL_AtomicIncRef(&data->errors);
+    }
+    SDL_snprintf(message, sizeof(message), "TLS thread %lu", SDL_ThreadID());
+    SDL_TLSSet(data->tls[0], &values[0], NULL);
+    SDL_TLSSet(data->tls[1], &values[1], NULL);
+    for (i = 0; i < THREAD_TEST_ITERATIONS; i++) {
+        SDL_TLSSet(data->tls[i & 1], &values[i & 1], NULL);
+        SDL_SetError("%s", message);
+        if (SDL_TLSGet(data->tls[0]) != &values[0] ||
+            SDL_TLSGet(data->tls[1]) != &values[1] ||
+            SDL_strcmp(SDL_GetError(), message) != 0) {
+            SDL_AtomicIncRef(&data->errors);
+        }
+    }
+    SDL_TLSSet(data->tls[0], data, _tlsDestructor);
+    SDL_TLSSet(data->tls[1], data, _tlsDestructor);
+    return 0;
+}
+
+/**
+ * @brief Tests that each thread sees only its own thread-local values and
+ * error message, and that the values are destroyed when the thread exits.
+ */
+int
+thread_testTLS(void *arg)
+{
+    _ThreadTestData data;
+    SDL_Thread *threads[THREAD_TEST_THREADS];
+    int mainValue = 0;
+    int wave, i, started = 0;
+
+    SDL_zero(data);
+    data.tls[0] = SDL_TLSCreate();
+    data.tls[1] = SDL_TLSCreate();
+    SDLTest_AssertCheck(data.tls[0] != 0 && data.tls[1] != 0 && data.tls[0] != data.tls[1],
+                        "Verify SDL_TLSCreate() returned two different IDs, got: %u and %u", data.tls[0], data.tls[1]);
+    SDLTest_AssertCheck(SDL_TLSSet(data.tls[0], &mainValue, NULL) == 0, "Verify SDL_TLSSet() on the main thread succeeded");
+
+    /* The second wave reuses whatever the first one released */
+    for (wave = 0; wave < 2; wave++) {
+        for (i = 0; i < THREAD_TEST_THREADS; i++) {
+            threads[i] = SDL_CreateThread(_tlsThread, "TLS", &data);
+            SDLTest_AssertCheck(threads[i] != NULL, "Verify thread %i of wave %i is not NULL", i, wave);
+        }
+        for (i = 0; i < THREAD_TEST_THREADS; i++) {
+            if (threads[i]) {
+                SDL_WaitThread(threads[i], NULL);
+                started++;
+            }
+        }
+    }
+
+    SDLTest_AssertCheck(SDL_AtomicGet(&data.errors) == 0, "Verify threads only saw their own values, expected: 0 errors, got: %i", SDL_AtomicGet(&data.errors));
+    SDLTest_AssertCheck(SDL_AtomicGet(&data.destroyed) == 2 * started, "Verify values were destroyed on thread exit, expected: %i, got: %i", 2 * started, SDL_AtomicGet(&data.destroyed));
+    SDLTest_AssertCheck(SDL_TLSGet(data.tls[0]) == &mainValue, "Verify the main thread kept its value");
+    SDLTest_AssertCheck(SDL_TLSGet(data.tls[1]) == NULL, "Verify the main thread has no value for the second ID");
+    SDL_TLSSet(data.tls[0], NULL, NULL);
+
+    return TEST_COMPLETED;
+}
+
+/* Adds to the counter under the spinlock, now and then holding it long
+   enough for the other threads to stop spinning and sleep */
+static int SDLCALL
+_spinLockThread(void *arg)
+{
+    _ThreadTestData *data = (_ThreadTestData *) arg;
+    int i;
+
+    for (i = 0; i < THREAD_TEST_ITERATIONS; i++) {
+        if ((i & 1) == 0 || !SDL_AtomicTryLock(&data->spinlock)) {
+            SDL_AtomicLock(&data->spinlock);
+        }
+        data->counter++;
+        if ((i % 2500) == 0) {
+            SDL_Delay(1);
+        }
+        SDL_AtomicUnlock(&data->spinlock);
+    }
+    return 0;
+}
+
+/* Tries to take the spinlock, which the test thread is holding */
+static int SDLCALL
+_spinTryLockThread(void *arg)
+{
+    _ThreadTestData *data = (_ThreadTestData *) arg;
+
+    data->result = SDL_AtomicTryLock(&data->spinlock);
+    return 0;
+}
+
+/**
+ * @brief Tests SDL_AtomicLock and SDL_AtomicTryLock with several threads
+ * contending for the same spinlock.
+ */
+int
+thread_testSpinLock(void *arg)
+{
+    _ThreadTestData data;
+    SDL_Thread *threads[THREAD_TEST_THREADS];
+    int i, started = 0;
+
+    SDL_zero(data);
+
+    /* A held lock can't be taken by another thread */
+    SDL_AtomicLock(&data.spinlock);
+    data.result = -1;
+    threads[0] = SDL_CreateThread(_spinTryLockThread, "SpinTryLock", &data);
+    SDLTest_AssertCheck(threads[0] != NULL, "Verify thread is not NULL");
+    if (threads[0]) {
+        SDL_WaitThread(threads[0], NULL);
+        SDLTest_AssertCheck(data.result == SDL_FALSE, "Verify SDL_AtomicTryLock() on a held lock, expected: SDL_FALSE, got: %i", data.result);
+    }
+    SDL_AtomicUnlock(&data.spinlock);
+
+    for (i = 0; i < THREAD_TEST_THREADS; i++) {
+        threads[i] = SDL_CreateThread(_spinLockThread, "SpinLock", &data);
+        SDLTest_AssertCheck(threads[i] != NULL, "Verify thread %i is not NULL", i);
+    }
+    for (i = 0; i < THREAD_TEST_THREADS; i++) {
+        if (threads[i]) {
+            SDL_WaitThread(threads[i], NULL);
+            started++;
+        }
+    }
+    SDLTest_AssertCheck(data.counter == started * THREAD_TEST_ITERATIONS, "Verify no increment was lost, expected: %i, got: %i",
+                        started * THREAD_TEST_ITERATIONS, data.counter);
+
+    /* Nobody is left holding or waiting on it */
+    SDLTest_AssertCheck(SDL_AtomicTryLock(&data.spinlock) == SDL_TRUE, "Verify the spinlock is free afterwards");
+    SDL_AtomicUnlock(&data.spinlock);
+    SDLTest_AssertCheck(data.spinlock == 0, "Verify the unlocked spinlock is 0, got: %i", data.spinlock);
+
+    return TEST_COMPLETED;
+}
+
+/* ================= Test References ================== */
+
+/* Thread test cases */
+static const SDLTest_TestCaseReference threadTest1 =
+        { (SDLTest_TestCaseFp)thread_testNonRecursiveMutex, "thread_testNonRecursiveMutex", "Tests SDL_CreateNonRecursiveMutex with several threads and a condition variable", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference threadTest2 =
+        { (SDLTest_TestCaseFp)thread_testRWLock, "thread_testRWLock", "Tests SDL_RWLock with readers and writers", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference threadTest3 =
+        { (SDLTest_TestCaseFp)thread_testSeqLock, "thread_testSeqLock", "Tests SDL_SeqLock with readers and writers", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference threadTest4 =
+        { (SDLTest_TestCaseFp)thread_testCreateWithAttributes, "thread_testCreateWithAttributes", "Tests SDL_CreateThreadWithAttributes with each attribute", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference threadTest5 =
+        { (SDLTest_TestCaseFp)thread_testSetThreadAffinity, "thread_testSetThreadAffinity", "Tests SDL_SetThreadAffinity with a valid and an empty mask", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference threadTest6 =
+        { (SDLTest_TestCaseFp)thread_testTLS, "thread_testTLS", "Tests SDL_TLSGet and SDL_TLSSet from several threads", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference threadTest7 =
+        { (SDLTest_TestCaseFp)thread_testSpinLock, "thread_testSpinLock", "Tests SDL_AtomicLock and SDL_AtomicTryLock with contending threads", TEST_ENABLED };
+
+/* Sequence of Thread test cases */
+static const SDLTest_TestCaseReference *threadTests[] =  {
+    &threadTest1, &threadTest2, &threadTest3, &threadTest4, &threadTest5, &threadTest6, &threadTest7, NULL
+};
+
+/* Thread test suite (global) */
+SDLTest_TestSuiteReference threadTestSuite = {
+    "Thread",
+    NULL,
+    threadTests,
+    NULL
+};